@@ -0,0 +1,494 @@
+/**
+ * @file benchmark_algorithms.cpp
+ * @brief Google Benchmark suite covering every algorithm of <graph/algorithms.hpp>.
+ *
+ * Each algorithm runs on the CSR and vov containers of dijkstra_fixtures.hpp, over graphs from
+ * <graph/generators.hpp> at V ≈ 1K, 10K and 100K. Graph construction and output allocation are
+ * excluded from the timed region. Every benchmark reports:
+ *   - items_per_second : stored edges processed per second (SetItemsProcessed)
+ *   - peak_bytes       : peak heap memory allocated by one run of the algorithm, above what
+ *                        was live before it (graph and outputs excluded). Measured in one extra,
+ *                        untimed run with allocation tracking switched on.
+ *
+ * Benchmark naming convention:
+ *   BM_<Algorithm>_<Container>_<Input>/<V>
+ *   Container : CSR (compressed_graph), VoV (dynamic_graph, vector of vectors), EL (edge list)
+ *   Input     : BA    (Barabási–Albert, m = 4, undirected)
+ *               Grid  (2D grid, 4-connected, undirected)
+ *               RMAT  (Graph500 parameters, 8 edges per vertex, symmetrized)
+ *               ER    (Erdős–Rényi, average out-degree 8, directed)
+ *               DAG   (ER with every edge oriented from the lower to the higher id)
+ *
+ * Undirected algorithms get the undirected inputs; SCC, Bellman-Ford and topological sort get
+ * directed ones. Algorithms that do not compile for compressed_graph (see the comment at their
+ * registration) run on VoV only. Dijkstra, delta-stepping and parallel afforest have dedicated
+ * suites (benchmark_dijkstra, benchmark_delta_stepping, benchmark_connectivity).
+ *
+ * Quick run (as registered with CTest):  ./benchmark_algorithms --benchmark_min_time=0.1s
+ * One algorithm:                          ./benchmark_algorithms --benchmark_filter=BM_Prim_
+ * Baseline capture:                       ./benchmark_algorithms --benchmark_format=json
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithms.hpp>
+#include <graph/algorithm/tarjan_scc.hpp> // not part of algorithms.hpp
+#include <graph/graph.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// Peak heap tracking
+//
+// Every allocation through the global operator new carries a small header recording its size
+// and whether it was made while tracking was on; only those are counted, so blocks allocated
+// before a measurement and freed during it do not distort the result.
+//
+// The two helpers stay out of line: once inlined into operator delete, GCC sees the header read
+// in front of a block it knows operator new returned and miscompiles the surrounding algorithm.
+// ---------------------------------------------------------------------------
+
+namespace {
+
+constexpr std::size_t alloc_header = alignof(std::max_align_t); // keeps user blocks aligned
+
+std::atomic<bool>    tracking{false};
+std::atomic<int64_t> live_bytes{0};
+std::atomic<int64_t> peak_bytes{0};
+
+[[gnu::noinline]] void* tracked_alloc(std::size_t size) noexcept {
+  auto* base = static_cast<unsigned char*>(std::malloc(size + alloc_header));
+  if (base == nullptr)
+    return nullptr;
+  const bool counted = tracking.load(std::memory_order_relaxed);
+  // Size in the low bits, counted flag in the top bit
+  *reinterpret_cast<std::size_t*>(base) = size | (counted ? ~(~std::size_t{0} >> 1) : 0);
+  if (counted) {
+    const int64_t now  = live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+                         static_cast<int64_t>(size);
+    int64_t       peak = peak_bytes.load(std::memory_order_relaxed);
+    while (now > peak && !peak_bytes.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+    }
+  }
+  return base + alloc_header;
+}
+
+[[gnu::noinline]] void tracked_free(void* p) noexcept {
+  if (p == nullptr)
+    return;
+  auto*             base = static_cast<unsigned char*>(p) - alloc_header;
+  const std::size_t word = *reinterpret_cast<std::size_t*>(base);
+  constexpr auto    flag = ~(~std::size_t{0} >> 1);
+  if (word & flag)
+    live_bytes.fetch_sub(static_cast<int64_t>(word & ~flag), std::memory_order_relaxed);
+  std::free(base);
+}
+
+/// Peak heap bytes allocated while running fn once.
+template <class F>
+int64_t measure_peak_bytes(F& fn) {
+  live_bytes.store(0, std::memory_order_relaxed);
+  peak_bytes.store(0, std::memory_order_relaxed);
+  tracking.store(true, std::memory_order_relaxed);
+  fn();
+  tracking.store(false, std::memory_order_relaxed);
+  return peak_bytes.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  if (void* p = tracked_alloc(size))
+    return p;
+  throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return tracked_alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return tracked_alloc(size); }
+void  operator delete(void* p) noexcept { tracked_free(p); }
+void  operator delete[](void* p) noexcept { tracked_free(p); }
+void  operator delete(void* p, std::size_t) noexcept { tracked_free(p); }
+void  operator delete[](void* p, std::size_t) noexcept { tracked_free(p); }
+void  operator delete(void* p, const std::nothrow_t&) noexcept { tracked_free(p); }
+void  operator delete[](void* p, const std::nothrow_t&) noexcept { tracked_free(p); }
+
+// ---------------------------------------------------------------------------
+// Inputs
+// ---------------------------------------------------------------------------
+
+namespace {
+
+namespace gb = graph::benchmark;
+
+using csr_t   = gb::csr_graph_t;
+using vov_t   = gb::vov_graph_t;
+using vid_t   = gb::vertex_id_t;
+using edges_t = gb::edge_list;
+
+enum class input { ba, grid, rmat, er, dag };
+
+const char* input_name(input in) {
+  switch (in) {
+    case input::ba: return "BA";
+    case input::grid: return "Grid";
+    case input::rmat: return "RMAT";
+    case input::er: return "ER";
+    case input::dag: return "DAG";
+  }
+  return "?";
+}
+
+struct input_graph {
+  edges_t edges; // sorted by source_id
+  vid_t   n = 0;
+};
+
+void sort_by_source(edges_t& el) {
+  std::ranges::stable_sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+}
+
+input_graph make_input(input in, vid_t n) {
+  input_graph out;
+  switch (in) {
+    case input::ba:
+      out.edges = gb::barabasi_albert(n, 4);
+      out.n     = n;
+      break;
+    case input::grid: {
+      const auto side = static_cast<vid_t>(std::sqrt(static_cast<double>(n)));
+      out.edges       = gb::grid_2d(side, side);
+      out.n           = side * side;
+      break;
+    }
+    case input::rmat: {
+      const auto scale = static_cast<uint32_t>(std::bit_width(std::bit_ceil(n)) - 1);
+      out.edges        = graph::generators::rmat<vid_t>(scale, size_t{4} << scale);
+      const size_t m   = out.edges.size();
+      for (size_t i = 0; i < m; ++i)
+        out.edges.push_back({out.edges[i].target_id, out.edges[i].source_id, out.edges[i].value});
+      out.n = vid_t{1} << scale;
+      break;
+    }
+    case input::er:
+    case input::dag:
+      out.edges = gb::erdos_renyi(n, 8.0 / static_cast<double>(n));
+      out.n     = n;
+      if (in == input::dag)
+        for (auto& e : out.edges)
+          if (e.source_id > e.target_id)
+            std::swap(e.source_id, e.target_id);
+      break;
+  }
+  sort_by_source(out.edges);
+  return out;
+}
+
+// Undirected algorithms that sort neighbor lists (triangle count) need sorted rows
+void sort_rows(edges_t& el) {
+  std::ranges::sort(el, [](const auto& a, const auto& b) {
+    return a.source_id != b.source_id ? a.source_id < b.source_id : a.target_id < b.target_id;
+  });
+}
+
+template <class Graph>
+Graph build(const edges_t& el, vid_t n) {
+  Graph g;
+  g.load_edges(el, std::identity{}, n);
+  return g;
+}
+
+edges_t transpose(const edges_t& el) {
+  edges_t t;
+  t.reserve(el.size());
+  for (auto& e : el)
+    t.push_back({e.target_id, e.source_id, e.value});
+  sort_by_source(t);
+  return t;
+}
+
+// ---------------------------------------------------------------------------
+// Driver
+//
+// A kernel is a callable kernel(g, in) returning the benchmark body: a callable that runs the
+// algorithm once on outputs the kernel allocated up front.
+// ---------------------------------------------------------------------------
+
+template <class Graph, class Kernel>
+void BM_Algorithm(benchmark::State& state, input in, Kernel kernel) {
+  auto in_graph = make_input(in, static_cast<vid_t>(state.range(0)));
+  sort_rows(in_graph.edges);
+  const auto g    = build<Graph>(in_graph.edges, in_graph.n);
+  auto       body = kernel(g, in_graph);
+
+  for (auto _ : state) {
+    body();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(in_graph.edges.size()));
+  state.SetComplexityN(state.range(0));
+  state.counters["peak_bytes"] = static_cast<double>(measure_peak_bytes(body));
+}
+
+// Edge-list algorithms (Kruskal) take the input edges directly
+template <class Kernel>
+void BM_EdgeList(benchmark::State& state, input in, Kernel kernel) {
+  auto in_graph = make_input(in, static_cast<vid_t>(state.range(0)));
+  auto body     = kernel(in_graph);
+
+  for (auto _ : state) {
+    body();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(in_graph.edges.size()));
+  state.SetComplexityN(state.range(0));
+  state.counters["peak_bytes"] = static_cast<double>(measure_peak_bytes(body));
+}
+
+enum containers : unsigned { csr = 1, vov = 2, both = csr | vov };
+
+template <unsigned On = both, class Kernel>
+void add(const char* algorithm, std::initializer_list<input> inputs, Kernel kernel, int64_t max_n = 100'000) {
+  for (input in : inputs) {
+    auto reg = [&](const char* container, auto fn) {
+      const std::string name = std::string("BM_") + algorithm + "_" + container + "_" + input_name(in);
+      benchmark::RegisterBenchmark(name.c_str(), fn, in, kernel)
+            ->RangeMultiplier(10)
+            ->Range(1'000, max_n)
+            ->Unit(benchmark::kMicrosecond)
+            ->Complexity();
+    };
+    if constexpr ((On & csr) != 0)
+      reg("CSR", BM_Algorithm<csr_t, Kernel>);
+    if constexpr ((On & vov) != 0)
+      reg("VoV", BM_Algorithm<vov_t, Kernel>);
+  }
+}
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+template <class G>
+std::vector<vid_t> id_vector(const G& g) {
+  return std::vector<vid_t>(graph::num_vertices(g));
+}
+
+// ---------------------------------------------------------------------------
+// Registrations
+// ---------------------------------------------------------------------------
+
+const int registered = [] {
+  using graph::container_value_fn;
+  const auto undirected = {input::ba, input::grid, input::rmat};
+
+  // --- Traversal ---
+
+  add("BFS", {input::ba, input::er}, [](const auto& g, const input_graph&) {
+    return [&g] { graph::breadth_first_search(g, vid_t{0}); };
+  });
+
+  add("ParallelBFS", {input::ba, input::er}, [](const auto& g, const input_graph&) {
+    return [&g, level = std::vector<vid_t>(graph::num_vertices(g)),
+            parent = std::vector<vid_t>(graph::num_vertices(g))]() mutable {
+      graph::parallel_breadth_first_search(g, vid_t{0}, container_value_fn(level), container_value_fn(parent));
+      benchmark::DoNotOptimize(level.data());
+    };
+  });
+
+  add("DFS", {input::ba, input::er}, [](const auto& g, const input_graph&) {
+    return [&g] { graph::depth_first_search(g, vid_t{0}); };
+  });
+
+  add("TopologicalSort", {input::dag}, [](const auto& g, const input_graph&) {
+    return [&g, order = std::vector<vid_t>()]() mutable {
+      order.clear();
+      benchmark::DoNotOptimize(graph::topological_sort(g, std::back_inserter(order)));
+    };
+  });
+
+  // --- Shortest paths (Dijkstra and delta-stepping: see their own suites) ---
+
+  // O(V·E) worst case: limited to 10K vertices
+  add(
+        "BellmanFord", {input::er, input::grid},
+        [](const auto& g, const input_graph&) {
+          return [&g, dist = std::vector<double>(graph::num_vertices(g))]() mutable {
+            graph::init_shortest_paths(g, dist); // stale distances would end the run after one pass
+            benchmark::DoNotOptimize(
+                  graph::bellman_ford_shortest_distances(g, vid_t{0}, container_value_fn(dist), weight_fn));
+          };
+        },
+        10'000);
+
+  // --- Components ---
+
+  // connected_components, kosaraju, tarjan_scc, articulation_points and biconnected_components call
+  // edges(g, uid) with a vertex id, which compressed_graph does not provide: VoV only
+  add<vov>("ConnectedComponents", undirected, [](const auto& g, const input_graph&) {
+    return [&g, comp = id_vector(g)]() mutable {
+      benchmark::DoNotOptimize(graph::connected_components(g, container_value_fn(comp)));
+    };
+  });
+
+  add("Afforest", undirected, [](const auto& g, const input_graph&) {
+    return [&g, comp = id_vector(g)]() mutable {
+      graph::afforest(g, comp);
+      benchmark::DoNotOptimize(comp.data());
+    };
+  });
+
+  add<vov>("Kosaraju", {input::er, input::rmat}, [](const auto& g, const input_graph& in) {
+    using graph_type = std::remove_cvref_t<decltype(g)>;
+    return [&g, g_t = build<graph_type>(transpose(in.edges), in.n), comp = id_vector(g)]() mutable {
+      graph::kosaraju(g, g_t, container_value_fn(comp));
+      benchmark::DoNotOptimize(comp.data());
+    };
+  });
+
+  add<vov>("TarjanSCC", {input::er, input::rmat}, [](const auto& g, const input_graph&) {
+    return [&g, comp = id_vector(g)]() mutable {
+      benchmark::DoNotOptimize(graph::tarjan_scc(g, container_value_fn(comp)));
+    };
+  });
+
+  // Same transpose as Kosaraju, then without one: the in-edge index is built inside the timed run
+  add("ParallelSCC", {input::er, input::rmat}, [](const auto& g, const input_graph& in) {
+    using graph_type = std::remove_cvref_t<decltype(g)>;
+    return [&g, g_t = build<graph_type>(transpose(in.edges), in.n), comp = id_vector(g)]() mutable {
+      benchmark::DoNotOptimize(graph::parallel_scc(g, g_t, container_value_fn(comp)));
+    };
+  });
+
+  add("ParallelSCCInIndex", {input::er, input::rmat}, [](const auto& g, const input_graph&) {
+    return [&g, comp = id_vector(g)]() mutable {
+      benchmark::DoNotOptimize(graph::parallel_scc(g, container_value_fn(comp)));
+    };
+  });
+
+  add<vov>("ArticulationPoints", undirected, [](const auto& g, const input_graph&) {
+    return [&g, cut = std::vector<vid_t>()]() mutable {
+      cut.clear();
+      graph::articulation_points(g, std::back_inserter(cut));
+      benchmark::DoNotOptimize(cut.data());
+    };
+  });
+
+  add<vov>("BiconnectedComponents", undirected, [](const auto& g, const input_graph&) {
+    return [&g, comps = std::vector<std::vector<vid_t>>()]() mutable {
+      comps.clear();
+      graph::biconnected_components(g, comps);
+      benchmark::DoNotOptimize(comps.data());
+    };
+  });
+
+  // --- Minimum spanning tree ---
+
+  add("Prim", undirected, [](const auto& g, const input_graph&) {
+    return [&g, weight = std::vector<double>(graph::num_vertices(g)), pred = id_vector(g)]() mutable {
+      graph::init_shortest_paths(g, weight, pred);
+      benchmark::DoNotOptimize(graph::prim(g, vid_t{0}, container_value_fn(weight), container_value_fn(pred)));
+    };
+  });
+
+  for (input in : undirected) {
+    const std::string name = std::string("BM_Kruskal_EL_") + input_name(in);
+    auto              kernel = [](const input_graph& ig) {
+      return [&ig, tree = edges_t()]() mutable {
+        tree.clear();
+        benchmark::DoNotOptimize(graph::kruskal(ig.edges, tree));
+      };
+    };
+    benchmark::RegisterBenchmark(name.c_str(), BM_EdgeList<decltype(kernel)>, in, kernel)
+          ->RangeMultiplier(10)
+          ->Range(1'000, 100'000)
+          ->Unit(benchmark::kMicrosecond)
+          ->Complexity();
+  }
+
+  // --- Analytics ---
+
+  add("TriangleCount", undirected, [](const auto& g, const input_graph&) {
+    return [&g] { benchmark::DoNotOptimize(graph::triangle_count(g)); };
+  });
+
+  add("ParallelTriangleCount", undirected, [](const auto& g, const input_graph&) {
+    return [&g] { benchmark::DoNotOptimize(graph::parallel_triangle_count(g)); };
+  });
+
+  add("MIS", undirected, [](const auto& g, const input_graph&) {
+    return [&g, mis = std::vector<vid_t>()]() mutable {
+      mis.clear();
+      graph::maximal_independent_set(g, std::back_inserter(mis), vid_t{0});
+      benchmark::DoNotOptimize(mis.data());
+    };
+  });
+
+  // Ten sweeps from singleton labels; resetting the labels is part of the timed body
+  add("LabelPropagation", undirected, [](const auto& g, const input_graph&) {
+    return [&g, label = id_vector(g)]() mutable {
+      std::iota(label.begin(), label.end(), vid_t{0});
+      graph::label_propagation(g, container_value_fn(label), std::default_random_engine{42}, size_t{10});
+      benchmark::DoNotOptimize(label.data());
+    };
+  });
+
+  add("ParallelLabelPropagation", undirected, [](const auto& g, const input_graph&) {
+    return [&g, label = id_vector(g)]() mutable {
+      std::iota(label.begin(), label.end(), vid_t{0});
+      graph::parallel_label_propagation(g, container_value_fn(label),
+                                        graph::label_propagation_options{.symmetric = true, .max_iters = 10});
+      benchmark::DoNotOptimize(label.data());
+    };
+  });
+
+  add("Jaccard", undirected, [](const auto& g, const input_graph&) {
+    return [&g] {
+      double sum = 0;
+      graph::jaccard_coefficient(g, [&sum](auto, auto, auto&, double val) { sum += val; });
+      benchmark::DoNotOptimize(sum);
+    };
+  });
+
+  add("ParallelJaccard", undirected, [](const auto& g, const input_graph&) {
+    return [&g] {
+      std::atomic<size_t> similar{0};
+      graph::parallel_jaccard_coefficient(g, [&similar](auto, auto, auto&, double val) {
+        if (val > 0.1)
+          similar.fetch_add(1, std::memory_order_relaxed);
+      });
+      benchmark::DoNotOptimize(similar.load());
+    };
+  });
+
+  // Run to tolerance 1e-8, so the methods are compared on time to convergence; the transpose of
+  // the directed ER input is rebuilt in every run
+  for (auto [algorithm, method] : {std::pair{"PageRank", graph::pagerank_method::jacobi},
+                                   std::pair{"PageRankGaussSeidel", graph::pagerank_method::gauss_seidel},
+                                   std::pair{"PageRankDelta", graph::pagerank_method::delta}}) {
+    add(algorithm, {input::er, input::rmat}, [method](const auto& g, const input_graph&) {
+      return [&g, method, pr = std::vector<double>(graph::num_vertices(g))]() mutable {
+        benchmark::DoNotOptimize(graph::pagerank(
+              g, container_value_fn(pr), graph::pagerank_options{.tolerance = 1e-8, .max_iters = 1000, .method = method}));
+      };
+    });
+  }
+
+  return 0;
+}();
+
+} // namespace
+
+BENCHMARK_MAIN();
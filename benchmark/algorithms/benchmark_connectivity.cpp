@@ -0,0 +1,101 @@
+/**
+ * @file benchmark_connectivity.cpp
+ * @brief Google Benchmark suite for the connected components algorithms.
+ *
+ * Measures how the multi-threaded afforest scales against the serial afforest on the CSR
+ * container of dijkstra_fixtures.hpp. Graph construction is excluded from the timed region;
+ * afforest reinitializes the component array itself.
+ *
+ * Benchmark naming convention:
+ *   BM_CC_<Topology>_Afforest       — afforest, serial
+ *   BM_CC_<Topology>_Afforest_T<P>  — afforest on a thread_pool of P workers
+ *                                     (P = 0 → hardware concurrency)
+ *   Topology : RMAT (Graph500 parameters, 8 edges per vertex, symmetrized), Grid
+ *
+ * R-MAT graphs have one giant component plus many isolated vertices, the case afforest's
+ * component sampling is designed for; grids are a single large-diameter component.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/connected_components.hpp>
+#include <graph/graph.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+graph::thread_pool& bench_pool(std::size_t workers) {
+  // One pool per requested size, kept alive for the whole run so thread start-up is not timed
+  static graph::thread_pool single(1);
+  static graph::thread_pool two(2);
+  static graph::thread_pool four(4);
+  switch (workers) {
+    case 1: return single;
+    case 2: return two;
+    case 4: return four;
+    default: return graph::default_thread_pool();
+  }
+}
+
+// R-MAT on the next power of two >= n, with every edge stored in both directions
+graph::benchmark::edge_list rmat_symmetric(graph::benchmark::vertex_id_t n) {
+  const auto scale = static_cast<uint32_t>(std::bit_width(std::bit_ceil(n)) - 1);
+  auto       el    = graph::generators::rmat<graph::benchmark::vertex_id_t>(scale, size_t{4} << scale);
+  const auto m     = el.size();
+  for (size_t i = 0; i < m; ++i)
+    el.push_back({el[i].target_id, el[i].source_id, el[i].value});
+  std::ranges::stable_sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return el;
+}
+
+} // namespace
+
+#define RMAT_EDGES(n) rmat_symmetric(n)
+#define RMAT_N(n)     std::bit_ceil(n)
+#define GRID_SQRT(n)  static_cast<graph::benchmark::vertex_id_t>(std::sqrt(static_cast<double>(n)))
+#define GRID_EDGES(n) graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n))
+#define GRID_N(n)     GRID_SQRT(n) * GRID_SQRT(n)
+
+// ---------------------------------------------------------------------------
+// Macro: one connected components benchmark. CALL is an expression using g and comp.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_CC_BM(NAME, EDGE_EXPR, N_EXPR, CALL)                                                       \
+  static void NAME(benchmark::State& state) {                                                             \
+    const auto n     = static_cast<graph::benchmark::vertex_id_t>(state.range(0));                        \
+    const auto edges = (EDGE_EXPR);                                                                       \
+    auto       g     = graph::benchmark::make_csr(edges, (N_EXPR));                                       \
+    std::vector<graph::benchmark::vertex_id_t> comp(graph::num_vertices(g));                              \
+    for (auto _ : state) {                                                                                \
+      CALL;                                                                                               \
+      benchmark::DoNotOptimize(comp.data());                                                              \
+    }                                                                                                     \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *                                    \
+                            static_cast<int64_t>(graph::num_edges(g)));                                   \
+    state.SetComplexityN(state.range(0));                                                                 \
+  }
+
+#define AFFOREST_CALL         graph::afforest(g, comp)
+#define AFFOREST_PAR(WORKERS) graph::afforest(g, comp, bench_pool(WORKERS))
+
+#define DEFINE_CC_SET(TOPO, EDGE_EXPR, N_EXPR)                                                            \
+  DEFINE_CC_BM(BM_CC_##TOPO##_Afforest, EDGE_EXPR, N_EXPR, AFFOREST_CALL)                                 \
+  DEFINE_CC_BM(BM_CC_##TOPO##_Afforest_T1, EDGE_EXPR, N_EXPR, AFFOREST_PAR(1))                            \
+  DEFINE_CC_BM(BM_CC_##TOPO##_Afforest_T4, EDGE_EXPR, N_EXPR, AFFOREST_PAR(4))                            \
+  DEFINE_CC_BM(BM_CC_##TOPO##_Afforest_T0, EDGE_EXPR, N_EXPR, AFFOREST_PAR(0))                            \
+  BENCHMARK(BM_CC_##TOPO##_Afforest)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Complexity();        \
+  BENCHMARK(BM_CC_##TOPO##_Afforest_T1)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Complexity();     \
+  BENCHMARK(BM_CC_##TOPO##_Afforest_T4)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Complexity();     \
+  BENCHMARK(BM_CC_##TOPO##_Afforest_T0)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Complexity();
+
+DEFINE_CC_SET(RMAT, RMAT_EDGES(n), RMAT_N(n))
+DEFINE_CC_SET(Grid, GRID_EDGES(n), GRID_N(n))
+
+BENCHMARK_MAIN();
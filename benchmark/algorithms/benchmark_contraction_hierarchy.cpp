@@ -0,0 +1,154 @@
+/**
+ * @file benchmark_contraction_hierarchy.cpp
+ * @brief Google Benchmark suite comparing contraction hierarchy queries against Dijkstra.
+ *
+ * Each query picks a random source and target. The Dijkstra baseline is what a caller without
+ * preprocessing pays: init_shortest_paths plus a full dijkstra_shortest_distances run. The
+ * hierarchy of each graph is built once, outside the timed region, and timed separately.
+ *
+ * Benchmark naming convention:
+ *   BM_CH_<Topology>_Dijkstra   — init_shortest_paths + dijkstra_shortest_distances
+ *   BM_CH_<Topology>_Distance   — ch_query::distance
+ *   BM_CH_<Topology>_Path       — ch_query::shortest_path, including path unpacking
+ *   BM_CH_<Topology>_Build      — build_contraction_hierarchy
+ *   Topology : Grid (grid_2d, weights 1..100), Road (see road_like_edges below)
+ *   Arg      : side of the square grid
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/contraction_hierarchy.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/graph.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using graph::benchmark::csr_graph_t;
+using graph::benchmark::vertex_id_t;
+using hierarchy_t = graph::contraction_hierarchy<double>;
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+// A grid with road classes: every 32nd row and column is a highway (weights / 16), every 8th a
+// main road (weights / 4), and one in five of the remaining streets is missing. Like a road
+// network it is near-planar with a hierarchy of fast routes, which is what contraction exploits;
+// a uniform grid is the hard case.
+graph::benchmark::edge_list road_like_edges(vertex_id_t side) {
+  graph::benchmark::edge_list kept;
+  for (auto e : graph::benchmark::grid_2d(side, side)) {
+    const vertex_id_t lo    = std::min(e.source_id, e.target_id);
+    const vertex_id_t hi    = std::max(e.source_id, e.target_id);
+    const vertex_id_t line  = hi - lo == 1 ? lo / side : lo % side;
+    uint64_t          h     = (uint64_t{lo} * 0x9E3779B97F4A7C15ULL) ^ hi;
+    h                       = (h ^ (h >> 29)) * 0xBF58476D1CE4E5B9ULL;
+    const bool        minor = ((h ^ (h >> 32)) % 5) == 0;
+    if (line % 32 == 0)
+      e.value /= 16;
+    else if (line % 8 == 0)
+      e.value /= 4;
+    else if (minor)
+      continue;
+    kept.push_back(e);
+  }
+  return kept;
+}
+
+graph::benchmark::edge_list grid_edges(vertex_id_t side) { return graph::benchmark::grid_2d(side, side); }
+
+struct fixture {
+  csr_graph_t g;
+  hierarchy_t ch;
+};
+
+// Builds each (topology, side) graph and its hierarchy once per run
+template <auto MakeEdges>
+const fixture& get_fixture(vertex_id_t side) {
+  static std::map<vertex_id_t, std::unique_ptr<fixture>> cache;
+  auto&                                                  slot = cache[side];
+  if (!slot) {
+    csr_graph_t g;
+    g.load_edges(MakeEdges(side), std::identity{}, side * side);
+    auto ch = graph::build_contraction_hierarchy(g, weight_fn);
+    slot    = std::make_unique<fixture>(fixture{std::move(g), std::move(ch)});
+  }
+  return *slot;
+}
+
+template <auto MakeEdges>
+void bm_dijkstra(::benchmark::State& state) {
+  const auto&         f = get_fixture<MakeEdges>(static_cast<vertex_id_t>(state.range(0)));
+  const vertex_id_t   n = static_cast<vertex_id_t>(graph::num_vertices(f.g));
+  std::vector<double> dist(n);
+  std::mt19937        rng(1);
+  for (auto _ : state) {
+    const vertex_id_t s = rng() % n;
+    const vertex_id_t t = rng() % n;
+    graph::init_shortest_paths(f.g, dist);
+    graph::dijkstra_shortest_distances(f.g, s, graph::container_value_fn(dist), weight_fn);
+    ::benchmark::DoNotOptimize(dist[t]);
+  }
+}
+
+template <auto MakeEdges>
+void bm_distance(::benchmark::State& state) {
+  const auto&       f = get_fixture<MakeEdges>(static_cast<vertex_id_t>(state.range(0)));
+  const vertex_id_t n = f.ch.num_vertices();
+  graph::ch_query   q(f.ch);
+  std::mt19937      rng(1);
+  size_t            settled = 0;
+  for (auto _ : state) {
+    const vertex_id_t s = rng() % n;
+    const vertex_id_t t = rng() % n;
+    ::benchmark::DoNotOptimize(q.distance(s, t));
+    settled += q.settled();
+  }
+  state.counters["settled"] = ::benchmark::Counter(static_cast<double>(settled), ::benchmark::Counter::kAvgIterations);
+}
+
+template <auto MakeEdges>
+void bm_path(::benchmark::State& state) {
+  const auto&              f = get_fixture<MakeEdges>(static_cast<vertex_id_t>(state.range(0)));
+  const vertex_id_t        n = f.ch.num_vertices();
+  graph::ch_query          q(f.ch);
+  std::vector<vertex_id_t> path;
+  std::mt19937             rng(1);
+  for (auto _ : state) {
+    const vertex_id_t s = rng() % n;
+    const vertex_id_t t = rng() % n;
+    ::benchmark::DoNotOptimize(q.shortest_path(s, t, path));
+  }
+}
+
+template <auto MakeEdges>
+void bm_build(::benchmark::State& state) {
+  const auto& f = get_fixture<MakeEdges>(static_cast<vertex_id_t>(state.range(0)));
+  for (auto _ : state) {
+    auto ch = graph::build_contraction_hierarchy(f.g, weight_fn);
+    ::benchmark::DoNotOptimize(ch.num_shortcuts());
+  }
+  state.counters["shortcuts"] = static_cast<double>(f.ch.num_shortcuts());
+}
+
+} // namespace
+
+BENCHMARK(bm_dijkstra<grid_edges>)->Name("BM_CH_Grid_Dijkstra")->Arg(100)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_distance<grid_edges>)->Name("BM_CH_Grid_Distance")->Arg(100)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_path<grid_edges>)->Name("BM_CH_Grid_Path")->Arg(100)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_build<grid_edges>)->Name("BM_CH_Grid_Build")->Arg(100)->Unit(::benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(bm_dijkstra<road_like_edges>)->Name("BM_CH_Road_Dijkstra")->Arg(200)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_distance<road_like_edges>)->Name("BM_CH_Road_Distance")->Arg(200)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_path<road_like_edges>)->Name("BM_CH_Road_Path")->Arg(200)->Unit(::benchmark::kMicrosecond);
+BENCHMARK(bm_build<road_like_edges>)->Name("BM_CH_Road_Build")->Arg(200)->Unit(::benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+/**
+ * @file benchmark_delta_stepping.cpp
+ * @brief Google Benchmark suite comparing delta-stepping against the sequential Dijkstra heaps.
+ *
+ * Uses the same four topologies and CSR container as benchmark_dijkstra.cpp so the numbers
+ * line up with the heap baselines. Graph construction and distance reset are excluded from
+ * the timed region.
+ *
+ * Benchmark naming convention:
+ *   BM_SSSP_<Topology>_Dijkstra        — dijkstra_shortest_distances, use_default_heap
+ *   BM_SSSP_<Topology>_Dijkstra_Idx8   — dijkstra_shortest_distances, use_indexed_dary_heap<8>
+ *   BM_SSSP_<Topology>_Delta_T<P>      — delta_stepping_shortest_distances, automatic delta,
+ *                                        thread_pool of P workers (P = 0 → hardware concurrency)
+ *   Topology : ER_Sparse, Grid, BA, Path (see dijkstra_fixtures.hpp)
+ *
+ * Path graphs are the adversarial case for delta-stepping: every bucket holds a single
+ * vertex, so they measure the per-bucket synchronization overhead.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/delta_stepping_shortest_paths.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/graph.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+graph::thread_pool& bench_pool(std::size_t workers) {
+  // One pool per requested size, kept alive for the whole run so thread start-up is not timed
+  static graph::thread_pool single(1);
+  static graph::thread_pool two(2);
+  static graph::thread_pool four(4);
+  switch (workers) {
+    case 1: return single;
+    case 2: return two;
+    case 4: return four;
+    default: return graph::default_thread_pool();
+  }
+}
+
+} // namespace
+
+#define ER_EDGES(n)   graph::benchmark::erdos_renyi(n, 8.0 / n)
+#define GRID_SQRT(n)  static_cast<graph::benchmark::vertex_id_t>(std::sqrt(static_cast<double>(n)))
+#define GRID_EDGES(n) graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n))
+#define GRID_N(n)     GRID_SQRT(n) * GRID_SQRT(n)
+#define BA_EDGES(n)   graph::benchmark::barabasi_albert(n, 4)
+#define PATH_EDGES(n) graph::benchmark::path_graph(n)
+
+// ---------------------------------------------------------------------------
+// Macro: one SSSP benchmark. CALL is an expression using g and dist.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_SSSP_BM(NAME, EDGE_EXPR, N_EXPR, CALL)                                                     \
+  static void NAME(benchmark::State& state) {                                                             \
+    const auto n     = static_cast<graph::benchmark::vertex_id_t>(state.range(0));                        \
+    const auto edges = (EDGE_EXPR);                                                                       \
+    auto       g     = graph::benchmark::make_csr(edges, (N_EXPR));                                       \
+    std::vector<double> dist(graph::num_vertices(g), std::numeric_limits<double>::max());                 \
+    for (auto _ : state) {                                                                                \
+      state.PauseTiming();                                                                                \
+      std::fill(dist.begin(), dist.end(), std::numeric_limits<double>::max());                            \
+      state.ResumeTiming();                                                                               \
+      CALL;                                                                                               \
+      benchmark::DoNotOptimize(dist.data());                                                              \
+    }                                                                                                     \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *                                    \
+                            static_cast<int64_t>(graph::num_edges(g)));                                   \
+    state.SetComplexityN(state.range(0));                                                                 \
+  }
+
+#define DIJKSTRA_CALL(HEAP_TAG)                                                                           \
+  graph::dijkstra_shortest_distances(g, graph::benchmark::vertex_id_t{0}, graph::container_value_fn(dist), \
+                                     weight_fn, graph::empty_visitor{}, std::less<double>{},               \
+                                     std::plus<double>{}, HEAP_TAG, std::allocator<std::byte>{})
+
+#define DELTA_CALL(WORKERS)                                                                               \
+  graph::delta_stepping_shortest_distances(g, graph::benchmark::vertex_id_t{0},                           \
+                                           graph::container_value_fn(dist), weight_fn, 0.0,                \
+                                           bench_pool(WORKERS))
+
+#define DEFINE_SSSP_SET(TOPO, EDGE_EXPR, N_EXPR)                                                          \
+  DEFINE_SSSP_BM(BM_SSSP_##TOPO##_Dijkstra, EDGE_EXPR, N_EXPR, DIJKSTRA_CALL(graph::use_default_heap{}))  \
+  DEFINE_SSSP_BM(BM_SSSP_##TOPO##_Dijkstra_Idx8, EDGE_EXPR, N_EXPR,                                       \
+                 DIJKSTRA_CALL(graph::use_indexed_dary_heap<8>{}))                                        \
+  DEFINE_SSSP_BM(BM_SSSP_##TOPO##_Delta_T1, EDGE_EXPR, N_EXPR, DELTA_CALL(1))                             \
+  DEFINE_SSSP_BM(BM_SSSP_##TOPO##_Delta_T4, EDGE_EXPR, N_EXPR, DELTA_CALL(4))                             \
+  DEFINE_SSSP_BM(BM_SSSP_##TOPO##_Delta_T0, EDGE_EXPR, N_EXPR, DELTA_CALL(0))                             \
+  BENCHMARK(BM_SSSP_##TOPO##_Dijkstra)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();         \
+  BENCHMARK(BM_SSSP_##TOPO##_Dijkstra_Idx8)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();    \
+  BENCHMARK(BM_SSSP_##TOPO##_Delta_T1)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();         \
+  BENCHMARK(BM_SSSP_##TOPO##_Delta_T4)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();         \
+  BENCHMARK(BM_SSSP_##TOPO##_Delta_T0)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();
+
+DEFINE_SSSP_SET(ER_Sparse, ER_EDGES(n), n)
+DEFINE_SSSP_SET(Grid, GRID_EDGES(n), GRID_N(n))
+DEFINE_SSSP_SET(BA, BA_EDGES(n), n)
+DEFINE_SSSP_SET(Path, PATH_EDGES(n), n)
+
+BENCHMARK_MAIN();
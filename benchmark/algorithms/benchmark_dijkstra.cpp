@@ -11,6 +11,14 @@
  * Benchmark naming convention:
  *   BM_Dijkstra_<Container>_<Topology>           — default heap (priority_queue)
  *   BM_Dijkstra_<Container>_<Topology>_Idx<D>    — indexed d-ary heap, arity D
+ *   BM_DijkstraInt_<Weights>_<Topology>_<Heap>   — uint32_t distances on CSR
+ *   Weights   : U100  integer weights 1..99
+ *               Unit  all weights 1
+ *   Heap      : Binary   std::priority_queue (auto-selection disabled)
+ *               Auto     use_default_heap (selects the radix heap)
+ *               Radix    use_radix_heap
+ *               Bucket   use_bucket_heap
+ *               Idx4     use_indexed_dary_heap<4>
  *   Container : CSR  (compressed_graph)
  *               VoV  (dynamic_graph / vov)
  *   Topology  : ER_Sparse   Erdős–Rényi, E/V ≈ 8
@@ -64,6 +72,12 @@ constexpr auto weight_fn = [](const auto& g, const auto& uv) {
   return graph::edge_value(g, uv);
 };
 
+/// Integer weight function: truncate the stored edge value (1..99 for
+/// weight_dist::uniform, 1 for weight_dist::constant_one).
+constexpr auto int_weight_fn = [](const auto& g, const auto& uv) {
+  return static_cast<uint32_t>(graph::edge_value(g, uv));
+};
+
 } // namespace
 
 // ---------------------------------------------------------------------------
@@ -193,6 +207,62 @@ BENCHMARK(BM_Dijkstra_CSR_Path_Idx8)->RangeMultiplier(10)->Range(1'000, 100'000)
 BENCHMARK(BM_Dijkstra_VoV_Path)     ->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();
 BENCHMARK(BM_Dijkstra_VoV_Path_Idx4)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();
 
+// ---------------------------------------------------------------------------
+// Integer weights: monotone integer queues vs. comparison heaps
+//
+// uint32_t distances on CSR. std::ranges::less is not one of the comparators
+// that make use_default_heap pick the radix heap, so the Binary variant keeps
+// the std::priority_queue path as the baseline.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_DIJKSTRA_INT_BM(NAME, EDGE_EXPR, N_EXPR, COMPARE, HEAP_TAG)          \
+  static void NAME(benchmark::State& state) {                                        \
+    const auto n = static_cast<graph::benchmark::vertex_id_t>(state.range(0));       \
+    const auto edges = (EDGE_EXPR);                                                  \
+    graph::benchmark::csr_graph_t g = graph::benchmark::make_csr(edges, (N_EXPR));   \
+    std::vector<uint32_t> dist(graph::num_vertices(g));                              \
+    for (auto _ : state) {                                                           \
+      state.PauseTiming();                                                           \
+      std::fill(dist.begin(), dist.end(), std::numeric_limits<uint32_t>::max());     \
+      state.ResumeTiming();                                                          \
+      graph::dijkstra_shortest_distances(                                            \
+            g, graph::benchmark::vertex_id_t{0}, graph::container_value_fn(dist),   \
+            int_weight_fn, graph::empty_visitor{},                                   \
+            COMPARE, std::plus<uint32_t>{},                                          \
+            HEAP_TAG, std::allocator<std::byte>{});                                  \
+      benchmark::DoNotOptimize(dist.data());                                        \
+    }                                                                                \
+    state.SetComplexityN(state.range(0));                                            \
+  }
+
+// One benchmark per heap for a weight distribution and topology.
+#define DEF_BM_INT_HEAPS(PREFIX, EE, NE)                                                                             \
+  DEFINE_DIJKSTRA_INT_BM(PREFIX##_Binary, EE, NE, std::ranges::less{}, graph::use_default_heap{})                   \
+  DEFINE_DIJKSTRA_INT_BM(PREFIX##_Auto,   EE, NE, std::less<uint32_t>{}, graph::use_default_heap{})                 \
+  DEFINE_DIJKSTRA_INT_BM(PREFIX##_Radix,  EE, NE, std::less<uint32_t>{}, graph::use_radix_heap{})                   \
+  DEFINE_DIJKSTRA_INT_BM(PREFIX##_Bucket, EE, NE, std::less<uint32_t>{}, graph::use_bucket_heap{})                  \
+  DEFINE_DIJKSTRA_INT_BM(PREFIX##_Idx4,   EE, NE, std::less<uint32_t>{}, graph::use_indexed_dary_heap<4>{})         \
+  BENCHMARK(PREFIX##_Binary)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();                            \
+  BENCHMARK(PREFIX##_Auto)  ->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();                            \
+  BENCHMARK(PREFIX##_Radix) ->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();                            \
+  BENCHMARK(PREFIX##_Bucket)->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();                            \
+  BENCHMARK(PREFIX##_Idx4)  ->RangeMultiplier(10)->Range(1'000, 100'000)->Complexity();
+
+#define UNIT graph::benchmark::weight_dist::constant_one
+
+DEF_BM_INT_HEAPS(BM_DijkstraInt_U100_ER_Sparse, ER_EDGES(n), n)
+DEF_BM_INT_HEAPS(BM_DijkstraInt_U100_Grid,
+                 graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n)), GRID_SQRT(n) * GRID_SQRT(n))
+DEF_BM_INT_HEAPS(BM_DijkstraInt_U100_BA, graph::benchmark::barabasi_albert(n, 4), n)
+DEF_BM_INT_HEAPS(BM_DijkstraInt_U100_Path, graph::benchmark::path_graph(n), n)
+
+DEF_BM_INT_HEAPS(BM_DijkstraInt_Unit_ER_Sparse, graph::benchmark::erdos_renyi(n, 8.0 / n, 42, UNIT), n)
+DEF_BM_INT_HEAPS(BM_DijkstraInt_Unit_Grid,
+                 graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n), 42, UNIT), GRID_SQRT(n) * GRID_SQRT(n))
+DEF_BM_INT_HEAPS(BM_DijkstraInt_Unit_BA, graph::benchmark::barabasi_albert(n, 4, 42, UNIT), n)
+
+#undef UNIT
+
 // ---------------------------------------------------------------------------
 // Optional large-scale tier  (V = 1 000 000)
 // Enable with: cmake -DDIJKSTRA_BENCH_LARGE=ON ...
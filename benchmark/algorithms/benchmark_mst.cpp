@@ -0,0 +1,192 @@
+/**
+ * @file benchmark_mst.cpp
+ * @brief Google Benchmark suite for the minimum spanning tree algorithms.
+ *
+ * Compares prim on its lazy (binary heap) and eager (indexed d-ary heap) paths against the
+ * former implementation, which ran dijkstra_shortest_paths with a projecting combine and a
+ * weight function that reported +infinity for edges into finalized vertices. That baseline is
+ * reproduced below as prim_via_dijkstra. It also compares the edge-list forests kruskal and
+ * filter_kruskal with boruvka on the same graphs. Graph construction and output reset are
+ * excluded from the timed region.
+ *
+ * Benchmark naming convention:
+ *   BM_Prim_<Topology>_Shim       — prim_via_dijkstra, use_default_heap
+ *   BM_Prim_<Topology>_Shim_Idx4  — prim_via_dijkstra, use_indexed_dary_heap<4>
+ *   BM_Prim_<Topology>_Lazy       — prim, use_default_heap
+ *   BM_Prim_<Topology>_Idx4/_Idx8 — prim, use_indexed_dary_heap<4> / <8>
+ *   BM_Forest_<Topology>_Kruskal       — kruskal on the edge list
+ *   BM_Forest_<Topology>_FilterKruskal — filter_kruskal on the edge list
+ *   BM_Forest_<Topology>_Boruvka       — boruvka on the CSR graph holding both directions
+ *   Topology : Dense (G(n, 1/4)), ER_Sparse (8 edges per vertex), Grid; all symmetric
+ *   Arg      : number of vertices (and for the BM_Forest_ sets, the number of pool workers)
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/mst.hpp>
+#include <graph/algorithm/parallel_mst.hpp>
+#include <graph/graph.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+using graph::benchmark::csr_graph_t;
+using graph::benchmark::vertex_id_t;
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+// The edges of el in both directions
+graph::benchmark::edge_list symmetric(graph::benchmark::edge_list el) {
+  const auto m = el.size();
+  for (size_t i = 0; i < m; ++i)
+    el.push_back({el[i].target_id, el[i].source_id, el[i].value});
+  std::ranges::stable_sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return el;
+}
+
+// prim before it had its own loop: Dijkstra with combine(d_u, w_uv) = w_uv, and a weight
+// function that hides the edges into finalized vertices
+template <class Heap>
+double prim_via_dijkstra(const csr_graph_t& g, std::vector<double>& weight, std::vector<vertex_id_t>& pred) {
+  std::vector<bool> finalized(graph::num_vertices(g), false);
+  struct finish_visitor {
+    std::vector<bool>* finalized;
+    void on_finish_vertex(const csr_graph_t&, const vertex_id_t& uid) const { (*finalized)[uid] = true; }
+  };
+  auto guarded = [&finalized](const csr_graph_t& gr, const auto& uv) {
+    return finalized[graph::target_id(gr, uv)] ? graph::infinite_distance<double>() : graph::edge_value(gr, uv);
+  };
+  graph::dijkstra_shortest_paths(g, vertex_id_t{0}, graph::container_value_fn(weight), graph::container_value_fn(pred),
+                                 guarded, finish_visitor{&finalized}, std::less<double>{},
+                                 [](double, double w) { return w; }, Heap{}, std::allocator<std::byte>{});
+  double total = 0;
+  for (vertex_id_t v = 1; v < weight.size(); ++v)
+    if (pred[v] != v)
+      total += weight[v];
+  return total;
+}
+
+template <class Heap>
+double run_prim(const csr_graph_t& g, std::vector<double>& weight, std::vector<vertex_id_t>& pred) {
+  return graph::prim(g, vertex_id_t{0}, graph::container_value_fn(weight), graph::container_value_fn(pred), weight_fn,
+                     std::less<double>{}, Heap{});
+}
+
+double run_kruskal(const graph::benchmark::edge_list& el, const csr_graph_t&, graph::benchmark::edge_list& t,
+                   graph::thread_pool&) {
+  return graph::kruskal(el, t).first;
+}
+
+double run_filter_kruskal(const graph::benchmark::edge_list& el, const csr_graph_t&, graph::benchmark::edge_list& t,
+                          graph::thread_pool& pool) {
+  return graph::filter_kruskal(el, t, pool).first;
+}
+
+double run_boruvka(const graph::benchmark::edge_list&, const csr_graph_t& g, graph::benchmark::edge_list& t,
+                   graph::thread_pool& pool) {
+  return graph::boruvka(g, t, pool).first;
+}
+
+} // namespace
+
+#define DENSE_EDGES(n)     symmetric(graph::benchmark::erdos_renyi(n, 0.25))
+#define ER_EDGES(n)        symmetric(graph::benchmark::erdos_renyi(n, 4.0 / n))
+#define GRID_SQRT(n)       static_cast<vertex_id_t>(std::sqrt(static_cast<double>(n)))
+#define GRID_EDGES(n)      graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n))
+#define GRID_N(n)          GRID_SQRT(n) * GRID_SQRT(n)
+
+// ---------------------------------------------------------------------------
+// Macro: one Prim benchmark. CALL is run_prim<Heap> or prim_via_dijkstra<Heap>.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_PRIM_BM(NAME, EDGE_EXPR, N_EXPR, CALL)                                                              \
+  static void NAME(::benchmark::State& state) {                                                                    \
+    const auto               n0 = static_cast<vertex_id_t>(state.range(0));                                       \
+    const vertex_id_t        n  = N_EXPR;                                                                          \
+    csr_graph_t              g;                                                                                     \
+    g.load_edges(EDGE_EXPR, std::identity{}, n);                                                                    \
+    std::vector<double>      weight(n);                                                                             \
+    std::vector<vertex_id_t> pred(n);                                                                               \
+    for (auto _ : state) {                                                                                          \
+      state.PauseTiming();                                                                                          \
+      graph::init_shortest_paths(g, weight, pred);                                                                  \
+      state.ResumeTiming();                                                                                         \
+      ::benchmark::DoNotOptimize(CALL(g, weight, pred));                                                            \
+    }                                                                                                               \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(graph::num_edges(g)));  \
+  }
+
+#define DEFINE_PRIM_SET(PREFIX, EDGE_EXPR, N_EXPR)                                                                 \
+  DEFINE_PRIM_BM(PREFIX##_Shim, EDGE_EXPR, N_EXPR, prim_via_dijkstra<graph::use_default_heap>)                     \
+  DEFINE_PRIM_BM(PREFIX##_Shim_Idx4, EDGE_EXPR, N_EXPR, prim_via_dijkstra<graph::use_indexed_dary_heap<4>>)        \
+  DEFINE_PRIM_BM(PREFIX##_Lazy, EDGE_EXPR, N_EXPR, run_prim<graph::use_default_heap>)                              \
+  DEFINE_PRIM_BM(PREFIX##_Idx4, EDGE_EXPR, N_EXPR, run_prim<graph::use_indexed_dary_heap<4>>)                      \
+  DEFINE_PRIM_BM(PREFIX##_Idx8, EDGE_EXPR, N_EXPR, run_prim<graph::use_indexed_dary_heap<8>>)
+
+#define REGISTER_PRIM_SET(PREFIX, ...)                                                                              \
+  BENCHMARK(PREFIX##_Shim)->__VA_ARGS__;                                                                            \
+  BENCHMARK(PREFIX##_Shim_Idx4)->__VA_ARGS__;                                                                       \
+  BENCHMARK(PREFIX##_Lazy)->__VA_ARGS__;                                                                            \
+  BENCHMARK(PREFIX##_Idx4)->__VA_ARGS__;                                                                            \
+  BENCHMARK(PREFIX##_Idx8)->__VA_ARGS__;
+
+// ---------------------------------------------------------------------------
+// Macro: one spanning forest benchmark. EDGE_EXPR holds both directions; the
+// edge-list algorithms get the source < target half of it.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_FOREST_BM(NAME, EDGE_EXPR, N_EXPR, CALL)                                                            \
+  static void NAME(::benchmark::State& state) {                                                                    \
+    const auto         n0 = static_cast<vertex_id_t>(state.range(0));                                             \
+    const vertex_id_t  n  = N_EXPR;                                                                                \
+    graph::thread_pool pool(static_cast<size_t>(state.range(1)));                                                  \
+    const auto         both = EDGE_EXPR;                                                                           \
+    csr_graph_t        g;                                                                                          \
+    g.load_edges(both, std::identity{}, n);                                                                        \
+    graph::benchmark::edge_list half;                                                                              \
+    std::ranges::copy_if(both, std::back_inserter(half), [](const auto& e) { return e.source_id < e.target_id; }); \
+    graph::benchmark::edge_list forest;                                                                            \
+    forest.reserve(n);                                                                                             \
+    for (auto _ : state) {                                                                                         \
+      forest.clear();                                                                                              \
+      ::benchmark::DoNotOptimize(CALL(half, g, forest, pool));                                                     \
+    }                                                                                                              \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(half.size()));         \
+  }
+
+#define DEFINE_FOREST_SET(PREFIX, EDGE_EXPR, N_EXPR)                                                               \
+  DEFINE_FOREST_BM(PREFIX##_Kruskal, EDGE_EXPR, N_EXPR, run_kruskal)                                               \
+  DEFINE_FOREST_BM(PREFIX##_FilterKruskal, EDGE_EXPR, N_EXPR, run_filter_kruskal)                                  \
+  DEFINE_FOREST_BM(PREFIX##_Boruvka, EDGE_EXPR, N_EXPR, run_boruvka)
+
+#define REGISTER_FOREST_SET(PREFIX, ...)                                                                            \
+  BENCHMARK(PREFIX##_Kruskal)->__VA_ARGS__;                                                                         \
+  BENCHMARK(PREFIX##_FilterKruskal)->__VA_ARGS__;                                                                   \
+  BENCHMARK(PREFIX##_Boruvka)->__VA_ARGS__;
+
+DEFINE_PRIM_SET(BM_Prim_Dense, DENSE_EDGES(n), n0)
+DEFINE_PRIM_SET(BM_Prim_ER_Sparse, ER_EDGES(n), n0)
+DEFINE_PRIM_SET(BM_Prim_Grid, GRID_EDGES(n0), GRID_N(n0))
+
+REGISTER_PRIM_SET(BM_Prim_Dense, Arg(1'000)->Arg(4'000)->Unit(::benchmark::kMillisecond))
+REGISTER_PRIM_SET(BM_Prim_ER_Sparse, Arg(10'000)->Arg(100'000)->Unit(::benchmark::kMillisecond))
+REGISTER_PRIM_SET(BM_Prim_Grid, Arg(10'000)->Arg(100'000)->Unit(::benchmark::kMillisecond))
+
+DEFINE_FOREST_SET(BM_Forest_Dense, DENSE_EDGES(n), n0)
+DEFINE_FOREST_SET(BM_Forest_ER_Sparse, ER_EDGES(n), n0)
+DEFINE_FOREST_SET(BM_Forest_Grid, GRID_EDGES(n0), GRID_N(n0))
+
+REGISTER_FOREST_SET(BM_Forest_Dense, Args({4'000, 1})->Args({4'000, 4})->Unit(::benchmark::kMillisecond))
+REGISTER_FOREST_SET(BM_Forest_ER_Sparse, Args({100'000, 1})->Args({100'000, 4})->Unit(::benchmark::kMillisecond))
+REGISTER_FOREST_SET(BM_Forest_Grid, Args({100'000, 1})->Args({100'000, 4})->Unit(::benchmark::kMillisecond))
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+/**
+ * @file benchmark_reordering.cpp
+ * @brief Google Benchmark suite for the vertex orderings of vertex_ordering.hpp.
+ *
+ * Graphs often arrive with arbitrary vertex ids, which scatters the accesses of every
+ * traversal over the per-vertex arrays. This suite renames the vertices of the
+ * dijkstra_fixtures.hpp graphs by a random permutation, renumbers the result with each
+ * ordering (order_vertices + reorder, excluded from the timed region) and times, on the
+ * CSR container:
+ *
+ *   - dijkstra_shortest_distances from the original vertex 0, as benchmark_dijkstra.cpp;
+ *   - the view loops of benchmark/benchmark_views.cpp (BM_Incidence_AllVertices and
+ *     BM_BFS_Vertices) on CSR, plus a neighbors loop summing a value per target vertex, the
+ *     access pattern of pull-style kernels such as PageRank.
+ *
+ * The cost of computing each ordering is timed separately.
+ *
+ * Benchmark naming convention:
+ *   BM_Reorder_<Kernel>_<Topology>_<Order>  — kernel on the graph renumbered by Order
+ *   BM_Order_<Topology>_<Order>             — order_vertices alone
+ *   Kernel   : Dijkstra, Incidence, NeighborSum, BFS
+ *   Topology : ER (Erdős–Rényi, E/V ≈ 8, directed), Grid (2D grid), BA (Barabási–Albert, m = 4)
+ *   Order    : Shuffled (no reordering: the random ids), Degree, Hub, BFS, RCM, Gorder, Rabbit
+ *
+ * The differences grow with the size of the graph: they appear once the per-vertex arrays
+ * no longer fit in the caches.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/vertex_ordering.hpp>
+#include <graph/graph.hpp>
+#include <graph/views.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+
+using graph::benchmark::csr_graph_t;
+using graph::benchmark::edge_list;
+using graph::benchmark::vertex_id_t;
+
+// Renames every vertex by a fixed random permutation and sorts by source for make_csr
+edge_list shuffled(edge_list el, vertex_id_t n) {
+  std::vector<vertex_id_t> p(n);
+  std::iota(p.begin(), p.end(), vertex_id_t{0});
+  std::mt19937_64 rng(7);
+  std::ranges::shuffle(p, rng);
+  for (auto& e : el) {
+    e.source_id = p[e.source_id];
+    e.target_id = p[e.target_id];
+  }
+  std::ranges::stable_sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return el;
+}
+
+// The shuffled graph renumbered by an ordering (none: the shuffled graph itself), and the new
+// id of the original vertex 0 to start the searches from
+struct reordered_graph {
+  csr_graph_t g;
+  vertex_id_t source = 0;
+};
+
+reordered_graph make_reordered(const edge_list& edges, vertex_id_t n, std::optional<graph::vertex_order> order,
+                               bool symmetric) {
+  auto g = graph::benchmark::make_csr(edges, n);
+  if (!order)
+    return {std::move(g), 0};
+  const auto perm = graph::order_vertices(g, *order, {.symmetric = symmetric});
+  return {graph::reorder(g, perm), perm.new_id[0]};
+}
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+} // namespace
+
+#define ER_EDGES(n)   shuffled(graph::benchmark::erdos_renyi(n, 8.0 / n), n)
+#define GRID_SQRT(n)  static_cast<vertex_id_t>(std::sqrt(static_cast<double>(n)))
+#define GRID_N(n)     GRID_SQRT(n) * GRID_SQRT(n)
+#define GRID_EDGES(n) shuffled(graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n)), GRID_N(n))
+#define BA_EDGES(n)   shuffled(graph::benchmark::barabasi_albert(n, 4), n)
+
+#define ORDER_Shuffled std::nullopt
+#define ORDER_Degree   graph::vertex_order::degree_sort
+#define ORDER_Hub      graph::vertex_order::hub_cluster
+#define ORDER_BFS      graph::vertex_order::bfs
+#define ORDER_RCM      graph::vertex_order::rcm
+#define ORDER_Gorder   graph::vertex_order::gorder
+#define ORDER_Rabbit   graph::vertex_order::rabbit
+
+// ---------------------------------------------------------------------------
+// Kernels. Each uses h (the reordered graph) and src, and leaves its result in sink.
+// ---------------------------------------------------------------------------
+
+#define KERNEL_SETUP_Dijkstra std::vector<double> dist(graph::num_vertices(h));
+#define KERNEL_Dijkstra                                                                                   \
+  state.PauseTiming();                                                                                    \
+  std::ranges::fill(dist, std::numeric_limits<double>::max());                                            \
+  state.ResumeTiming();                                                                                   \
+  graph::dijkstra_shortest_distances(h, src, graph::container_value_fn(dist), weight_fn);                 \
+  sink = static_cast<size_t>(dist[src]);
+
+#define KERNEL_SETUP_Incidence
+#define KERNEL_Incidence                                                                                  \
+  for (vertex_id_t u = 0; u < graph::num_vertices(h); ++u)                                                \
+    for (auto [tid, e] : h | graph::views::adaptors::incidence(u))                                        \
+      sink += tid;
+
+#define KERNEL_SETUP_NeighborSum std::vector<double> x(graph::num_vertices(h), 1.0);
+#define KERNEL_NeighborSum                                                                                \
+  {                                                                                                       \
+    double sum = 0;                                                                                       \
+    for (vertex_id_t u = 0; u < graph::num_vertices(h); ++u)                                              \
+      for (auto [tid, v] : h | graph::views::adaptors::neighbors(u))                                      \
+        sum += x[tid];                                                                                    \
+    sink = static_cast<size_t>(sum);                                                                      \
+  }
+
+#define KERNEL_SETUP_BFS
+#define KERNEL_BFS                                                                                        \
+  for (auto [v] : h | graph::views::adaptors::vertices_bfs(src)) {                                        \
+    benchmark::DoNotOptimize(v);                                                                          \
+    ++sink;                                                                                               \
+  }
+
+// ---------------------------------------------------------------------------
+// Macro: one kernel on one topology renumbered by one ordering.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_REORDER_BM(KERNEL, TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                              \
+  static void BM_Reorder_##KERNEL##_##TOPO##_##ORDER(benchmark::State& state) {                           \
+    const auto  n    = static_cast<vertex_id_t>(state.range(0));                                          \
+    auto        r    = make_reordered((EDGE_EXPR), (N_EXPR), ORDER_##ORDER, SYMMETRIC);                   \
+    const auto& h    = r.g;                                                                               \
+    [[maybe_unused]] const auto src = r.source;                                                           \
+    KERNEL_SETUP_##KERNEL                                                                                 \
+    for (auto _ : state) {                                                                                \
+      size_t sink = 0;                                                                                    \
+      KERNEL_##KERNEL                                                                                     \
+      benchmark::DoNotOptimize(sink);                                                                     \
+    }                                                                                                     \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *                                    \
+                            static_cast<int64_t>(graph::num_edges(h)));                                   \
+    state.SetComplexityN(state.range(0));                                                                 \
+  }                                                                                                       \
+  BENCHMARK(BM_Reorder_##KERNEL##_##TOPO##_##ORDER)->RangeMultiplier(10)->Range(10'000, 1'000'000);
+
+// Macro: the cost of computing one ordering of one topology.
+#define DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                                        \
+  static void BM_Order_##TOPO##_##ORDER(benchmark::State& state) {                                        \
+    const auto n = static_cast<vertex_id_t>(state.range(0));                                              \
+    const auto g = graph::benchmark::make_csr((EDGE_EXPR), (N_EXPR));                                     \
+    for (auto _ : state) {                                                                                \
+      auto perm = graph::order_vertices(g, ORDER_##ORDER, {.symmetric = SYMMETRIC});                      \
+      benchmark::DoNotOptimize(perm.old_id.data());                                                       \
+    }                                                                                                     \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *                                    \
+                            static_cast<int64_t>(graph::num_edges(g)));                                   \
+    state.SetComplexityN(state.range(0));                                                                 \
+  }                                                                                                       \
+  BENCHMARK(BM_Order_##TOPO##_##ORDER)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Complexity();
+
+#define DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                                 \
+  DEFINE_REORDER_BM(Dijkstra, TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                                  \
+  DEFINE_REORDER_BM(Incidence, TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                                 \
+  DEFINE_REORDER_BM(NeighborSum, TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC)                               \
+  DEFINE_REORDER_BM(BFS, TOPO, EDGE_EXPR, N_EXPR, ORDER, SYMMETRIC) 
+
+#define DEFINE_REORDER_SET(TOPO, EDGE_EXPR, N_EXPR, SYMMETRIC)                                            \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, Shuffled, SYMMETRIC)                                    \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, Degree, SYMMETRIC)                                      \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, Hub, SYMMETRIC)                                         \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, BFS, SYMMETRIC)                                         \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, RCM, SYMMETRIC)                                         \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, Gorder, SYMMETRIC)                                      \
+  DEFINE_REORDER_KERNELS(TOPO, EDGE_EXPR, N_EXPR, Rabbit, SYMMETRIC)                                      \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, Degree, SYMMETRIC)                                             \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, Hub, SYMMETRIC)                                                \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, BFS, SYMMETRIC)                                                \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, RCM, SYMMETRIC)                                                \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, Gorder, SYMMETRIC)                                             \
+  DEFINE_ORDER_BM(TOPO, EDGE_EXPR, N_EXPR, Rabbit, SYMMETRIC) 
+
+DEFINE_REORDER_SET(ER, ER_EDGES(n), n, false)
+DEFINE_REORDER_SET(Grid, GRID_EDGES(n), GRID_N(n), true)
+DEFINE_REORDER_SET(BA, BA_EDGES(n), n, true)
+
+BENCHMARK_MAIN();
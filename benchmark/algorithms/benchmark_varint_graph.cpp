@@ -0,0 +1,171 @@
+/**
+ * @file benchmark_varint_graph.cpp
+ * @brief Google Benchmark suite comparing compressed_varint_graph with compressed_graph.
+ *
+ * compressed_varint_graph stores each row as gap-encoded group varints, so a traversal reads about
+ * 2 bytes per edge on a well-ordered graph instead of sizeof(VId), at the cost of decoding each
+ * target.
+ * This suite builds both containers from the same dijkstra_fixtures.hpp graphs, with the ids
+ * shuffled or the shuffled graph renumbered by rcm (order_vertices + reorder), and times:
+ *
+ *   - a neighbors loop summing a value per target vertex, the access pattern of pull-style
+ *     kernels such as PageRank (as in benchmark_reordering.cpp);
+ *   - the vertices_bfs view from vertex 0;
+ *   - dijkstra_shortest_distances from vertex 0, as benchmark_dijkstra.cpp.
+ *
+ * Each benchmark reports the bytes stored per edge for the targets (col_index_ or the varint
+ * rows) in the "bytes_per_edge" counter.
+ *
+ * Benchmark naming convention:
+ *   BM_Varint_<Kernel>_<Container>_<Topology>_<Order>
+ *   Kernel    : NeighborSum, BFS, Dijkstra
+ *   Container : CSR (compressed_graph), Varint (compressed_varint_graph)
+ *   Topology  : Grid (2D grid), BA (Barabási–Albert, m = 4)
+ *   Order     : Shuffled (random ids), RCM (shuffled, then renumbered by rcm)
+ *
+ * The gain of the smaller rows depends on memory bandwidth: it appears once the targets no longer
+ * fit in the caches, and is larger with several threads competing for memory.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/vertex_ordering.hpp>
+#include <graph/container/compressed_varint_graph.hpp>
+#include <graph/graph.hpp>
+#include <graph/views.hpp>
+
+#include "dijkstra_fixtures.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+using graph::benchmark::csr_graph_t;
+using graph::benchmark::edge_list;
+using graph::benchmark::vertex_id_t;
+using varint_graph_t = graph::container::compressed_varint_graph<double, void, void, vertex_id_t, vertex_id_t>;
+
+// Renames every vertex by a fixed random permutation and sorts by source for make_csr
+edge_list shuffled(edge_list el, vertex_id_t n) {
+  std::vector<vertex_id_t> p(n);
+  std::iota(p.begin(), p.end(), vertex_id_t{0});
+  std::mt19937_64 rng(7);
+  std::ranges::shuffle(p, rng);
+  for (auto& e : el) {
+    e.source_id = p[e.source_id];
+    e.target_id = p[e.target_id];
+  }
+  std::ranges::stable_sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return el;
+}
+
+csr_graph_t make_ordered_csr(const edge_list& edges, vertex_id_t n, bool rcm) {
+  auto g = graph::benchmark::make_csr(edges, n);
+  if (!rcm)
+    return g;
+  return graph::reorder(g, graph::order_vertices(g, graph::vertex_order::rcm, {.symmetric = true}));
+}
+
+csr_graph_t make_CSR(const edge_list& edges, vertex_id_t n, bool rcm) { return make_ordered_csr(edges, n, rcm); }
+
+varint_graph_t make_Varint(const edge_list& edges, vertex_id_t n, bool rcm) {
+  varint_graph_t g;
+  g.load_graph(make_ordered_csr(edges, n, rcm));
+  return g;
+}
+
+double bytes_per_edge(const csr_graph_t& g) {
+  return static_cast<double>(sizeof(vertex_id_t) * g.col_index_storage().size()) /
+         static_cast<double>(std::max<size_t>(1, graph::num_edges(g)));
+}
+double bytes_per_edge(const varint_graph_t& g) {
+  return static_cast<double>(g.bytes().size()) / static_cast<double>(std::max<size_t>(1, graph::num_edges(g)));
+}
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return graph::edge_value(g, uv); };
+
+} // namespace
+
+#define GRID_SQRT(n)  static_cast<vertex_id_t>(std::sqrt(static_cast<double>(n)))
+#define GRID_N(n)     GRID_SQRT(n) * GRID_SQRT(n)
+#define GRID_EDGES(n) shuffled(graph::benchmark::grid_2d(GRID_SQRT(n), GRID_SQRT(n)), GRID_N(n))
+#define BA_EDGES(n)   shuffled(graph::benchmark::barabasi_albert(n, 4), n)
+
+#define ORDER_Shuffled false
+#define ORDER_RCM      true
+
+// ---------------------------------------------------------------------------
+// Kernels. Each uses h (the graph), and leaves its result in sink.
+// ---------------------------------------------------------------------------
+
+#define KERNEL_SETUP_NeighborSum std::vector<double> x(graph::num_vertices(h), 1.0);
+#define KERNEL_NeighborSum                                                                                \
+  {                                                                                                       \
+    double sum = 0;                                                                                       \
+    for (vertex_id_t u = 0; u < graph::num_vertices(h); ++u)                                              \
+      for (auto [tid, v] : h | graph::views::adaptors::neighbors(u))                                      \
+        sum += x[tid];                                                                                    \
+    sink = static_cast<size_t>(sum);                                                                      \
+  }
+
+#define KERNEL_SETUP_BFS
+#define KERNEL_BFS                                                                                        \
+  for (auto [v] : h | graph::views::adaptors::vertices_bfs(vertex_id_t{0})) {                             \
+    benchmark::DoNotOptimize(v);                                                                          \
+    ++sink;                                                                                               \
+  }
+
+#define KERNEL_SETUP_Dijkstra std::vector<double> dist(graph::num_vertices(h));
+#define KERNEL_Dijkstra                                                                                   \
+  state.PauseTiming();                                                                                    \
+  std::ranges::fill(dist, std::numeric_limits<double>::max());                                            \
+  state.ResumeTiming();                                                                                   \
+  graph::dijkstra_shortest_distances(h, vertex_id_t{0}, graph::container_value_fn(dist), weight_fn);      \
+  sink = static_cast<size_t>(dist[0]);
+
+// ---------------------------------------------------------------------------
+// Macro: one kernel on one container, topology and ordering.
+// ---------------------------------------------------------------------------
+
+#define DEFINE_VARINT_BM(KERNEL, CONTAINER, TOPO, EDGE_EXPR, N_EXPR, ORDER)                               \
+  static void BM_Varint_##KERNEL##_##CONTAINER##_##TOPO##_##ORDER(benchmark::State& state) {              \
+    const auto  n = static_cast<vertex_id_t>(state.range(0));                                             \
+    const auto  h = make_##CONTAINER((EDGE_EXPR), (N_EXPR), ORDER_##ORDER);                               \
+    KERNEL_SETUP_##KERNEL                                                                                 \
+    for (auto _ : state) {                                                                                \
+      size_t sink = 0;                                                                                    \
+      KERNEL_##KERNEL                                                                                     \
+      benchmark::DoNotOptimize(sink);                                                                     \
+    }                                                                                                     \
+    state.counters["bytes_per_edge"] = bytes_per_edge(h);                                                 \
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *                                    \
+                            static_cast<int64_t>(graph::num_edges(h)));                                   \
+    state.SetComplexityN(state.range(0));                                                                 \
+  }                                                                                                       \
+  BENCHMARK(BM_Varint_##KERNEL##_##CONTAINER##_##TOPO##_##ORDER)                                          \
+        ->RangeMultiplier(10)                                                                             \
+        ->Range(10'000, 1'000'000);
+
+#define DEFINE_VARINT_CONTAINERS(KERNEL, TOPO, EDGE_EXPR, N_EXPR, ORDER)                                  \
+  DEFINE_VARINT_BM(KERNEL, CSR, TOPO, EDGE_EXPR, N_EXPR, ORDER)                                           \
+  DEFINE_VARINT_BM(KERNEL, Varint, TOPO, EDGE_EXPR, N_EXPR, ORDER)
+
+#define DEFINE_VARINT_SET(TOPO, EDGE_EXPR, N_EXPR)                                                        \
+  DEFINE_VARINT_CONTAINERS(NeighborSum, TOPO, EDGE_EXPR, N_EXPR, Shuffled)                                \
+  DEFINE_VARINT_CONTAINERS(NeighborSum, TOPO, EDGE_EXPR, N_EXPR, RCM)                                     \
+  DEFINE_VARINT_CONTAINERS(BFS, TOPO, EDGE_EXPR, N_EXPR, Shuffled)                                        \
+  DEFINE_VARINT_CONTAINERS(BFS, TOPO, EDGE_EXPR, N_EXPR, RCM)                                             \
+  DEFINE_VARINT_CONTAINERS(Dijkstra, TOPO, EDGE_EXPR, N_EXPR, Shuffled)                                   \
+  DEFINE_VARINT_CONTAINERS(Dijkstra, TOPO, EDGE_EXPR, N_EXPR, RCM)
+
+DEFINE_VARINT_SET(Grid, GRID_EDGES(n), GRID_N(n))
+DEFINE_VARINT_SET(BA, BA_EDGES(n), n)
+
+BENCHMARK_MAIN();
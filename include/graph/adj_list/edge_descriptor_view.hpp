@@ -87,7 +87,7 @@ public:
      */
     constexpr edge_descriptor_view(edge_storage_type begin_val, edge_storage_type end_val, vertex_desc src_vertex) noexcept
         : begin_(begin_val), end_(end_val), source_(src_vertex) {
-    size_ = static_cast<std::size_t>(std::distance(begin_val, end_val));
+    size_ = static_cast<std::size_t>(std::ranges::distance(begin_val, end_val));
   }
 
   /**
@@ -106,7 +106,7 @@ public:
     if constexpr(std::ranges::sized_range<Container>) {
       size_ = std::ranges::size(container);
     } else {
-      size_  = static_cast<std::size_t>(std::distance(begin_, end_));
+      size_  = static_cast<std::size_t>(std::ranges::distance(begin_, end_));
     }
   }
 
@@ -129,7 +129,7 @@ public:
     if constexpr(std::ranges::sized_range<const Container>) {
       size_ = std::ranges::size(container);
     } else {
-      size_  = static_cast<std::size_t>(std::distance(begin_, end_));
+      size_  = static_cast<std::size_t>(std::ranges::distance(begin_, end_));
     }
   }
 
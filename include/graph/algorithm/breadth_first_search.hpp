@@ -21,6 +21,7 @@
 #include "graph/graph.hpp"
 #include "graph/views/incidence.hpp"
 #include "graph/algorithm/traversal_common.hpp"
+#include "graph/algorithm/traversal_workspace.hpp"
 #include "graph/adj_list/vertex_property_map.hpp"
 
 #include <array>
@@ -37,6 +38,8 @@ namespace graph {
 using adj_list::adjacency_list;
 using adj_list::vertex_id_t;
 using adj_list::find_vertex;
+using adj_list::index_adjacency_list;
+using adj_list::num_vertices;
 
 /**
  * @brief Multi-source breadth-first search with visitor pattern.
@@ -283,6 +286,114 @@ void breadth_first_search(G&&                      g,      // graph
   breadth_first_search(std::forward<G>(g), sources, std::forward<Visitor>(visitor), alloc);
 }
 
+/**
+ * @brief Multi-source breadth-first search reusing a traversal_workspace.
+ *
+ * Same traversal and visitor events as breadth_first_search(g, sources, visitor), but the
+ * visited set and the FIFO queue live in @p workspace: they are reset in O(1) instead of
+ * allocated and cleared, so a search costs O(vertices and edges reached) rather than O(V).
+ * The visited set doubles as the queue, since BFS examines vertices in discovery order.
+ * Afterwards workspace.visited().members() lists the vertices reached, in that order.
+ *
+ * @tparam G       Graph type satisfying index_adjacency_list
+ * @tparam Sources Input range of source vertex IDs
+ * @tparam VId     Vertex id type of the workspace; must hold every vertex id of g
+ * @tparam Visitor Visitor type with optional callback methods
+ *
+ * @param g         The graph to traverse
+ * @param sources   Range of starting vertex IDs. A source listed twice is visited once.
+ * @param workspace Workspace of the calling thread
+ * @param visitor   Visitor object to receive traversal events (default: empty_visitor)
+ *
+ * **Complexity:**
+ * - Time: O(reached vertices + their out-edges), after the workspace's first use on g
+ * - Space: O(V) in the workspace, allocated on first use
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * traversal_workspace<uint32_t> ws;           // one per thread
+ * for (auto query : queries) {
+ *   breadth_first_search(g, query.sources, ws);
+ *   for (auto vid : ws.visited().members()) { ... }
+ * }
+ * ```
+ */
+template <index_adjacency_list G, std::ranges::input_range Sources, std::integral VId, class Distance,
+          class Visitor = empty_visitor>
+requires std::convertible_to<std::ranges::range_value_t<Sources>, vertex_id_t<G>>
+void breadth_first_search(G&&                                 g,
+                          const Sources&                      sources,
+                          traversal_workspace<VId, Distance>& workspace,
+                          Visitor&&                           visitor = empty_visitor()) {
+  static_assert(valid_visitor<G, Visitor>,
+                "Visitor has no recognized on_* callbacks. Check for a misspelled event name "
+                "(e.g. on_discover_vertx), or pass graph::empty_visitor{} for no callbacks.");
+  using id_type = vertex_id_t<G>;
+
+  auto& visited = workspace.begin_search(static_cast<size_t>(num_vertices(g)));
+
+  for (auto&& seed_id : sources) {
+    const id_type uid = static_cast<id_type>(seed_id);
+    if (!visited.insert(static_cast<VId>(uid)))
+      continue;
+    if constexpr (has_on_initialize_vertex<G, Visitor>) {
+      visitor.on_initialize_vertex(g, *find_vertex(g, uid));
+    } else if constexpr (has_on_initialize_vertex_id<G, Visitor>) {
+      visitor.on_initialize_vertex(g, uid);
+    }
+    if constexpr (has_on_discover_vertex<G, Visitor>) {
+      visitor.on_discover_vertex(g, *find_vertex(g, uid));
+    } else if constexpr (has_on_discover_vertex_id<G, Visitor>) {
+      visitor.on_discover_vertex(g, uid);
+    }
+  }
+
+  // The members of the visited set, in insertion order, are the queue
+  for (size_t head = 0; head < visited.size(); ++head) {
+    const id_type uid = static_cast<id_type>(visited.members()[head]);
+
+    if constexpr (has_on_examine_vertex<G, Visitor>) {
+      visitor.on_examine_vertex(g, *find_vertex(g, uid));
+    } else if constexpr (has_on_examine_vertex_id<G, Visitor>) {
+      visitor.on_examine_vertex(g, uid);
+    }
+
+    for (auto&& [vid, uv] : views::incidence(g, *find_vertex(g, uid))) {
+      if constexpr (has_on_examine_edge<G, Visitor>) {
+        visitor.on_examine_edge(g, uv);
+      }
+      if (visited.insert(static_cast<VId>(vid))) {
+        if constexpr (has_on_discover_vertex<G, Visitor>) {
+          visitor.on_discover_vertex(g, *find_vertex(g, vid));
+        } else if constexpr (has_on_discover_vertex_id<G, Visitor>) {
+          visitor.on_discover_vertex(g, vid);
+        }
+      }
+    }
+
+    if constexpr (has_on_finish_vertex<G, Visitor>) {
+      visitor.on_finish_vertex(g, *find_vertex(g, uid));
+    } else if constexpr (has_on_finish_vertex_id<G, Visitor>) {
+      visitor.on_finish_vertex(g, uid);
+    }
+  }
+}
+
+/**
+ * @brief Single-source breadth-first search reusing a traversal_workspace.
+ *
+ * @see breadth_first_search(G&&, const Sources&, traversal_workspace<VId, Distance>&, Visitor&&)
+ */
+template <index_adjacency_list G, std::integral VId, class Distance, class Visitor = empty_visitor>
+void breadth_first_search(G&&                                 g,
+                          const vertex_id_t<G>&               start_vertex_id,
+                          traversal_workspace<VId, Distance>& workspace,
+                          Visitor&&                           visitor = empty_visitor()) {
+  std::array<vertex_id_t<G>, 1> sources{start_vertex_id};
+  breadth_first_search(std::forward<G>(g), sources, workspace, std::forward<Visitor>(visitor));
+}
+
 } // namespace graph
 
 #endif // GRAPH_BREADTH_FIRST_SEARCH_HPP
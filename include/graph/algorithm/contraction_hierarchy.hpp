@@ -0,0 +1,760 @@
+/**
+ * @file contraction_hierarchy.hpp
+ *
+ * @brief Contraction hierarchies: preprocessing for microsecond point-to-point shortest path
+ *        queries on road networks.
+ *
+ * Geisberger, Sanders, Schultes and Delling, "Contraction Hierarchies: Faster and Simpler
+ * Hierarchical Routing in Road Networks" (WEA 2008). Preprocessing removes ("contracts") the
+ * vertices one at a time in an order of increasing importance. Contracting v adds a shortcut
+ * u -> w of weight w(u, v) + w(v, w) for every pair of in-neighbour u and out-neighbour w whose
+ * shortest connection runs through v, so the distances between the remaining vertices do not
+ * change. A witness search (a Dijkstra from u that avoids v) finds the pairs that have another
+ * path at most as short; they get no shortcut. The search gives up after a fixed number of
+ * settled vertices, which may add superfluous shortcuts but never drops a needed one.
+ *
+ * Every shortest path of the graph then has a shortest path of the same length in the graph plus
+ * shortcuts whose vertices first go up in the order and then down. A query runs Dijkstra upward
+ * from the source on the upward graph and upward from the target on the reversed downward graph
+ * and takes the best meeting vertex. On road networks both searches settle a few hundred
+ * vertices, independent of the distance between source and target.
+ *
+ * Node ordering and contraction run in rounds on a thread_pool, after Vetter, "Parallel Time-
+ * Dependent Contraction Hierarchies" (2009):
+ *
+ * 1. The priority of every vertex whose neighbourhood changed is recomputed in parallel by
+ *    simulating its contraction: 4 * (shortcuts added - arcs removed) + contracted neighbours +
+ *    level (an upper bound on its search depth).
+ * 2. The vertices whose priority is smaller than that of all their neighbours form an independent
+ *    set. They are contracted together, in parallel. A witness through another vertex of the set
+ *    must be strictly shorter, so two contractions never rely on each other's witnesses.
+ * 3. The shortcuts are merged into the remaining graph in parallel, grouped by endpoint.
+ *
+ * Ties are broken by a hash of the vertex id and nothing depends on the schedule, so the order
+ * and the shortcuts are the same for any number of threads.
+ *
+ * The result is stored as two compressed_graph instances over the original vertex ids:
+ *
+ * - upward()   : row u holds the arcs u -> v with rank(v) > rank(u)
+ * - downward() : row v holds, reversed, the arcs u -> v with rank(u) > rank(v)
+ *
+ * Each arc carries its weight and, for a shortcut, the contracted vertex it bypasses, which is
+ * how ch_query unpacks a shortcut into the original path. See io/contraction_hierarchy.hpp to
+ * save a hierarchy to disk and load it back.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/traversal_common.hpp"
+#include "graph/algorithm/traversal_workspace.hpp"
+#include "graph/container/compressed_graph.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef GRAPH_CONTRACTION_HIERARCHY_HPP
+#  define GRAPH_CONTRACTION_HIERARCHY_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::edge_t;
+using adj_list::num_vertices;
+using adj_list::find_vertex;
+using adj_list::edges;
+using adj_list::target_id;
+
+/// Value of an arc of a contraction hierarchy.
+template <class Distance, std::integral VId>
+struct ch_edge {
+  Distance weight{};
+  VId      middle{}; ///< The vertex a shortcut bypasses, or std::numeric_limits<VId>::max() for an original arc
+};
+
+/// Tuning parameters of build_contraction_hierarchy.
+struct ch_build_options {
+  /// Vertices a witness search may settle before giving up and keeping the shortcut. Smaller
+  /// limits contract faster and add more shortcuts.
+  size_t witness_settle_limit = 500;
+
+  /// The same limit for the simulated contractions that rank the vertices. They run several
+  /// times per vertex, so this limit dominates the preprocessing time.
+  size_t priority_settle_limit = 50;
+};
+
+/**
+ * @brief A contraction hierarchy: the vertex order and the upward and downward graphs.
+ *
+ * Built by build_contraction_hierarchy, queried through ch_query. See the file comment.
+ *
+ * @tparam Distance Edge weight and distance type
+ * @tparam VId      Vertex id type
+ * @tparam EIndex   Edge index type of the two graphs
+ */
+template <class Distance, std::integral VId = uint32_t, std::integral EIndex = uint32_t>
+class contraction_hierarchy {
+public:
+  using distance_type   = Distance;
+  using vertex_id_type  = VId;
+  using edge_index_type = EIndex;
+  using edge_value_type = ch_edge<Distance, VId>;
+  using graph_type      = container::compressed_graph<edge_value_type, void, void, VId, EIndex>;
+
+  /// middle of an arc that is not a shortcut
+  static constexpr VId no_middle = std::numeric_limits<VId>::max();
+
+  contraction_hierarchy() = default;
+
+  /**
+   * @brief Assembles a hierarchy from its parts.
+   * @throws graph_error if the graphs and the ranks do not cover the same number of vertices,
+   *         the ranks are not a permutation, or a shortcut's middle vertex is out of range or
+   *         does not rank below both ends of the shortcut.
+   */
+  contraction_hierarchy(graph_type upward, graph_type downward, std::vector<VId> rank)
+        : upward_(std::move(upward)), downward_(std::move(downward)), rank_(std::move(rank)) {
+    const size_t n = rank_.size();
+    if (upward_.size() != n || downward_.size() != n)
+      throw graph_error(std::format("contraction_hierarchy: {} ranks for graphs of {} and {} vertices", n,
+                                    upward_.size(), downward_.size()));
+    std::vector<bool> seen(n);
+    for (VId r : rank_) {
+      if (static_cast<size_t>(r) >= n || seen[static_cast<size_t>(r)])
+        throw graph_error("contraction_hierarchy: the ranks are not a permutation");
+      seen[static_cast<size_t>(r)] = true;
+    }
+    // A middle ranked below both ends makes every unpacking step lower the arc's smaller rank,
+    // so ch_query::unpack ends; any other middle could send it round a cycle
+    for (const graph_type* g : {&upward_, &downward_})
+      for (VId u : g->vertex_ids())
+        for (EIndex eid : g->edge_ids(u)) {
+          const VId m = g->edge_value(eid).middle;
+          if (m == no_middle)
+            continue;
+          const VId v = g->target_id(eid);
+          if (static_cast<size_t>(m) >= n)
+            throw graph_error(std::format("contraction_hierarchy: shortcut middle vertex {} out of range", m));
+          if (rank_[m] >= std::min(rank_[u], rank_[v]))
+            throw graph_error(std::format(
+                  "contraction_hierarchy: shortcut {} - {} has middle vertex {}, which does not rank below both ends",
+                  u, v, m));
+          ++num_shortcuts_;
+        }
+  }
+
+  [[nodiscard]] size_t num_vertices() const noexcept { return rank_.size(); }
+
+  /// Row u: the arcs u -> v with rank(v) > rank(u).
+  [[nodiscard]] const graph_type& upward() const noexcept { return upward_; }
+
+  /// Row v: the arcs u -> v with rank(u) > rank(v), stored as v -> u.
+  [[nodiscard]] const graph_type& downward() const noexcept { return downward_; }
+
+  /// rank()[u]: the position of u in the contraction order.
+  [[nodiscard]] std::span<const VId> rank() const noexcept { return rank_; }
+
+  /// The number of shortcut arcs in upward() and downward().
+  [[nodiscard]] size_t num_shortcuts() const noexcept { return num_shortcuts_; }
+
+private:
+  graph_type       upward_;
+  graph_type       downward_;
+  std::vector<VId> rank_;
+  size_t           num_shortcuts_ = 0;
+};
+
+namespace detail {
+  /// Arc of the graph being contracted; other is the head of an out-arc or the tail of an in-arc
+  template <class Distance, class VId>
+  struct ch_arc {
+    VId      other;
+    Distance weight;
+    VId      middle;
+  };
+
+  template <class Distance, class VId>
+  struct ch_shortcut {
+    VId      from;
+    VId      to;
+    Distance weight;
+    VId      middle;
+  };
+
+  /// Witness search label. clean: a shortest path found so far avoids the vertices being
+  /// contracted in the same round.
+  template <class Distance>
+  struct ch_witness_label {
+    Distance dist  = infinite_distance<Distance>();
+    bool     clean = false;
+  };
+
+  /// Per-thread scratch of the witness searches
+  template <class Distance, class VId>
+  struct ch_witness_workspace {
+    epoch_vertex_map<ch_witness_label<Distance>, VId> dist;
+    epoch_vertex_set<VId>                             targets;
+    std::vector<std::pair<Distance, VId>>             heap;
+    std::vector<ch_shortcut<Distance, VId>>           shortcuts;
+  };
+
+  /// Tie-breaker of equal priorities: a bijective mix of the id, so that ties do not follow the
+  /// id order (which on a grid would contract whole rows first)
+  inline uint64_t ch_tie_hash(uint64_t x) noexcept {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+  }
+
+  /// Replaces the arc to `other` in `arcs` if the new weight is smaller, or appends it.
+  template <class Distance, class VId>
+  void ch_upsert(std::vector<ch_arc<Distance, VId>>& arcs, VId other, Distance weight, VId middle) {
+    for (auto& a : arcs) {
+      if (a.other == other) {
+        if (weight < a.weight) {
+          a.weight = weight;
+          a.middle = middle;
+        }
+        return;
+      }
+    }
+    arcs.push_back({other, weight, middle});
+  }
+
+  /// Node ordering and contraction; see the file comment.
+  template <class Distance, class VId>
+  class ch_builder {
+  public:
+    using arc_type      = ch_arc<Distance, VId>;
+    using shortcut_type = ch_shortcut<Distance, VId>;
+    using workspace     = ch_witness_workspace<Distance, VId>;
+    using final_edge    = copyable_edge_t<VId, ch_edge<Distance, VId>>;
+
+    static constexpr VId no_middle = std::numeric_limits<VId>::max();
+
+    ch_builder(size_t n, const ch_build_options& options, thread_pool& pool)
+          : n_(n), options_(options), pool_(pool), out_(n), in_(n), contracted_(n, 0), rank_(n), priority_(n, 0),
+            deleted_(n, 0), level_(n, 0), ws_(pool.size()) {}
+
+    std::vector<std::vector<arc_type>>& out_arcs() noexcept { return out_; }
+    std::vector<std::vector<arc_type>>& in_arcs() noexcept { return in_; }
+
+    /// Contracts every vertex. out_arcs() must hold each vertex's out-arcs, without self-loops and
+    /// with one arc per head; the in-arcs are derived from them.
+    void run() {
+      for (size_t u = 0; u < n_; ++u)
+        for (const auto& a : out_[u])
+          in_[static_cast<size_t>(a.other)].push_back({static_cast<VId>(u), a.weight, a.middle});
+
+      std::vector<VId> remaining(n_);
+      for (size_t u = 0; u < n_; ++u)
+        remaining[u] = static_cast<VId>(u);
+      update_priorities(remaining);
+
+      std::vector<std::vector<VId>> local(pool_.size());
+      std::vector<VId>              round, touched;
+      std::vector<uint8_t>          mark(n_, 0);
+      VId                           next_rank = 0;
+      while (!remaining.empty()) {
+        // 1. The independent set of local priority minima
+        pool_.for_each_chunk(remaining.size(), [&](size_t first, size_t last, size_t tid) {
+          for (size_t i = first; i < last; ++i)
+            if (is_local_minimum(remaining[i]))
+              local[tid].push_back(remaining[i]);
+        });
+        round.clear();
+        for (auto& l : local) {
+          round.insert(round.end(), l.begin(), l.end());
+          l.clear();
+        }
+        std::ranges::sort(round);
+        for (VId v : round) {
+          contracted_[static_cast<size_t>(v)] = 1;
+          rank_[static_cast<size_t>(v)]       = next_rank++;
+        }
+
+        // 2. Contract them
+        std::vector<std::vector<shortcut_type>> added(round.size());
+        pool_.for_each_index(round.size(), [&](size_t i, size_t tid) {
+          find_shortcuts(round[i], options_.witness_settle_limit, ws_[tid]);
+          added[i] = ws_[tid].shortcuts;
+        }, 1);
+
+        // 3. Their arcs are final; merge the shortcuts into their neighbours' arcs
+        touched.clear();
+        for (VId v : round) {
+          const size_t vi = static_cast<size_t>(v);
+          for (const auto& a : out_[vi]) {
+            up_.push_back({v, a.other, {a.weight, a.middle}});
+            if (!std::exchange(mark[static_cast<size_t>(a.other)], 1))
+              touched.push_back(a.other);
+          }
+          for (const auto& a : in_[vi]) {
+            down_.push_back({v, a.other, {a.weight, a.middle}});
+            if (!std::exchange(mark[static_cast<size_t>(a.other)], 1))
+              touched.push_back(a.other);
+          }
+        }
+        merge(added, touched);
+        for (VId v : round) {
+          std::vector<arc_type>().swap(out_[static_cast<size_t>(v)]);
+          std::vector<arc_type>().swap(in_[static_cast<size_t>(v)]);
+        }
+        for (VId x : touched)
+          mark[static_cast<size_t>(x)] = 0;
+
+        std::erase_if(remaining, [&](VId v) { return contracted_[static_cast<size_t>(v)] != 0; });
+        update_priorities(touched);
+      }
+    }
+
+    std::vector<final_edge>& upward_edges() noexcept { return up_; }
+    std::vector<final_edge>& downward_edges() noexcept { return down_; }
+    std::vector<VId>&        rank() noexcept { return rank_; }
+
+  private:
+    using key_type = std::tuple<int64_t, uint64_t, VId>;
+
+    key_type key(VId v) const noexcept {
+      return {priority_[static_cast<size_t>(v)], ch_tie_hash(static_cast<uint64_t>(v)), v};
+    }
+
+    bool is_local_minimum(VId v) const {
+      const key_type kv = key(v);
+      for (const auto& a : out_[static_cast<size_t>(v)])
+        if (!(kv < key(a.other)))
+          return false;
+      for (const auto& a : in_[static_cast<size_t>(v)])
+        if (!(kv < key(a.other)))
+          return false;
+      return true;
+    }
+
+    // Dijkstra from `from` over the uncontracted vertices other than skip, until every vertex of
+    // ws.targets is settled, the smallest key exceeds max_dist or the settle limit is reached.
+    // The labels stay in ws.dist.
+    //
+    // The search may pass through the other vertices contracted in the same round (marked in
+    // contracted_ but still linked), but such a path only counts as a witness if it is strictly
+    // shorter. An equally short one could itself run through a vertex whose witness runs through
+    // this one, and neither would get its shortcut.
+    void witness_search(VId from, VId skip, Distance max_dist, size_t limit, workspace& ws) const {
+      constexpr auto later = [](const auto& a, const auto& b) { return a.first > b.first; };
+      ws.dist.clear(n_, {});
+      ws.heap.clear();
+      ws.dist[from] = {Distance{}, true};
+      ws.heap.emplace_back(Distance{}, from);
+      size_t settled = 0, left = ws.targets.size();
+      while (!ws.heap.empty()) {
+        std::ranges::pop_heap(ws.heap, later);
+        const auto [d, x] = ws.heap.back();
+        ws.heap.pop_back();
+        const auto lx = ws.dist.get(x);
+        if (lx.dist < d)
+          continue;
+        if (max_dist < d || ++settled > limit)
+          break;
+        if (ws.targets.contains(x) && --left == 0)
+          break;
+        for (const auto& a : out_[static_cast<size_t>(x)]) {
+          if (a.other == skip)
+            continue;
+          const Distance nd    = d + a.weight;
+          const bool     clean = lx.clean && !contracted_[static_cast<size_t>(a.other)];
+          auto&          ly    = ws.dist[a.other];
+          if (nd < ly.dist) {
+            ly = {nd, clean};
+            ws.heap.emplace_back(nd, a.other);
+            std::ranges::push_heap(ws.heap, later);
+          } else if (clean && nd == ly.dist) {
+            ly.clean = true;
+          }
+        }
+      }
+    }
+
+    // The shortcuts that contracting v needs, in ws.shortcuts
+    void find_shortcuts(VId v, size_t limit, workspace& ws) const {
+      ws.shortcuts.clear();
+      const auto& outs = out_[static_cast<size_t>(v)];
+      for (const auto& in : in_[static_cast<size_t>(v)]) {
+        const VId u        = in.other;
+        Distance  max_dist = Distance{};
+        ws.targets.clear(n_);
+        for (const auto& out : outs) {
+          if (out.other != u) {
+            max_dist = std::max(max_dist, in.weight + out.weight);
+            ws.targets.insert(out.other);
+          }
+        }
+        if (ws.targets.empty())
+          continue;
+        witness_search(u, v, max_dist, limit, ws);
+        for (const auto& out : outs) {
+          if (out.other == u)
+            continue;
+          const Distance via     = in.weight + out.weight;
+          const auto&    witness = ws.dist.get(out.other);
+          if (via < witness.dist || (via == witness.dist && !witness.clean))
+            ws.shortcuts.push_back({u, out.other, via, v});
+        }
+      }
+    }
+
+    void update_priorities(const std::vector<VId>& vertices) {
+      pool_.for_each_index(vertices.size(), [&](size_t i, size_t tid) {
+        const VId    v  = vertices[i];
+        const size_t vi = static_cast<size_t>(v);
+        find_shortcuts(v, options_.priority_settle_limit, ws_[tid]);
+        const auto added   = static_cast<int64_t>(ws_[tid].shortcuts.size());
+        const auto removed = static_cast<int64_t>(out_[vi].size() + in_[vi].size());
+        priority_[vi] = 4 * (added - removed) + static_cast<int64_t>(deleted_[vi]) + static_cast<int64_t>(level_[vi]);
+      });
+    }
+
+    // Drops the arcs to the contracted vertices from the touched vertices and adds the shortcuts,
+    // each touched vertex by one worker
+    void merge(const std::vector<std::vector<shortcut_type>>& added, const std::vector<VId>& touched) {
+      std::vector<shortcut_type> by_from;
+      for (const auto& s : added)
+        by_from.insert(by_from.end(), s.begin(), s.end());
+      std::vector<shortcut_type> by_to = by_from;
+      std::ranges::stable_sort(by_from, {}, &shortcut_type::from);
+      std::ranges::stable_sort(by_to, {}, &shortcut_type::to);
+
+      pool_.for_each_index(touched.size(), [&](size_t i, size_t) {
+        const VId    x  = touched[i];
+        const size_t xi = static_cast<size_t>(x);
+        auto         drop = [&](std::vector<arc_type>& arcs) {
+          std::erase_if(arcs, [&](const arc_type& a) {
+            const size_t o = static_cast<size_t>(a.other);
+            if (!contracted_[o])
+              return false;
+            ++deleted_[xi];
+            level_[xi] = std::max(level_[xi], level_[o] + 1);
+            return true;
+          });
+        };
+        drop(out_[xi]);
+        drop(in_[xi]);
+        for (const auto& s : std::ranges::equal_range(by_from, x, {}, &shortcut_type::from))
+          ch_upsert(out_[xi], s.to, s.weight, s.middle);
+        for (const auto& s : std::ranges::equal_range(by_to, x, {}, &shortcut_type::to))
+          ch_upsert(in_[xi], s.from, s.weight, s.middle);
+      });
+    }
+
+    size_t                             n_;
+    ch_build_options                   options_;
+    thread_pool&                       pool_;
+    std::vector<std::vector<arc_type>> out_;
+    std::vector<std::vector<arc_type>> in_;
+    std::vector<uint8_t>               contracted_;
+    std::vector<VId>                   rank_;
+    std::vector<int64_t>               priority_;
+    std::vector<uint32_t>              deleted_;
+    std::vector<uint32_t>              level_;
+    std::vector<workspace>             ws_;
+    std::vector<final_edge>            up_;
+    std::vector<final_edge>            down_;
+  };
+} // namespace detail
+
+/**
+ * @brief Builds the contraction hierarchy of a graph with non-negative edge weights.
+ *
+ * Parallel edges keep the smallest weight and self-loops are dropped; neither changes any
+ * distance. The graph is read once, into a private copy that is contracted.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * compressed_graph<int64_t, void, void, uint32_t, uint32_t> g;
+ * io::load_dimacs_file(g, "USA-road-d.NY.gr");
+ * auto ch = build_contraction_hierarchy(g, [](const auto& g, const auto& uv) { return edge_value(g, uv); });
+ *
+ * ch_query q(ch);                     // one per thread
+ * int64_t d = q.distance(s, t);
+ * ```
+ *
+ * @tparam EIndex Edge index type of the hierarchy's graphs
+ *
+ * @param g       The graph
+ * @param weight  Edge weight function, weight(g, uv)
+ * @param options Witness search limit
+ * @param pool    Thread pool for the ordering and contraction
+ *
+ * @return contraction_hierarchy<Distance, vertex_id_t<G>, EIndex>, where Distance is the
+ *         weight function's result type.
+ *
+ * **Complexity:** Depends on the graph. Road networks need about as many shortcuts as edges;
+ * graphs with dense, well-connected cores (social networks, random graphs) need far more.
+ *
+ * @throws std::out_of_range if a negative edge weight is found (signed weight types only)
+ * @throws graph_error if the hierarchy has more arcs than EIndex can index
+ */
+template <std::integral EIndex = uint32_t, index_adjacency_list G, class WF>
+requires edge_weight_function<G, WF, std::remove_cvref_t<std::invoke_result_t<WF, const std::remove_reference_t<G>&, edge_t<G>>>>
+[[nodiscard]] auto build_contraction_hierarchy(G&&                     g,
+                                               WF&&                    weight,
+                                               const ch_build_options& options = {},
+                                               thread_pool&            pool    = default_thread_pool()) {
+  using graph_type    = std::remove_reference_t<G>;
+  using id_type       = vertex_id_t<graph_type>;
+  using distance_type = std::remove_cvref_t<std::invoke_result_t<WF, const graph_type&, edge_t<graph_type>>>;
+  using arc_type      = detail::ch_arc<distance_type, id_type>;
+  using result_type   = contraction_hierarchy<distance_type, id_type, EIndex>;
+  constexpr id_type no_middle = result_type::no_middle;
+
+  const size_t                               n = static_cast<size_t>(num_vertices(g));
+  detail::ch_builder<distance_type, id_type> builder(n, options, pool);
+
+  // One arc per head, with the smallest weight
+  auto& out = builder.out_arcs();
+  pool.for_each_index(n, [&](size_t uid, size_t) {
+    auto& arcs = out[uid];
+    for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(uid)))) {
+      const id_type       vid = static_cast<id_type>(target_id(g, uv));
+      const distance_type w   = static_cast<distance_type>(weight(g, uv));
+      if constexpr (std::is_signed_v<distance_type>) {
+        if (w < distance_type{})
+          throw std::out_of_range(
+                std::format("build_contraction_hierarchy: invalid negative edge weight of '{}' encountered", w));
+      }
+      if (static_cast<size_t>(vid) != uid)
+        arcs.push_back({vid, w, no_middle});
+    }
+    std::ranges::sort(arcs, [](const arc_type& a, const arc_type& b) {
+      return a.other < b.other || (a.other == b.other && a.weight < b.weight);
+    });
+    const auto dup = std::ranges::unique(arcs, {}, &arc_type::other);
+    arcs.erase(dup.begin(), dup.end());
+  });
+
+  builder.run();
+
+  typename result_type::graph_type upward, downward;
+  const container::csr_build_options sorted{.sort_targets = true};
+  upward.load_unsorted_edges(builder.upward_edges(), std::identity{}, n, sorted, pool);
+  downward.load_unsorted_edges(builder.downward_edges(), std::identity{}, n, sorted, pool);
+  return result_type(std::move(upward), std::move(downward), std::move(builder.rank()));
+}
+
+/**
+ * @brief Point-to-point queries on a contraction_hierarchy.
+ *
+ * Holds the search state, reset in O(1) between queries, so a query costs only the vertices it
+ * settles. A ch_query is not thread-safe; use one per thread. The hierarchy must outlive it.
+ *
+ * The forward search from the source runs on upward() and the backward search from the target
+ * on downward(), each advancing while its smallest key is below the best meeting distance. A
+ * vertex reached more cheaply from a higher vertex (an arc of the other graph) is not expanded
+ * ("stall-on-demand").
+ */
+template <class Distance, std::integral VId = uint32_t, std::integral EIndex = uint32_t>
+class ch_query {
+public:
+  using hierarchy_type = contraction_hierarchy<Distance, VId, EIndex>;
+  using distance_type  = Distance;
+  using vertex_id_type = VId;
+
+  explicit ch_query(const hierarchy_type& ch) : ch_(&ch) {}
+
+  /**
+   * @brief The shortest distance from source to target, or infinite_distance() if unreachable.
+   * @throws std::out_of_range if source or target is out of range.
+   */
+  [[nodiscard]] Distance distance(VId source_vid, VId target_vid) {
+    search(source_vid, target_vid);
+    return best_;
+  }
+
+  /**
+   * @brief The shortest distance from source to target; path receives the vertices of a
+   *        shortest path in the original graph, source first and target last.
+   *
+   * path is left empty if target is unreachable.
+   *
+   * @throws std::out_of_range if source or target is out of range.
+   */
+  Distance shortest_path(VId source_vid, VId target_vid, std::vector<VId>& path) {
+    search(source_vid, target_vid);
+    path.clear();
+    if (best_ == infinite_distance<Distance>())
+      return best_;
+
+    // Forward arcs from the meeting vertex back to the source, then in source-to-meet order
+    hops_.clear();
+    for (VId v = meet_; v != source_vid;) {
+      const label& l = forward_.get(v);
+      hops_.push_back({l.parent, v, ch_->upward().edge_value(l.edge).middle});
+      v = l.parent;
+    }
+    std::ranges::reverse(hops_);
+    // Backward arcs from the meeting vertex to the target
+    for (VId v = meet_; v != target_vid;) {
+      const label& l = backward_.get(v);
+      hops_.push_back({v, l.parent, ch_->downward().edge_value(l.edge).middle});
+      v = l.parent;
+    }
+
+    path.push_back(source_vid);
+    for (const auto& h : hops_)
+      unpack(h, path);
+    return best_;
+  }
+
+  /// Vertices settled by the last query, in both directions.
+  [[nodiscard]] size_t settled() const noexcept { return settled_; }
+
+private:
+  static constexpr VId no_middle = hierarchy_type::no_middle;
+
+  struct label {
+    Distance dist   = infinite_distance<Distance>();
+    VId      parent = 0;
+    EIndex   edge   = 0;
+  };
+  struct hop {
+    VId from;
+    VId to;
+    VId middle;
+  };
+  using heap_type = std::vector<std::pair<Distance, VId>>;
+
+  static constexpr auto later = [](const auto& a, const auto& b) { return a.first > b.first; };
+
+  void search(VId source_vid, VId target_vid) {
+    const size_t n = ch_->num_vertices();
+    if (static_cast<size_t>(source_vid) >= n)
+      throw std::out_of_range(std::format("ch_query: source vertex id '{}' is out of range", source_vid));
+    if (static_cast<size_t>(target_vid) >= n)
+      throw std::out_of_range(std::format("ch_query: target vertex id '{}' is out of range", target_vid));
+
+    forward_.clear(n, label{});
+    backward_.clear(n, label{});
+    fheap_.clear();
+    bheap_.clear();
+    settled_ = 0;
+    best_    = infinite_distance<Distance>();
+    meet_    = source_vid;
+
+    forward_[source_vid].dist = Distance{};
+    fheap_.emplace_back(Distance{}, source_vid);
+    backward_[target_vid].dist = Distance{};
+    bheap_.emplace_back(Distance{}, target_vid);
+
+    for (;;) {
+      const bool f = !fheap_.empty() && fheap_.front().first < best_;
+      const bool b = !bheap_.empty() && bheap_.front().first < best_;
+      if (!f && !b)
+        break;
+      if (f && (!b || !(bheap_.front().first < fheap_.front().first)))
+        step(fheap_, forward_, backward_, ch_->upward(), ch_->downward());
+      else
+        step(bheap_, backward_, forward_, ch_->downward(), ch_->upward());
+    }
+  }
+
+  // Settles the top of one search: connects it with the other search, then relaxes its arcs
+  // in `graph` unless an arc of `opposite` shows a shorter path to it
+  void step(heap_type&                               heap,
+            epoch_vertex_map<label, VId>&            mine,
+            const epoch_vertex_map<label, VId>&      other,
+            const typename hierarchy_type::graph_type& graph,
+            const typename hierarchy_type::graph_type& opposite) {
+    std::ranges::pop_heap(heap, later);
+    const auto [d, u] = heap.back();
+    heap.pop_back();
+    if (mine.get(u).dist < d)
+      return;
+    ++settled_;
+
+    const Distance back = other.get(u).dist;
+    if (back != infinite_distance<Distance>() && d + back < best_) {
+      best_ = d + back;
+      meet_ = u;
+    }
+
+    for (auto eid : opposite.edge_ids(u)) {
+      const Distance via = mine.get(opposite.target_id(eid)).dist;
+      if (via != infinite_distance<Distance>() && via + opposite.edge_value(eid).weight < d)
+        return;
+    }
+    for (auto eid : graph.edge_ids(u)) {
+      const VId      v  = graph.target_id(eid);
+      const Distance nd = d + graph.edge_value(eid).weight;
+      if (nd < mine.get(v).dist) {
+        mine[v] = {nd, u, static_cast<EIndex>(eid)};
+        heap.emplace_back(nd, v);
+        std::ranges::push_heap(heap, later);
+      }
+    }
+  }
+
+  // The middle of the arc in row `row` of g whose head is `to`; the rows are sorted by head
+  static VId middle_of(const typename hierarchy_type::graph_type& g, VId row, VId to) {
+    const auto heads = g.target_ids(row);
+    const auto it    = std::ranges::lower_bound(heads, to);
+    if (it == heads.end() || *it != to)
+      return no_middle; // not reached for a well-formed hierarchy
+    return g.edge_value(*g.edge_ids(row).begin() + static_cast<EIndex>(it - heads.begin())).middle;
+  }
+
+  // Appends the original vertices of an arc after its tail. A shortcut from -> to via m splits
+  // into from -> m, stored reversed in the downward row of m, and m -> to, in its upward row.
+  void unpack(const hop& h, std::vector<VId>& path) {
+    stack_.clear();
+    stack_.push_back(h);
+    while (!stack_.empty()) {
+      const hop top = stack_.back();
+      stack_.pop_back();
+      if (top.middle == no_middle) {
+        path.push_back(top.to);
+        continue;
+      }
+      const VId m = top.middle;
+      stack_.push_back({m, top.to, middle_of(ch_->upward(), m, top.to)});
+      stack_.push_back({top.from, m, middle_of(ch_->downward(), m, top.from)});
+    }
+  }
+
+  const hierarchy_type*        ch_;
+  epoch_vertex_map<label, VId> forward_;
+  epoch_vertex_map<label, VId> backward_;
+  heap_type                    fheap_;
+  heap_type                    bheap_;
+  std::vector<hop>             hops_;
+  std::vector<hop>             stack_;
+  Distance                     best_    = infinite_distance<Distance>();
+  VId                          meet_    = 0;
+  size_t                       settled_ = 0;
+};
+
+template <class Distance, class VId, class EIndex>
+ch_query(const contraction_hierarchy<Distance, VId, EIndex>&) -> ch_query<Distance, VId, EIndex>;
+
+} // namespace graph
+
+#endif // GRAPH_CONTRACTION_HIERARCHY_HPP
@@ -14,10 +14,13 @@
 
 #include "graph/graph.hpp"
 #include "graph/algorithm/traversal_common.hpp"
+#include "graph/algorithm/traversal_workspace.hpp"
 #include "graph/adj_list/vertex_property_map.hpp"
 #include "graph/detail/indexed_dary_heap.hpp"
 #include "graph/detail/heap_position_map.hpp"
+#include "graph/detail/radix_heap.hpp"
 
+#include <algorithm>
 #include <queue>
 #include <ranges>
 #include <format>
@@ -62,6 +65,62 @@ struct use_indexed_dary_heap {
   static constexpr std::size_t arity = Arity;
 };
 
+/**
+ * @brief Heap-selector tag: use a radix heap over integer distances.
+ *
+ * A monotone priority queue (detail::radix_heap): push is O(1) and pop amortized
+ * O(log C) for maximum distance C, with bit operations in place of comparisons.
+ * Lazy deletion as in use_default_heap. Requires an integral distance type,
+ * non-negative weights and the default less/plus compare and combine, under
+ * which popped distances never decrease; another compare or combine is a
+ * compile-time error.
+ *
+ * Selected automatically by use_default_heap when the distance type is an
+ * unsigned integer and compare/combine are std::less/std::plus.
+ *
+ * Recommended for: integer weights of any size, e.g. road networks in metres
+ * or seconds.
+ */
+struct use_radix_heap {};
+
+/**
+ * @brief Heap-selector tag: use Dial's bucket queue over integer distances.
+ *
+ * A circular array of one bucket per distance value (detail::bucket_queue):
+ * push and pop are O(1) plus a scan over empty buckets bounded by the largest
+ * distance, so the total cost is O(E + V + C) for maximum distance C. Memory
+ * grows with the largest edge weight. Lazy deletion as in use_default_heap.
+ * Requires an integral distance type, non-negative weights and the default
+ * less/plus compare and combine; another compare or combine is a compile-time
+ * error.
+ *
+ * Recommended for: small integer weights (unit weights, hop counts, weights
+ * up to a few thousand).
+ */
+struct use_bucket_heap {};
+
+namespace detail {
+  /// True if Compare is std::less, the only order the integer queues (which always pop the
+  /// smallest key) can honour.
+  template <class Distance, class Compare>
+  inline constexpr bool integer_queue_compare_v = std::is_same_v<std::remove_cvref_t<Compare>, std::less<Distance>> ||
+                                                  std::is_same_v<std::remove_cvref_t<Compare>, std::less<>>;
+
+  /// True if Combine is std::plus, under which the keys of a search with non-negative weights
+  /// never decrease.
+  template <class Distance, class Combine>
+  inline constexpr bool integer_queue_combine_v = std::is_same_v<std::remove_cvref_t<Combine>, std::plus<Distance>> ||
+                                                  std::is_same_v<std::remove_cvref_t<Combine>, std::plus<>>;
+
+  /// True if use_default_heap selects the radix heap: unsigned integer distances ordered and
+  /// combined by std::less / std::plus, under which popped distances never decrease.
+  template <class Heap, class Distance, class Compare, class Combine>
+  inline constexpr bool auto_radix_heap_v =
+        std::is_same_v<Heap, use_default_heap> && std::is_unsigned_v<Distance> && std::is_integral_v<Distance> &&
+        !std::is_same_v<Distance, bool> && integer_queue_compare_v<Distance, Compare> &&
+        integer_queue_combine_v<Distance, Combine>;
+} // namespace detail
+
 // Import CPOs and types for use in algorithms
 using adj_list::vertices;
 using adj_list::num_vertices;
@@ -73,6 +132,7 @@ using adj_list::vertex_id;
 using adj_list::edge_t;
 using adj_list::adjacency_list;
 using adj_list::index_vertex_range;
+using adj_list::index_adjacency_list;
 
 /**
  * @brief Multi-source shortest paths using Dijkstra's algorithm.
@@ -292,115 +352,170 @@ constexpr void dijkstra_shortest_paths(
   // ---------------------------------------------------------------------
   // Heap-implementation dispatch.
   //
-  // - use_default_heap         : std::priority_queue with lazy deletion.
+  // - use_default_heap         : std::priority_queue with lazy deletion, or
+  //                              the radix heap for unsigned integer distances
+  //                              under std::less / std::plus.
+  // - use_radix_heap           : radix heap with lazy deletion.
+  // - use_bucket_heap          : Dial's bucket queue with lazy deletion.
   // - use_indexed_dary_heap<d> : indexed d-ary heap with true decrease-key
   //                              (heap size bounded by O(V)).
   //
-  // Both branches honour identical visitor semantics: on_examine_vertex and
+  // All branches honour identical visitor semantics: on_examine_vertex and
   // on_finish_vertex fire exactly once per reachable vertex; on_edge_relaxed
   // and on_edge_not_relaxed fire exactly once per outgoing edge of every
   // examined vertex.
   // ---------------------------------------------------------------------
-  if constexpr (std::is_same_v<Heap, use_default_heap>) {
+
+  // The monotone integer queues are also chosen for use_default_heap when the distances are
+  // unsigned integers ordered and combined by std::less / std::plus.
+  constexpr bool is_lazy_heap = std::is_same_v<Heap, use_default_heap> || std::is_same_v<Heap, use_radix_heap> ||
+                                std::is_same_v<Heap, use_bucket_heap>;
+  constexpr bool auto_radix_heap = detail::auto_radix_heap_v<Heap, distance_type, Compare, Combine>;
+
+  if constexpr (is_lazy_heap) {
     // -----------------------------------------------------------------
-    // std::priority_queue path (legacy / default).
+    // Lazy-deletion path: std::priority_queue (legacy / default), radix
+    // heap or bucket queue.
     //
-    // std::priority_queue lacks a decrease-key operation, so when a vertex's
+    // None of these queues has a decrease-key operation, so when a vertex's
     // distance improves we re-insert it (lazy deletion). The earlier entry
     // becomes stale and is skipped at pop time. This keeps the code simple
-    // but allows the heap to grow to O(E) entries in the worst case.
+    // but allows the queue to grow to O(E) entries in the worst case.
     // -----------------------------------------------------------------
     struct weighted_vertex {
       vertex_t<graph_type> vertex_desc = {};
       distance_type        weight      = distance_type();
     };
-    auto qcompare = [&compare](const weighted_vertex& a, const weighted_vertex& b) {
-      return compare(b.weight, a.weight); // min-heap: pop lowest weight first
-    };
-    using WVAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<weighted_vertex>;
-    using Queue = std::priority_queue<weighted_vertex, std::vector<weighted_vertex, WVAlloc>, decltype(qcompare)>;
-    Queue queue(qcompare, std::vector<weighted_vertex, WVAlloc>(WVAlloc(alloc)));
-
-    // Seed the queue with the initial vertice(s)
-    for (auto&& seed_id : sources) {
-      auto seed_it = find_vertex(g, seed_id);
-      if (seed_it == std::ranges::end(vertices(g))) {
-        throw std::out_of_range(std::format("dijkstra_shortest_paths: source vertex id '{}' is out of range", seed_id));
-      }
-      vertex_t<graph_type> seed = *seed_it;
 
-      distance(g, seed_id) = zero; // mark seed_id as discovered
-      queue.push({seed, zero});
-      if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
-        visitor.on_discover_vertex(g, seed);
-      } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
-        visitor.on_discover_vertex(g, seed_id);
-      }
-    }
+    // Seed + main loop, generic over the queue: push(weighted_vertex),
+    // pop() -> weighted_vertex of the smallest weight, empty().
+    auto run = [&](auto& queue) {
+      // Seed the queue with the initial vertice(s)
+      for (auto&& seed_id : sources) {
+        auto seed_it = find_vertex(g, seed_id);
+        if (seed_it == std::ranges::end(vertices(g))) {
+          throw std::out_of_range(std::format("dijkstra_shortest_paths: source vertex id '{}' is out of range", seed_id));
+        }
+        vertex_t<graph_type> seed = *seed_it;
 
-    // Main loop to process the queue
-    while (!queue.empty()) {
-      auto [u, w] = queue.top();
-      queue.pop();
-      const id_type uid = vertex_id(g, u);
-
-      // Skip stale queue entries: because std::priority_queue lacks decrease-key,
-      // we re-insert vertices when their distance is improved. The earlier (larger)
-      // entry is still in the heap and must be ignored when popped. This also
-      // ensures on_examine_vertex / on_finish_vertex fire exactly once per vertex,
-      // matching BGL visitor semantics.
-      if (compare(distance(g, uid), w)) {
-        continue;
+        distance(g, seed_id) = zero; // mark seed_id as discovered
+        queue.push({seed, zero});
+        if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
+          visitor.on_discover_vertex(g, seed);
+        } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
+          visitor.on_discover_vertex(g, seed_id);
+        }
       }
 
-      if constexpr (has_on_examine_vertex<graph_type, Visitor>) {
-        visitor.on_examine_vertex(g, u);
-      } else if constexpr (has_on_examine_vertex_id<graph_type, Visitor>) {
-        visitor.on_examine_vertex(g, uid);
-      }
+      // Main loop to process the queue
+      while (!queue.empty()) {
+        auto [u, w] = queue.pop();
+        const id_type uid = vertex_id(g, u);
 
-      // Process all outgoing edges from the current vertex
-      for (auto&& [vid, uv] : views::incidence(g, u)) {
-        if constexpr (has_on_examine_edge<graph_type, Visitor>) {
-          visitor.on_examine_edge(g, uv);
+        // Skip stale queue entries: because the queues lack decrease-key,
+        // we re-insert vertices when their distance is improved. The earlier (larger)
+        // entry is still in the heap and must be ignored when popped. This also
+        // ensures on_examine_vertex / on_finish_vertex fire exactly once per vertex,
+        // matching BGL visitor semantics.
+        if (compare(distance(g, uid), w)) {
+          continue;
         }
 
-        // Use the user-supplied comparator for "undiscovered" detection so that
-        // custom Compare orderings remain consistent (matches BGL's
-        // !distance_compare(neighbor_distance, infinity)).
-        const bool is_neighbor_undiscovered = !compare(distance(g, vid), infinite);
-        const bool was_edge_relaxed         = relax_target(uv, uid);
+        if constexpr (has_on_examine_vertex<graph_type, Visitor>) {
+          visitor.on_examine_vertex(g, u);
+        } else if constexpr (has_on_examine_vertex_id<graph_type, Visitor>) {
+          visitor.on_examine_vertex(g, uid);
+        }
 
-        if (was_edge_relaxed) {
-          if constexpr (has_on_edge_relaxed<graph_type, Visitor>) {
-            visitor.on_edge_relaxed(g, uv);
+        // Process all outgoing edges from the current vertex
+        for (auto&& [vid, uv] : views::incidence(g, u)) {
+          if constexpr (has_on_examine_edge<graph_type, Visitor>) {
+            visitor.on_examine_edge(g, uv);
           }
-          vertex_t<graph_type> v = target(g, uv);
-          if (is_neighbor_undiscovered) {
-            if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
-              visitor.on_discover_vertex(g, v);
-            } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
-              visitor.on_discover_vertex(g, vid);
+
+          // Use the user-supplied comparator for "undiscovered" detection so that
+          // custom Compare orderings remain consistent (matches BGL's
+          // !distance_compare(neighbor_distance, infinity)).
+          const bool is_neighbor_undiscovered = !compare(distance(g, vid), infinite);
+          const bool was_edge_relaxed         = relax_target(uv, uid);
+
+          if (was_edge_relaxed) {
+            if constexpr (has_on_edge_relaxed<graph_type, Visitor>) {
+              visitor.on_edge_relaxed(g, uv);
+            }
+            vertex_t<graph_type> v = target(g, uv);
+            if (is_neighbor_undiscovered) {
+              if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
+                visitor.on_discover_vertex(g, v);
+              } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
+                visitor.on_discover_vertex(g, vid);
+              }
+            }
+            queue.push({v, distance(g, vid)});
+          } else {
+            if constexpr (has_on_edge_not_relaxed<graph_type, Visitor>) {
+              visitor.on_edge_not_relaxed(g, uv);
             }
-          }
-          queue.push({v, distance(g, vid)});
-        } else {
-          if constexpr (has_on_edge_not_relaxed<graph_type, Visitor>) {
-            visitor.on_edge_not_relaxed(g, uv);
           }
         }
-      }
 
-      // The stale-pop skip at the top of the loop guarantees we only reach this
-      // point on the settled (final) pop of u, so on_examine_vertex and
-      // on_finish_vertex are each called exactly once per reachable vertex,
-      // matching BGL visitor semantics.
-      if constexpr (has_on_finish_vertex<graph_type, Visitor>) {
-        visitor.on_finish_vertex(g, u);
-      } else if constexpr (has_on_finish_vertex_id<graph_type, Visitor>) {
-        visitor.on_finish_vertex(g, uid);
-      }
-    } // while(!queue.empty())
+        // The stale-pop skip at the top of the loop guarantees we only reach this
+        // point on the settled (final) pop of u, so on_examine_vertex and
+        // on_finish_vertex are each called exactly once per reachable vertex,
+        // matching BGL visitor semantics.
+        if constexpr (has_on_finish_vertex<graph_type, Visitor>) {
+          visitor.on_finish_vertex(g, u);
+        } else if constexpr (has_on_finish_vertex_id<graph_type, Visitor>) {
+          visitor.on_finish_vertex(g, uid);
+        }
+      } // while(!queue.empty())
+    };
+
+    if constexpr (std::is_same_v<Heap, use_radix_heap> || std::is_same_v<Heap, use_bucket_heap> || auto_radix_heap) {
+      static_assert(std::is_integral_v<distance_type>,
+                    "use_radix_heap and use_bucket_heap require an integral distance type");
+      static_assert(detail::integer_queue_compare_v<distance_type, Compare> &&
+                          detail::integer_queue_combine_v<distance_type, Combine>,
+                    "use_radix_heap and use_bucket_heap require std::less compare and std::plus combine");
+      // Distances are non-negative (negative weights throw), so they map onto unsigned keys
+      using key_type   = std::make_unsigned_t<distance_type>;
+      using entry_type = std::pair<key_type, vertex_t<graph_type>>;
+      using KeyAlloc   = typename std::allocator_traits<Alloc>::template rebind_alloc<entry_type>;
+      using IntQueue   = std::conditional_t<std::is_same_v<Heap, use_bucket_heap>,
+                                            detail::bucket_queue<key_type, vertex_t<graph_type>, KeyAlloc>,
+                                            detail::radix_heap<key_type, vertex_t<graph_type>, KeyAlloc>>;
+      struct integer_queue {
+        IntQueue heap;
+        void push(const weighted_vertex& x) { heap.push(static_cast<key_type>(x.weight), x.vertex_desc); }
+        weighted_vertex pop() {
+          const auto& [key, u] = heap.top();
+          weighted_vertex x{u, static_cast<distance_type>(key)};
+          heap.pop();
+          return x;
+        }
+        bool empty() const noexcept { return heap.empty(); }
+      };
+      integer_queue queue{IntQueue(KeyAlloc(alloc))};
+      run(queue);
+    } else {
+      auto qcompare = [&compare](const weighted_vertex& a, const weighted_vertex& b) {
+        return compare(b.weight, a.weight); // min-heap: pop lowest weight first
+      };
+      using WVAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<weighted_vertex>;
+      using Queue = std::priority_queue<weighted_vertex, std::vector<weighted_vertex, WVAlloc>, decltype(qcompare)>;
+      struct binary_queue {
+        Queue heap;
+        void push(const weighted_vertex& x) { heap.push(x); }
+        weighted_vertex pop() {
+          weighted_vertex x = heap.top();
+          heap.pop();
+          return x;
+        }
+        bool empty() const noexcept { return heap.empty(); }
+      };
+      binary_queue queue{Queue(qcompare, std::vector<weighted_vertex, WVAlloc>(WVAlloc(alloc)))};
+      run(queue);
+    }
   } else {
     // -----------------------------------------------------------------
     // indexed d-ary heap path.
@@ -682,6 +797,273 @@ constexpr void dijkstra_shortest_distances(
                           heap_tag, alloc);
 }
 
+namespace detail {
+  /**
+   * @brief Dijkstra on the scratch of a traversal_workspace.
+   *
+   * The lazy-deletion search of the use_default_heap path, with the distances, predecessors and
+   * binary heap held by the workspace. Distances start as infinite in O(1), so only the vertices
+   * reached are initialized, and on_initialize_vertex is not called. Visitor events are
+   * otherwise those of dijkstra_shortest_paths.
+   */
+  template <bool RecordPredecessors, class G, class Sources, class VId, class Distance, class WF, class Visitor,
+            class Compare, class Combine>
+  void dijkstra_with_workspace(G&&                                 g,
+                               const Sources&                      sources,
+                               traversal_workspace<VId, Distance>& workspace,
+                               WF&                                 weight,
+                               Visitor&                            visitor,
+                               Compare&                            compare,
+                               Combine&                            combine) {
+    using graph_type  = std::remove_reference_t<G>;
+    using id_type     = vertex_id_t<graph_type>;
+    using weight_type = invoke_result_t<WF, const graph_type&, edge_t<graph_type>>;
+    using entry_type  = std::pair<Distance, VId>;
+
+    constexpr auto zero = zero_distance<Distance>();
+    const size_t   n    = static_cast<size_t>(num_vertices(g));
+
+    auto& heap     = workspace.begin_shortest_paths(n, RecordPredecessors);
+    auto& distance = workspace.distances();
+    auto  qcompare = [&compare](const entry_type& a, const entry_type& b) {
+      return compare(b.first, a.first); // min-heap: pop lowest distance first
+    };
+
+    for (auto&& seed_id : sources) {
+      if (static_cast<size_t>(seed_id) >= n) {
+        throw std::out_of_range(std::format("dijkstra_shortest_paths: source vertex id '{}' is out of range", seed_id));
+      }
+      const VId seed  = static_cast<VId>(seed_id);
+      distance[seed] = zero;
+      if constexpr (RecordPredecessors) {
+        workspace.predecessor_slot(seed) = seed;
+      }
+      heap.push_back({zero, seed});
+      std::ranges::push_heap(heap, qcompare);
+      if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
+        visitor.on_discover_vertex(g, *find_vertex(g, static_cast<id_type>(seed_id)));
+      } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
+        visitor.on_discover_vertex(g, static_cast<id_type>(seed_id));
+      }
+    }
+
+    while (!heap.empty()) {
+      std::ranges::pop_heap(heap, qcompare);
+      const auto [w, ukey] = heap.back();
+      heap.pop_back();
+
+      // Skip stale entries left behind by re-insertion, as in the use_default_heap path.
+      const Distance d_u = distance.get(ukey);
+      if (compare(d_u, w)) {
+        continue;
+      }
+      const id_type              uid = static_cast<id_type>(ukey);
+      const vertex_t<graph_type> u   = *find_vertex(g, uid);
+
+      if constexpr (has_on_examine_vertex<graph_type, Visitor>) {
+        visitor.on_examine_vertex(g, u);
+      } else if constexpr (has_on_examine_vertex_id<graph_type, Visitor>) {
+        visitor.on_examine_vertex(g, uid);
+      }
+
+      for (auto&& [vid, uv] : views::incidence(g, u)) {
+        if constexpr (has_on_examine_edge<graph_type, Visitor>) {
+          visitor.on_examine_edge(g, uv);
+        }
+
+        const weight_type w_uv = weight(g, uv);
+        if constexpr (!(std::is_integral_v<weight_type> && std::is_unsigned_v<weight_type>)) {
+          if (compare(w_uv, zero)) {
+            throw std::out_of_range(
+                  std::format("dijkstra_shortest_paths: invalid negative edge weight of '{}' encountered", w_uv));
+          }
+        }
+
+        const VId      vkey                     = static_cast<VId>(vid);
+        const bool     is_neighbor_undiscovered = !distance.contains(vkey);
+        const Distance d_v                      = combine(d_u, w_uv);
+        if (compare(d_v, distance.get(vkey))) {
+          distance[vkey] = d_v;
+          if constexpr (RecordPredecessors) {
+            workspace.predecessor_slot(vkey) = ukey;
+          }
+          if constexpr (has_on_edge_relaxed<graph_type, Visitor>) {
+            visitor.on_edge_relaxed(g, uv);
+          }
+          if (is_neighbor_undiscovered) {
+            if constexpr (has_on_discover_vertex<graph_type, Visitor>) {
+              visitor.on_discover_vertex(g, target(g, uv));
+            } else if constexpr (has_on_discover_vertex_id<graph_type, Visitor>) {
+              visitor.on_discover_vertex(g, vid);
+            }
+          }
+          heap.push_back({d_v, vkey});
+          std::ranges::push_heap(heap, qcompare);
+        } else {
+          if constexpr (has_on_edge_not_relaxed<graph_type, Visitor>) {
+            visitor.on_edge_not_relaxed(g, uv);
+          }
+        }
+      }
+
+      if constexpr (has_on_finish_vertex<graph_type, Visitor>) {
+        visitor.on_finish_vertex(g, u);
+      } else if constexpr (has_on_finish_vertex_id<graph_type, Visitor>) {
+        visitor.on_finish_vertex(g, uid);
+      }
+    }
+  }
+} // namespace detail
+
+/**
+ * @brief Multi-source shortest paths into a reusable traversal_workspace.
+ *
+ * Computes the same distances and predecessors as dijkstra_shortest_paths(g, sources, distance,
+ * predecessor, weight, ...), but stores them in @p workspace rather than in caller-owned
+ * arrays that must first be set to infinity. The workspace resets them in O(1), so a query
+ * costs O((reached vertices + their out-edges) log) instead of O(V) for the initialization.
+ * Read the results with workspace.distances() and workspace.predecessor(uid).
+ *
+ * Uses a binary heap with lazy deletion held by the workspace. on_initialize_vertex is not
+ * called, since the vertices are not initialized one by one.
+ *
+ * @tparam G        Graph type satisfying index_adjacency_list
+ * @tparam Sources  Input range of source vertex IDs
+ * @tparam VId      Vertex id type of the workspace; must hold every vertex id of g
+ * @tparam Distance Distance type of the workspace
+ *
+ * @param g         The graph
+ * @param sources   Range of source vertex IDs
+ * @param workspace Workspace of the calling thread
+ * @param weight    Edge weight function: (const G&, const edge_t<G>&) -> Distance (default: 1)
+ * @param visitor   Visitor for algorithm events (default: empty_visitor)
+ * @param compare   Distance comparison (default: less<Distance>)
+ * @param combine   Distance combination (default: plus<Distance>)
+ *
+ * @throws std::out_of_range if a source is out of range or a negative edge weight is found.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * traversal_workspace<uint32_t, double> ws; // one per thread
+ * dijkstra_shortest_paths(g, source, ws, [](const auto& g, const auto& uv) { return edge_value(g, uv); });
+ * for (auto vid : ws.distances().keys())
+ *   use(vid, ws.distances().get(vid), ws.predecessor(vid));
+ * ```
+ */
+template <index_adjacency_list G,
+          input_range          Sources,
+          std::integral        VId,
+          class Distance,
+          class WF      = function<Distance(const std::remove_reference_t<G>&, const edge_t<G>&)>,
+          class Visitor = empty_visitor,
+          class Compare = less<Distance>,
+          class Combine = plus<Distance>>
+requires convertible_to<range_value_t<Sources>, vertex_id_t<G>> && //
+         basic_edge_weight_function<G, WF, Distance, Compare, Combine>
+void dijkstra_shortest_paths(
+      G&&                                 g,
+      const Sources&                      sources,
+      traversal_workspace<VId, Distance>& workspace,
+      WF&&                                weight =
+            [](const auto&, const edge_t<G>&) {
+              return Distance(1);
+            }, // default weight(g, uv) -> 1
+      Visitor&& visitor = empty_visitor(),
+      Compare&& compare = less<Distance>(),
+      Combine&& combine = plus<Distance>()) {
+  static_assert(valid_visitor<std::remove_reference_t<G>, Visitor>,
+                "Visitor has no recognized on_* callbacks. Check for a misspelled event name "
+                "(e.g. on_discover_vertx), or pass graph::empty_visitor{} for no callbacks.");
+  detail::dijkstra_with_workspace<true>(g, sources, workspace, weight, visitor, compare, combine);
+}
+
+/**
+ * @brief Single-source shortest paths into a reusable traversal_workspace.
+ *
+ * @see dijkstra_shortest_paths(G&&, const Sources&, traversal_workspace<VId, Distance>&, WF&&, Visitor&&, Compare&&, Combine&&)
+ */
+template <index_adjacency_list G,
+          std::integral        VId,
+          class Distance,
+          class WF      = function<Distance(const std::remove_reference_t<G>&, const edge_t<G>&)>,
+          class Visitor = empty_visitor,
+          class Compare = less<Distance>,
+          class Combine = plus<Distance>>
+requires basic_edge_weight_function<G, WF, Distance, Compare, Combine>
+void dijkstra_shortest_paths(
+      G&&                                 g,
+      const vertex_id_t<G>&               start_vertex_id,
+      traversal_workspace<VId, Distance>& workspace,
+      WF&&                                weight =
+            [](const auto&, const edge_t<G>&) {
+              return Distance(1);
+            }, // default weight(g, uv) -> 1
+      Visitor&& visitor = empty_visitor(),
+      Compare&& compare = less<Distance>(),
+      Combine&& combine = plus<Distance>()) {
+  dijkstra_shortest_paths(g, subrange(&start_vertex_id, (&start_vertex_id + 1)), workspace, forward<WF>(weight),
+                          forward<Visitor>(visitor), forward<Compare>(compare), forward<Combine>(combine));
+}
+
+/**
+ * @brief Multi-source shortest distances into a reusable traversal_workspace.
+ *
+ * As dijkstra_shortest_paths with a workspace, without recording predecessors.
+ */
+template <index_adjacency_list G,
+          input_range          Sources,
+          std::integral        VId,
+          class Distance,
+          class WF      = function<Distance(const std::remove_reference_t<G>&, const edge_t<G>&)>,
+          class Visitor = empty_visitor,
+          class Compare = less<Distance>,
+          class Combine = plus<Distance>>
+requires convertible_to<range_value_t<Sources>, vertex_id_t<G>> && //
+         basic_edge_weight_function<G, WF, Distance, Compare, Combine>
+void dijkstra_shortest_distances(
+      G&&                                 g,
+      const Sources&                      sources,
+      traversal_workspace<VId, Distance>& workspace,
+      WF&&                                weight =
+            [](const auto&, const edge_t<G>&) {
+              return Distance(1);
+            }, // default weight(g, uv) -> 1
+      Visitor&& visitor = empty_visitor(),
+      Compare&& compare = less<Distance>(),
+      Combine&& combine = plus<Distance>()) {
+  static_assert(valid_visitor<std::remove_reference_t<G>, Visitor>,
+                "Visitor has no recognized on_* callbacks. Check for a misspelled event name "
+                "(e.g. on_discover_vertx), or pass graph::empty_visitor{} for no callbacks.");
+  detail::dijkstra_with_workspace<false>(g, sources, workspace, weight, visitor, compare, combine);
+}
+
+/**
+ * @brief Single-source shortest distances into a reusable traversal_workspace.
+ */
+template <index_adjacency_list G,
+          std::integral        VId,
+          class Distance,
+          class WF      = function<Distance(const std::remove_reference_t<G>&, const edge_t<G>&)>,
+          class Visitor = empty_visitor,
+          class Compare = less<Distance>,
+          class Combine = plus<Distance>>
+requires basic_edge_weight_function<G, WF, Distance, Compare, Combine>
+void dijkstra_shortest_distances(
+      G&&                                 g,
+      const vertex_id_t<G>&               start_vertex_id,
+      traversal_workspace<VId, Distance>& workspace,
+      WF&&                                weight =
+            [](const auto&, const edge_t<G>&) {
+              return Distance(1);
+            }, // default weight(g, uv) -> 1
+      Visitor&& visitor = empty_visitor(),
+      Compare&& compare = less<Distance>(),
+      Combine&& combine = plus<Distance>()) {
+  dijkstra_shortest_distances(g, subrange(&start_vertex_id, (&start_vertex_id + 1)), workspace, forward<WF>(weight),
+                              forward<Visitor>(visitor), forward<Compare>(compare), forward<Combine>(combine));
+}
+
 } // namespace graph
 
 #endif // GRAPH_DIJKSTRA_SHORTEST_PATHS_HPP
@@ -16,11 +16,16 @@
 #include "graph/views/incidence.hpp"
 #include "graph/views/vertexlist.hpp"
 #include "graph/adj_list/vertex_property_map.hpp"
+#include "graph/detail/sorted_intersection.hpp"
+#include "graph/detail/thread_pool.hpp"
 
 #ifndef GRAPH_JACCARD_HPP
 #  define GRAPH_JACCARD_HPP
 
+#  include <algorithm>
+#  include <atomic>
 #  include <functional>
+#  include <span>
 #  include <unordered_set>
 #  include <vector>
 
@@ -31,6 +36,115 @@ using adj_list::adjacency_list;
 using adj_list::vertex_id_t;
 using adj_list::edge_t;
 using adj_list::num_vertices;
+using adj_list::index_adjacency_list;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+
+namespace detail {
+  /**
+   * Open neighbourhoods of every vertex of an index graph as ascending, duplicate-free id
+   * arrays without self-loops: the sets J(u, v) is defined on, in a form the kernels of
+   * sorted_intersection.hpp intersect directly.
+   *
+   * Each row is checked once. If the graph exposes contiguous rows (g.target_ids(uid)) and all
+   * of them are already strictly ascending and loop-free, the rows are used in place and nothing
+   * is copied. Otherwise the ids are copied into one flat array (one id per edge) and only the
+   * rows that need it are sorted and deduplicated.
+   */
+  template <index_adjacency_list G>
+  class sorted_neighborhoods {
+  public:
+    using id_type = vertex_id_t<G>;
+
+    sorted_neighborhoods(const G& g, thread_pool& pool) : g_(&g) {
+      const size_t n = static_cast<size_t>(num_vertices(g));
+
+      // Non-loop out-degree of every vertex, and whether every row is already a proper set
+      std::atomic<bool> clean{true};
+      offsets_.assign(n + 1, 0);
+      pool.for_each_index(n, [&](size_t u, size_t) {
+        size_t  count = 0;
+        bool    row_clean = true, have_prev = false;
+        id_type prev{};
+        for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u)))) {
+          const auto vid = static_cast<id_type>(target_id(g, uv));
+          if (static_cast<size_t>(vid) == u) {
+            row_clean = false;
+            continue;
+          }
+          row_clean = row_clean && (!have_prev || prev < vid);
+          have_prev = true;
+          prev      = vid;
+          ++count;
+        }
+        offsets_[u] = count;
+        if (!row_clean)
+          clean.store(false, std::memory_order_relaxed);
+      });
+
+      if constexpr (contiguous_target_ids<G>) {
+        if constexpr (std::same_as<std::ranges::range_value_t<decltype(g.target_ids(id_type{}))>, id_type>) {
+          if (clean.load(std::memory_order_relaxed)) {
+            borrowed_ = true;
+            offsets_  = {};
+            return;
+          }
+        }
+      }
+
+      length_.assign(offsets_.begin(), offsets_.end() - 1);
+      parallel_exclusive_scan(pool, offsets_.begin(), n + 1);
+      ids_.resize(offsets_[n]);
+      pool.for_each_index(n, [&](size_t u, size_t) {
+        id_type* const first = ids_.data() + offsets_[u];
+        id_type*       last  = first;
+        for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u)))) {
+          const auto vid = static_cast<id_type>(target_id(g, uv));
+          if (static_cast<size_t>(vid) != u)
+            *last++ = vid;
+        }
+        if (std::adjacent_find(first, last, std::greater_equal<>{}) != last) {
+          std::sort(first, last);
+          last = std::unique(first, last);
+        }
+        length_[u] = static_cast<size_t>(last - first);
+      });
+    }
+
+    /// N(u) in ascending order.
+    [[nodiscard]] std::span<const id_type> operator[](size_t u) const noexcept {
+      if constexpr (contiguous_target_ids<G>) {
+        if (borrowed_)
+          return g_->target_ids(static_cast<id_type>(u));
+      }
+      return {ids_.data() + offsets_[u], length_[u]};
+    }
+
+    /// True if the rows are the graph's own target arrays.
+    [[nodiscard]] bool borrowed() const noexcept { return borrowed_; }
+
+  private:
+    const G*             g_;
+    bool                 borrowed_ = false;
+    std::vector<size_t>  offsets_; // row starts in ids_ (n + 1)
+    std::vector<size_t>  length_;  // row lengths after deduplication
+    std::vector<id_type> ids_;
+  };
+
+  /// |N(u) ∩ N(v)| of two rows of sorted_neighborhoods.
+  template <class Id>
+  size_t common_neighbors(std::span<const Id> nu, std::span<const Id> nv) {
+    return sorted_intersection_count(nu.data(), nu.size(), nv.data(), nv.size());
+  }
+
+  /// |A ∩ B| / |A ∪ B| from |A|, |B| and |A ∩ B|; 0 when both sets are empty.
+  template <class T>
+  T jaccard_value(size_t common, size_t size_a, size_t size_b) {
+    const size_t union_size = size_a + size_b - common;
+    return union_size == 0 ? T{0} : static_cast<T>(common) / static_cast<T>(union_size);
+  }
+} // namespace detail
 
 /**
  * @ingroup graph_algorithms
@@ -72,11 +186,15 @@ using adj_list::num_vertices;
  *
  * **Complexity:**
  * - Time: O(V + E × d_min) where d_min is minimum degree per edge; worst case O(V³)
- * - Space: O(V + E) for precomputed neighbor sets
+ * - Space: index graphs: O(V + E) ids, none when the rows are already sorted sets exposed
+ *   through g.target_ids(uid); mapped graphs: O(V + E) hashed neighbor sets
  *
  * **Remarks:**
  * - T = double is recommended. Integral types truncate results to 0 or 1.
  * - Self-loops are skipped and do not affect Jaccard computation
+ * - Index graphs intersect sorted neighbor arrays (detail::sorted_neighborhoods) with the
+ *   kernels of sorted_intersection.hpp; mapped graphs probe hashed neighbor sets.
+ * - See parallel_jaccard.hpp for a multi-threaded version and per-vertex top-k selection.
  *
  * **Supported Graph Properties:**
  *
@@ -125,10 +243,29 @@ void jaccard_coefficient(G&& g, OutOp out) {
     return;
   }
 
+  if constexpr (index_adjacency_list<G>) {
+    thread_pool serial(1); // runs inline; no threads are started
+    const detail::sorted_neighborhoods<std::remove_cvref_t<G>> nbrs(g, serial);
+
+    for (auto&& [uid_raw, u] : views::vertexlist(g)) {
+      const vid_t uid = static_cast<vid_t>(uid_raw);
+      const auto  nu  = nbrs[static_cast<size_t>(uid)];
+      for (auto&& [vid_raw, uv] : views::incidence(g, u)) {
+        const vid_t vid = static_cast<vid_t>(vid_raw);
+        if (vid == uid) { // skip self-loops
+          continue;
+        }
+        const auto nv = nbrs[static_cast<size_t>(vid)];
+        out(uid, vid, uv, detail::jaccard_value<T>(detail::common_neighbors(nu, nv), nu.size(), nv.size()));
+      }
+    }
+    return;
+  }
+
   // ============================================================================
-  // Phase 1: Build neighbor sets for every vertex (self-loops excluded)
+  // Mapped graphs. Phase 1: Build neighbor sets for every vertex (self-loops excluded)
   // ============================================================================
-  // vertex_property_map: vector<set> for index graphs, unordered_map<VId, set> for mapped.
+  // vertex_property_map: unordered_map<VId, set> for mapped graphs.
   using nbr_set = std::unordered_set<vid_t>;
   auto nbrs     = make_vertex_property_map<std::remove_reference_t<G>, nbr_set>(g, nbr_set{});
 
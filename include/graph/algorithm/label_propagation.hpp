@@ -15,6 +15,7 @@
 #include "graph/graph.hpp"
 #include "graph/adj_list/vertex_property_map.hpp"
 #include "graph/algorithm/traversal_common.hpp"
+#include "graph/detail/label_histogram.hpp"
 
 #ifndef GRAPH_LABEL_PROPAGATION_HPP
 #  define GRAPH_LABEL_PROPAGATION_HPP
@@ -25,7 +26,6 @@
 #  include <optional>
 #  include <random>
 #  include <ranges>
-#  include <unordered_map>
 #  include <vector>
 
 namespace graph {
@@ -42,6 +42,26 @@ using adj_list::num_vertices;
 
 namespace detail {
 
+/// Smallest and largest label (by operator<) over all vertices, ignoring empty_label; both
+/// empty if no vertex is labelled or the labels are not ordered.
+template <adjacency_list G, class LabelFn>
+auto label_bounds(G&& g, LabelFn&& label, const std::optional<vertex_fn_value_t<LabelFn, G>>& empty_label) {
+  using label_type = vertex_fn_value_t<LabelFn, G>;
+  std::optional<label_type> lo, hi;
+  if constexpr (std::totally_ordered<label_type>) {
+    for (auto&& u : vertices(g)) {
+      const label_type& lbl = label(g, vertex_id(g, u));
+      if (empty_label && lbl == *empty_label)
+        continue;
+      if (!lo || lbl < *lo)
+        lo = lbl;
+      if (!hi || *hi < lbl)
+        hi = lbl;
+    }
+  }
+  return std::pair(std::move(lo), std::move(hi));
+}
+
 template <adjacency_list G,
           class LabelFn,
           class Gen,
@@ -68,60 +88,45 @@ void label_propagation_impl(G&&
     order.push_back(vertex_id(g, u));
   }
 
-  for (T iter = 0; iter < max_iters; ++iter) {
-    std::shuffle(order.begin(), order.end(), rng);
-
-    bool changed = false;
+  auto [lo, hi] = label_bounds(g, label, empty_label);
+  with_label_histogram(lo, hi, N, 1, [&](auto make_histogram) {
+    // One histogram for the whole run, cleared in O(1) per vertex
+    auto freq = make_histogram();
+    auto pick = [&rng](size_t ties) { return std::uniform_int_distribution<size_t>(0, ties - 1)(rng); };
 
-    for (auto uid : order) {
-      // Tally neighbour labels, skipping neighbours with empty_label if provided
-      std::unordered_map<label_type, size_t> freq;
-      for (auto&& uv : edges(g, *find_vertex(g, uid))) {
-        auto tid = target_id(g, uv);
-        if (!empty_label || !(label(g, tid) == *empty_label)) {
-          ++freq[label(g, tid)];
-        }
-      }
+    for (T iter = 0; iter < max_iters; ++iter) {
+      std::shuffle(order.begin(), order.end(), rng);
 
-      if (freq.empty()) {
-        continue; // isolated vertex or no labelled neighbours — keep current label
-      }
+      bool changed = false;
 
-      // Find the maximum frequency
-      size_t max_count = 0;
-      for (auto& [lbl, cnt] : freq) {
-        if (cnt > max_count) {
-          max_count = cnt;
+      for (auto uid : order) {
+        // Tally neighbour labels, skipping neighbours with empty_label if provided
+        freq.clear();
+        for (auto&& uv : edges(g, *find_vertex(g, uid))) {
+          auto tid = target_id(g, uv);
+          if (!empty_label || !(label(g, tid) == *empty_label)) {
+            freq.add(label(g, tid));
+          }
         }
-      }
 
-      // Collect all labels tied at the maximum
-      std::vector<label_type> candidates;
-      for (auto& [lbl, cnt] : freq) {
-        if (cnt == max_count) {
-          candidates.push_back(lbl);
+        if (freq.empty()) {
+          continue; // isolated vertex or no labelled neighbours — keep current label
         }
-      }
 
-      // Pick one of the tied labels (randomly if more than one)
-      label_type best;
-      if (candidates.size() == 1) {
-        best = candidates[0];
-      } else {
-        std::uniform_int_distribution<size_t> dist(0, candidates.size() - 1);
-        best = candidates[dist(rng)];
-      }
+        // Pick one of the labels tied at the maximum frequency (randomly if more than one)
+        label_type best = histogram_mode(freq, pick);
 
-      if (!(label(g, uid) == best)) {
-        label(g, uid) = best;
-        changed    = true;
+        if (!(label(g, uid) == best)) {
+          label(g, uid) = std::move(best);
+          changed       = true;
+        }
       }
-    }
 
-    if (!changed) {
-      break; // convergence
+      if (!changed) {
+        break; // convergence
+      }
     }
-  }
+  });
 }
 
 } // namespace detail
@@ -169,14 +174,16 @@ void label_propagation_impl(G&&
  * - Neighbouring vertices in the same dense community share a common label
  *
  * **Throws:**
- * - std::bad_alloc from internal allocations (frequency map, candidate vector)
+ * - std::bad_alloc from internal allocations (vertex order, label histogram)
  * - Exception guarantee: Basic. If an exception is thrown, graph g remains unchanged;
  *   label may be partially modified (indeterminate state).
  *
  * **Complexity:**
  * - Time: O(E) per iteration; the number of iterations required for convergence is
  *   typically small relative to graph size
- * - Space: O(V) for the shuffled vertex-ID vector and frequency map
+ * - Space: O(V) for the shuffled vertex-ID vector and the label histogram: a dense counter
+ *   array when the labels are integers spanning at most about 4V values (e.g. iota), otherwise
+ *   an open-addressing table sized to the largest neighbourhood. Neither allocates per vertex.
  *
  * **Remarks:**
  * - For semi-supervised propagation with unlabelled vertices, use the overload
@@ -253,14 +260,16 @@ void label_propagation(G&&      g,
  * - Vertices in components with no labelled vertex retain empty_label
  *
  * **Throws:**
- * - std::bad_alloc from internal allocations (frequency map, candidate vector)
+ * - std::bad_alloc from internal allocations (vertex order, label histogram)
  * - Exception guarantee: Basic. If an exception is thrown, graph g remains unchanged;
  *   label may be partially modified (indeterminate state).
  *
  * **Complexity:**
  * - Time: O(E) per iteration; the number of iterations required for convergence is
  *   typically small relative to graph size
- * - Space: O(V) for the shuffled vertex-ID vector and frequency map
+ * - Space: O(V) for the shuffled vertex-ID vector and the label histogram: a dense counter
+ *   array when the labels are integers spanning at most about 4V values (e.g. iota), otherwise
+ *   an open-addressing table sized to the largest neighbourhood. Neither allocates per vertex.
  *
  * **Remarks:**
  * - If no vertex in a connected component has a non-empty label, those vertices
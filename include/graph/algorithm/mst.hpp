@@ -194,26 +194,36 @@
  * **Performance Notes:**
  * 
  * **Prim's Priority Queue:**
- * `prim()` is implemented as a thin wrapper over `dijkstra_shortest_paths`,
- * so it inherits the same `Heap` template parameter:
+ * `prim()` has its own main loop and takes the same `Heap` selectors as
+ * `dijkstra_shortest_paths`:
  *
- * - `use_default_heap` (default): `std::priority_queue` with lazy deletion.
- *   Provides O(E log V). Good general-purpose choice.
- * - `use_indexed_dary_heap<D>`: indexed d-ary heap with true O(log_D V)
- *   decrease-key. Recommended opt-in for high-E/V random / scale-free
- *   workloads on `compressed_graph` (typically `D = 8`); see Dijkstra
- *   Phase 4 results.
+ * - `use_default_heap` (default): lazy Prim on `std::priority_queue`. A
+ *   vertex is pushed again whenever its key improves and stale entries are
+ *   skipped on pop. O(E log E).
+ * - `use_indexed_dary_heap<D>`: eager Prim with one entry per vertex and a
+ *   true O(log_D V) decrease-key. The heap's position array also records
+ *   which vertices have been popped (`detail::finalizing_position_map`), so a
+ *   single load per edge decides between skip, decrease and push. Best on
+ *   sparse graphs and grids (D = 4).
+ * - `use_bucket_heap`: lazy Prim on Dial's bucket queue, one bucket per
+ *   weight value. O(1) per operation for small non-negative integer weights;
+ *   memory grows with the largest weight.
+ * - `use_radix_heap`: accepted, and runs as `use_bucket_heap`. A radix heap
+ *   needs keys that never go below the last one popped; Prim's keys (the
+ *   cheapest edge into the tree) do not have that property, while they are
+ *   bounded by the largest weight, which suits Dial.
  *
- * Implementation note: because Prim's relaxation criterion is
- * `compare(w_uv, weight[v])` rather than Dijkstra's
- * `compare(d_u + w_uv, distance[v])`, Prim does not satisfy the
- * monotonicity invariant Dijkstra's main loop assumes. `prim()` therefore
- * maintains a small `std::vector<bool> finalized(V)` and wraps `weight_fn`
- * so finalized targets report `+infinity`, which prevents the relax step
- * from corrupting `weight[]` (the MST output) or calling `decrease()` on
- * a vertex that has already been popped. See
- * `agents/indexed_dary_heap_plan.md` § Phase 5.2 for the full discussion
- * and the standalone-Prim alternative ("Option 2").
+ * The integer queues always pop the smallest key, so they require the default
+ * `std::less` compare; a maximum spanning tree (`std::greater<>`) needs one of
+ * the other heaps.
+ *
+ * Unlike `dijkstra_shortest_paths`, `prim()` does not switch to an integer
+ * queue by itself for unsigned weights, since the bucket count would follow
+ * the largest weight.
+ *
+ * Both loops skip an edge into a finalized vertex before calling
+ * `weight_fn`, so `weight[]` of a tree vertex is never overwritten and
+ * negative weights are valid with the binary and indexed heaps.
  *
  * Fibonacci heap implementations achieve O(E + V log V) but have higher
  * constant factors and are not used here. A simple array (O(V²)) is fastest
@@ -268,6 +278,9 @@
 #include "graph/edge_list/edge_list.hpp"
 #include "graph/views/edgelist.hpp"
 #include "graph/algorithm/dijkstra_shortest_paths.hpp"
+#include "graph/detail/heap_position_map.hpp"
+#include "graph/detail/indexed_dary_heap.hpp"
+#include "graph/detail/radix_heap.hpp"
 #include <queue>
 #include <format>
 #include <vector>
@@ -837,14 +850,17 @@ auto inplace_kruskal(IELR&&      e,       // graph
  * @brief Find the minimum weight spanning tree using Prim's algorithm starting from a seed vertex.
  * 
  * Grows a minimum spanning tree from a seed vertex by repeatedly adding the minimum-weight
- * edge connecting a tree vertex to a non-tree vertex. Delegates to dijkstra_shortest_paths
- * with a projecting combine function.
+ * edge connecting a tree vertex to a non-tree vertex. The default heap runs lazy Prim (vertices
+ * are pushed again when their key improves); use_indexed_dary_heap<D> runs eager Prim with
+ * decrease-key.
  * 
  * @tparam G             Graph type satisfying adjacency_list.
  * @tparam PredecessorFn Function type returning lvalue ref to predecessor for a vertex.
  * @tparam WeightFn      Function type returning lvalue ref to edge weight for a vertex.
  * @tparam WF            Edge weight function type. Defaults to edge_value(g, uv).
  * @tparam CompareOp     Comparison operator type. Defaults to less<>.
+ * @tparam Heap          Heap selector: use_default_heap, use_indexed_dary_heap<D>,
+ *                       use_bucket_heap or use_radix_heap (runs as use_bucket_heap).
  * @tparam Alloc         Allocator type for the internal priority queue storage.
  *                       Defaults to std::allocator<std::byte>.
  * 
@@ -854,7 +870,8 @@ auto inplace_kruskal(IELR&&      e,       // graph
  * @param predecessor Function predecessor(g, uid) -> vertex_id&: returns lvalue ref to predecessor for vertex uid.
  * @param weight_fn   Edge weight function (default: edge_value).
  * @param compare     Comparison for edge weights (default: less<>).
- * @param alloc       Allocator instance forwarded to dijkstra_shortest_paths (default: Alloc())
+ * @param heap        Heap selector tag (default: use_default_heap{}).
+ * @param alloc       Allocator instance for the priority queue storage (default: Alloc())
  * 
  * @return Total weight of the spanning tree.
  * 
@@ -863,6 +880,7 @@ auto inplace_kruskal(IELR&&      e,       // graph
  * - WeightFn must satisfy distance_fn_for<WeightFn, G>
  * - PredecessorFn must satisfy predecessor_fn_for<PredecessorFn, G>
  * - WF must satisfy basic_edge_weight_function
+ * - With use_bucket_heap or use_radix_heap, CompareOp must be std::less (checked by static_assert)
  * 
  * **Preconditions:**
  * - seed must be a valid vertex in the graph
@@ -885,11 +903,13 @@ auto inplace_kruskal(IELR&&      e,       // graph
  * 
  * **Throws:**
  * - std::out_of_range if seed vertex ID is out of range
+ * - std::out_of_range if a negative edge weight is found with use_bucket_heap or
+ *   use_radix_heap (signed weight types only)
  * - Exception guarantee: Basic. Graph g unchanged; predecessor/weight may be partial.
  * 
  * **Complexity:**
- * - Time: O(E log V) with binary heap priority queue
- * - Space: O(V) for distance array and priority queue
+ * - Time: O(E log V) with the binary or indexed d-ary heap
+ * - Space: O(V) with the indexed heap; O(E) worst case for the lazy queue
  * 
  * **Remarks:**
  * - Only produces MST for the connected component containing seed
@@ -926,109 +946,214 @@ auto prim(G&&                   g,           // graph
                   return edge_value(gr, uv);
                 }, // default weight_fn(g, uv) -> edge_value(g, uv)
           CompareOp    compare  = less<distance_fn_value_t<WeightFn, G>>(), // edge value comparator
-          Heap         heap_tag = Heap{},                                   // heap selector (use_default_heap or use_indexed_dary_heap<D>)
+          Heap         /*heap_tag*/ = Heap{},                                 // heap selector (use_default_heap, use_indexed_dary_heap<D>,
+                                                                              // use_bucket_heap or use_radix_heap)
           const Alloc& alloc    = Alloc()
 ) {
+  using graph_type      = std::remove_reference_t<G>;
   using edge_value_type = distance_fn_value_t<WeightFn, G>;
   using id_type         = vertex_id_t<G>;
+  using pred_id_type    = predecessor_fn_value_t<PredecessorFn, G>;
 
-  // Prim's combine: ignore accumulated distance, use edge weight directly.
-  // This transforms Dijkstra's relaxation check from compare(d_u + w, d_v)
-  // to compare(w, d_v), which is exactly Prim's criterion.
-  auto prim_combine = [](edge_value_type /*d_u*/, edge_value_type w_uv) -> edge_value_type { return w_uv; };
+  auto seed_it = find_vertex(g, seed);
+  if (seed_it == std::ranges::end(vertices(g))) {
+    throw std::out_of_range(std::format("prim: seed vertex id '{}' is out of range", seed));
+  }
+
+  weight(g, seed) = edge_value_type{};
+  if constexpr (!is_null_predecessor_fn_v<PredecessorFn>) {
+    predecessor(g, seed) = static_cast<pred_id_type>(seed);
+  }
+  edge_value_type total_weight = edge_value_type{};
+
+  // Records the cheaper edge uid -> vid as vid's tree edge candidate. Only called for targets
+  // that are not finalized: a finalized vertex is in the tree and its weight is final.
+  auto improve = [&](const id_type& uid, const id_type& vid, const edge_value_type& w_uv) -> bool {
+    if (!compare(w_uv, weight(g, vid))) {
+      return false;
+    }
+    weight(g, vid) = w_uv;
+    if constexpr (!is_null_predecessor_fn_v<PredecessorFn>) {
+      predecessor(g, vid) = static_cast<pred_id_type>(uid);
+    }
+    return true;
+  };
 
   // ---------------------------------------------------------------------
-  // Prim correctness shim ("Option 1" in indexed_dary_heap_plan.md § 5.2).
-  //
-  // Dijkstra's main loop relies on the monotonicity invariant:
-  //   with non-negative weights and combine = plus, a finalized vertex's
-  //   distance can never be improved later.
-  // It therefore omits a "skip if finalized" guard in the relax step.
-  //
-  // Prim's combine (return w_uv, ignoring d_u) breaks that invariant:
-  // a finalized vertex v carries weight[v] = w_xv (the cheapest tree-edge
-  // found before v was popped). A later-popped neighbor y may present an
-  // edge y -> v with w_yv < weight[v]; relaxing it would *overwrite* the
-  // MST output (weight[] is the result, not a working distance), and with
-  // the indexed heap would call decrease() on a vertex whose heap position
-  // is npos -> out-of-bounds.
-  //
-  // Fix: track which vertices have been finalized and force weight_fn to
-  // report +infinity for any edge whose target is already finalized. The
-  // relax then computes compare(infinite, weight[v]) = false and the edge
-  // is skipped. This is correct for Prim because by definition a finalized
-  // vertex is already in the MST and cannot accept a cheaper tree-edge.
+  // Heap dispatch. Unlike Dijkstra's keys, Prim's (the cheapest edge into
+  // the tree) are not monotone: an edge into a vertex that has already been
+  // popped may be cheaper than its tree edge. Both paths therefore check
+  // whether the target is finalized before calling weight_fn.
   //
-  // The bitset add ~1 bit per vertex of memory and one predictable
-  // branch + bit-load per edge in the inner loop. See "Option 2" in the
-  // plan for a faster but more invasive standalone-Prim alternative.
-  //
-  // Storage strategy: for graphs with index_vertex_range (dense integer
-  // ids in [0, num_vertices)), a std::vector<bool> indexed by id is fast
-  // and cache-friendly. For sparse / mapped graphs whose ids are not
-  // contiguous (or not integral), an unordered_set is used instead.
+  // - use_indexed_dary_heap<d> : eager Prim. One heap entry per vertex with
+  //                              decrease-key; a finalizing_position_map
+  //                              marks popped vertices in the position array,
+  //                              so one load decides skip / decrease / push.
+  // - use_default_heap         : lazy Prim on std::priority_queue. Improved
+  //                              vertices are pushed again and a pop of a
+  //                              finalized vertex is skipped; a separate
+  //                              finalized array holds the state.
+  // - use_bucket_heap          : lazy Prim on Dial's bucket queue.
+  // - use_radix_heap           : runs as use_bucket_heap (keys not monotone).
   // ---------------------------------------------------------------------
-  using GraphT = std::remove_reference_t<G>;
-  if constexpr (adj_list::index_vertex_range<GraphT>) {
-    std::vector<bool> finalized(num_vertices(g), false);
-
-    struct prim_finish_visitor {
-      std::vector<bool>* finalized_ptr;
-      void on_finish_vertex(const GraphT& /*gr*/, const id_type& uid) const {
-        (*finalized_ptr)[static_cast<std::size_t>(uid)] = true;
-      }
+  constexpr bool is_lazy_heap = std::is_same_v<Heap, use_default_heap> || std::is_same_v<Heap, use_radix_heap> ||
+                                std::is_same_v<Heap, use_bucket_heap>;
+
+  if constexpr (is_lazy_heap) {
+    struct weighted_vertex {
+      vertex_t<graph_type> vertex_desc = {};
+      edge_value_type      weight      = edge_value_type();
     };
-    prim_finish_visitor visitor{&finalized};
-
-    auto wf_ref = std::ref(weight_fn);
-    auto guarded_weight_fn = [&finalized, wf_ref](
-          const GraphT& gr, const edge_t<G>& uv) -> edge_value_type {
-      const id_type vid = static_cast<id_type>(target_id(gr, uv));
-      if (finalized[static_cast<std::size_t>(vid)]) {
-        return infinite_distance<edge_value_type>();
+
+    // Main loop, generic over the queue (push(weighted_vertex), pop(), empty()) and the
+    // finalized set (test(uid), set(uid))
+    auto run = [&](auto& queue, auto& finalized) {
+      queue.push({*seed_it, edge_value_type{}});
+      while (!queue.empty()) {
+        const auto [u, w] = queue.pop();
+        const id_type uid = vertex_id(g, u);
+        if (finalized.test(uid)) {
+          continue; // stale: u was popped earlier with a smaller key
+        }
+        finalized.set(uid);
+        total_weight += w;
+
+        for (auto&& [vid, uv] : views::incidence(g, u)) {
+          if (finalized.test(vid)) {
+            continue;
+          }
+          const edge_value_type w_uv = weight_fn(g, uv);
+          if (improve(uid, vid, w_uv)) {
+            queue.push({target(g, uv), w_uv});
+          }
+        }
       }
-      return wf_ref.get()(gr, uv);
     };
 
-    dijkstra_shortest_paths(g, seed,
-                            std::forward<WeightFn>(weight),
-                            std::forward<PredecessorFn>(predecessor),
-                            guarded_weight_fn, visitor,
-                            std::forward<CompareOp>(compare), prim_combine, heap_tag, alloc);
-  } else {
-    std::unordered_set<id_type> finalized;
-    finalized.reserve(num_vertices(g));
-
-    struct prim_finish_visitor {
-      std::unordered_set<id_type>* finalized_ptr;
-      void on_finish_vertex(const GraphT& /*gr*/, const id_type& uid) const {
-        finalized_ptr->insert(uid);
+    auto run_with_finalized = [&](auto& queue) {
+      if constexpr (adj_list::index_vertex_range<graph_type>) {
+        struct finalized_flags {
+          std::vector<bool> flags;
+          bool test(const id_type& uid) const { return flags[static_cast<std::size_t>(uid)]; }
+          void set(const id_type& uid) { flags[static_cast<std::size_t>(uid)] = true; }
+        };
+        finalized_flags finalized{std::vector<bool>(num_vertices(g), false)};
+        run(queue, finalized);
+      } else {
+        struct finalized_set {
+          std::unordered_set<id_type> ids;
+          bool test(const id_type& uid) const { return ids.contains(uid); }
+          void set(const id_type& uid) { ids.insert(uid); }
+        };
+        finalized_set finalized;
+        finalized.ids.reserve(num_vertices(g));
+        run(queue, finalized);
       }
     };
-    prim_finish_visitor visitor{&finalized};
-
-    auto wf_ref = std::ref(weight_fn);
-    auto guarded_weight_fn = [&finalized, wf_ref](
-          const GraphT& gr, const edge_t<G>& uv) -> edge_value_type {
-      const id_type vid = static_cast<id_type>(target_id(gr, uv));
-      if (finalized.contains(vid)) {
-        return infinite_distance<edge_value_type>();
+
+    if constexpr (std::is_same_v<Heap, use_radix_heap> || std::is_same_v<Heap, use_bucket_heap>) {
+      static_assert(std::is_integral_v<edge_value_type>,
+                    "use_radix_heap and use_bucket_heap require an integral weight type");
+      // The bucket queue pops the smallest key, so any other order would grow a wrong tree
+      static_assert(detail::integer_queue_compare_v<edge_value_type, CompareOp>,
+                    "use_radix_heap and use_bucket_heap require a std::less compare; use another heap for a "
+                    "maximum spanning tree");
+      using key_type   = std::make_unsigned_t<edge_value_type>;
+      using entry_type = std::pair<key_type, vertex_t<graph_type>>;
+      using KeyAlloc   = typename std::allocator_traits<Alloc>::template rebind_alloc<entry_type>;
+      using IntQueue   = detail::bucket_queue<key_type, vertex_t<graph_type>, KeyAlloc>;
+      struct integer_queue {
+        IntQueue heap;
+        void push(const weighted_vertex& x) {
+          if constexpr (std::is_signed_v<edge_value_type>) {
+            if (x.weight < edge_value_type{}) {
+              throw std::out_of_range(
+                    std::format("prim: invalid negative edge weight of '{}' encountered", x.weight));
+            }
+          }
+          heap.push(static_cast<key_type>(x.weight), x.vertex_desc);
+        }
+        weighted_vertex pop() {
+          const auto& [key, u] = heap.top();
+          weighted_vertex x{u, static_cast<edge_value_type>(key)};
+          heap.pop();
+          return x;
+        }
+        bool empty() const noexcept { return heap.empty(); }
+      };
+      integer_queue queue{IntQueue(KeyAlloc(alloc))};
+      run_with_finalized(queue);
+    } else {
+      auto qcompare = [&compare](const weighted_vertex& a, const weighted_vertex& b) {
+        return compare(b.weight, a.weight); // min-heap: pop lowest weight first
+      };
+      using WVAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<weighted_vertex>;
+      using Queue = std::priority_queue<weighted_vertex, std::vector<weighted_vertex, WVAlloc>, decltype(qcompare)>;
+      struct binary_queue {
+        Queue heap;
+        void push(const weighted_vertex& x) { heap.push(x); }
+        weighted_vertex pop() {
+          weighted_vertex x = heap.top();
+          heap.pop();
+          return x;
+        }
+        bool empty() const noexcept { return heap.empty(); }
+      };
+      binary_queue queue{Queue(qcompare, std::vector<weighted_vertex, WVAlloc>(WVAlloc(alloc)))};
+      run_with_finalized(queue);
+    }
+  } else {
+    constexpr std::size_t arity = Heap::arity;
+
+    // Live key lookup for the heap (reads, never writes)
+    auto heap_keyfn = [&g, &weight](const id_type& k) -> const edge_value_type& { return weight(g, k); };
+
+    auto run = [&](auto& heap) {
+      const auto& positions = heap.position_map_ref();
+      constexpr std::size_t npos      = std::remove_cvref_t<decltype(positions)>::npos;
+      constexpr std::size_t finalized = std::remove_cvref_t<decltype(positions)>::finalized;
+
+      heap.push(static_cast<id_type>(seed));
+      while (!heap.empty()) {
+        const id_type uid = heap.top();
+        heap.pop(); // marks uid finalized
+        total_weight += weight(g, uid);
+
+        for (auto&& [vid, uv] : views::incidence(g, *find_vertex(g, uid))) {
+          const std::size_t state = positions.state(vid);
+          if (state == finalized) {
+            continue;
+          }
+          if (improve(uid, vid, weight_fn(g, uv))) {
+            if (state == npos) {
+              heap.push(vid);
+            } else {
+              heap.decrease(vid);
+            }
+          }
+        }
       }
-      return wf_ref.get()(gr, uv);
     };
 
-    dijkstra_shortest_paths(g, seed,
-                            std::forward<WeightFn>(weight),
-                            std::forward<PredecessorFn>(predecessor),
-                            guarded_weight_fn, visitor,
-                            std::forward<CompareOp>(compare), prim_combine, heap_tag, alloc);
-  }
-
-  // Calculate total MST weight by summing edge weights
-  edge_value_type total_weight = edge_value_type{};
-  for (auto [vid] : views::basic_vertexlist(g)) {
-    if (vid != seed && predecessor(g, vid) != vid) {
-      total_weight += weight(g, vid);
+    using HeapAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<id_type>;
+
+    if constexpr (adj_list::index_vertex_range<graph_type>) {
+      std::vector<std::size_t> positions(num_vertices(g), detail::vector_position_map::npos);
+      using PMap  = detail::finalizing_position_map<detail::vector_position_map>;
+      using HeapT = detail::indexed_dary_heap<id_type, decltype(heap_keyfn), CompareOp, PMap, arity, HeapAlloc>;
+      HeapT heap(heap_keyfn, compare, PMap{detail::vector_position_map{positions}}, HeapAlloc(alloc));
+      run(heap);
+    } else {
+      static_assert(adj_list::hashable_vertex_id<graph_type>,
+                    "use_indexed_dary_heap requires either index_vertex_range<G> or a "
+                    "hashable vertex_id_t<G> for the associative position-map adapter.");
+      using Base = detail::assoc_position_map<id_type>;
+      typename Base::map_type positions;
+      positions.reserve(num_vertices(g));
+      using PMap  = detail::finalizing_position_map<Base>;
+      using HeapT = detail::indexed_dary_heap<id_type, decltype(heap_keyfn), CompareOp, PMap, arity, HeapAlloc>;
+      HeapT heap(heap_keyfn, compare, PMap{Base{positions}}, HeapAlloc(alloc));
+      run(heap);
     }
   }
 
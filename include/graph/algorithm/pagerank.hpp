@@ -0,0 +1,490 @@
+/**
+ * @file pagerank.hpp
+ *
+ * @brief Multi-threaded PageRank with pull-based Jacobi, Gauss-Seidel and delta (active-set)
+ *        iterations.
+ *
+ * Every sweep computes, for each vertex v,
+ *
+ *   rank(v) = (1 - d) / n + d * D / n + d * sum over edges (u, v) of rank(u) * w(u, v) / W(u)
+ *
+ * where d is the damping factor, W(u) the total out-weight of u (its out-degree when
+ * unweighted) and D the rank held by dangling vertices (W(u) == 0), which is spread evenly.
+ *
+ * The sum is pulled over the in-edges of v, so each worker writes only the vertices it owns
+ * and reads the contributions rank(u) / W(u) from one contiguous array. The in-edges come from
+ * in_edges(g, v) on bidirectional graphs, from the out-edges when the graph is symmetric, and
+ * otherwise from a transpose built once, in parallel, before the first sweep. Vertices are
+ * processed in fixed blocks whose error and dangling partial sums are added in block order, so
+ * the result does not depend on the number of workers. The dangling mass of the next sweep is
+ * gathered in the same pass as the new ranks.
+ *
+ * Gauss-Seidel and delta sweeps do not keep the ranks summing to 1, so every sweep scales the
+ * teleport and dangling terms by the total of the previous sweep: any multiple of the PageRank
+ * vector is then a fixed point, only the direction has to converge, and the result is
+ * normalized once at the end.
+ *
+ * - **Jacobi**: every sweep reads the contributions of the previous sweep.
+ * - **Gauss-Seidel**: contributions are updated in place, so vertices read values already
+ *   updated in the same sweep; it typically needs fewer sweeps than Jacobi.
+ * - **Delta**: a vertex's in-edges are summed again only if one of its in-neighbours changed
+ *   by more than tolerance / n since it last notified its out-neighbours (the active set);
+ *   the other vertices reuse their previous sum. Sweeps are dense while many vertices move.
+ *   Once the changes are confined to a part of the graph (the last sweeps, or a warm start
+ *   after a local change on a graph with a large diameter) sweeps touch only the edges
+ *   around it; when every rank keeps moving, delta costs somewhat more per sweep than Jacobi.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/traversal_common.hpp"
+#include "graph/detail/in_edge_index.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#ifndef GRAPH_PAGERANK_HPP
+#  define GRAPH_PAGERANK_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::bidirectional_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::num_vertices;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+
+/// Sweep schedule of pagerank.
+enum class pagerank_method {
+  jacobi,       ///< Every sweep reads the previous sweep's ranks (the default)
+  gauss_seidel, ///< Ranks are updated in place and read within the same sweep
+  delta,        ///< Only vertices with a changed in-neighbour sum their in-edges again
+};
+
+/**
+ * @brief Options for pagerank.
+ *
+ * - `damping`: probability of following an edge rather than jumping to a random vertex.
+ * - `tolerance`: the run stops once a sweep changes the ranks by less than this in total
+ *   (L1 norm).
+ * - `max_iters`: maximum number of sweeps.
+ * - `method`: see pagerank_method.
+ * - `symmetric`: the out-edges of every vertex are also its in-edges (undirected graph, or a
+ *   directed graph stored with both directions), so no transpose is needed. For the weighted
+ *   overload the weights must be symmetric too.
+ * - `warm_start`: start from the values in rank (e.g. yesterday's ranks) rather than 1/n.
+ *   They are scaled to sum to 1; uniform ranks are used if they do not have a positive sum.
+ */
+struct pagerank_options {
+  double          damping    = 0.85;
+  double          tolerance  = 1e-6;
+  size_t          max_iters  = 100;
+  pagerank_method method     = pagerank_method::jacobi;
+  bool            symmetric  = false;
+  bool            warm_start = false;
+};
+
+/// Outcome of pagerank.
+struct pagerank_result {
+  size_t iterations = 0;     ///< Number of sweeps run
+  double residual   = 0.0;   ///< L1 change of the ranks in the last sweep
+  bool   converged  = false; ///< residual < options.tolerance
+};
+
+namespace detail {
+  // Weight of every edge in the unweighted overload
+  struct pagerank_unit_weight {
+    template <class G, class E>
+    constexpr int operator()(const G&, const E&) const noexcept {
+      return 1;
+    }
+  };
+
+  // Vertices per block: the unit of scheduling and of the ordered partial sums
+  inline constexpr size_t pagerank_grain = 1024;
+
+  // A delta sweep is dense (every vertex sums its in-edges) while more than 1/4 of the
+  // vertices moved in the previous sweep: a sparse sweep reads the in-edges of the notified
+  // vertices and writes along the out-edges of the moved ones, which then costs more than it saves
+  inline constexpr size_t pagerank_dense_fraction = 4;
+
+  /// Calls fn(block, lo, hi) for the fixed blocks [lo, hi) of [0, n) in parallel.
+  template <class F>
+  void for_each_pagerank_block(thread_pool& pool, size_t n, F&& fn) {
+    pool.for_each_chunk(
+          n,
+          [&](size_t lo, size_t hi, size_t) {
+            // A chunk may span several blocks when it runs serially
+            for (size_t b = lo / pagerank_grain; b * pagerank_grain < hi; ++b)
+              fn(b, b * pagerank_grain, std::min(hi, (b + 1) * pagerank_grain));
+          },
+          pagerank_grain);
+  }
+
+  template <index_adjacency_list G, class RankFn, class WF>
+  requires vertex_property_fn_for<RankFn, G> && std::floating_point<vertex_fn_value_t<RankFn, G>>
+  pagerank_result pagerank_impl(G&& g, RankFn& rank, WF& weight, const pagerank_options& options, thread_pool& pool) {
+    using id_type               = vertex_id_t<G>;
+    using T                     = vertex_fn_value_t<RankFn, G>;
+    constexpr bool weighted     = !std::same_as<WF, pagerank_unit_weight>;
+    constexpr bool bidirectional = bidirectional_adjacency_list<std::remove_cvref_t<G>>;
+
+    const size_t n = static_cast<size_t>(num_vertices(g));
+    if (n == 0)
+      return {0, 0.0, true};
+
+    const T d = static_cast<T>(options.damping);
+
+    // Inverse out-weights; 0 marks a dangling vertex
+    std::vector<T>      inv_out(n);
+    std::vector<size_t> block_edges((n + pagerank_grain - 1) / pagerank_grain);
+    for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+      size_t edges_in_block = 0;
+      for (size_t u = lo; u < hi; ++u) {
+        T w = 0;
+        for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u)))) {
+          if constexpr (weighted)
+            w += static_cast<T>(weight(g, uv));
+          else
+            w += T{1};
+          ++edges_in_block;
+        }
+        inv_out[u] = w > T{0} ? T{1} / w : T{0};
+      }
+      block_edges[b] = edges_in_block;
+    });
+
+    in_edge_index<id_type, std::conditional_t<weighted, T, void>> in_index;
+    if constexpr (!bidirectional) {
+      if (!options.symmetric) {
+        size_t m = 0;
+        for (size_t c : block_edges)
+          m += c;
+        in_index = build_in_edge_index<std::conditional_t<weighted, T, void>>(g, m, pool, weight);
+      }
+    }
+
+    // Sum of contrib[u] * w(u, v) over the in-edges (u, v) of v; load(u) reads contrib[u]
+    auto pull = [&](size_t v, auto&& load) {
+      T s = 0;
+      if constexpr (bidirectional) {
+        for (auto&& vu : in_edges(g, *find_vertex(g, static_cast<id_type>(v)))) {
+          if constexpr (weighted)
+            s += load(static_cast<size_t>(source_id(g, vu))) * static_cast<T>(weight(g, vu));
+          else
+            s += load(static_cast<size_t>(source_id(g, vu)));
+        }
+      } else {
+        if (options.symmetric) {
+          for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(v)))) {
+            if constexpr (weighted)
+              s += load(static_cast<size_t>(target_id(g, uv))) * static_cast<T>(weight(g, uv));
+            else
+              s += load(static_cast<size_t>(target_id(g, uv)));
+          }
+        } else {
+          for (size_t k = in_index.offsets[v]; k < in_index.offsets[v + 1]; ++k) {
+            if constexpr (weighted)
+              s += load(static_cast<size_t>(in_index.sources[k])) * in_index.values[k];
+            else
+              s += load(static_cast<size_t>(in_index.sources[k]));
+          }
+        }
+      }
+      return s;
+    };
+
+    // Initial ranks, summing to 1
+    std::vector<T> block_sum(block_edges.size());
+    std::vector<T> r(n, T{1} / static_cast<T>(n));
+    if (options.warm_start) {
+      for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+        T s = 0;
+        for (size_t u = lo; u < hi; ++u)
+          s += std::max(T{0}, static_cast<T>(rank(g, static_cast<id_type>(u))));
+        block_sum[b] = s;
+      });
+      T total = 0;
+      for (T s : block_sum)
+        total += s;
+      if (total > T{0} && std::isfinite(total))
+        pool.for_each_index(
+              n, [&](size_t u, size_t) { r[u] = std::max(T{0}, static_cast<T>(rank(g, static_cast<id_type>(u)))) / total; },
+              pagerank_grain);
+    }
+
+    // Per-block error, total and dangling partial sums of a sweep, added in block order
+    std::vector<T> block_err(block_sum.size()), block_total(block_sum.size());
+    auto           reduce = [](const std::vector<T>& parts) {
+      T total = 0;
+      for (T s : parts)
+        total += s;
+      return total;
+    };
+
+    // contrib[u] = r[u] / W(u), and the dangling mass of the first sweep
+    std::vector<T> contrib(n);
+    for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+      T dangling = 0;
+      for (size_t u = lo; u < hi; ++u) {
+        contrib[u] = r[u] * inv_out[u];
+        if (inv_out[u] == T{0})
+          dangling += r[u];
+      }
+      block_sum[b]   = dangling;
+      block_total[b] = T{0};
+    });
+    block_total[0] = T{1};
+
+    std::vector<T>       next;   // jacobi, delta: contributions of the sweep being computed
+    std::vector<T>       cached; // delta: last in-edge sum of every vertex
+    std::vector<T>       sent;   // delta: rank at the last notification of the out-neighbours
+    std::vector<uint8_t> dirty;  // delta: an in-neighbour notified since the last sum
+    std::vector<uint8_t> dirty_next;
+    std::vector<size_t>  block_moved;
+    bool                 dense     = true;  // delta: every vertex sums its in-edges
+    bool                 notifying = false; // delta: moved vertices mark their out-neighbours
+    if (options.method != pagerank_method::gauss_seidel)
+      next.resize(n);
+    if (options.method == pagerank_method::delta) {
+      cached.resize(n);
+      sent = r;
+      dirty.assign(n, 0);
+      dirty_next.assign(n, 0);
+      block_moved.resize(block_sum.size());
+    }
+    const T notify = static_cast<T>(options.tolerance) / static_cast<T>(n);
+
+    pagerank_result result;
+    while (result.iterations < options.max_iters) {
+      // The teleport and dangling terms scale with the total of the previous sweep. Jacobi keeps
+      // that total at 1; Gauss-Seidel and delta sweeps let it drift, but any multiple of the
+      // ranks is then a fixed point, so only their direction has to converge.
+      const T total = reduce(block_total);
+      const T base  = ((T{1} - d) * total + d * reduce(block_sum)) / static_cast<T>(n);
+
+      switch (options.method) {
+      case pagerank_method::jacobi:
+        for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+          T err = 0, sum = 0, dangling = 0;
+          for (size_t v = lo; v < hi; ++v) {
+            const T nr = base + d * pull(v, [&](size_t u) { return contrib[u]; });
+            err += std::abs(nr - r[v]);
+            r[v]    = nr;
+            next[v] = nr * inv_out[v];
+            sum += nr;
+            if (inv_out[v] == T{0})
+              dangling += nr;
+          }
+          block_err[b]   = err;
+          block_total[b] = sum;
+          block_sum[b]   = dangling;
+        });
+        contrib.swap(next);
+        break;
+
+      case pagerank_method::gauss_seidel:
+        for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+          T err = 0, sum = 0, dangling = 0;
+          for (size_t v = lo; v < hi; ++v) {
+            const T nr = base + d * pull(v, [&](size_t u) {
+                           return std::atomic_ref<T>(contrib[u]).load(std::memory_order_relaxed);
+                         });
+            err += std::abs(nr - r[v]);
+            r[v] = nr;
+            std::atomic_ref<T>(contrib[v]).store(nr * inv_out[v], std::memory_order_relaxed);
+            sum += nr;
+            if (inv_out[v] == T{0})
+              dangling += nr;
+          }
+          block_err[b]   = err;
+          block_total[b] = sum;
+          block_sum[b]   = dangling;
+        });
+        break;
+
+      case pagerank_method::delta: {
+        // As jacobi, but only the notified vertices (all of them in a dense sweep) sum their
+        // in-edges again. A vertex that moved since it last notified its out-neighbours marks
+        // them in the flags of the next sweep, unless many vertices moved in the previous sweep;
+        // the next sweep is then dense anyway.
+        for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+          T      err = 0, sum = 0, dangling = 0;
+          size_t count = 0;
+          for (size_t v = lo; v < hi; ++v) {
+            const bool notified = dirty[v];
+            if (notified)
+              dirty[v] = 0;
+            if (dense || notified)
+              cached[v] = pull(v, [&](size_t u) { return contrib[u]; });
+            const T nr = base + d * cached[v];
+            err += std::abs(nr - r[v]);
+            r[v]    = nr;
+            next[v] = nr * inv_out[v];
+            sum += nr;
+            if (inv_out[v] == T{0})
+              dangling += nr;
+            if (std::abs(nr - sent[v]) > notify) {
+              sent[v] = nr;
+              ++count;
+              if (notifying)
+                for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(v))))
+                  std::atomic_ref<uint8_t>(dirty_next[static_cast<size_t>(target_id(g, uv))])
+                        .store(1, std::memory_order_relaxed);
+            }
+          }
+          block_err[b]   = err;
+          block_total[b] = sum;
+          block_sum[b]   = dangling;
+          block_moved[b] = count;
+        });
+        contrib.swap(next);
+        dirty.swap(dirty_next); // every flag of the old array was cleared by the sweep
+
+        size_t count = 0;
+        for (size_t c : block_moved)
+          count += c;
+        dense     = !notifying || count > n / pagerank_dense_fraction;
+        notifying = count <= n / pagerank_dense_fraction;
+        break;
+      }
+      }
+
+      ++result.iterations;
+      result.residual = static_cast<double>(reduce(block_err) / total);
+      if (result.residual < options.tolerance) {
+        result.converged = true;
+        break;
+      }
+    }
+
+    // Normalize: Gauss-Seidel and delta ranks are only proportional to the result
+    for_each_pagerank_block(pool, n, [&](size_t b, size_t lo, size_t hi) {
+      T s = 0;
+      for (size_t v = lo; v < hi; ++v)
+        s += r[v];
+      block_sum[b] = s;
+    });
+    const T total = reduce(block_sum);
+    pool.for_each_index(
+          n, [&](size_t v, size_t) { rank(g, static_cast<id_type>(v)) = r[v] / total; }, pagerank_grain);
+    return result;
+  }
+} // namespace detail
+
+/**
+ * @ingroup graph_algorithms
+ * @brief PageRank of every vertex, on multiple threads.
+ *
+ * Iterates rank(v) = (1 - d)/n + d * (D/n + sum over in-edges (u, v) of rank(u) / outdeg(u)),
+ * where D is the total rank of the vertices without out-edges, until the L1 change of a sweep
+ * is below options.tolerance or options.max_iters sweeps have run. The sums are pulled over the
+ * in-edges of each vertex (see the file description for where they come from).
+ *
+ * @tparam G      The graph type. Must satisfy index_adjacency_list.
+ * @tparam RankFn Callable providing per-vertex rank access: (const G&, vertex_id_t<G>) -> T&,
+ *                with T a floating-point type. Must satisfy vertex_property_fn_for<RankFn, G>.
+ *
+ * @param g       The graph to process.
+ * @param rank    Callable providing per-vertex rank access: rank(g, uid) -> T&. Ranks out,
+ *                summing to 1; initial ranks in when options.warm_start is set.
+ *                For containers: wrap with container_value_fn(c).
+ * @param options Damping, tolerance, sweep limit, method, symmetry and warm start.
+ * @param pool    Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return pagerank_result with the number of sweeps, the last L1 change and whether it is
+ *         below options.tolerance.
+ *
+ * **Mandates:**
+ * - G must satisfy index_adjacency_list
+ * - RankFn must satisfy vertex_property_fn_for<RankFn, G>, with a floating-point value type
+ *
+ * **Preconditions:**
+ * - 0 <= options.damping < 1
+ * - rank(g, uid) returns a valid reference for every vertex in g, and references for
+ *   different vertices can be assigned concurrently
+ * - If options.symmetric is true, (u,v) is an edge iff (v,u) is an edge
+ *
+ * **Effects:**
+ * - Sets rank(g, uid) for all vertices
+ * - Does not modify the graph g
+ *
+ * **Throws:**
+ * - std::bad_alloc from internal allocations
+ * - Exception guarantee: Basic. Graph g remains unchanged; rank is written only at the end.
+ *
+ * **Complexity:**
+ * - Work: O(V + E) per sweep (jacobi, gauss_seidel); O(V) plus the in-edges of the notified
+ *   vertices and the out-edges of the moved ones (delta). O(V + E) once for the transpose
+ *   when g is neither bidirectional nor symmetric.
+ * - Span: O((V + E) / P) per sweep
+ * - Space: O(V); O(V + E) for the transpose when g is neither bidirectional nor symmetric
+ *
+ * **Remarks:**
+ * - Jacobi and delta give the same ranks for any number of workers. Gauss-Seidel reads values
+ *   written concurrently by other workers, so its last digits can vary between runs.
+ * - Multi-edges count once per edge; self-loops keep part of a vertex's rank on it.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * #include <graph/algorithm/pagerank.hpp>
+ *
+ * std::vector<double> pr(num_vertices(g));
+ * auto res = pagerank(g, container_value_fn(pr), {.tolerance = 1e-8, .method = pagerank_method::gauss_seidel});
+ * ```
+ */
+template <index_adjacency_list G, class RankFn>
+requires vertex_property_fn_for<RankFn, G> && std::floating_point<vertex_fn_value_t<RankFn, G>>
+pagerank_result pagerank(G&&                     g,
+                         RankFn&&                rank,
+                         const pagerank_options& options = {},
+                         thread_pool&            pool    = default_thread_pool()) {
+  detail::pagerank_unit_weight unit;
+  return detail::pagerank_impl(g, rank, unit, options, pool);
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Weighted PageRank of every vertex, on multiple threads.
+ *
+ * Behaves like the unweighted overload, except a vertex u passes its rank to each out-edge
+ * (u, v) in proportion to weight(g, uv) / (total out-weight of u). Vertices whose out-weights
+ * sum to 0 are dangling.
+ *
+ * @param weight Edge weight function: weight(g, uv) -> arithmetic, non-negative. On
+ *               bidirectional graphs it is also called with in-edges; on symmetric graphs the
+ *               weight of (v, u) is used for (u, v).
+ *
+ * All other parameters, mandates, preconditions and complexity are those of the unweighted
+ * overload.
+ */
+template <index_adjacency_list G, class RankFn, class WF>
+requires vertex_property_fn_for<RankFn, G> && std::floating_point<vertex_fn_value_t<RankFn, G>> &&
+         edge_weight_function<G, WF, vertex_fn_value_t<RankFn, G>>
+pagerank_result pagerank(G&&                     g,
+                         RankFn&&                rank,
+                         WF&&                    weight,
+                         const pagerank_options& options = {},
+                         thread_pool&            pool    = default_thread_pool()) {
+  return detail::pagerank_impl(g, rank, weight, options, pool);
+}
+
+} // namespace graph
+
+#endif // GRAPH_PAGERANK_HPP
@@ -0,0 +1,578 @@
+/**
+ * @file parallel_mst.hpp
+ *
+ * @brief Multi-threaded minimum spanning forests: Borůvka on an adjacency list and
+ *        filter-Kruskal on an edge list.
+ *
+ * Both write the forest into an output edge list, as kruskal does, and return the total weight
+ * and the number of components.
+ *
+ * **Borůvka** (`boruvka`) copies the non-loop edges of an index graph, such as compressed_graph,
+ * into a flat array in parallel. Every round then runs three parallel passes over it:
+ *
+ * 1. Each component finds its lightest edge. Workers offer every edge to the components of its
+ *    two endpoints with a compare-and-swap on the component's best edge; ties are broken by the
+ *    edge's position, so all components agree on one strict order.
+ * 2. Each component hooks itself to the component at the other end of its lightest edge, and the
+ *    edge joins the forest. Two components that chose the same edge would hook to each other; the
+ *    one with the smaller id stays a root. A parallel pointer-jumping pass then points every
+ *    vertex at its new root.
+ * 3. The edges inside one component are filtered out, keeping the others in order.
+ *
+ * Every round at least halves the number of components, so there are at most log2(V) rounds.
+ *
+ * **Filter-Kruskal** (`filter_kruskal`, Osipov, Sanders and Singler, ALENEX 2009) copies the
+ * edge list like kruskal, but does not sort it all. It partitions the edges around a pivot (the
+ * median weight of a random sample), recurses on the light part, and then drops the heavy edges
+ * whose endpoints the light part has already joined before it recurses on the rest. Parts of
+ * at most max(4096, V/2) edges are sorted and run through union-find as in kruskal. On graphs
+ * with many more edges than vertices most heavy edges are filtered out unsorted. The partition
+ * and filter passes run on the pool; the union-find runs on the calling thread.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/connected_components.hpp"
+#include "graph/algorithm/mst.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#ifndef GRAPH_PARALLEL_MST_HPP
+#  define GRAPH_PARALLEL_MST_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::num_vertices;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+using adj_list::edge_t;
+using adj_list::edge_value;
+
+namespace detail {
+  // Vertices per dynamically scheduled chunk of the loops over vertex rows, whose cost is the
+  // degree; edges per chunk of the loops over the flat edge array
+  inline constexpr size_t mst_vertex_grain = 256;
+  inline constexpr size_t mst_edge_grain   = 4096;
+
+  // Partition and filter passes over fewer elements run on the calling thread
+  inline constexpr size_t mst_serial_cutoff = size_t{1} << 14;
+
+  // Filter-Kruskal sorts parts of at most max(filter_kruskal_base, V / 2) edges
+  inline constexpr size_t filter_kruskal_base = 4096;
+
+  /// An edge of the working arrays of boruvka and filter_kruskal.
+  template <class VId, class EV>
+  struct mst_edge {
+    VId source_id;
+    VId target_id;
+    EV  value;
+  };
+
+  /// Moves the elements of data[0, n) that satisfy pred to the front and returns their number.
+  /// With keep_rest the others follow them, and the order within both parts is unspecified.
+  /// Otherwise the kept elements stay in their original order and data[count, n) is
+  /// unspecified. pred is called once per element, concurrently; scratch is resized to n when
+  /// the pass runs in parallel.
+  template <class T, class Pred>
+  size_t mst_partition(thread_pool& pool, T* data, size_t n, std::vector<T>& scratch, Pred&& pred, bool keep_rest) {
+    if (pool.size() == 1 || n < mst_serial_cutoff) {
+      if (keep_rest)
+        return static_cast<size_t>(std::partition(data, data + n, pred) - data);
+      return static_cast<size_t>(std::remove_if(data, data + n, [&pred](const T& x) { return !pred(x); }) - data);
+    }
+
+    // Each block splits its range into scratch, the kept elements forward from its first
+    // index and the others backward from its last; a second pass moves both runs into place
+    if (scratch.size() < n)
+      scratch.resize(n);
+    const size_t        blocks = pool.size() * 8;
+    auto                first  = [n, blocks](size_t b) { return n * b / blocks; };
+    std::vector<size_t> kept(blocks);
+    pool.for_each_index(
+          blocks,
+          [&](size_t b, size_t) {
+            size_t k = first(b), r = first(b + 1);
+            for (size_t i = first(b); i < first(b + 1); ++i) {
+              if (pred(data[i]))
+                scratch[k++] = data[i];
+              else if (keep_rest)
+                scratch[--r] = data[i];
+            }
+            kept[b] = k - first(b);
+          },
+          1);
+
+    std::vector<size_t> kept_at(blocks), rest_at(blocks);
+    size_t              total = 0;
+    for (size_t b = 0; b < blocks; ++b) {
+      kept_at[b] = total;
+      total += kept[b];
+    }
+    for (size_t b = 0, rest = total; b < blocks; ++b) {
+      rest_at[b] = rest;
+      rest += first(b + 1) - first(b) - kept[b];
+    }
+    pool.for_each_index(
+          blocks,
+          [&](size_t b, size_t) {
+            const auto lo = scratch.begin() + static_cast<std::ptrdiff_t>(first(b));
+            const auto hi = scratch.begin() + static_cast<std::ptrdiff_t>(first(b + 1));
+            std::copy(lo, lo + static_cast<std::ptrdiff_t>(kept[b]), data + kept_at[b]);
+            if (keep_rest)
+              std::copy(lo + static_cast<std::ptrdiff_t>(kept[b]), hi, data + rest_at[b]);
+          },
+          1);
+    return total;
+  }
+
+  /// Shared body of the boruvka overloads.
+  template <class G, class OELR, class WF, class CompareOp>
+  auto boruvka_impl(G& g, OELR& t, WF& weight, CompareOp& compare, thread_pool& pool) {
+    using out_edge  = std::ranges::range_value_t<OELR>;
+    using VId       = std::remove_const_t<typename out_edge::source_id_type>;
+    using EV        = typename out_edge::value_type;
+    using id_type   = vertex_id_t<G>;
+    using edge_type = mst_edge<VId, EV>;
+    constexpr uint64_t none    = std::numeric_limits<uint64_t>::max();
+    constexpr auto     relaxed = std::memory_order_relaxed;
+
+    const size_t n = static_cast<size_t>(num_vertices(g));
+    if (n == 0)
+      return std::pair<EV, size_t>{EV{}, 0};
+
+    // The non-loop edges of g, grouped by source vertex
+    std::vector<size_t> offset(n + 1);
+    pool.for_each_index(
+          n,
+          [&](size_t u, size_t) {
+            size_t degree = 0;
+            for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u))))
+              degree += static_cast<size_t>(target_id(g, uv)) != u;
+            offset[u] = degree;
+          },
+          mst_vertex_grain);
+    size_t m  = parallel_exclusive_scan(pool, offset.begin(), n);
+    offset[n] = m;
+
+    std::vector<edge_type> arcs(m);
+    pool.for_each_index(
+          n,
+          [&](size_t u, size_t) {
+            size_t k = offset[u];
+            for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u)))) {
+              const size_t v = static_cast<size_t>(target_id(g, uv));
+              if (v != u)
+                arcs[k++] = {static_cast<VId>(u), static_cast<VId>(v), static_cast<EV>(weight(g, uv))};
+            }
+          },
+          mst_vertex_grain);
+    std::vector<size_t>().swap(offset);
+
+    // comp[v]: the root of v's component, fully compressed between rounds. best[c]: the
+    // position of root c's lightest arc in this round.
+    std::vector<VId>      comp(n);
+    std::vector<uint64_t> best(n, none);
+    std::vector<VId>      roots(n);
+    pool.for_each_index(n, [&](size_t v, size_t) { comp[v] = roots[v] = static_cast<VId>(v); });
+
+    const bool concurrent = pool.size() > 1;
+    auto       lighter    = [&](uint64_t i, uint64_t j) {
+      return compare(arcs[i].value, arcs[j].value) || (!compare(arcs[j].value, arcs[i].value) && i < j);
+    };
+    auto offer = [&](VId c, uint64_t i) {
+      std::atomic_ref<uint64_t> slot(best[c]);
+      uint64_t                  cur = slot.load(relaxed);
+      while (cur == none || lighter(i, cur)) {
+        if (!concurrent) {
+          slot.store(i, relaxed);
+          return;
+        }
+        if (slot.compare_exchange_weak(cur, i, relaxed))
+          return;
+      }
+    };
+
+    EV                     total_weight = EV{};
+    size_t                 tree_edges   = 0;
+    std::vector<VId>       hook;
+    std::vector<edge_type> scratch;
+    t.reserve(t.size() + n - 1);
+
+    while (m > 0) {
+      // 1. The lightest arc of every component. Arcs stay grouped by source vertex, so a chunk
+      //    offers each run of one source component once.
+      pool.for_each_chunk(
+            m,
+            [&](size_t lo, size_t hi, size_t) {
+              VId      run      = comp[arcs[lo].source_id];
+              uint64_t run_best = lo;
+              for (size_t i = lo; i < hi; ++i) {
+                const VId c = comp[arcs[i].source_id];
+                if (c != run) {
+                  offer(run, run_best);
+                  run      = c;
+                  run_best = i;
+                } else if (lighter(i, run_best)) {
+                  run_best = i;
+                }
+                offer(comp[arcs[i].target_id], i);
+              }
+              offer(run, run_best);
+            },
+            mst_edge_grain);
+
+      // 2. Hook every component to the other end of its lightest arc. Of two components that
+      //    chose the same arc, the one with the smaller id stays a root.
+      const size_t r = roots.size();
+      hook.resize(r);
+      pool.for_each_index(
+            r,
+            [&](size_t k, size_t) {
+              const VId      c = roots[k];
+              const uint64_t i = best[c];
+              hook[k]          = c;
+              if (i == none)
+                return; // no arcs left
+              const VId cu    = comp[arcs[i].source_id];
+              const VId other = cu == c ? comp[arcs[i].target_id] : cu;
+              if (best[other] != i || other < c)
+                hook[k] = other;
+            },
+            mst_vertex_grain);
+
+      size_t next = 0;
+      for (size_t k = 0; k < r; ++k) {
+        const VId c = roots[k];
+        if (hook[k] != c) {
+          comp[c]            = hook[k];
+          const edge_type& a = arcs[best[c]];
+          t.push_back(out_edge());
+          t.back().source_id = a.source_id;
+          t.back().target_id = a.target_id;
+          t.back().value     = a.value;
+          total_weight += a.value;
+          ++tree_edges;
+        } else if (best[c] != none) {
+          roots[next++] = c;
+        }
+      }
+      roots.resize(next);
+      pool.for_each_index(next, [&](size_t k, size_t) { best[roots[k]] = none; }, mst_vertex_grain);
+      afforest_compress(comp.data(), n, pool);
+
+      // 3. Drop the arcs inside one component
+      m = mst_partition(
+            pool, arcs.data(), m, scratch,
+            [&comp](const edge_type& a) { return comp[a.source_id] != comp[a.target_id]; }, false);
+    }
+
+    return std::pair<EV, size_t>{total_weight, n - tree_edges};
+  }
+
+  /// Root of x's set without path compression, so that workers can search concurrently while
+  /// the sets do not change.
+  template <class VId, class Alloc>
+  VId disjoint_root(const disjoint_vector<VId, Alloc>& subsets, VId x) {
+    while (subsets[x].id != x)
+      x = subsets[x].id;
+    return x;
+  }
+
+  /// One filter-Kruskal step on first[0, n): see the file description.
+  template <class VId, class EV, class Alloc, class CompareOp, class Emit>
+  void filter_kruskal_step(thread_pool&                          pool,
+                           mst_edge<VId, EV>*                    first,
+                           size_t                                n,
+                           std::vector<mst_edge<VId, EV>>&       scratch,
+                           disjoint_vector<VId, Alloc>&          subsets,
+                           CompareOp&                            compare,
+                           size_t                                base,
+                           uint64_t&                             rng,
+                           Emit&                                 emit) {
+    using edge_type = mst_edge<VId, EV>;
+    auto by_value   = [&compare](const edge_type& a, const edge_type& b) { return compare(a.value, b.value); };
+    auto kruskal    = [&](edge_type* lo, size_t count) {
+      std::sort(lo, lo + count, by_value);
+      for (size_t i = 0; i < count; ++i)
+        if (disjoint_union_find(subsets, lo[i].source_id, lo[i].target_id))
+          emit(lo[i]);
+    };
+    if (n <= base) {
+      kruskal(first, n);
+      return;
+    }
+
+    // Pivot: the median of a random sample (splitmix64)
+    constexpr size_t           samples = 31;
+    std::array<EV, samples>    sample;
+    for (auto& s : sample) {
+      uint64_t z = (rng += 0x9E3779B97F4A7C15ULL);
+      z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      s          = first[(z ^ (z >> 31)) % n].value;
+    }
+    std::nth_element(sample.begin(), sample.begin() + samples / 2, sample.end(), compare);
+    const EV pivot = sample[samples / 2];
+
+    size_t light = mst_partition(
+          pool, first, n, scratch, [&](const edge_type& a) { return compare(a.value, pivot); }, true);
+    if (light == 0) {
+      // The pivot is the smallest weight: split off the edges equal to it instead
+      light = mst_partition(
+            pool, first, n, scratch, [&](const edge_type& a) { return !compare(pivot, a.value); }, true);
+      if (light == n) {
+        kruskal(first, n); // all weights equal
+        return;
+      }
+    }
+    filter_kruskal_step(pool, first, light, scratch, subsets, compare, base, rng, emit);
+
+    edge_type*   heavy = first + light;
+    const size_t kept  = mst_partition(
+          pool, heavy, n - light, scratch,
+          [&subsets](const edge_type& a) {
+            return disjoint_root(subsets, a.source_id) != disjoint_root(subsets, a.target_id);
+          },
+          false);
+    filter_kruskal_step(pool, heavy, kept, scratch, subsets, compare, base, rng, emit);
+  }
+} // namespace detail
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Minimum spanning forest of an index graph with Borůvka's algorithm, on multiple
+ *        threads.
+ *
+ * See the file description for the rounds. The graph is treated as undirected: an edge stored
+ * in one direction is enough, and the second copy of an edge stored in both directions is
+ * dropped once the first joins its endpoints.
+ *
+ * @tparam G         Graph type satisfying index_adjacency_list (e.g. compressed_graph).
+ * @tparam OELR      Output edge list range type.
+ * @tparam WF        Edge weight function type.
+ * @tparam CompareOp Comparison operator type.
+ *
+ * @param g       The graph to process.
+ * @param t       Output edge list for the forest edges. Must support push_back() and reserve().
+ * @param weight  Edge weight function: weight(g, uv), converted to the value type of t.
+ * @param compare Comparison function: compare(ev1, ev2) returns true if ev1 should be preferred.
+ *                Default: std::less<>. Pass std::greater<> for a maximum spanning forest.
+ * @param pool    Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return std::pair<EV, size_t> with the total weight of the forest and the number of
+ *         connected components (isolated vertices included).
+ *
+ * **Mandates:**
+ * - G must satisfy index_adjacency_list
+ * - OELR must satisfy x_index_edgelist_range with push_back() and reserve()
+ *
+ * **Preconditions:**
+ * - Every vertex id of g is representable in the vertex id type of t
+ * - compare must define a strict weak ordering on edge values
+ * - g must not be modified while the algorithm runs
+ *
+ * **Effects:**
+ * - Appends the forest edges to t, in (source, target, value) form as stored in g
+ * - Does not modify the graph g
+ *
+ * **Postconditions:**
+ * - t holds V - components new edges
+ *
+ * **Throws:**
+ * - std::bad_alloc if internal allocations fail
+ * - May propagate exceptions from weight or compare
+ * - Exception guarantee: Basic. Graph g unchanged; output t may be partially written.
+ *
+ * **Complexity:**
+ * - Work: O((V + E) log V)
+ * - Span: O((V + E) / P) per round, at most log2(V) rounds
+ * - Space: O(V + E) for two copies of the edges
+ *
+ * **Remarks:**
+ * - The forest, and the order of its edges, does not depend on the number of workers.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * std::vector<edge_descriptor<uint32_t, double>> forest;
+ * auto [total_weight, components] = boruvka(g, forest);
+ * ```
+ */
+template <index_adjacency_list G, x_index_edgelist_range OELR, class WF, class CompareOp = std::less<>>
+requires std::invocable<WF&, const std::remove_reference_t<G>&, const edge_t<G>&>
+auto boruvka(G&&          g,       // graph
+             OELR&&       t,       // forest
+             WF&&         weight,  // edge weight function
+             CompareOp    compare = CompareOp(),
+             thread_pool& pool    = default_thread_pool()) {
+  return detail::boruvka_impl(g, t, weight, compare, pool);
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Minimum spanning forest of an index graph with Borůvka's algorithm, weighted by
+ *        edge_value(g, uv).
+ *
+ * All parameters other than weight and compare, and the mandates, preconditions and complexity,
+ * are those of the overload above.
+ */
+template <index_adjacency_list G, x_index_edgelist_range OELR>
+auto boruvka(G&& g, OELR&& t, thread_pool& pool = default_thread_pool()) {
+  auto weight  = [](const auto& gr, const auto& uv) { return edge_value(gr, uv); };
+  auto compare = std::less<>();
+  return detail::boruvka_impl(g, t, weight, compare, pool);
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Minimum spanning forest of an edge list with filter-Kruskal, on multiple threads.
+ *
+ * A drop-in replacement for kruskal: the same input and output edge lists, comparison and
+ * result. See the file description for the partitioning.
+ *
+ * @tparam IELR      Input edge list range type.
+ * @tparam OELR      Output edge list range type.
+ * @tparam CompareOp Comparison operator type.
+ *
+ * @param e       Input edge list with source_id, target_id, and value members.
+ * @param t       Output edge list for the forest edges. Must support push_back() and reserve().
+ * @param compare Comparison function: compare(ev1, ev2) returns true if ev1 should be processed first.
+ * @param pool    Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return std::pair<EV, size_t> with the total weight of the forest and the number of
+ *         connected components, counting the vertices 0 to the largest id in e, as kruskal.
+ *
+ * **Mandates:**
+ * - IELR must satisfy x_index_edgelist_range
+ * - OELR must satisfy x_index_edgelist_range with push_back() and reserve()
+ *
+ * **Preconditions:**
+ * - compare must define a strict weak ordering on edge values
+ *
+ * **Effects:**
+ * - Copies the edge list; input e is unchanged
+ * - Appends the forest edges to t in ascending order of weight (by compare)
+ *
+ * **Throws:**
+ * - std::bad_alloc if internal containers cannot allocate memory
+ * - May propagate exceptions from the comparison operator
+ * - Exception guarantee: Basic. Input e unchanged; output t may be partially written.
+ *
+ * **Complexity:**
+ * - Work: O(E log E) worst case; O(E + V log V log(E/V)) expected on random edge weights
+ * - Space: O(E + V) for two copies of the edges and the disjoint-set structure
+ *
+ * **Remarks:**
+ * - Which of several edges of equal weight joins the forest may depend on the number of workers;
+ *   the total weight does not.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * std::vector<edge_descriptor<uint32_t, int>> mst;
+ * auto [total_weight, components] = filter_kruskal(edges, mst);
+ * ```
+ */
+template <x_index_edgelist_range IELR, x_index_edgelist_range OELR, class CompareOp>
+requires std::strict_weak_order<CompareOp&,
+                                const typename std::ranges::range_value_t<IELR>::value_type&,
+                                const typename std::ranges::range_value_t<IELR>::value_type&>
+auto filter_kruskal(IELR&&       e,       // graph
+                    OELR&&       t,       // tree
+                    CompareOp    compare, // edge value comparator
+                    thread_pool& pool = default_thread_pool()) {
+  using edge_data = std::ranges::range_value_t<IELR>;
+  using VId       = std::remove_const_t<typename edge_data::source_id_type>;
+  using EV        = typename edge_data::value_type;
+  using edge_type = detail::mst_edge<VId, EV>;
+
+  if (std::ranges::empty(e)) {
+    t.clear();
+    return std::pair<EV, size_t>{EV{}, 0};
+  }
+
+  // Copy the edges and find the largest vertex id, in parallel for random-access input
+  std::vector<edge_type> work;
+  VId                    N = 0;
+  if constexpr (std::ranges::random_access_range<IELR> && std::ranges::sized_range<IELR>) {
+    const size_t     m = static_cast<size_t>(std::ranges::size(e));
+    std::vector<VId> local_max(pool.size(), VId{0});
+    work.resize(m);
+    auto in = std::ranges::begin(e);
+    pool.for_each_chunk(m, [&](size_t lo, size_t hi, size_t tid) {
+      VId high = local_max[tid];
+      for (size_t i = lo; i < hi; ++i) {
+        const auto& ed = in[static_cast<std::ranges::range_difference_t<IELR>>(i)];
+        work[i]        = {ed.source_id, ed.target_id, ed.value};
+        high           = std::max({high, static_cast<VId>(ed.source_id), static_cast<VId>(ed.target_id)});
+      }
+      local_max[tid] = high;
+    });
+    N = *std::ranges::max_element(local_max);
+  } else {
+    for (auto&& ed : e) {
+      work.push_back({ed.source_id, ed.target_id, ed.value});
+      N = std::max({N, static_cast<VId>(ed.source_id), static_cast<VId>(ed.target_id)});
+    }
+  }
+
+  // Initialize disjoint-set: each vertex starts in its own set
+  disjoint_vector<VId> subsets(static_cast<size_t>(N) + 1);
+  pool.for_each_index(subsets.size(), [&subsets](size_t v, size_t) { subsets[v].id = static_cast<VId>(v); });
+
+  t.reserve(t.size() + static_cast<size_t>(N));
+  EV     total_weight   = EV{};
+  size_t num_components = static_cast<size_t>(N) + 1;
+  auto   emit           = [&](const edge_type& a) {
+    t.push_back(std::ranges::range_value_t<OELR>());
+    t.back().source_id = a.source_id;
+    t.back().target_id = a.target_id;
+    t.back().value     = a.value;
+    total_weight += a.value;
+    --num_components;
+  };
+
+  std::vector<edge_type> scratch;
+  uint64_t               rng  = 0x5DEECE66DULL;
+  const size_t           base = std::max(detail::filter_kruskal_base, subsets.size() / 2);
+  detail::filter_kruskal_step(pool, work.data(), work.size(), scratch, subsets, compare, base, rng, emit);
+
+  return std::pair<EV, size_t>{total_weight, num_components};
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Minimum spanning forest of an edge list with filter-Kruskal, comparing edge values
+ *        with operator<.
+ *
+ * All parameters other than compare, and the mandates, preconditions and complexity, are those
+ * of the overload above.
+ */
+template <x_index_edgelist_range IELR, x_index_edgelist_range OELR>
+auto filter_kruskal(IELR&& e, OELR&& t, thread_pool& pool = default_thread_pool()) {
+  return filter_kruskal(e, t, [](auto&& i, auto&& j) { return i < j; }, pool);
+}
+
+} // namespace graph
+
+#endif // GRAPH_PARALLEL_MST_HPP
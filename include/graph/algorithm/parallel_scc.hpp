@@ -0,0 +1,468 @@
+/**
+ * @file parallel_scc.hpp
+ *
+ * @brief Multi-threaded strongly connected components (Multistep).
+ *
+ * Follows Slota, Rajamanickam and Madduri, "BFS and Coloring-based Parallel Algorithms for
+ * Strongly Connected Components and Related Problems" (IPDPS'14). Every phase is a parallel,
+ * level-synchronous sweep over a frontier of vertex ids, and each removes whole SCCs:
+ *
+ * 1. **Trim**: a vertex without in-edges or without out-edges from the remaining vertices is an
+ *    SCC of its own. Removing it decrements the counters of its neighbours, which may then be
+ *    trimmed in the next level (complete trimming).
+ * 2. **Forward-backward**: the vertices reached from a pivot by a forward search, that also
+ *    reach it by a backward search restricted to them, form the pivot's SCC. The pivot
+ *    maximizes in-degree times out-degree, so on graphs with a giant SCC this removes it.
+ * 3. **Coloring**: every remaining vertex starts with its own id as color, and the largest
+ *    color is propagated along out-edges. A vertex whose color is its own id is a root; its
+ *    SCC is the set of vertices of that color reaching it, found by a backward search from
+ *    all roots at once. Rounds repeat on the vertices still unassigned.
+ * 4. **Serial**: once few vertices are left, or a coloring round assigned only a small
+ *    fraction of them, Tarjan's algorithm finishes the remaining subgraph.
+ *
+ * Backward searches use in_edges(g, v) on bidirectional graphs, a transpose passed by the
+ * caller, or an in-edge index built once in parallel. Each SCC is labelled by one of its
+ * vertices (the trimmed vertex, pivot, root or Tarjan root); these labels do not depend on
+ * the schedule, and component ids are numbered in the order of their representatives.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/traversal_common.hpp"
+#include "graph/detail/in_edge_index.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#ifndef GRAPH_PARALLEL_SCC_HPP
+#  define GRAPH_PARALLEL_SCC_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::bidirectional_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::num_vertices;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+
+namespace detail {
+  // Frontier vertices per dynamically scheduled chunk; their cost is their degree
+  inline constexpr size_t scc_grain = 256;
+
+  // Coloring hands the rest to Tarjan's algorithm once at most this many vertices are left,
+  // or when a round assigned fewer than 1/scc_min_round_fraction of them (e.g. a chain of
+  // small cycles whose ids decrease along the chain, which coloring peels one per round)
+  inline constexpr size_t scc_serial_cutoff      = 1024;
+  inline constexpr size_t scc_min_round_fraction = 64;
+
+  /// Shared body of the parallel_scc overloads. for_each_in(v, f) calls f(u) for the source u
+  /// of every in-edge (u, v) of v.
+  template <index_adjacency_list G, class InFn, class ComponentFn>
+  size_t parallel_scc_impl(G& g, InFn&& for_each_in, ComponentFn& component, thread_pool& pool) {
+    using id_type              = vertex_id_t<G>;
+    using CT                   = vertex_fn_value_t<ComponentFn, G>;
+    constexpr id_type none     = std::numeric_limits<id_type>::max();
+    constexpr auto    relaxed  = std::memory_order_relaxed;
+    constexpr auto    seq_cst  = std::memory_order_seq_cst;
+
+    const size_t n = static_cast<size_t>(num_vertices(g));
+    if (n == 0)
+      return 0;
+
+    auto for_each_out = [&g](size_t v, auto&& f) {
+      for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(v))))
+        f(static_cast<size_t>(target_id(g, uv)));
+    };
+
+    // label[v]: the representative of v's SCC, one of its vertices; none while unassigned.
+    // Written only by claim() during the parallel phases.
+    std::vector<id_type> label(n, none);
+    auto                 claim = [&label](size_t v, id_type rep) {
+      std::atomic_ref<id_type> l(label[v]);
+      id_type                  expected = none;
+      return l.load(relaxed) == none && l.compare_exchange_strong(expected, rep, relaxed);
+    };
+
+    // Runs visit(v, push) for every frontier vertex in parallel, where push(w) adds w to the
+    // next level, until a level is empty. Returns the number of vertices visited.
+    std::vector<id_type>              frontier;
+    std::vector<std::vector<id_type>> local_next(pool.size());
+    auto                              gather = [&] {
+      frontier.clear();
+      for (auto& out : local_next) {
+        frontier.insert(frontier.end(), out.begin(), out.end());
+        out.clear();
+      }
+    };
+    auto expand = [&](auto&& visit) {
+      size_t visited = 0;
+      while (!frontier.empty()) {
+        visited += frontier.size();
+        pool.for_each_chunk(
+              frontier.size(),
+              [&](size_t lo, size_t hi, size_t tid) {
+                auto& out  = local_next[tid];
+                auto  push = [&out](size_t w) { out.push_back(static_cast<id_type>(w)); };
+                for (size_t i = lo; i < hi; ++i)
+                  visit(static_cast<size_t>(frontier[i]), push);
+              },
+              scc_grain);
+        gather();
+      }
+      return visited;
+    };
+
+    // --- Trim ---
+    // Counters exclude self-loops: a vertex whose only in-edge is a self-loop is still alone
+    std::vector<size_t> in_count(n), out_count(n);
+    pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t tid) {
+      for (size_t v = lo; v < hi; ++v) {
+        size_t out = 0, in = 0;
+        for_each_out(v, [&](size_t w) { out += w != v; });
+        for_each_in(v, [&](size_t u) { in += u != v; });
+        out_count[v] = out;
+        in_count[v]  = in;
+        if (in == 0 || out == 0) {
+          label[v] = static_cast<id_type>(v);
+          local_next[tid].push_back(static_cast<id_type>(v));
+        }
+      }
+    });
+    gather();
+    size_t remaining = n - expand([&](size_t v, auto& push) {
+                         for_each_out(v, [&](size_t w) {
+                           if (w != v && std::atomic_ref<size_t>(in_count[w]).fetch_sub(1, relaxed) == 1 &&
+                               claim(w, static_cast<id_type>(w)))
+                             push(w);
+                         });
+                         for_each_in(v, [&](size_t u) {
+                           if (u != v && std::atomic_ref<size_t>(out_count[u]).fetch_sub(1, relaxed) == 1 &&
+                               claim(u, static_cast<id_type>(u)))
+                             push(u);
+                         });
+                       });
+
+    // --- Forward-backward from the vertex with the largest in-degree * out-degree ---
+    std::vector<uint8_t> flag(n, 0); // reached forward; later, queued for coloring / on stack
+    if (remaining > 0) {
+      struct candidate {
+        size_t score = 0;
+        size_t v     = 0;
+      };
+      auto better = [](const candidate& a, const candidate& b) {
+        return a.score > b.score || (a.score == b.score && a.v < b.v);
+      };
+      std::vector<candidate> best(pool.size(), candidate{0, n});
+      pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t tid) {
+        for (size_t v = lo; v < hi; ++v)
+          if (label[v] == none && better({in_count[v] * out_count[v], v}, best[tid]))
+            best[tid] = {in_count[v] * out_count[v], v};
+      });
+      candidate pivot{0, n};
+      for (const auto& c : best)
+        if (better(c, pivot))
+          pivot = c;
+      const id_type p = static_cast<id_type>(pivot.v);
+
+      flag[pivot.v] = 1;
+      frontier.assign(1, p);
+      expand([&](size_t v, auto& push) {
+        for_each_out(v, [&](size_t w) {
+          std::atomic_ref<uint8_t> reached(flag[w]);
+          if (label[w] == none && reached.load(relaxed) == 0 && reached.exchange(1, relaxed) == 0)
+            push(w);
+        });
+      });
+
+      // Every vertex on a backward path from the pivot to a forward-reached vertex is itself
+      // forward-reached, so the backward search only needs to look at those
+      label[pivot.v] = p;
+      frontier.assign(1, p);
+      remaining -= expand([&](size_t v, auto& push) {
+        for_each_in(v, [&](size_t u) {
+          if (flag[u] && claim(u, p))
+            push(u);
+        });
+      });
+    }
+
+    // --- Coloring rounds ---
+    std::vector<id_type> color;
+    while (remaining > scc_serial_cutoff) {
+      if (color.empty())
+        color.resize(n);
+      pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t tid) {
+        for (size_t v = lo; v < hi; ++v) {
+          if (label[v] == none) {
+            color[v] = static_cast<id_type>(v);
+            flag[v]  = 1;
+            local_next[tid].push_back(static_cast<id_type>(v));
+          }
+        }
+      });
+      gather();
+
+      // Propagate the largest color. A vertex is queued again whenever its color is raised;
+      // clearing its flag before reading its color (both seq_cst) ensures a raise is never
+      // missed between the two.
+      expand([&](size_t v, auto& push) {
+        std::atomic_ref<uint8_t>(flag[v]).store(0, seq_cst);
+        const id_type c = std::atomic_ref<id_type>(color[v]).load(seq_cst);
+        for_each_out(v, [&](size_t w) {
+          if (label[w] != none)
+            return;
+          std::atomic_ref<id_type> cw(color[w]);
+          id_type                  cur = cw.load(relaxed);
+          while (cur < c && !cw.compare_exchange_weak(cur, c, seq_cst, relaxed)) {
+          }
+          if (cur < c && std::atomic_ref<uint8_t>(flag[w]).exchange(1, seq_cst) == 0)
+            push(w);
+        });
+      });
+
+      // Roots keep their own color; each collects the vertices of its color that reach it
+      pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t tid) {
+        for (size_t v = lo; v < hi; ++v) {
+          if (label[v] == none && color[v] == v) {
+            label[v] = static_cast<id_type>(v);
+            local_next[tid].push_back(static_cast<id_type>(v));
+          }
+        }
+      });
+      gather();
+      const size_t assigned = expand([&](size_t v, auto& push) {
+        const id_type c = color[v];
+        for_each_in(v, [&](size_t u) {
+          if (color[u] == c && claim(u, c))
+            push(u);
+        });
+      });
+      const bool slow = assigned < remaining / scc_min_round_fraction;
+      remaining -= assigned;
+      if (slow)
+        break;
+    }
+
+    // --- Tarjan on the remaining vertices ---
+    if (remaining > 0) {
+      using edge_iter = std::ranges::iterator_t<decltype(edges(g, *find_vertex(g, id_type{})))>;
+      struct frame {
+        id_type   v;
+        edge_iter it, end;
+      };
+      constexpr size_t     unvisited = std::numeric_limits<size_t>::max();
+      std::vector<size_t>  disc(n, unvisited), low(n);
+      std::vector<id_type> stack;
+      std::vector<frame>   dfs;
+      size_t               timer = 0;
+      std::ranges::fill(flag, uint8_t{0}); // on the Tarjan stack
+
+      auto enter = [&](id_type v) {
+        disc[v] = low[v] = timer++;
+        flag[v]          = 1;
+        stack.push_back(v);
+        auto&& adj = edges(g, *find_vertex(g, v));
+        dfs.push_back({v, std::ranges::begin(adj), std::ranges::end(adj)});
+      };
+      for (size_t s = 0; s < n; ++s) {
+        if (label[s] != none || disc[s] != unvisited)
+          continue;
+        enter(static_cast<id_type>(s));
+        while (!dfs.empty()) {
+          auto& [v, it, end] = dfs.back();
+          if (it != end) {
+            const id_type w = static_cast<id_type>(target_id(g, *it));
+            ++it;
+            if (label[w] != none)
+              continue; // in an SCC found by an earlier phase
+            if (disc[w] == unvisited)
+              enter(w);
+            else if (flag[w])
+              low[v] = std::min(low[v], disc[w]);
+            continue;
+          }
+          const id_type u = v;
+          dfs.pop_back();
+          if (!dfs.empty())
+            low[dfs.back().v] = std::min(low[dfs.back().v], low[u]);
+          if (low[u] == disc[u]) {
+            id_type w;
+            do {
+              w = stack.back();
+              stack.pop_back();
+              flag[w]  = 0;
+              label[w] = u;
+            } while (w != u);
+          }
+        }
+      }
+    }
+
+    // Number the SCCs in the order of their representatives
+    std::vector<size_t> rank(n);
+    pool.for_each_index(n, [&](size_t v, size_t) { rank[v] = label[v] == v ? 1 : 0; });
+    const size_t count = parallel_exclusive_scan(pool, rank.begin(), n);
+    pool.for_each_index(n, [&](size_t v, size_t) {
+      component(g, static_cast<id_type>(v)) = static_cast<CT>(rank[label[v]]);
+    });
+    return count;
+  }
+} // namespace detail
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Finds strongly connected components on multiple threads, using a transpose graph.
+ *
+ * A drop-in replacement for kosaraju(g, g_t, component): trimming, a forward-backward search
+ * from a pivot and coloring rounds (see the file description) assign whole SCCs in parallel,
+ * and Tarjan's algorithm finishes what little remains.
+ *
+ * @tparam G           The graph type. Must satisfy index_adjacency_list.
+ * @tparam GT          The transpose graph type. Must satisfy index_adjacency_list.
+ * @tparam ComponentFn Callable providing per-vertex component ID access:
+ *                     (const G&, vertex_id_t<G>) -> ComponentID&. Must satisfy
+ *                     vertex_property_fn_for<ComponentFn, G>.
+ *
+ * @param g         The directed graph to analyze
+ * @param g_t       The transpose of g
+ * @param component Callable providing per-vertex component access: component(g, uid) -> ComponentID&.
+ *                  For containers: wrap with container_value_fn(c).
+ * @param pool      Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return Number of strongly connected components found
+ *
+ * **Mandates:**
+ * - G and GT must satisfy index_adjacency_list
+ * - ComponentFn must satisfy vertex_property_fn_for<ComponentFn, G>
+ *
+ * **Preconditions:**
+ * - g_t has the same vertices as g and an edge (v,u) for every edge (u,v) of g
+ * - component(g, uid) returns a valid reference for every vertex in g, and references for
+ *   different vertices can be assigned concurrently
+ *
+ * **Effects:**
+ * - Sets component(g, uid) for all vertices
+ * - Does not modify g or g_t
+ *
+ * **Postconditions:**
+ * - Vertices in the same SCC have the same component ID
+ * - Component IDs are 0, 1, ..., num_components-1, numbered in the order of one
+ *   representative vertex per SCC; they do not depend on the number of workers
+ *
+ * **Throws:**
+ * - std::bad_alloc if internal allocations fail
+ * - Exception guarantee: Basic. The graphs remain unchanged; component is written only at
+ *   the end.
+ *
+ * **Complexity:**
+ * - Work: O(V + E) for trimming, forward-backward and the final Tarjan pass, plus O(V + E)
+ *   per coloring step; coloring needs as many steps as the longest path of increasing colors
+ * - Span: O((V + E) / P) per frontier level
+ * - Space: O(V)
+ *
+ * **Remarks:**
+ * - Prefer tarjan_scc for small graphs and for graphs whose SCCs are all small and chained
+ *   (the serial fallback then does all the work after the coloring rounds).
+ * - Self-loops and multi-edges are handled correctly.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * #include <graph/algorithm/parallel_scc.hpp>
+ *
+ * std::vector<uint32_t> comp(num_vertices(g));
+ * size_t num = parallel_scc(g, g_t, container_value_fn(comp));
+ * ```
+ *
+ * @see kosaraju, tarjan_scc For the serial algorithms
+ */
+template <index_adjacency_list G, index_adjacency_list GT, class ComponentFn>
+requires vertex_property_fn_for<ComponentFn, G>
+size_t parallel_scc(G&&           g,         // graph
+                    GT&&          g_t,       // graph transpose
+                    ComponentFn&& component, // out: strongly connected component assignment
+                    thread_pool&  pool = default_thread_pool()) {
+  using id_type = vertex_id_t<std::remove_cvref_t<GT>>;
+  return detail::parallel_scc_impl(
+        g,
+        [&g_t](size_t v, auto&& f) {
+          for (auto&& vu : edges(g_t, *find_vertex(g_t, static_cast<id_type>(v))))
+            f(static_cast<size_t>(target_id(g_t, vu)));
+        },
+        component, pool);
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Finds strongly connected components on multiple threads.
+ *
+ * A drop-in replacement for tarjan_scc(g, component) and kosaraju(g, component). Backward
+ * searches use in_edges(g, v) when G is bidirectional; otherwise an in-edge index of g is
+ * built first, in parallel.
+ *
+ * All parameters, mandates, postconditions and remarks are those of the transpose overload.
+ *
+ * **Complexity:**
+ * - As the transpose overload, plus O(V + E) work and space for the in-edge index when G is
+ *   not bidirectional
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * using G = container::compressed_graph<void, void, void, uint32_t, uint64_t, true>; // bidirectional
+ * std::vector<uint32_t> comp(num_vertices(g));
+ * size_t num = parallel_scc(g, container_value_fn(comp));
+ * ```
+ */
+template <index_adjacency_list G, class ComponentFn>
+requires vertex_property_fn_for<ComponentFn, G>
+size_t parallel_scc(G&&           g,         // graph
+                    ComponentFn&& component, // out: strongly connected component assignment
+                    thread_pool&  pool = default_thread_pool()) {
+  using graph_type = std::remove_cvref_t<G>;
+  using id_type    = vertex_id_t<graph_type>;
+  if constexpr (bidirectional_adjacency_list<graph_type>) {
+    return detail::parallel_scc_impl(
+          g,
+          [&g](size_t v, auto&& f) {
+            for (auto&& vu : adj_list::in_edges(g, *find_vertex(g, static_cast<id_type>(v))))
+              f(static_cast<size_t>(adj_list::source_id(g, vu)));
+          },
+          component, pool);
+  } else {
+    const size_t        n = static_cast<size_t>(num_vertices(g));
+    std::vector<size_t> degrees(pool.size(), 0);
+    pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t tid) {
+      for (size_t u = lo; u < hi; ++u)
+        degrees[tid] += static_cast<size_t>(std::ranges::distance(edges(g, *find_vertex(g, static_cast<id_type>(u)))));
+    });
+    size_t m = 0;
+    for (size_t d : degrees)
+      m += d;
+    const auto index = detail::build_in_edge_index(g, m, pool);
+    return detail::parallel_scc_impl(
+          g,
+          [&index](size_t v, auto&& f) {
+            for (size_t k = index.offsets[v]; k < index.offsets[v + 1]; ++k)
+              f(static_cast<size_t>(index.sources[k]));
+          },
+          component, pool);
+  }
+}
+
+} // namespace graph
+
+#endif // GRAPH_PARALLEL_SCC_HPP
@@ -0,0 +1,313 @@
+/**
+ * @file parallel_triangle_count.hpp
+ *
+ * @brief Multi-threaded triangle counting on a degree-ordered orientation of the graph.
+ *
+ * The serial triangle_count walks every edge (u, v) with u < v by vertex id, so a hub with a
+ * small id intersects its full adjacency list once per neighbor and the cost explodes on
+ * skewed degree distributions. parallel_triangle_count first orients every undirected edge
+ * from the endpoint of lower degree to the endpoint of higher degree (ties broken by id),
+ * giving a DAG whose out-degrees are at most O(sqrt(E)) (Schank & Wagner; Shun & Tangwongsan,
+ * "Multicore Triangle Computations Without Tuning", ICDE'15). Each triangle {a, b, c} with
+ * a ≺ b ≺ c in that order is then found exactly once, as c ∈ out(a) ∩ out(b).
+ *
+ * Both phases run on a thread_pool:
+ * - the oriented CSR is built with a parallel count, prefix sum and fill, copying each
+ *   vertex's kept targets in their existing (ascending id) order;
+ * - the intersections are scheduled dynamically over vertices in small chunks, with
+ *   per-worker counters, using the kernels of detail/sorted_intersection.hpp.
+ *
+ * An overload also reports the number of triangles through every vertex, the numerator of
+ * the local clustering coefficient.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/traversal_common.hpp"
+#include "graph/detail/sorted_intersection.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#ifndef GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
+#  define GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::ordered_vertex_edges;
+using adj_list::vertex_id_t;
+using adj_list::num_vertices;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+using adj_list::degree;
+
+namespace detail {
+  /// Out-edges of the degree-ordered orientation, in CSR form. Targets of each row are in
+  /// ascending id order.
+  template <class VId>
+  struct oriented_adjacency {
+    std::vector<size_t> offsets; // size n + 1
+    std::vector<VId>    targets;
+
+    [[nodiscard]] std::span<const VId> out(size_t u) const noexcept {
+      return {targets.data() + offsets[u], offsets[u + 1] - offsets[u]};
+    }
+  };
+
+  /// Orient every edge u -> v with (degree(u), u) < (degree(v), v); drops self-loops and
+  /// repeated targets (lists are sorted, so repeats are adjacent).
+  template <index_adjacency_list G>
+  oriented_adjacency<vertex_id_t<G>> degree_oriented_adjacency(const G& g, thread_pool& pool) {
+    using id_type  = vertex_id_t<G>;
+    const size_t n = static_cast<size_t>(num_vertices(g));
+
+    std::vector<size_t> deg(n);
+    pool.for_each_index(n, [&](size_t u, size_t) {
+      deg[u] = static_cast<size_t>(degree(g, *find_vertex(g, static_cast<id_type>(u))));
+    });
+    auto precedes = [&deg](size_t u, size_t v) { return deg[u] < deg[v] || (deg[u] == deg[v] && u < v); };
+
+    // Visits the kept targets of u in list order
+    auto for_each_kept = [&](size_t u, auto&& fn) {
+      bool    have_prev = false;
+      id_type prev{};
+      for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u)))) {
+        const id_type vid    = static_cast<id_type>(target_id(g, uv));
+        const bool    repeat = have_prev && vid == prev;
+        have_prev            = true;
+        prev                 = vid;
+        if (!repeat && precedes(u, static_cast<size_t>(vid)))
+          fn(vid);
+      }
+    };
+
+    oriented_adjacency<id_type> dag;
+    dag.offsets.assign(n + 1, 0);
+    pool.for_each_index(n, [&](size_t u, size_t) {
+      size_t k = 0;
+      for_each_kept(u, [&k](id_type) { ++k; });
+      dag.offsets[u] = k;
+    });
+    parallel_exclusive_scan(pool, dag.offsets.begin(), n + 1);
+
+    dag.targets.resize(dag.offsets[n]);
+    pool.for_each_index(n, [&](size_t u, size_t) {
+      id_type* out = dag.targets.data() + dag.offsets[u];
+      for_each_kept(u, [&out](id_type vid) { *out++ = vid; });
+    });
+    return dag;
+  }
+
+  // Vertices per dynamically scheduled chunk of the counting phase. Small, because the work per
+  // vertex varies by orders of magnitude on skewed graphs.
+  inline constexpr size_t triangle_count_grain = 64;
+} // namespace detail
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Count triangles in an undirected graph on multiple threads.
+ *
+ * Orients each edge from its lower-degree to its higher-degree endpoint and counts, for every
+ * oriented edge (u, v), the common out-neighbors of u and v. Vertices are distributed over the
+ * pool in small dynamically scheduled chunks; each worker accumulates into its own counter.
+ *
+ * @tparam G Graph type satisfying index_adjacency_list with ordered edges.
+ *
+ * @param g    The graph. Must be undirected (each edge stored in both directions) with
+ *             adjacency lists sorted by target id.
+ * @param pool Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return Number of triangles, each counted once.
+ *
+ * **Mandates:**
+ * - G must satisfy index_adjacency_list
+ * - G must satisfy ordered_vertex_edges (adjacency lists sorted by target ID)
+ *
+ * **Preconditions:**
+ * - Graph must store undirected edges bidirectionally (both (u,v) and (v,u))
+ * - Adjacency lists must be sorted by target_id in ascending order
+ *
+ * **Effects:**
+ * - Builds a degree-ordered oriented copy of the adjacency structure and counts on it
+ * - Does not modify the graph g
+ *
+ * **Returns:**
+ * - Number of triangles of the underlying simple graph (size_t)
+ *
+ * **Throws:**
+ * - std::bad_alloc if the oriented copy cannot be allocated
+ * - Exception guarantee: Strong. g is unchanged.
+ *
+ * **Complexity:**
+ * - Work: O(E^(3/2)) worst case (independent of the degree distribution), O(V + E) to orient
+ * - Span: O((V + E) / P + max oriented intersection) on P workers
+ * - Space: O(V + E) for the oriented CSR
+ *
+ * **Remarks:**
+ * - Multi-edges and self-loops are ignored: the result is the number of 3-cliques. The serial
+ *   triangle_count matches it on simple graphs.
+ * - Use directed_triangle_count for directed 3-cycles; this algorithm assumes symmetry.
+ *
+ * **Supported Graph Properties:**
+ *
+ * Directedness:
+ * - ✅ Undirected graphs (each edge stored bidirectionally)
+ * - ❌ Directed graphs: edges are treated as undirected only if stored both ways
+ *
+ * Edge Properties:
+ * - ✅ Unweighted edges
+ * - ✅ Weighted edges (weights ignored)
+ * - ✅ Multi-edges: counted once
+ * - ✅ Self-loops: ignored
+ *
+ * Graph Structure:
+ * - ✅ Connected graphs
+ * - ✅ Disconnected graphs
+ * - ✅ Skewed (power-law) degree distributions
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * #include <graph/algorithm/parallel_triangle_count.hpp>
+ *
+ * using G = container::compressed_graph<void, void, void, uint32_t, uint64_t>;
+ * G g = ...; // symmetric, rows sorted by target id
+ *
+ * size_t total = parallel_triangle_count(g);
+ * ```
+ *
+ * @see triangle_count
+ */
+template <index_adjacency_list G>
+requires ordered_vertex_edges<G>
+[[nodiscard]] size_t parallel_triangle_count(G&& g, thread_pool& pool = default_thread_pool()) {
+  const auto   dag = detail::degree_oriented_adjacency(g, pool);
+  const size_t n   = static_cast<size_t>(num_vertices(g));
+
+  std::vector<size_t> partial(pool.size(), 0); // per-worker counters
+  pool.for_each_chunk(
+        n,
+        [&](size_t first, size_t last, size_t tid) {
+          size_t local = 0;
+          for (size_t u = first; u < last; ++u) {
+            const auto out_u = dag.out(u);
+            for (const auto vid : out_u) {
+              const auto out_v = dag.out(static_cast<size_t>(vid));
+              local += detail::sorted_intersection_count(out_u.data(), out_u.size(), out_v.data(), out_v.size());
+            }
+          }
+          partial[tid] += local;
+        },
+        detail::triangle_count_grain);
+
+  size_t total = 0;
+  for (auto p : partial)
+    total += p;
+  return total;
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Count triangles on multiple threads and the number of triangles through each vertex.
+ *
+ * As parallel_triangle_count(g, pool), and also sets triangles(g, uid) to the number of
+ * triangles that contain uid. The local clustering coefficient of a vertex of degree d
+ * (without self-loops or multi-edges) is then 2 * triangles(g, uid) / (d * (d - 1)).
+ *
+ * @tparam G          Graph type satisfying index_adjacency_list with ordered edges.
+ * @tparam TriangleFn Callable: triangles(g, uid) -> T& with integral T.
+ *
+ * @param g         The graph (see parallel_triangle_count(g, pool)).
+ * @param triangles Per-vertex output. Every vertex is written; prior values are ignored.
+ * @param pool      Thread pool to run on. Default: default_thread_pool().
+ *
+ * @return Number of triangles, each counted once. The per-vertex counts sum to 3 times this.
+ *
+ * **Mandates:**
+ * - G must satisfy index_adjacency_list and ordered_vertex_edges
+ * - TriangleFn must satisfy vertex_property_fn_for<G> with an integral value type
+ *
+ * **Preconditions:**
+ * - As parallel_triangle_count(g, pool)
+ * - triangles(g, uid) is called concurrently for distinct uid; values must not share storage
+ *   between vertices (std::vector<bool> is not suitable)
+ *
+ * **Throws:**
+ * - std::bad_alloc if internal allocations fail
+ * - Exception guarantee: Basic. g is unchanged; per-vertex output may be partial.
+ *
+ * **Complexity:**
+ * - As parallel_triangle_count, plus O(V) space for the per-vertex counters
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * std::vector<uint64_t> tri(num_vertices(g));
+ * size_t total = parallel_triangle_count(g, container_value_fn(tri));
+ * ```
+ */
+template <index_adjacency_list G, class TriangleFn>
+requires ordered_vertex_edges<G> && vertex_property_fn_for<TriangleFn, G> &&
+         std::integral<vertex_fn_value_t<TriangleFn, G>>
+size_t parallel_triangle_count(G&& g, TriangleFn&& triangles, thread_pool& pool = default_thread_pool()) {
+  using id_type    = vertex_id_t<G>;
+  using count_type = vertex_fn_value_t<TriangleFn, G>;
+
+  const auto   dag = detail::degree_oriented_adjacency(g, pool);
+  const size_t n   = static_cast<size_t>(num_vertices(g));
+
+  // u's own count is accumulated locally; v and w belong to other chunks, so they are
+  // incremented atomically
+  std::vector<size_t> counts(n, 0);
+  std::vector<size_t> partial(pool.size(), 0);
+  pool.for_each_chunk(
+        n,
+        [&](size_t first, size_t last, size_t tid) {
+          size_t local = 0;
+          for (size_t u = first; u < last; ++u) {
+            const auto out_u   = dag.out(u);
+            size_t     u_count = 0;
+            for (const auto vid : out_u) {
+              const auto out_v   = dag.out(static_cast<size_t>(vid));
+              size_t     v_count = 0;
+              detail::sorted_intersection(out_u.data(), out_u.size(), out_v.data(), out_v.size(), [&](id_type wid) {
+                ++v_count;
+                std::atomic_ref<size_t>(counts[static_cast<size_t>(wid)]).fetch_add(1, std::memory_order_relaxed);
+              });
+              if (v_count != 0)
+                std::atomic_ref<size_t>(counts[static_cast<size_t>(vid)]).fetch_add(v_count, std::memory_order_relaxed);
+              u_count += v_count;
+            }
+            if (u_count != 0)
+              std::atomic_ref<size_t>(counts[u]).fetch_add(u_count, std::memory_order_relaxed);
+            local += u_count;
+          }
+          partial[tid] += local;
+        },
+        detail::triangle_count_grain);
+
+  pool.for_each_index(n, [&](size_t u, size_t) {
+    triangles(g, static_cast<id_type>(u)) = static_cast<count_type>(counts[u]);
+  });
+
+  size_t total = 0;
+  for (auto p : partial)
+    total += p;
+  return total;
+}
+
+} // namespace graph
+
+#endif // GRAPH_PARALLEL_TRIANGLE_COUNT_HPP
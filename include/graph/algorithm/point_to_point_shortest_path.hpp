@@ -0,0 +1,545 @@
+/**
+ * @file point_to_point_shortest_path.hpp
+ *
+ * @brief Shortest path between one source and one target: Dijkstra with early exit,
+ *        bidirectional Dijkstra and A*.
+ *
+ * dijkstra_shortest_paths settles every vertex reachable from the sources. A route query needs
+ * only the distance to one target, which is known as soon as the target is settled, so these
+ * searches stop there and explore only the vertices closer to the source than the target:
+ *
+ * - dijkstra_shortest_path               : Dijkstra that returns when the target is settled.
+ * - bidirectional_dijkstra_shortest_path : a forward search over out-edges from the source and a
+ *   backward search over in_edges from the target, advancing the one with the smaller queue key
+ *   and stopping when the two keys add up to the best source-target connection seen (Goldberg
+ *   and Harrelson's criterion). On road-like graphs each search covers about half the radius,
+ *   roughly halving the vertices explored.
+ * - astar_shortest_path                  : Dijkstra ordered by distance + heuristic(g, v), a lower
+ *   bound on the distance from v to the target (Hart, Nilsson and Raphael, 1968).
+ *
+ * They take the DistanceFn, PredecessorFn, WF, Compare, Combine and Heap arguments of
+ * dijkstra_shortest_paths and read and write the distance and predecessor of a vertex only once
+ * the search reaches it. With an epoch_vertex_map behind the DistanceFn (see
+ * traversal_workspace.hpp), resetting the distances between queries is O(1) and a query costs
+ * O((explored vertices + their edges) log) instead of O(V).
+ *
+ * All three use a queue with lazy deletion. use_default_heap, use_radix_heap and use_bucket_heap
+ * select it as in dijkstra_shortest_paths; use_indexed_dary_heap<D> runs as the binary heap,
+ * since its decrease-key needs an O(V) position array that a point-to-point query avoids.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/algorithm/traversal_common.hpp"
+#include "graph/algorithm/dijkstra_shortest_paths.hpp"
+#include "graph/detail/radix_heap.hpp"
+
+#include <concepts>
+#include <format>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef GRAPH_POINT_TO_POINT_SHORTEST_PATH_HPP
+#  define GRAPH_POINT_TO_POINT_SHORTEST_PATH_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::adjacency_list;
+using adj_list::bidirectional_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::edge_t;
+using adj_list::vertices;
+using adj_list::num_vertices;
+using adj_list::find_vertex;
+using adj_list::target_id;
+using adj_list::source_id;
+using adj_list::in_edges;
+
+namespace detail {
+  /// Default weight of the point-to-point searches: 1 for every out- or in-edge.
+  template <class Distance>
+  struct unit_edge_weight {
+    template <class G, class E>
+    constexpr Distance operator()(const G&, const E&) const noexcept {
+      return Distance(1);
+    }
+  };
+
+  /// Queue entry: the priority (distance, plus the heuristic for A*), the vertex and its distance
+  /// when pushed. The entry is stale once the vertex's distance has dropped below dist.
+  template <class Distance, class Id>
+  struct p2p_entry {
+    Distance key;
+    Id       id;
+    Distance dist;
+  };
+
+  /// std::priority_queue of p2p_entry ordered by key under compare.
+  template <class Distance, class Id, class Compare, class Alloc>
+  class p2p_binary_queue {
+  public:
+    using entry_type = p2p_entry<Distance, Id>;
+
+    p2p_binary_queue(const Compare& compare, const Alloc& alloc)
+          : heap_(key_greater{&compare}, container_type(entry_alloc(alloc))) {}
+
+    void       push(const entry_type& e) { heap_.push(e); }
+    entry_type top() const { return heap_.top(); }
+    void       pop() { heap_.pop(); }
+    bool       empty() const noexcept { return heap_.empty(); }
+
+  private:
+    struct key_greater {
+      const Compare* compare;
+      bool operator()(const entry_type& a, const entry_type& b) const { return (*compare)(b.key, a.key); }
+    };
+    using entry_alloc    = typename std::allocator_traits<Alloc>::template rebind_alloc<entry_type>;
+    using container_type = std::vector<entry_type, entry_alloc>;
+
+    std::priority_queue<entry_type, container_type, key_greater> heap_;
+  };
+
+  /// radix_heap or bucket_queue of p2p_entry over the (non-negative, integral) key.
+  template <class Distance, class Id, class Alloc, bool Bucket>
+  class p2p_integer_queue {
+  public:
+    using entry_type = p2p_entry<Distance, Id>;
+
+    template <class Compare>
+    p2p_integer_queue(const Compare&, const Alloc& alloc) : heap_(value_alloc(alloc)) {}
+
+    void       push(const entry_type& e) { heap_.push(static_cast<key_type>(e.key), {e.id, e.dist}); }
+    entry_type top() {
+      const auto& [key, value] = heap_.top();
+      return {static_cast<Distance>(key), value.first, value.second};
+    }
+    void pop() { heap_.pop(); }
+    bool empty() const noexcept { return heap_.empty(); }
+
+  private:
+    using key_type    = std::make_unsigned_t<Distance>;
+    using value_type  = std::pair<Id, Distance>;
+    using value_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<std::pair<key_type, value_type>>;
+    using heap_type   = std::conditional_t<Bucket, bucket_queue<key_type, value_type, value_alloc>,
+                                           radix_heap<key_type, value_type, value_alloc>>;
+    heap_type heap_;
+  };
+
+  /// The queue a point-to-point search uses for Heap. AutoRadix lets use_default_heap pick the
+  /// radix heap as dijkstra_shortest_paths does; A* passes false, since its keys are monotone
+  /// only for a consistent heuristic.
+  template <class Heap, bool AutoRadix, class Distance, class Id, class Compare, class Combine, class Alloc>
+  auto p2p_queue_selector() {
+    constexpr bool radix =
+          std::is_same_v<Heap, use_radix_heap> || (AutoRadix && auto_radix_heap_v<Heap, Distance, Compare, Combine>);
+    constexpr bool bucket = std::is_same_v<Heap, use_bucket_heap>;
+    if constexpr (radix || bucket) {
+      static_assert(std::is_integral_v<Distance>, "use_radix_heap and use_bucket_heap require an integral distance type");
+      static_assert(integer_queue_compare_v<Distance, Compare> && integer_queue_combine_v<Distance, Combine>,
+                    "use_radix_heap and use_bucket_heap require std::less compare and std::plus combine");
+      return std::type_identity<p2p_integer_queue<Distance, Id, Alloc, bucket>>{};
+    } else {
+      return std::type_identity<p2p_binary_queue<Distance, Id, std::remove_cvref_t<Compare>, Alloc>>{};
+    }
+  }
+
+  template <class Heap, bool AutoRadix, class Distance, class Id, class Compare, class Combine, class Alloc>
+  using p2p_queue_t =
+        typename decltype(p2p_queue_selector<Heap, AutoRadix, Distance, Id, Compare, Combine, Alloc>())::type;
+
+  /// Marks an unguided search in p2p_search.
+  struct no_heuristic {};
+
+  template <class G>
+  bool p2p_contains(G& g, const vertex_id_t<G>& uid) {
+    if constexpr (adj_list::index_vertex_range<std::remove_reference_t<G>>)
+      return static_cast<size_t>(uid) < static_cast<size_t>(num_vertices(g));
+    else
+      return find_vertex(g, uid) != std::ranges::end(vertices(g));
+  }
+
+  template <class G>
+  void p2p_check_endpoints(G& g, const vertex_id_t<G>& source_vid, const vertex_id_t<G>& target_vid, const char* name) {
+    if (!p2p_contains(g, source_vid))
+      throw std::out_of_range(std::format("{}: source vertex id '{}' is out of range", name, source_vid));
+    if (!p2p_contains(g, target_vid))
+      throw std::out_of_range(std::format("{}: target vertex id '{}' is out of range", name, target_vid));
+  }
+
+  template <class Distance, class Weight, class Compare>
+  void p2p_check_weight(const Weight& w, const Compare& compare, const char* name) {
+    if constexpr (!(std::is_integral_v<Weight> && std::is_unsigned_v<Weight>)) {
+      if (compare(w, zero_distance<Distance>()))
+        throw std::out_of_range(std::format("{}: invalid negative edge weight of '{}' encountered", name, w));
+    }
+  }
+
+  /// Dijkstra (no_heuristic) or A* from source_vid, returning once target_vid is settled.
+  template <class G,
+            class DistanceFn,
+            class PredecessorFn,
+            class WF,
+            class Heuristic,
+            class Compare,
+            class Combine,
+            class Queue>
+  distance_fn_value_t<DistanceFn, G> p2p_search(G&                    g,
+                                                const vertex_id_t<G>& source_vid,
+                                                const vertex_id_t<G>& target_vid,
+                                                DistanceFn&           distance,
+                                                PredecessorFn&        predecessor,
+                                                WF&                   weight,
+                                                Heuristic&            heuristic,
+                                                Compare&              compare,
+                                                Combine&              combine,
+                                                Queue&                queue,
+                                                const char*           name) {
+    using graph_type    = std::remove_reference_t<G>;
+    using id_type       = vertex_id_t<graph_type>;
+    using pred_id_type  = predecessor_fn_value_t<PredecessorFn, G>;
+    using distance_type = distance_fn_value_t<DistanceFn, G>;
+    constexpr bool informed = !std::is_same_v<Heuristic, no_heuristic>;
+
+    p2p_check_endpoints(g, source_vid, target_vid, name);
+
+    auto key_of = [&](const id_type& uid, const distance_type& d) -> distance_type {
+      if constexpr (informed)
+        return combine(d, static_cast<distance_type>(heuristic(g, uid)));
+      else
+        return d;
+    };
+
+    constexpr auto zero = zero_distance<distance_type>();
+    distance(g, source_vid) = zero;
+    if constexpr (!is_null_predecessor_fn_v<PredecessorFn>)
+      predecessor(g, source_vid) = static_cast<pred_id_type>(source_vid);
+    queue.push({key_of(source_vid, zero), source_vid, zero});
+
+    while (!queue.empty()) {
+      const auto [key, uid, d_u] = queue.top();
+      queue.pop();
+      if (compare(distance(g, uid), d_u))
+        continue; // stale entry
+      if (uid == target_vid)
+        return d_u;
+
+      for (auto&& [vid, uv] : views::incidence(g, *find_vertex(g, uid))) {
+        const auto w_uv = weight(g, uv);
+        p2p_check_weight<distance_type>(w_uv, compare, name);
+        const distance_type d_v = combine(d_u, w_uv);
+        if (compare(d_v, distance(g, vid))) {
+          distance(g, vid) = d_v;
+          if constexpr (!is_null_predecessor_fn_v<PredecessorFn>)
+            predecessor(g, vid) = static_cast<pred_id_type>(uid);
+          queue.push({key_of(vid, d_v), static_cast<id_type>(vid), d_v});
+        }
+      }
+    }
+    return infinite_distance<distance_type>();
+  }
+} // namespace detail
+
+/**
+ * @brief Shortest distance from source to target with Dijkstra's algorithm, stopping as soon as
+ *        the target is settled.
+ *
+ * Explores the vertices whose distance from the source is less than (or, on ties, equal to) the
+ * distance to the target, and their out-edges.
+ *
+ * @tparam G             Graph type satisfying adjacency_list
+ * @tparam DistanceFn    Function (const G&, vertex_id_t<G>) -> Distance& (see distance_fn_for)
+ * @tparam PredecessorFn Function (const G&, vertex_id_t<G>) -> Predecessor&, or _null_predecessor
+ * @tparam WF            Edge weight function (const G&, const edge_t<G>&) -> weight
+ * @tparam Heap          use_default_heap, use_radix_heap or use_bucket_heap; use_indexed_dary_heap<D>
+ *                       runs as use_default_heap
+ *
+ * @param g           The graph
+ * @param source_vid  Source vertex id
+ * @param target_vid  Target vertex id
+ * @param distance    Distance of each vertex. Must read infinite_distance() for every vertex the
+ *                    search may reach, e.g. after init_shortest_paths or an epoch_vertex_map clear().
+ * @param predecessor Predecessor of each vertex; predecessor(g, source_vid) is set to source_vid
+ * @param weight      Edge weight function (default: 1 for every edge)
+ * @param compare     Distance comparison (default: less<Distance>)
+ * @param combine     Distance combination (default: plus<Distance>)
+ * @param alloc       Allocator for the queue storage
+ *
+ * @return The distance from source_vid to target_vid, or infinite_distance() if the target is
+ *         unreachable. Following predecessor from target_vid leads back to source_vid.
+ *
+ * @throws std::out_of_range if the source or target is out of range, or a negative edge weight is
+ *         found (signed weight types only).
+ *
+ * **Complexity:** O((V' + E') log V') for the V' vertices explored and their E' out-edges.
+ */
+template <adjacency_list G,
+          class DistanceFn,
+          class PredecessorFn,
+          class WF      = detail::unit_edge_weight<distance_fn_value_t<DistanceFn, G>>,
+          class Compare = less<distance_fn_value_t<DistanceFn, G>>,
+          class Combine = plus<distance_fn_value_t<DistanceFn, G>>,
+          class Heap    = use_default_heap,
+          class Alloc   = std::allocator<std::byte>>
+requires distance_fn_for<DistanceFn, G> &&       //
+         predecessor_fn_for<PredecessorFn, G> && //
+         basic_edge_weight_function<G, WF, distance_fn_value_t<DistanceFn, G>, Compare, Combine>
+distance_fn_value_t<DistanceFn, G> dijkstra_shortest_path(G&&                   g,
+                                                          const vertex_id_t<G>& source_vid,
+                                                          const vertex_id_t<G>& target_vid,
+                                                          DistanceFn&&          distance,
+                                                          PredecessorFn&&       predecessor,
+                                                          WF&&                  weight  = WF(),
+                                                          Compare&&             compare = Compare(),
+                                                          Combine&&             combine = Combine(),
+                                                          Heap /*heap_tag*/             = Heap{},
+                                                          const Alloc&          alloc   = Alloc()) {
+  using distance_type = distance_fn_value_t<DistanceFn, G>;
+  using Queue = detail::p2p_queue_t<Heap, true, distance_type, vertex_id_t<G>, Compare, Combine, Alloc>;
+  Queue                queue(compare, alloc);
+  detail::no_heuristic heuristic;
+  return detail::p2p_search(g, source_vid, target_vid, distance, predecessor, weight, heuristic, compare, combine,
+                            queue, "dijkstra_shortest_path");
+}
+
+/**
+ * @brief Shortest distance from source to target with A*: Dijkstra ordered by distance plus a
+ *        lower bound on the remaining distance to the target.
+ *
+ * The heuristic steers the search toward the target; with heuristic 0 this is
+ * dijkstra_shortest_path. The result is exact for an admissible heuristic, one that never
+ * exceeds the true distance to the target. A consistent heuristic (h(u) <= w(u, v) + h(v) for
+ * every edge, and h(target) = 0) also examines each vertex at most once; with an admissible but
+ * inconsistent one a vertex may be examined again when a shorter path to it is found. Typical
+ * heuristics are the straight-line distance on geometric graphs and landmark (ALT) bounds.
+ *
+ * @param heuristic Function (const G&, vertex_id_t<G>) -> Distance, the lower bound from a vertex
+ *                  to target_vid
+ *
+ * The other parameters are those of dijkstra_shortest_path. use_default_heap always uses the
+ * binary heap here; use_radix_heap requires a consistent heuristic, under which keys never
+ * decrease.
+ *
+ * @return The distance from source_vid to target_vid, or infinite_distance() if unreachable.
+ *
+ * @throws std::out_of_range as dijkstra_shortest_path.
+ *
+ * **Complexity:** O((V' + E') log V') for the V' vertices explored and their E' out-edges; V' shrinks
+ * as the heuristic approaches the true distances.
+ */
+template <adjacency_list G,
+          class Heuristic,
+          class DistanceFn,
+          class PredecessorFn,
+          class WF      = detail::unit_edge_weight<distance_fn_value_t<DistanceFn, G>>,
+          class Compare = less<distance_fn_value_t<DistanceFn, G>>,
+          class Combine = plus<distance_fn_value_t<DistanceFn, G>>,
+          class Heap    = use_default_heap,
+          class Alloc   = std::allocator<std::byte>>
+requires distance_fn_for<DistanceFn, G> &&                                                     //
+         predecessor_fn_for<PredecessorFn, G> &&                                               //
+         std::is_invocable_v<Heuristic&, const std::remove_reference_t<G>&, vertex_id_t<G>> && //
+         basic_edge_weight_function<G, WF, distance_fn_value_t<DistanceFn, G>, Compare, Combine>
+distance_fn_value_t<DistanceFn, G> astar_shortest_path(G&&                   g,
+                                                       const vertex_id_t<G>& source_vid,
+                                                       const vertex_id_t<G>& target_vid,
+                                                       Heuristic&&           heuristic,
+                                                       DistanceFn&&          distance,
+                                                       PredecessorFn&&       predecessor,
+                                                       WF&&                  weight  = WF(),
+                                                       Compare&&             compare = Compare(),
+                                                       Combine&&             combine = Combine(),
+                                                       Heap /*heap_tag*/             = Heap{},
+                                                       const Alloc&          alloc   = Alloc()) {
+  using distance_type = distance_fn_value_t<DistanceFn, G>;
+  using Queue = detail::p2p_queue_t<Heap, false, distance_type, vertex_id_t<G>, Compare, Combine, Alloc>;
+  Queue queue(compare, alloc);
+  return detail::p2p_search(g, source_vid, target_vid, distance, predecessor, weight, heuristic, compare, combine,
+                            queue, "astar_shortest_path");
+}
+
+/**
+ * @brief Shortest distance from source to target, searching forward from the source over
+ *        out-edges and backward from the target over in_edges.
+ *
+ * Each step advances the search whose queue holds the smaller key. Every edge scanned by either
+ * search that joins a vertex reached forward to one reached backward gives a candidate path
+ * length mu; the searches stop once the two smallest keys add up to at least mu, which then is
+ * the shortest distance.
+ *
+ * @tparam G                    Graph type satisfying bidirectional_adjacency_list
+ * @tparam ReverseDistanceFn    As DistanceFn, for the distances to the target
+ * @tparam SuccessorFn          As PredecessorFn, for the next vertex toward the target
+ *
+ * @param distance         Distance from the source; must read infinite_distance() for every vertex
+ *                         the forward search may reach
+ * @param predecessor      Predecessor of each vertex; on return, following it from target_vid
+ *                         traces a shortest path back to source_vid
+ * @param reverse_distance Distance to the target; must read infinite_distance() for every vertex
+ *                         the backward search may reach
+ * @param successor        Next vertex toward the target in the backward search's tree
+ * @param weight           Edge weight function, called with out-edges and with in-edges (e.g. a
+ *                         generic lambda); default: 1 for every edge
+ *
+ * The other parameters are those of dijkstra_shortest_path.
+ *
+ * @return The distance from source_vid to target_vid, or infinite_distance() if unreachable.
+ *         distance(g, target_vid) is set to it; the distances of other vertices are exact only up
+ *         to the forward search's last settled key.
+ *
+ * @throws std::out_of_range as dijkstra_shortest_path.
+ *
+ * **Complexity:** O((V' + E') log V') for the V' vertices explored by both searches and their
+ * E' edges.
+ */
+template <bidirectional_adjacency_list G,
+          class DistanceFn,
+          class PredecessorFn,
+          class ReverseDistanceFn,
+          class SuccessorFn,
+          class WF      = detail::unit_edge_weight<distance_fn_value_t<DistanceFn, G>>,
+          class Compare = less<distance_fn_value_t<DistanceFn, G>>,
+          class Combine = plus<distance_fn_value_t<DistanceFn, G>>,
+          class Heap    = use_default_heap,
+          class Alloc   = std::allocator<std::byte>>
+requires distance_fn_for<DistanceFn, G> &&                                                                    //
+         predecessor_fn_for<PredecessorFn, G> &&                                                              //
+         distance_fn_for<ReverseDistanceFn, G> &&                                                             //
+         std::same_as<distance_fn_value_t<ReverseDistanceFn, G>, distance_fn_value_t<DistanceFn, G>> &&       //
+         predecessor_fn_for<SuccessorFn, G> &&                                                                //
+         basic_edge_weight_function<G, WF, distance_fn_value_t<DistanceFn, G>, Compare, Combine>
+distance_fn_value_t<DistanceFn, G> bidirectional_dijkstra_shortest_path(G&&                   g,
+                                                                        const vertex_id_t<G>& source_vid,
+                                                                        const vertex_id_t<G>& target_vid,
+                                                                        DistanceFn&&          distance,
+                                                                        PredecessorFn&&       predecessor,
+                                                                        ReverseDistanceFn&&   reverse_distance,
+                                                                        SuccessorFn&&         successor,
+                                                                        WF&&                  weight  = WF(),
+                                                                        Compare&&             compare = Compare(),
+                                                                        Combine&&             combine = Combine(),
+                                                                        Heap /*heap_tag*/             = Heap{},
+                                                                        const Alloc&          alloc   = Alloc()) {
+  using graph_type    = std::remove_reference_t<G>;
+  using id_type       = vertex_id_t<graph_type>;
+  using pred_id_type  = predecessor_fn_value_t<PredecessorFn, G>;
+  using succ_id_type  = predecessor_fn_value_t<SuccessorFn, G>;
+  using distance_type = distance_fn_value_t<DistanceFn, G>;
+  using Queue         = detail::p2p_queue_t<Heap, true, distance_type, id_type, Compare, Combine, Alloc>;
+  constexpr const char* name = "bidirectional_dijkstra_shortest_path";
+
+  detail::p2p_check_endpoints(g, source_vid, target_vid, name);
+
+  constexpr auto zero     = zero_distance<distance_type>();
+  constexpr auto infinite = infinite_distance<distance_type>();
+
+  distance(g, source_vid) = zero;
+  if constexpr (!is_null_predecessor_fn_v<PredecessorFn>)
+    predecessor(g, source_vid) = static_cast<pred_id_type>(source_vid);
+  if (source_vid == target_vid)
+    return zero;
+  reverse_distance(g, target_vid) = zero;
+  if constexpr (!is_null_predecessor_fn_v<SuccessorFn>)
+    successor(g, target_vid) = static_cast<succ_id_type>(target_vid);
+
+  Queue forward(compare, alloc);
+  Queue backward(compare, alloc);
+  forward.push({zero, source_vid, zero});
+  backward.push({zero, target_vid, zero});
+
+  distance_type mu = infinite; // shortest source-target path length found so far
+  id_type       meet_u{};      // ...ending with the edge (meet_u, meet_v)
+  id_type       meet_v{};
+
+  // Considers the path source ~> uid -> vid ~> target; d_uv is the length of its first two parts.
+  auto connect = [&](const id_type& uid, const id_type& vid, const distance_type& d_uv) {
+    const distance_type d_v = reverse_distance(g, vid);
+    if (!compare(d_v, infinite))
+      return;
+    const distance_type length = combine(d_uv, d_v);
+    if (compare(length, mu)) {
+      mu     = length;
+      meet_u = uid;
+      meet_v = vid;
+    }
+  };
+
+  // Pops the stale entries at the top; false if the queue is then empty.
+  auto clean = [&](Queue& queue, auto& dist) {
+    while (!queue.empty()) {
+      if (!compare(dist(g, queue.top().id), queue.top().dist))
+        return true;
+      queue.pop();
+    }
+    return false;
+  };
+
+  while (clean(forward, distance) && clean(backward, reverse_distance)) {
+    const auto f = forward.top();
+    const auto b = backward.top();
+    if (!compare(combine(f.key, b.key), mu))
+      break; // no path through an unsettled vertex can be shorter than mu
+
+    if (!compare(b.key, f.key)) {
+      forward.pop();
+      for (auto&& [vid, uv] : views::incidence(g, *find_vertex(g, f.id))) {
+        const auto w_uv = weight(g, uv);
+        detail::p2p_check_weight<distance_type>(w_uv, compare, name);
+        const distance_type d_v = combine(f.dist, w_uv);
+        if (compare(d_v, distance(g, vid))) {
+          distance(g, vid) = d_v;
+          if constexpr (!is_null_predecessor_fn_v<PredecessorFn>)
+            predecessor(g, vid) = static_cast<pred_id_type>(f.id);
+          forward.push({d_v, static_cast<id_type>(vid), d_v});
+        }
+        if (static_cast<id_type>(vid) != source_vid) // a path back through the source is never shorter
+          connect(f.id, static_cast<id_type>(vid), d_v);
+      }
+    } else {
+      backward.pop();
+      for (auto&& vu : in_edges(g, *find_vertex(g, b.id))) {
+        const id_type uid  = static_cast<id_type>(source_id(g, vu));
+        const auto    w_uv = weight(g, vu);
+        detail::p2p_check_weight<distance_type>(w_uv, compare, name);
+        const distance_type d_u = combine(b.dist, w_uv);
+        if (compare(d_u, reverse_distance(g, uid))) {
+          reverse_distance(g, uid) = d_u;
+          if constexpr (!is_null_predecessor_fn_v<SuccessorFn>)
+            successor(g, uid) = static_cast<succ_id_type>(b.id);
+          backward.push({d_u, uid, d_u});
+        }
+        const distance_type d_from = distance(g, uid);
+        if (uid != target_vid && compare(d_from, infinite))
+          connect(uid, b.id, combine(d_from, w_uv));
+      }
+    }
+  }
+
+  if (!compare(mu, infinite))
+    return infinite;
+
+  distance(g, target_vid) = mu;
+  if constexpr (!is_null_predecessor_fn_v<PredecessorFn> && !is_null_predecessor_fn_v<SuccessorFn>) {
+    // Extend the forward tree along the backward one: meet_u -> meet_v -> ... -> target
+    predecessor(g, meet_v) = static_cast<pred_id_type>(meet_u);
+    for (id_type x = meet_v; x != target_vid;) {
+      const id_type y = static_cast<id_type>(successor(g, x));
+      predecessor(g, y) = static_cast<pred_id_type>(x);
+      x                 = y;
+    }
+  }
+  return mu;
+}
+
+} // namespace graph
+
+#endif // GRAPH_POINT_TO_POINT_SHORTEST_PATH_HPP
@@ -0,0 +1,268 @@
+/**
+ * @file traversal_workspace.hpp
+ *
+ * @brief Reusable scratch memory for repeated traversals of one graph.
+ *
+ * Each call of breadth_first_search, dijkstra_shortest_paths or topological_sort normally
+ * allocates and initializes O(V) visited flags, colors or distances, even when the query only
+ * reaches a few vertices. A traversal_workspace is allocated once, typically one per thread,
+ * and passed to those algorithms instead. Its per-vertex arrays are epoch-stamped: a vertex's
+ * entry counts only if its stamp equals the current epoch, so starting a new query increments
+ * the epoch instead of clearing the arrays, and a query costs O(vertices and edges explored).
+ * The arrays grow on first use to the graph's vertex count; once they have, a query performs
+ * no allocation beyond the growth of its queue, heap or output to the size of the search.
+ *
+ * The results of the last query stay readable until the next one:
+ *
+ *   - visited()     : the vertices reached by breadth_first_search, in discovery order.
+ *   - distances()   : the distances found by dijkstra_shortest_paths/distances; vertices not
+ *                     reached read as infinite_distance<Distance>().
+ *   - predecessor() : the shortest-path tree of dijkstra_shortest_paths.
+ *
+ * The overloads taking a workspace require an index_adjacency_list, whose vertex ids lie in
+ * [0, num_vertices(g)). A workspace is not thread-safe; use one per thread.
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/algorithm/traversal_common.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#ifndef GRAPH_TRAVERSAL_WORKSPACE_HPP
+#  define GRAPH_TRAVERSAL_WORKSPACE_HPP
+
+namespace graph {
+
+/**
+ * @brief A set of vertex ids in [0, n) that is cleared in O(1).
+ *
+ * Each vertex holds the epoch in which it was last inserted. clear() starts a new epoch and
+ * forgets the members; the stamps are rewritten only when the epoch counter wraps.
+ *
+ * @tparam VId   Vertex id type
+ * @tparam Epoch Stamp type. A narrower type saves memory and rewrites the stamps more often
+ *               (every 2^N - 1 clears).
+ */
+template <std::integral VId = uint32_t, std::unsigned_integral Epoch = uint32_t>
+class epoch_vertex_set {
+public:
+  using vertex_id_type = VId;
+
+  epoch_vertex_set() = default;
+  explicit epoch_vertex_set(size_t vertex_count) : stamp_(vertex_count, Epoch{0}) {}
+
+  /// Empties the set and makes room for ids in [0, vertex_count). O(1) unless it grows.
+  void clear(size_t vertex_count = 0) {
+    if (vertex_count > stamp_.size())
+      stamp_.resize(vertex_count, Epoch{0});
+    members_.clear();
+    if (++epoch_ == 0) { // stamps wrapped: restart them once every 2^N - 1 clears
+      std::ranges::fill(stamp_, Epoch{0});
+      epoch_ = 1;
+    }
+  }
+
+  [[nodiscard]] bool contains(VId u) const noexcept { return stamp_[static_cast<size_t>(u)] == epoch_; }
+
+  /// Adds u; returns false if it was already a member.
+  bool insert(VId u) {
+    Epoch& stamp = stamp_[static_cast<size_t>(u)];
+    if (stamp == epoch_)
+      return false;
+    stamp = epoch_;
+    members_.push_back(u);
+    return true;
+  }
+
+  /// The members, in insertion order.
+  [[nodiscard]] std::span<const VId> members() const noexcept { return members_; }
+  [[nodiscard]] size_t               size() const noexcept { return members_.size(); }
+  [[nodiscard]] bool                 empty() const noexcept { return members_.empty(); }
+
+  /// The number of vertex ids the set has room for.
+  [[nodiscard]] size_t capacity() const noexcept { return stamp_.size(); }
+
+private:
+  std::vector<Epoch> stamp_;
+  std::vector<VId>   members_;
+  Epoch              epoch_ = 1;
+};
+
+/**
+ * @brief A vertex property map over ids in [0, n) whose values are reset in O(1).
+ *
+ * A vertex not written since the last clear() reads as the default value. operator[] gives the
+ * vertex that default first and records it in keys(), so the map can stand in for the
+ * std::vector of make_vertex_property_map() in algorithms that write through operator[] and
+ * read through vertex_property_map_get(). Stamps and values are stored side by side, so a
+ * lookup touches one cache line.
+ *
+ * @tparam T     Value type
+ * @tparam VId   Vertex id type
+ * @tparam Epoch Stamp type (see epoch_vertex_set)
+ */
+template <class T, std::integral VId = uint32_t, std::unsigned_integral Epoch = uint32_t>
+class epoch_vertex_map {
+public:
+  using vertex_id_type = VId;
+  using value_type     = T;
+
+  epoch_vertex_map() = default;
+  explicit epoch_vertex_map(size_t vertex_count, T default_value = T())
+        : slot_(vertex_count), default_(std::move(default_value)) {}
+
+  /// Resets every vertex to default_value and makes room for ids in [0, vertex_count).
+  /// O(1) unless it grows.
+  void clear(size_t vertex_count, T default_value) {
+    if (vertex_count > slot_.size())
+      slot_.resize(vertex_count);
+    default_ = std::move(default_value);
+    keys_.clear();
+    if (++epoch_ == 0) {
+      for (auto& s : slot_)
+        s.stamp = 0;
+      epoch_ = 1;
+    }
+  }
+
+  [[nodiscard]] bool contains(VId u) const noexcept { return slot_[static_cast<size_t>(u)].stamp == epoch_; }
+
+  /// The value of u, or the default value if u was not written since the last clear().
+  [[nodiscard]] const T& get(VId u) const noexcept {
+    const slot& s = slot_[static_cast<size_t>(u)];
+    return s.stamp == epoch_ ? s.value : default_;
+  }
+
+  /// The value of u, set to the default value first if u was not written since the last clear().
+  T& operator[](VId u) {
+    slot& s = slot_[static_cast<size_t>(u)];
+    if (s.stamp != epoch_) {
+      s.stamp = epoch_;
+      s.value = default_;
+      keys_.push_back(u);
+    }
+    return s.value;
+  }
+
+  /// The vertices written since the last clear(), in order of their first write.
+  [[nodiscard]] std::span<const VId> keys() const noexcept { return keys_; }
+  [[nodiscard]] const T&             default_value() const noexcept { return default_; }
+  [[nodiscard]] size_t               capacity() const noexcept { return slot_.size(); }
+
+private:
+  struct slot {
+    T     value{};
+    Epoch stamp = 0;
+  };
+
+  std::vector<slot> slot_;
+  std::vector<VId>  keys_;
+  T                 default_{};
+  Epoch             epoch_ = 1;
+};
+
+/// vertex_property_map_contains() for epoch_vertex_map: true if u was written since the last clear().
+template <class T, class VId, class Epoch, class Key>
+[[nodiscard]] bool vertex_property_map_contains(const epoch_vertex_map<T, VId, Epoch>& m, const Key& u) {
+  return m.contains(static_cast<VId>(u));
+}
+
+/// vertex_property_map_get() for epoch_vertex_map: the value of u, or default_val if u was not
+/// written since the last clear().
+template <class T, class VId, class Epoch, class Key>
+[[nodiscard]] T vertex_property_map_get(const epoch_vertex_map<T, VId, Epoch>& m, const Key& u, const T& default_val) {
+  return m.contains(static_cast<VId>(u)) ? m.get(static_cast<VId>(u)) : default_val;
+}
+
+namespace detail {
+  // Vertex color states for DFS in topological sort
+  enum class TopoColor : uint8_t {
+    White, // Undiscovered
+    Gray,  // Discovered but not finished (on stack)
+    Black  // Finished
+  };
+} // namespace detail
+
+/**
+ * @brief Scratch memory reused across calls of the traversal algorithms; see the file comment.
+ *
+ * @tparam VId      Vertex id type of the graphs traversed
+ * @tparam Distance Distance type of dijkstra_shortest_paths/distances
+ */
+template <std::integral VId = uint32_t, class Distance = double>
+class traversal_workspace {
+public:
+  using vertex_id_type = VId;
+  using distance_type  = Distance;
+
+  traversal_workspace() = default;
+
+  /// The vertices reached by the last breadth_first_search, in discovery order.
+  [[nodiscard]] const epoch_vertex_set<VId>& visited() const noexcept { return visited_; }
+
+  /// The distances of the last dijkstra_shortest_paths/distances. keys() lists the vertices
+  /// reached, in discovery order; the others read as infinite_distance<Distance>().
+  [[nodiscard]] const epoch_vertex_map<Distance, VId>& distances() const noexcept { return distance_; }
+  [[nodiscard]] epoch_vertex_map<Distance, VId>&       distances() noexcept { return distance_; }
+
+  /// The predecessor of u in the last dijkstra_shortest_paths, or u itself for the sources, the
+  /// vertices not reached, and after dijkstra_shortest_distances.
+  [[nodiscard]] VId predecessor(VId u) const noexcept {
+    return has_predecessors_ && distance_.contains(u) ? predecessor_[static_cast<size_t>(u)] : u;
+  }
+
+  // ----- scratch for the algorithms ---------------------------------------
+
+  /// Starts a breadth-first search over vertex_count vertices. The visited set doubles as the
+  /// FIFO queue: vertices are examined in the order they were inserted.
+  epoch_vertex_set<VId>& begin_search(size_t vertex_count) {
+    visited_.clear(vertex_count);
+    return visited_;
+  }
+
+  /// Starts a shortest-path search over vertex_count vertices. Returns the empty heap storage.
+  std::vector<std::pair<Distance, VId>>& begin_shortest_paths(size_t vertex_count, bool record_predecessors) {
+    distance_.clear(vertex_count, infinite_distance<Distance>());
+    if (record_predecessors && predecessor_.size() < vertex_count)
+      predecessor_.resize(vertex_count);
+    has_predecessors_ = record_predecessors;
+    heap_.clear();
+    return heap_;
+  }
+
+  /// The predecessor slot of u, valid while distances() contains u.
+  VId& predecessor_slot(VId u) noexcept { return predecessor_[static_cast<size_t>(u)]; }
+
+  /// Starts a topological sort over vertex_count vertices. Returns the empty finish order.
+  std::vector<VId>& begin_topological_sort(size_t vertex_count) {
+    color_.clear(vertex_count, detail::TopoColor::White);
+    order_.clear();
+    return order_;
+  }
+
+  epoch_vertex_map<detail::TopoColor, VId>& colors() noexcept { return color_; }
+
+private:
+  epoch_vertex_set<VId>                    visited_;
+  epoch_vertex_map<Distance, VId>          distance_;
+  std::vector<VId>                         predecessor_;
+  std::vector<std::pair<Distance, VId>>    heap_;
+  epoch_vertex_map<detail::TopoColor, VId> color_;
+  std::vector<VId>                         order_;
+  bool                                     has_predecessors_ = false;
+};
+
+} // namespace graph
+
+#endif // GRAPH_TRAVERSAL_WORKSPACE_HPP
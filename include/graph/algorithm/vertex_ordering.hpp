@@ -0,0 +1,614 @@
+/**
+ * @file vertex_ordering.hpp
+ *
+ * @brief Locality-improving vertex orderings, and renumbering a compressed_graph by them.
+ *
+ * Traversals read the neighbours of a vertex right after the vertex itself. When their ids are
+ * scattered, as in graphs with arbitrary ids, nearly every such read misses the cache.
+ * order_vertices computes a permutation that gives vertices used together nearby ids, and
+ * reorder rebuilds a compressed_graph under it (compressed_graph::load_permuted). The orderings:
+ *
+ * - **degree_sort**: by decreasing degree, so the hubs share the first cache lines.
+ * - **hub_cluster**: the vertices of above-average degree first, both groups keeping their
+ *   original order (Balaji and Lucia, "When is Graph Reordering an Optimization?", IISWC'18).
+ * - **bfs**: breadth-first visiting order, one component after another.
+ * - **rcm**: reverse Cuthill-McKee from a pseudo-peripheral vertex of every component, which
+ *   narrows the band of the adjacency matrix.
+ * - **gorder**: places next the vertex sharing the most edges and in-neighbours with the last
+ *   few placed (Wei, Yu, Lu and Lin, "Speedup Graph Processing by Graph Ordering", SIGMOD'16).
+ * - **rabbit**: merges every vertex, by increasing degree, into the neighbouring community with
+ *   the largest modularity gain, then numbers each community contiguously by a depth-first walk
+ *   of the merges (Arai et al., "Rabbit Order", IPDPS'16).
+ *
+ * Neighbourhoods are the out- and in-neighbours of a vertex, read from one flat copy of the
+ * graph and an in-edge index (the out-edges alone with options.symmetric).
+ *
+ * @copyright Copyright (c) 2024
+ *
+ * SPDX-License-Identifier: BSL-1.0
+ *
+ * @authors Andrew Lumsdaine, Phil Ratzloff
+ */
+
+#include "graph/graph.hpp"
+#include "graph/detail/in_edge_index.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef GRAPH_VERTEX_ORDERING_HPP
+#  define GRAPH_VERTEX_ORDERING_HPP
+
+namespace graph {
+
+// Using declarations for new namespace structure
+using adj_list::index_adjacency_list;
+using adj_list::vertex_id_t;
+using adj_list::num_vertices;
+using adj_list::edges;
+using adj_list::target_id;
+using adj_list::find_vertex;
+
+/// Vertex orderings computed by order_vertices (see the file description)
+enum class vertex_order { degree_sort, hub_cluster, bfs, rcm, gorder, rabbit };
+
+/// Options of order_vertices
+struct vertex_order_options {
+  bool   symmetric     = false; ///< Every edge is stored in both directions: the out-edges serve as in-edges
+  size_t gorder_window = 5;     ///< Number of last placed vertices a gorder candidate is scored against
+};
+
+/// A renumbering of the vertices 0..n-1, with its inverse
+template <class VId>
+struct vertex_permutation {
+  std::vector<VId> new_id; ///< new_id[u]: id of original vertex u after reordering (old-to-new)
+  std::vector<VId> old_id; ///< old_id[v]: original id of reordered vertex v (new-to-old)
+};
+
+namespace detail {
+  /// Out- and in-neighbours of every vertex in flat arrays; on symmetric graphs the in-edges are
+  /// the out-edges.
+  template <class VId>
+  struct ordering_adjacency {
+    std::vector<size_t> offsets;
+    std::vector<VId>    targets;
+    in_edge_index<VId>  in;
+    bool                symmetric = false;
+
+    std::span<const VId> out(size_t u) const {
+      return {targets.data() + offsets[u], targets.data() + offsets[u + 1]};
+    }
+    std::span<const VId> in_edges(size_t u) const {
+      if (symmetric)
+        return out(u);
+      return {in.sources.data() + in.offsets[u], in.sources.data() + in.offsets[u + 1]};
+    }
+    /// Out-degree plus in-degree of every vertex (the out-degree alone when symmetric)
+    std::vector<size_t> degrees() const {
+      std::vector<size_t> degree(offsets.size() - 1);
+      for (size_t u = 0; u < degree.size(); ++u)
+        degree[u] = out(u).size() + (symmetric ? 0 : in_edges(u).size());
+      return degree;
+    }
+    /// Calls f(v) for every out- and in-neighbour v of u (each once when symmetric)
+    template <class F>
+    void for_each_neighbor(size_t u, F&& f) const {
+      for (VId v : out(u))
+        f(static_cast<size_t>(v));
+      if (!symmetric)
+        for (VId v : in_edges(u))
+          f(static_cast<size_t>(v));
+    }
+  };
+
+  template <index_adjacency_list G>
+  ordering_adjacency<vertex_id_t<G>> make_ordering_adjacency(const G& g, bool symmetric, thread_pool& pool) {
+    using id_type  = vertex_id_t<G>;
+    const size_t n = static_cast<size_t>(num_vertices(g));
+
+    ordering_adjacency<id_type> adj;
+    adj.symmetric = symmetric;
+    adj.offsets.assign(n + 1, 0);
+    pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+      for (size_t u = lo; u < hi; ++u)
+        adj.offsets[u] = static_cast<size_t>(std::ranges::distance(edges(g, *find_vertex(g, static_cast<id_type>(u)))));
+    });
+    const size_t m = parallel_exclusive_scan(pool, adj.offsets.begin(), n + 1);
+    adj.targets.resize(m);
+    pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+      for (size_t u = lo; u < hi; ++u) {
+        size_t k = adj.offsets[u];
+        for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u))))
+          adj.targets[k++] = static_cast<id_type>(target_id(g, uv));
+      }
+    });
+    if (!symmetric)
+      adj.in = build_in_edge_index(g, m, pool);
+    return adj;
+  }
+
+  /// Out-degree plus in-degree of every vertex (the out-degree alone when symmetric)
+  template <index_adjacency_list G>
+  std::vector<size_t> ordering_degrees(const G& g, bool symmetric, thread_pool& pool) {
+    using id_type  = vertex_id_t<G>;
+    const size_t n = static_cast<size_t>(num_vertices(g));
+
+    std::vector<size_t> degree(n, 0);
+    pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+      for (size_t u = lo; u < hi; ++u)
+        degree[u] = static_cast<size_t>(std::ranges::distance(edges(g, *find_vertex(g, static_cast<id_type>(u)))));
+    });
+    if (!symmetric) {
+      std::vector<size_t> in_degree(n, 0);
+      pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+        for (size_t u = lo; u < hi; ++u)
+          for (auto&& uv : edges(g, *find_vertex(g, static_cast<id_type>(u))))
+            std::atomic_ref<size_t>(in_degree[static_cast<size_t>(target_id(g, uv))])
+                  .fetch_add(1, std::memory_order_relaxed);
+      });
+      pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+        for (size_t u = lo; u < hi; ++u)
+          degree[u] += in_degree[u];
+      });
+    }
+    return degree;
+  }
+
+  /// Vertex ids sorted by degree, ties in id order (counting sort)
+  template <class VId>
+  std::vector<VId> ids_by_degree(const std::vector<size_t>& degree, bool descending) {
+    const size_t n       = degree.size();
+    const size_t max_deg = n == 0 ? 0 : *std::ranges::max_element(degree);
+    auto         key     = [&](size_t u) { return descending ? max_deg - degree[u] : degree[u]; };
+
+    std::vector<size_t> start(max_deg + 2, 0);
+    for (size_t u = 0; u < n; ++u)
+      ++start[key(u) + 1];
+    for (size_t d = 1; d < start.size(); ++d)
+      start[d] += start[d - 1];
+    std::vector<VId> ids(n);
+    for (size_t u = 0; u < n; ++u)
+      ids[start[key(u)]++] = static_cast<VId>(u);
+    return ids;
+  }
+
+  /// Vertices of above-average degree first; both groups keep their original order
+  template <class VId>
+  std::vector<VId> hub_cluster_order(const std::vector<size_t>& degree) {
+    const size_t n     = degree.size();
+    size_t       total = 0;
+    for (size_t d : degree)
+      total += d;
+    // degree > total / n, in integers
+    auto is_hub = [&](size_t u) { return degree[u] * n > total; };
+
+    std::vector<VId> ids;
+    ids.reserve(n);
+    for (size_t u = 0; u < n; ++u)
+      if (is_hub(u))
+        ids.push_back(static_cast<VId>(u));
+    for (size_t u = 0; u < n; ++u)
+      if (!is_hub(u))
+        ids.push_back(static_cast<VId>(u));
+    return ids;
+  }
+
+  /// Breadth-first visiting order, starting each component at its lowest unvisited id
+  template <class VId>
+  std::vector<VId> bfs_order(const ordering_adjacency<VId>& adj) {
+    const size_t n = adj.offsets.size() - 1;
+
+    std::vector<VId>  order; // doubles as the queue
+    std::vector<char> seen(n, 0);
+    order.reserve(n);
+    for (size_t s = 0; s < n; ++s) {
+      if (seen[s])
+        continue;
+      seen[s] = 1;
+      order.push_back(static_cast<VId>(s));
+      for (size_t head = order.size() - 1; head < order.size(); ++head) {
+        adj.for_each_neighbor(static_cast<size_t>(order[head]), [&](size_t v) {
+          if (!seen[v]) {
+            seen[v] = 1;
+            order.push_back(static_cast<VId>(v));
+          }
+        });
+      }
+    }
+    return order;
+  }
+
+  /// Reverse Cuthill-McKee. Each component is numbered breadth-first from a pseudo-peripheral
+  /// vertex (George and Liu), visiting the new neighbours of a vertex by increasing degree; the
+  /// whole order is then reversed.
+  template <class VId>
+  std::vector<VId> rcm_order(const ordering_adjacency<VId>& adj, const std::vector<size_t>& degree) {
+    const size_t n = adj.offsets.size() - 1;
+
+    std::vector<VId>    order;
+    std::vector<char>   placed(n, 0);
+    std::vector<size_t> stamp(n, 0); // search number that last reached a vertex
+    std::vector<size_t> queue;
+    size_t              search = 0;
+    order.reserve(n);
+
+    // Eccentricity of root within its component; queue[last..] holds the farthest level
+    auto eccentricity = [&](size_t root, size_t& last) {
+      ++search;
+      queue.clear();
+      queue.push_back(root);
+      stamp[root]  = search;
+      size_t level = 0;
+      last         = 0;
+      for (size_t lo = 0; lo < queue.size(); ++level) {
+        const size_t hi = queue.size();
+        for (size_t k = lo; k < hi; ++k)
+          adj.for_each_neighbor(queue[k], [&](size_t v) {
+            if (stamp[v] != search) {
+              stamp[v] = search;
+              queue.push_back(v);
+            }
+          });
+        last = lo;
+        lo   = hi;
+      }
+      return level - 1;
+    };
+
+    for (VId s : ids_by_degree<VId>(degree, false)) {
+      if (placed[static_cast<size_t>(s)])
+        continue;
+
+      // Pseudo-peripheral root: move to a vertex of least degree in the farthest level while
+      // that increases the eccentricity
+      size_t last = 0, root = static_cast<size_t>(s);
+      size_t ecc  = eccentricity(root, last);
+      for (;;) {
+        const size_t candidate =
+              *std::ranges::min_element(queue.begin() + static_cast<std::ptrdiff_t>(last), queue.end(), {},
+                                        [&](size_t v) { return degree[v]; });
+        size_t       candidate_last = 0;
+        const size_t candidate_ecc  = eccentricity(candidate, candidate_last);
+        if (candidate_ecc <= ecc)
+          break;
+        root = candidate;
+        ecc  = candidate_ecc;
+        last = candidate_last;
+      }
+
+      placed[root] = 1;
+      order.push_back(static_cast<VId>(root));
+      for (size_t head = order.size() - 1; head < order.size(); ++head) {
+        const size_t first = order.size();
+        adj.for_each_neighbor(static_cast<size_t>(order[head]), [&](size_t v) {
+          if (!placed[v]) {
+            placed[v] = 1;
+            order.push_back(static_cast<VId>(v));
+          }
+        });
+        std::stable_sort(order.begin() + static_cast<std::ptrdiff_t>(first), order.end(),
+                         [&](VId a, VId b) { return degree[static_cast<size_t>(a)] < degree[static_cast<size_t>(b)]; });
+      }
+    }
+    std::ranges::reverse(order);
+    return order;
+  }
+
+  /// Gorder: the score of an unplaced vertex u is the number of edges between u and the window
+  /// of the last placed vertices, plus the number of in-neighbours u shares with them. The
+  /// vertex of highest score is placed next. Scores change by one as vertices enter and leave
+  /// the window, so they are kept in a bucket list per score ("unit heap"). In-neighbours with
+  /// more than sqrt(n) out-edges are not used for the shared count, which would cost too much.
+  template <class VId>
+  std::vector<VId> gorder_order(const ordering_adjacency<VId>& adj, size_t window) {
+    const size_t     n    = adj.offsets.size() - 1;
+    constexpr size_t none = std::numeric_limits<size_t>::max();
+    window                = std::max<size_t>(window, 1);
+    const auto hub_limit  = static_cast<size_t>(std::sqrt(static_cast<double>(n))) + 1;
+
+    std::vector<VId> order;
+    if (n == 0)
+      return order;
+    order.reserve(n);
+
+    // Unit heap: doubly linked list of the unplaced vertices of each score
+    std::vector<size_t> score(n, 0), prev(n, none), next(n, none), head(1, none);
+    std::vector<char>   placed(n, 0);
+    size_t              top = 0;
+    auto                unlink = [&](size_t u) {
+      (prev[u] == none ? head[score[u]] : next[prev[u]]) = next[u];
+      if (next[u] != none)
+        prev[next[u]] = prev[u];
+    };
+    auto link = [&](size_t u) {
+      if (score[u] >= head.size())
+        head.resize(score[u] + 1, none);
+      prev[u] = none;
+      next[u] = head[score[u]];
+      if (next[u] != none)
+        prev[next[u]] = u;
+      head[score[u]] = u;
+      top            = std::max(top, score[u]);
+    };
+    auto bump = [&](size_t u, bool up) {
+      if (placed[u])
+        return;
+      unlink(u);
+      score[u] = up ? score[u] + 1 : score[u] - 1;
+      link(u);
+    };
+    // Scores against vertex v when it enters (up) or leaves the window
+    auto update = [&](size_t v, bool up) {
+      for (VId u : adj.out(v))
+        bump(static_cast<size_t>(u), up);
+      for (VId x : adj.in_edges(v)) {
+        bump(static_cast<size_t>(x), up);
+        if (adj.out(static_cast<size_t>(x)).size() <= hub_limit)
+          for (VId u : adj.out(static_cast<size_t>(x)))
+            if (static_cast<size_t>(u) != v)
+              bump(static_cast<size_t>(u), up);
+      }
+    };
+
+    for (size_t u = n; u-- > 0;)
+      link(u);
+    // Start from the vertex with the most in-edges
+    size_t v = 0;
+    for (size_t u = 1; u < n; ++u)
+      if (adj.in_edges(u).size() > adj.in_edges(v).size())
+        v = u;
+    for (;;) {
+      unlink(v);
+      placed[v] = 1;
+      order.push_back(static_cast<VId>(v));
+      if (order.size() == n)
+        break;
+      update(v, true);
+      if (order.size() > window)
+        update(static_cast<size_t>(order[order.size() - 1 - window]), false);
+      while (head[top] == none)
+        --top;
+      v = head[top];
+    }
+    return order;
+  }
+
+  /// Rabbit order. Vertices are visited by increasing degree; each merges into the neighbouring
+  /// community c that maximizes the modularity gain w(u,c) - s(u) s(c) / S, if positive, where w
+  /// counts the edges between them, s is the total degree of a community and S that of the graph.
+  /// A vertex absorbed into a community not yet visited passes on its edges, which that
+  /// community sums when its own turn comes. The order is a depth-first walk of the merges, from
+  /// the remaining communities in id order, so every community is contiguous.
+  template <class VId>
+  std::vector<VId> rabbit_order(const ordering_adjacency<VId>& adj, const std::vector<size_t>& degree) {
+    const size_t     n    = adj.offsets.size() - 1;
+    constexpr size_t none = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> parent(n), first_child(n, none), next_sibling(n, none);
+    std::vector<double> strength(n);
+    std::vector<char>   visited(n, 0);
+    double              total = 0;
+    for (size_t u = 0; u < n; ++u) {
+      parent[u]   = u;
+      strength[u] = static_cast<double>(degree[u]);
+      total += strength[u];
+    }
+    auto find = [&](size_t u) {
+      while (parent[u] != u) {
+        parent[u] = parent[parent[u]];
+        u         = parent[u];
+      }
+      return u;
+    };
+
+    std::vector<std::vector<std::pair<VId, size_t>>> passed(n); // edges handed on by absorbed vertices
+    std::vector<size_t>                               weight(n, 0), touched;
+    if (total > 0) {
+      for (VId id : ids_by_degree<VId>(degree, false)) {
+        const size_t u   = static_cast<size_t>(id);
+        auto         add = [&](size_t v, size_t w) {
+          const size_t c = find(v);
+          if (c == u)
+            return;
+          if (weight[c] == 0)
+            touched.push_back(c);
+          weight[c] += w;
+        };
+        adj.for_each_neighbor(u, [&](size_t v) { add(v, 1); });
+        for (auto [v, w] : passed[u])
+          add(static_cast<size_t>(v), w);
+        passed[u]  = {};
+        visited[u] = 1;
+
+        size_t best      = none;
+        double best_gain = 0;
+        for (size_t c : touched) {
+          const double gain = static_cast<double>(weight[c]) - strength[u] * strength[c] / total;
+          if (gain > best_gain) {
+            best      = c;
+            best_gain = gain;
+          }
+        }
+        if (best != none) {
+          parent[u]         = best;
+          strength[best]   += strength[u];
+          next_sibling[u]   = first_child[best];
+          first_child[best] = u;
+          if (!visited[best])
+            for (size_t c : touched)
+              if (c != best)
+                passed[best].emplace_back(static_cast<VId>(c), weight[c]);
+        }
+        for (size_t c : touched)
+          weight[c] = 0;
+        touched.clear();
+      }
+    }
+
+    std::vector<VId>    order;
+    std::vector<size_t> stack;
+    order.reserve(n);
+    for (size_t r = 0; r < n; ++r) {
+      if (parent[r] != r)
+        continue;
+      stack.push_back(r);
+      while (!stack.empty()) {
+        const size_t u = stack.back();
+        stack.pop_back();
+        order.push_back(static_cast<VId>(u));
+        for (size_t c = first_child[u]; c != none; c = next_sibling[c])
+          stack.push_back(c);
+      }
+    }
+    return order;
+  }
+} // namespace detail
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Computes a vertex ordering that improves the memory locality of graph traversals.
+ *
+ * See the file description for the orderings. Apply the result with reorder(g, perm), or
+ * compressed_graph::load_permuted, and translate per-vertex results of the reordered graph back
+ * with perm.old_id: result_for_original[perm.old_id[v]] = result[v].
+ *
+ * @tparam G The graph type. Must satisfy index_adjacency_list.
+ *
+ * @param g       The graph
+ * @param method  The ordering to compute
+ * @param options symmetric: every edge (u,v) is also stored as (v,u), so no in-edge index is
+ *                built and degrees count each edge once; gorder_window: number of last placed
+ *                vertices a gorder candidate is scored against.
+ * @param pool    Thread pool for the degree computations and the in-edge index. Default:
+ *                default_thread_pool().
+ *
+ * @return The permutation: new_id maps original ids to new ids, old_id is its inverse
+ *
+ * **Mandates:**
+ * - G must satisfy index_adjacency_list
+ *
+ * **Preconditions:**
+ * - If options.symmetric is true, (u,v) is an edge iff (v,u) is an edge
+ *
+ * **Effects:**
+ * - Does not modify g
+ *
+ * **Postconditions:**
+ * - new_id and old_id are permutations of 0..num_vertices(g)-1, and new_id[old_id[v]] == v
+ * - The result depends only on g and options, not on the number of workers
+ *
+ * **Throws:**
+ * - std::bad_alloc if internal allocations fail
+ *
+ * **Complexity:**
+ * - degree_sort, hub_cluster: O(V + E + max degree) work, parallel over the vertices; O(V) space
+ * - bfs: O(V + E); rcm: O(V + E) per pseudo-peripheral search, usually a few, plus sorting the
+ *   neighbours of each vertex by degree
+ * - gorder: O(w · Σ_v (deg(v) + Σ_{in-neighbours x with out-degree <= √V} outdeg(x)))
+ *   for window w
+ * - rabbit: O(E α(V)) plus the edges passed between communities
+ * - bfs, rcm, gorder, rabbit: O(V + E) space for a flat copy of the graph and its in-edges
+ *
+ * **Remarks:**
+ * - gorder and rabbit are the slowest to compute and usually give the best locality on graphs
+ *   with community structure; rcm suits meshes and grids; degree_sort and hub_cluster are cheap
+ *   and help skewed graphs.
+ *
+ * ## Example Usage
+ *
+ * ```cpp
+ * auto perm = order_vertices(g, vertex_order::rcm);
+ * auto h    = reorder(g, perm);  // same graph, renumbered
+ *
+ * std::vector<double> dist(num_vertices(h));
+ * dijkstra_shortest_distances(h, perm.new_id[source], container_value_fn(dist), weight);
+ * // dist[perm.new_id[u]] is the distance of original vertex u
+ * ```
+ */
+template <index_adjacency_list G>
+vertex_permutation<vertex_id_t<std::remove_cvref_t<G>>> order_vertices(G&&                         g,
+                                                                       vertex_order                method,
+                                                                       const vertex_order_options& options = {},
+                                                                       thread_pool& pool = default_thread_pool()) {
+  using id_type = vertex_id_t<std::remove_cvref_t<G>>;
+
+  vertex_permutation<id_type> perm;
+  switch (method) {
+    case vertex_order::degree_sort:
+      perm.old_id = detail::ids_by_degree<id_type>(detail::ordering_degrees(g, options.symmetric, pool), true);
+      break;
+    case vertex_order::hub_cluster:
+      perm.old_id = detail::hub_cluster_order<id_type>(detail::ordering_degrees(g, options.symmetric, pool));
+      break;
+    case vertex_order::bfs:
+      perm.old_id = detail::bfs_order(detail::make_ordering_adjacency(g, options.symmetric, pool));
+      break;
+    case vertex_order::rcm: {
+      const auto adj = detail::make_ordering_adjacency(g, options.symmetric, pool);
+      perm.old_id    = detail::rcm_order(adj, adj.degrees());
+      break;
+    }
+    case vertex_order::gorder:
+      perm.old_id = detail::gorder_order(detail::make_ordering_adjacency(g, options.symmetric, pool),
+                                         options.gorder_window);
+      break;
+    case vertex_order::rabbit: {
+      const auto adj = detail::make_ordering_adjacency(g, options.symmetric, pool);
+      perm.old_id    = detail::rabbit_order(adj, adj.degrees());
+      break;
+    }
+  }
+
+  perm.new_id.resize(perm.old_id.size());
+  pool.for_each_chunk(perm.old_id.size(), [&](size_t lo, size_t hi, size_t) {
+    for (size_t v = lo; v < hi; ++v)
+      perm.new_id[static_cast<size_t>(perm.old_id[v])] = static_cast<id_type>(v);
+  });
+  return perm;
+}
+
+/**
+ * @ingroup graph_algorithms
+ * @brief Returns a copy of a compressed_graph with its vertices renumbered by perm.
+ *
+ * Vertex u of g becomes vertex perm.new_id[u]; vertex values, edge values and the graph value are
+ * carried along, and the rows are sorted by the new target ids. See
+ * compressed_graph::load_permuted.
+ *
+ * @param g    The graph to copy
+ * @param perm The permutation, e.g. from order_vertices(g, ...)
+ * @param pool Thread pool to build on. Default: default_thread_pool().
+ *
+ * @return The renumbered graph, with a single partition
+ *
+ * **Throws:**
+ * - graph_error if perm.new_id is not a permutation of the vertex ids of g
+ * - std::bad_alloc if allocations fail; a copy of a vertex, edge or graph value may also throw
+ *
+ * **Complexity:**
+ * - O(V + E log(max degree)) work, parallel over the vertices; O(V + E) space for the copy
+ */
+template <class G>
+requires requires(G& h, const G& src, std::span<const typename G::vertex_id_type> ids, thread_pool& pool) {
+  h.load_permuted(src, ids, pool);
+}
+G reorder(const G& g, const vertex_permutation<typename G::vertex_id_type>& perm, thread_pool& pool = default_thread_pool()) {
+  G out;
+  if constexpr (requires { out.graph_value() = g.graph_value(); })
+    out.graph_value() = g.graph_value();
+  out.load_permuted(g, perm.new_id, pool);
+  return out;
+}
+
+} // namespace graph
+
+#endif // GRAPH_VERTEX_ORDERING_HPP
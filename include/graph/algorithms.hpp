@@ -26,27 +26,40 @@
 // Visitor Utilities
 #include "algorithm/visitor_factory.hpp"
 
+// Reusable Scratch for Repeated Traversals
+#include "algorithm/traversal_workspace.hpp"
+
 // Shortest Path Algorithms
 #include "algorithm/dijkstra_shortest_paths.hpp"
+#include "algorithm/point_to_point_shortest_path.hpp"
+#include "algorithm/contraction_hierarchy.hpp"
+#include "algorithm/delta_stepping_shortest_paths.hpp"
 #include "algorithm/bellman_ford_shortest_paths.hpp"
 #include "algorithm/breadth_first_search.hpp"
+#include "algorithm/parallel_breadth_first_search.hpp"
+#include "algorithm/multi_source_bfs.hpp"
 
 // Community Detection
 #include "algorithm/label_propagation.hpp"
+#include "algorithm/parallel_label_propagation.hpp"
 
 // Search Algorithms
 #include "algorithm/depth_first_search.hpp"
 
 // Minimum Spanning Tree
 #include "algorithm/mst.hpp"
+#include "algorithm/parallel_mst.hpp"
 
 // Connectivity
 #include "algorithm/connected_components.hpp"
 #include "algorithm/articulation_points.hpp"
 #include "algorithm/biconnected_components.hpp"
+#include "algorithm/parallel_scc.hpp"
 
 // Link Analysis
 #include "algorithm/jaccard.hpp"
+#include "algorithm/parallel_jaccard.hpp"
+#include "algorithm/pagerank.hpp"
 
 // Topological Sort & DAG
 #include "algorithm/topological_sort.hpp"
@@ -56,6 +69,10 @@
 
 // Triangle Counting
 #include "algorithm/tc.hpp"
+#include "algorithm/parallel_triangle_count.hpp"
+
+// Vertex Ordering
+#include "algorithm/vertex_ordering.hpp"
 
 /**
  * @defgroup graph_algorithms Graph Algorithms
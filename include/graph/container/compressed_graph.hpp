@@ -6,7 +6,10 @@
 #include <functional>
 #include <algorithm>
 #include <ranges>
+#include <span>
 #include <cstdint>
+#include <limits>
+#include <numeric>
 #include <cassert>
 #include <format>
 #include <iostream>
@@ -16,11 +19,16 @@
 #include "graph/adj_list/descriptor_traits.hpp"
 #include "graph/adj_list/vertex_descriptor_view.hpp"
 #include "graph/adj_list/edge_descriptor_view.hpp"
+#include "graph/detail/thread_pool.hpp"
 
 // NOTES
 //  have public load_edges(...), load_vertices(...), and load()
 //  allow separation of construction and load
 //  allow multiple calls to load edges as long as subsequent edges have uid >= last vertex (append)
+//  load_unsorted_edges(...) builds from edges in any order, in parallel (histogram, scan, scatter)
+//  load_edge_stream(...) and load_row_stream(...) build the same way from edges generated twice per
+//  part (e.g. parsed from a file), without an intermediate edge vector
+//  Bidirectional=true adds an incoming-edge (CSC) index, built in parallel after the edges are loaded
 //  VId must be large enough for the total edges and the total vertices.
 //
 // API Design:
@@ -75,12 +83,13 @@ requires copyable_edge<invoke_result_t<EProj, range_value_t<ERng>>, VId, EV>
 //
 // forward declarations
 //
-template <class EV        = void,            // edge value type
-          class VV        = void,            // vertex value type
-          class GV        = void,            // graph value type
-          integral VId    = uint32_t,        // vertex id type
-          integral EIndex = uint32_t,        // edge index type
-          class Alloc     = std::allocator<VId>> // for internal containers
+template <class EV           = void,                // edge value type
+          class VV           = void,                // vertex value type
+          class GV           = void,                // graph value type
+          integral VId       = uint32_t,            // vertex id type
+          integral EIndex    = uint32_t,            // edge index type
+          bool Bidirectional = false,               // maintain an incoming-edge (CSC) index?
+          class Alloc        = std::allocator<VId>> // for internal containers
 class compressed_graph;
 
 /**
@@ -109,6 +118,17 @@ struct csr_col {
   vertex_id_type index = 0;
 };
 
+/**
+ * @ingroup graph_containers
+ * @brief Options for @c compressed_graph_base::load_unsorted_edges.
+ *
+ * With both options off, the edges of each row keep their order in the input range.
+*/
+struct csr_build_options {
+  bool sort_targets      = false; ///< Sort the edges of each row by target_id (stable)
+  bool remove_duplicates = false; ///< Keep only the first edge for each (source_id, target_id); implies sort_targets
+};
+
 
 /**
  * @ingroup graph_containers
@@ -136,7 +156,6 @@ class csr_row_values {
   using row_index_vector   = std::vector<row_type, row_allocator_type>;
 
 public:
-  using graph_type        = compressed_graph<EV, VV, GV, VId, EIndex, Alloc>;
   using vertex_type       = row_type;
   using vertex_value_type = VV;
   using allocator_type    = typename std::allocator_traits<Alloc>::template rebind_alloc<vertex_value_type>;
@@ -308,7 +327,6 @@ class csr_col_values {
   using col_index_vector   = std::vector<col_type, col_allocator_type>;
 
 public:
-  using graph_type      = compressed_graph<EV, VV, GV, VId, EIndex, Alloc>;
   using edge_type       = col_type; // index into v_
   using edge_value_type = EV;
   using allocator_type  = typename std::allocator_traits<Alloc>::template rebind_alloc<edge_value_type>;
@@ -382,6 +400,56 @@ public: // Operations
 };
 
 
+/**
+ * @ingroup graph_containers
+ * @brief Incoming-edge (CSC) index of a bidirectional @c compressed_graph.
+ *
+ * The edges are grouped by target_id: @c in_row_index_[v] to @c in_row_index_[v+1] delimit the
+ * source ids of v's incoming edges in @c in_col_index_, in ascending order. When @c EV is not void,
+ * @c in_edge_ids_ holds the index of each incoming edge in @c col_index_, so edge values are reached
+ * through the outgoing edge and never copied.
+ *
+ * If @c Bidirectional is false the class is empty.
+ *
+ * @tparam EV            The edge value type.
+ * @tparam VId           Vertex id type.
+ * @tparam EIndex        The type for storing an edge index.
+ * @tparam Bidirectional True to hold the index.
+ * @tparam Alloc         The allocator type.
+*/
+template <class EV, integral VId, integral EIndex, bool Bidirectional, class Alloc>
+class csr_in_index {
+protected:
+  using in_row_vector =
+        std::vector<csr_row<EIndex>, typename std::allocator_traits<Alloc>::template rebind_alloc<csr_row<EIndex>>>;
+  using in_col_vector =
+        std::vector<csr_col<VId>, typename std::allocator_traits<Alloc>::template rebind_alloc<csr_col<VId>>>;
+  using in_edge_id_vector = std::vector<EIndex, typename std::allocator_traits<Alloc>::template rebind_alloc<EIndex>>;
+
+  constexpr csr_in_index() = default;
+  constexpr csr_in_index(const Alloc& alloc) : in_row_index_(alloc), in_col_index_(alloc), in_edge_ids_(alloc) {}
+
+  constexpr void clear() noexcept {
+    in_row_index_.clear();
+    in_col_index_.clear();
+    in_edge_ids_.clear();
+  }
+
+  in_row_vector     in_row_index_; // starting index into in_col_index_; holds +1 extra terminating row
+  in_col_vector     in_col_index_; // in_col_index_[n] holds the source id of the n-th incoming edge
+  in_edge_id_vector in_edge_ids_;  // in_edge_ids_[n] holds its index in col_index_ (empty if EV is void)
+};
+
+template <class EV, integral VId, integral EIndex, class Alloc>
+class csr_in_index<EV, VId, EIndex, false, Alloc> {
+protected:
+  constexpr csr_in_index() = default;
+  constexpr csr_in_index([[maybe_unused]] const Alloc& alloc) {}
+
+  constexpr void clear() noexcept {}
+};
+
+
 /**
  * @ingroup graph_containers
  * @brief Base class for compressed sparse row adjacency graph
@@ -408,14 +476,18 @@ public: // Operations
  *                 number of vertices in the graph.
  * @tparam EIndex  The type for storing an edge index. It must be able to store a value of |E|+1,
  *                 where |E| is the total number of edges in the graph.
+ * @tparam Bidirectional If true, an incoming-edge (CSC) index is built with the edges, providing
+ *                 @c in_edges(g,u) so that the graph satisfies @c bidirectional_adjacency_list.
  * @tparam Alloc   The allocator type.
 */
-template <class EV, class VV, class GV, integral VId, integral EIndex, class Alloc>
+template <class EV, class VV, class GV, integral VId, integral EIndex, bool Bidirectional, class Alloc>
 class compressed_graph_base
       : protected csr_row_values<EV, VV, GV, VId, EIndex, Alloc>
-      , protected csr_col_values<EV, VV, GV, VId, EIndex, Alloc> {
+      , protected csr_col_values<EV, VV, GV, VId, EIndex, Alloc>
+      , protected csr_in_index<EV, VId, EIndex, Bidirectional, Alloc> {
   using row_values_base = csr_row_values<EV, VV, GV, VId, EIndex, Alloc>;
   using col_values_base = csr_col_values<EV, VV, GV, VId, EIndex, Alloc>;
+  using in_index_base   = csr_in_index<EV, VId, EIndex, Bidirectional, Alloc>;
 
   using row_type           = csr_row<EIndex>; // index into col_index_
   using row_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<row_type>;
@@ -426,7 +498,9 @@ class compressed_graph_base
   using col_index_vector   = std::vector<col_type, col_allocator_type>;
 
 public: // Types
-  using graph_type = compressed_graph_base<EV, VV, GV, VId, EIndex, Alloc>;
+  using graph_type = compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>;
+
+  static constexpr bool bidirectional = Bidirectional;
 
   using partition_id_type = VId;
   using partition_vector  = std::vector<VId>;
@@ -460,7 +534,12 @@ public: // Construction/Destruction
   constexpr compressed_graph_base& operator=(compressed_graph_base&&)      = default;
 
   constexpr compressed_graph_base(const Alloc& alloc)
-        : row_values_base(alloc), col_values_base(alloc), row_index_(alloc), col_index_(alloc), partition_(alloc) {
+        : row_values_base(alloc)
+        , col_values_base(alloc)
+        , in_index_base(alloc)
+        , row_index_(alloc)
+        , col_index_(alloc)
+        , partition_(alloc) {
     terminate_partitions();
   }
 
@@ -510,6 +589,7 @@ public: // Properties - resolve ambiguity from multiple inheritance
     col_index_.clear();
     row_values_base::clear();
     col_values_base::clear();
+    in_index_base::clear();
     partition_.clear();
     terminate_partitions();
   }
@@ -537,6 +617,7 @@ public: // Properties - resolve ambiguity from multiple inheritance
                                   const Alloc&   alloc               = Alloc())
         : row_values_base(alloc)
         , col_values_base(alloc)
+        , in_index_base(alloc)
         , row_index_(alloc)
         , col_index_(alloc)
         , partition_(partition_start_ids, alloc) {
@@ -578,6 +659,7 @@ public: // Properties - resolve ambiguity from multiple inheritance
                                   const Alloc&   alloc               = Alloc())
         : row_values_base(alloc)
         , col_values_base(alloc)
+        , in_index_base(alloc)
         , row_index_(alloc)
         , col_index_(alloc)
         , partition_(partition_start_ids, alloc) {
@@ -595,7 +677,12 @@ public: // Properties - resolve ambiguity from multiple inheritance
   */
   constexpr compressed_graph_base(const std::initializer_list<copyable_edge_t<VId, EV>>& ilist,
                                   const Alloc&                                           alloc = Alloc())
-        : row_values_base(alloc), col_values_base(alloc), row_index_(alloc), col_index_(alloc), partition_(alloc) {
+        : row_values_base(alloc)
+        , col_values_base(alloc)
+        , in_index_base(alloc)
+        , row_index_(alloc)
+        , col_index_(alloc)
+        , partition_(alloc) {
     load_edges(ilist, identity());
     terminate_partitions();
   }
@@ -653,6 +740,11 @@ public: // Operations
       // Expand existing structure if needed
       row_index_.resize(vertex_count + 1, vertex_type{0});
     }
+    if constexpr (Bidirectional) {
+      // New vertices have no incoming edges either
+      if (!this->in_row_index_.empty() && this->in_row_index_.size() < row_index_.size())
+        this->in_row_index_.resize(row_index_.size(), this->in_row_index_.back());
+    }
 
     row_values_base::load_row_values(vrng, vprojection, vertex_count);
   }
@@ -683,6 +775,9 @@ public: // Operations
    * extended to match the number of @c row_index_.size()-1 to avoid out-of-bounds errors when
    * accessing vertex values.
    *
+   * When @c Bidirectional is true, the incoming-edge index is built from the loaded edges on
+   * @c default_thread_pool().
+   *
    * @todo @c ERng not a forward_range because CSV reader doesn't conform to be a forward_range
    *          10/14/2025: The library has been updated to comply with C++20 ranges. This needs revalidated.
    * 
@@ -757,6 +852,9 @@ public: // Operations
     // getting a value for a row.
     if (row_values_base::size() > 1 && row_values_base::size() < vertex_count)
       row_values_base::resize(vertex_count);
+
+    if constexpr (Bidirectional)
+      build_in_index(default_thread_pool());
   }
 
   // The only diff with this and ERng&& is v_.push_back vs. v_.emplace_back
@@ -839,6 +937,326 @@ public: // Operations
     // getting a value for a row.
     if (row_values_base::size() > 0 && row_values_base::size() < vertex_count)
       row_values_base::resize(vertex_count);
+
+    if constexpr (Bidirectional)
+      build_in_index(default_thread_pool());
+  }
+
+  /**
+   * @brief Load edges given in any order, building the CSR arrays in parallel.
+   *
+   * Unlike @c load_edges(erng,eproj), @c erng does not need to be ordered by source_id, so callers
+   * can skip the serial sort. The build is a counting sort distributed over @c pool:
+   *
+   *  1. the edge range is split into contiguous parts and each part counts its edges per source
+   *     (one histogram per part);
+   *  2. the histograms are combined into per-row degrees and a parallel exclusive scan of the
+   *     degrees produces @c row_index_;
+   *  3. each part scatters its edges into @c col_index_ (and the edge values) at its own offsets
+   *     within each row.
+   *
+   * Because the parts are contiguous and scattered in part order, the edges of each row keep
+   * their input order. @c options can then sort each row by target_id and drop duplicate
+   * (source_id, target_id) pairs, keeping the first occurrence and its value.
+   *
+   * The number of parts is limited so that the histograms never take more entries than there are
+   * edges; graphs with an average degree below the worker count use fewer parts.
+   *
+   * If @c load_vertices(vrng,vproj) has been called before this, the row_values_ vector will be
+   * extended to match the number of vertices.
+   *
+   * When @c Bidirectional is true, the incoming-edge index is built afterwards on the same @c pool.
+   *
+   * @tparam ERng   Random-access, sized edge range type
+   * @tparam EProj  Edge projection function type
+   *
+   * @param erng         Input range for edges, in any order
+   * @param eprojection  Edge projection function that returns a @c copyable_edge_t<VId,EV> for an element in
+   *                     @c erng. It is called twice per edge, concurrently, and must be free of side effects.
+   * @param vertex_count The number of vertices in the graph. If smaller than the largest vertex id + 1 (or 0),
+   *                     the largest vertex id in the edge range determines the number of vertices.
+   * @param options      Row sorting and duplicate removal.
+   * @param pool         Thread pool to build on.
+   *
+   * @throws graph_error if the number of edges does not fit in @c EIndex.
+  */
+  template <std::ranges::random_access_range ERng, class EProj = identity>
+  requires std::ranges::sized_range<ERng>
+  void load_unsorted_edges(const ERng&              erng,
+                           EProj                    eprojection  = {},
+                           size_type                vertex_count = 0,
+                           const csr_build_options& options      = {},
+                           thread_pool&             pool         = default_thread_pool()) {
+    // should only be loading into an empty graph
+    assert(row_index_.empty() && col_index_.empty() && static_cast<col_values_base&>(*this).empty());
+
+    const size_t num_input = static_cast<size_t>(std::ranges::size(erng));
+    if (num_input > static_cast<size_t>(std::numeric_limits<edge_index_type>::max())) {
+      throw graph_error(std::format("{} edges exceed the capacity of the edge index type", num_input));
+    }
+    auto edge_at = [&erng, &eprojection](size_t i) -> decltype(auto) {
+      return eprojection(std::ranges::begin(erng)[static_cast<std::ranges::range_difference_t<ERng>>(i)]);
+    };
+
+    // Largest vertex id referenced, as either source or target
+    std::vector<vertex_id_type> tid_max(pool.size(), vertex_id_type{0});
+    pool.for_each_chunk(num_input, [&](size_t first, size_t last, size_t tid) {
+      vertex_id_type m = tid_max[tid];
+      for (size_t i = first; i < last; ++i) {
+        auto&& edge = edge_at(i);
+        m = max(m, max(static_cast<vertex_id_type>(edge.source_id), static_cast<vertex_id_type>(edge.target_id)));
+      }
+      tid_max[tid] = m;
+    });
+    if (num_input > 0) {
+      vertex_count = max(vertex_count, static_cast<size_type>(*std::ranges::max_element(tid_max)) + 1);
+    }
+    const size_t n = static_cast<size_t>(vertex_count);
+    if (n == 0) {
+      return;
+    }
+
+    // One histogram per contiguous part of the input
+    const size_t parts      = std::clamp<size_t>(num_input / n, 1, pool.size());
+    auto         part_first = [&](size_t p) { return num_input * p / parts; };
+    load_edge_parts<false>(
+          parts,
+          [&](size_t p, auto&& emit) {
+            for (size_t i = part_first(p); i < part_first(p + 1); ++i)
+              emit(edge_at(i));
+          },
+          vertex_count, options, pool);
+  }
+
+  /**
+   * @brief Load edges generated part by part, without storing them in between.
+   *
+   * This is the build of @c load_unsorted_edges for edges that are not in a range, such as the
+   * arcs parsed from the chunks of a text file. @c for_each_edge(p, emit) calls @c emit(edge) for
+   * every edge of part p in [0, parts), where @c edge has the @c source_id, @c target_id (and
+   * @c value) members of @c copyable_edge_t<VId,EV>. It is called twice per part: once to count
+   * the edges of each source and once to scatter them. Different parts run concurrently, and each
+   * call for a part must emit the same edges in the same order.
+   *
+   * The edges of each row keep part order, then emission order; @c options can then sort each row
+   * and drop duplicates as for @c load_unsorted_edges. Each part keeps a histogram of one entry per
+   * vertex, so @c parts should not exceed the number of edges per vertex.
+   *
+   * When @c Bidirectional is true, the incoming-edge index is built afterwards on the same @c pool.
+   *
+   * @param parts         The number of parts.
+   * @param for_each_edge Callable emitting the edges of a part. Exceptions it throws while counting
+   *                      leave the graph empty.
+   * @param vertex_count  The number of vertices. If smaller than the largest vertex id + 1, the
+   *                      largest vertex id emitted determines the number of vertices.
+   * @param options       Row sorting and duplicate removal.
+   * @param pool          Thread pool to build on.
+   *
+   * @throws graph_error if the number of edges does not fit in @c EIndex.
+  */
+  template <class ForEachEdge>
+  void load_edge_stream(size_t                   parts,
+                        ForEachEdge&&            for_each_edge,
+                        size_type                vertex_count = 0,
+                        const csr_build_options& options      = {},
+                        thread_pool&             pool         = default_thread_pool()) {
+    load_edge_parts<true>(parts, std::forward<ForEachEdge>(for_each_edge), vertex_count, options, pool);
+  }
+
+  /**
+   * @brief Load rows generated in vertex order, part by part, without storing the edges in between.
+   *
+   * For inputs that list the edges of vertex 0, then vertex 1, and so on, such as the adjacency
+   * lines of a METIS file, the row offsets follow from the degrees and no histogram is needed.
+   * @c for_each_row(p, next_row, emit) calls @c next_row() to start each row of part p in
+   * [0, parts), and @c emit(edge) for every edge of the current row, where @c edge has the
+   * @c target_id (and @c value) members of @c copyable_edge_t<VId,EV>. The rows of part p follow
+   * those of part p-1. It is called twice per part: once to count the degrees and once to write
+   * the edges in place. Different parts run concurrently, and each call for a part must produce
+   * the same rows in the same order.
+   *
+   * When @c Bidirectional is true, the incoming-edge index is built afterwards on the same @c pool.
+   *
+   * @param parts        The number of parts.
+   * @param for_each_row Callable producing the rows of a part. Exceptions it throws while counting
+   *                     leave the graph empty.
+   * @param vertex_count The number of vertices. If smaller than the number of rows or the largest
+   *                     target id + 1, they determine the number of vertices; missing rows are empty.
+   * @param options      Row sorting and duplicate removal.
+   * @param pool         Thread pool to build on.
+   *
+   * @throws graph_error if the number of edges does not fit in @c EIndex.
+  */
+  template <class ForEachRow>
+  void load_row_stream(size_t                   parts,
+                       ForEachRow&&             for_each_row,
+                       size_type                vertex_count = 0,
+                       const csr_build_options& options      = {},
+                       thread_pool&             pool         = default_thread_pool()) {
+    // should only be loading into an empty graph
+    assert(row_index_.empty() && col_index_.empty() && static_cast<col_values_base&>(*this).empty());
+
+    // Pass 1: the degree of every row of each part
+    std::vector<std::vector<edge_index_type>> degrees(parts);
+    std::vector<size_t>                       part_edges(parts, 0);
+    std::vector<size_t>                       part_vertices(parts, 0);
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            auto&  deg = degrees[p];
+            size_t m = 0, nv = 0;
+            for_each_row(
+                  p, [&] { deg.push_back(edge_index_type{0}); },
+                  [&](const auto& edge) {
+                    assert(!deg.empty());
+                    nv = max(nv, static_cast<size_t>(edge.target_id) + 1);
+                    ++deg.back();
+                    ++m;
+                  });
+            part_edges[p]    = m;
+            part_vertices[p] = nv;
+          },
+          1);
+    const size_t num_input = std::reduce(part_edges.begin(), part_edges.end(), size_t{0});
+    if (num_input > static_cast<size_t>(std::numeric_limits<edge_index_type>::max())) {
+      throw graph_error(std::format("{} edges exceed the capacity of the edge index type", num_input));
+    }
+    std::vector<size_t> first_row(parts + 1, 0);
+    for (size_t p = 0; p < parts; ++p)
+      first_row[p + 1] = first_row[p] + degrees[p].size();
+    vertex_count = max({vertex_count, static_cast<size_type>(first_row[parts]),
+                        static_cast<size_type>(std::reduce(part_vertices.begin(), part_vertices.end(), size_t{0},
+                                                           [](size_t a, size_t b) { return max(a, b); }))});
+    const size_t n = static_cast<size_t>(vertex_count);
+    if (n == 0) {
+      return;
+    }
+
+    std::vector<edge_index_type> row_start(n + 1, edge_index_type{0});
+    pool.for_each_index(
+          parts, [&](size_t p, size_t) { std::ranges::copy(degrees[p], row_start.begin() + first_row[p]); }, 1);
+    degrees = {};
+    parallel_exclusive_scan(pool, row_start.begin(), n + 1);
+
+    // Pass 2: each part writes its rows in place
+    col_index_.resize(num_input);
+    if constexpr (!is_void_v<EV>)
+      static_cast<col_values_base&>(*this).resize(num_input);
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            auto pos = static_cast<size_t>(row_start[first_row[p]]);
+            for_each_row(
+                  p, [] {},
+                  [&](const auto& edge) {
+                    col_index_[pos] = edge_type{static_cast<vertex_id_type>(edge.target_id)};
+                    if constexpr (!is_void_v<EV>)
+                      static_cast<col_values_base&>(*this)[static_cast<edge_index_type>(pos)] = edge.value;
+                    ++pos;
+                  });
+          },
+          1);
+
+    finish_rows(row_start, vertex_count, options, pool);
+  }
+
+  /**
+   * @brief Load a copy of another graph with its vertices renumbered, building the CSR arrays in
+   *        parallel.
+   *
+   * Vertex u of @c src becomes vertex @c new_id[u]: its row, its value and the values of its edges
+   * move with it, and every target id is renumbered. Each row is then sorted by the new target ids,
+   * keeping parallel edges in their original order. Permutations that give vertices accessed
+   * together nearby ids are computed by @c order_vertices (algorithm/vertex_ordering.hpp).
+   *
+   * The rows are copied in new-id order over @c pool, with the row offsets from a parallel prefix
+   * sum of the degrees. The copy has a single partition; when @c Bidirectional is true, its
+   * incoming-edge index is rebuilt on @c pool.
+   *
+   * @param src    The graph to copy. It must not be this graph.
+   * @param new_id The new id of every vertex of @c src (old-to-new map).
+   * @param pool   Thread pool to build on.
+   *
+   * @throws graph_error if @c new_id is not a permutation of the vertex ids of @c src.
+  */
+  void load_permuted(const compressed_graph_base&      src,
+                     std::span<const vertex_id_type> new_id,
+                     thread_pool&                    pool = default_thread_pool()) {
+    // should only be loading into an empty graph
+    assert(row_index_.empty() && col_index_.empty() && static_cast<col_values_base&>(*this).empty());
+    assert(this != &src);
+
+    const size_t n = src.size();
+    if (new_id.size() != n) {
+      throw graph_error(std::format("Permutation has {} ids for {} vertices", new_id.size(), n));
+    }
+    // Inverse map; an id out of range or seen twice means new_id is not a permutation
+    constexpr auto              unset = std::numeric_limits<vertex_id_type>::max();
+    std::vector<vertex_id_type> old_id(n, unset);
+    for (size_t u = 0; u < n; ++u) {
+      const auto v = static_cast<size_t>(new_id[u]);
+      if (v >= n || old_id[v] != unset) {
+        throw graph_error(std::format("Invalid permutation: new id {} of vertex {} is out of range or repeated", v, u));
+      }
+      old_id[v] = static_cast<vertex_id_type>(u);
+    }
+    partition_.clear();
+    if (n == 0) {
+      terminate_partitions();
+      return;
+    }
+
+    // Rows in the new order
+    std::vector<edge_index_type> row_start(n + 1, edge_index_type{0});
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t v = first; v < last; ++v) {
+        const size_t u = static_cast<size_t>(old_id[v]);
+        row_start[v]   = src.row_index_[u + 1].index - src.row_index_[u].index;
+      }
+    });
+    parallel_exclusive_scan(pool, row_start.begin(), n + 1);
+
+    const size_t m = src.col_index_.size();
+    col_index_.resize(m);
+    if constexpr (!is_void_v<EV>)
+      static_cast<col_values_base&>(*this).resize(m);
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t v = first; v < last; ++v) {
+        const size_t u    = static_cast<size_t>(old_id[v]);
+        const auto   from = src.row_index_[u].index, to = row_start[v];
+        const auto   deg  = static_cast<edge_index_type>(row_start[v + 1] - to);
+        for (edge_index_type j = 0; j < deg; ++j) {
+          col_index_[static_cast<size_t>(to + j)] =
+                edge_type{new_id[static_cast<size_t>(src.col_index_[static_cast<size_t>(from + j)].index)]};
+          if constexpr (!is_void_v<EV>)
+            static_cast<col_values_base&>(*this)[to + j] = static_cast<const col_values_base&>(src)[from + j];
+        }
+      }
+    });
+    sort_rows(row_start, false, pool);
+
+    row_index_.resize(n + 1);
+    pool.for_each_chunk(n + 1, [&](size_t first, size_t last, size_t) {
+      for (size_t v = first; v < last; ++v) {
+        row_index_[v] = vertex_type{row_start[v]};
+      }
+    });
+
+    // Vertex values follow their vertices
+    if constexpr (!is_void_v<VV>) {
+      const auto& src_values = static_cast<const row_values_base&>(src);
+      if (src_values.size() > 0) {
+        row_values_base::resize(n);
+        pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+          for (size_t v = first; v < last; ++v)
+            row_values_base::operator[](v) = src_values[static_cast<size_t>(old_id[v])];
+        });
+      }
+    }
+    terminate_partitions();
+
+    if constexpr (Bidirectional)
+      build_in_index(pool);
   }
 
   /**
@@ -893,6 +1311,288 @@ protected:
     return last_id;
   }
 
+  /// The build of load_unsorted_edges and load_edge_stream. For a stream the histograms grow to
+  /// the vertex ids found while counting, and the scatter is batched, which pays off when producing
+  /// an edge costs more than reading it from memory. Otherwise vertex_count covers every id.
+  template <bool Stream, class ForEachEdge>
+  void load_edge_parts(size_t                   parts,
+                       ForEachEdge&&            for_each_edge,
+                       size_type                vertex_count,
+                       const csr_build_options& options,
+                       thread_pool&             pool) {
+    // should only be loading into an empty graph
+    assert(row_index_.empty() && col_index_.empty() && static_cast<col_values_base&>(*this).empty());
+
+    // Pass 1: one histogram per part, grown to the largest vertex id the part references
+    std::vector<std::vector<edge_index_type>> cursor(parts);
+    std::vector<size_t>                       part_edges(parts, 0);
+    std::vector<size_t>                       part_vertices(parts, 0);
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            auto&  counts = cursor[p];
+            size_t m = 0, nv = 0;
+            counts.assign(static_cast<size_t>(vertex_count), edge_index_type{0});
+            for_each_edge(p, [&](const auto& edge) {
+              const size_t u = static_cast<size_t>(edge.source_id);
+              if constexpr (Stream) {
+                nv = max(nv, max(u, static_cast<size_t>(edge.target_id)) + 1);
+                if (u >= counts.size())
+                  counts.resize(max(u + 1, 2 * counts.size()), edge_index_type{0});
+              }
+              ++counts[u];
+              ++m;
+            });
+            part_edges[p]    = m;
+            part_vertices[p] = nv;
+          },
+          1);
+    const size_t num_input = std::reduce(part_edges.begin(), part_edges.end(), size_t{0});
+    if (num_input > static_cast<size_t>(std::numeric_limits<edge_index_type>::max())) {
+      throw graph_error(std::format("{} edges exceed the capacity of the edge index type", num_input));
+    }
+    vertex_count = max(vertex_count, static_cast<size_type>(
+                                           std::reduce(part_vertices.begin(), part_vertices.end(), size_t{0},
+                                                       [](size_t a, size_t b) { return max(a, b); })));
+    const size_t n = static_cast<size_t>(vertex_count);
+    if (n == 0) {
+      return;
+    }
+
+    // Per-row degrees; each part's histogram becomes its offset within the row
+    pool.for_each_index(
+          parts, [&](size_t p, size_t) { cursor[p].resize(n, edge_index_type{0}); }, 1);
+    std::vector<edge_index_type> row_start(n + 1, edge_index_type{0});
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t u = first; u < last; ++u) {
+        edge_index_type running = 0;
+        for (size_t p = 0; p < parts; ++p) {
+          edge_index_type c  = cursor[p][u];
+          cursor[p][u]       = running;
+          running           += c;
+        }
+        row_start[u] = running;
+      }
+    });
+    parallel_exclusive_scan(pool, row_start.begin(), n + 1);
+
+    // Pass 2: scatter. Streamed edges are written in small batches so that the random writes of a
+    // batch overlap, rather than each waiting behind the work of producing the next edge.
+    col_index_.resize(num_input);
+    if constexpr (!is_void_v<EV>)
+      static_cast<col_values_base&>(*this).resize(num_input);
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            edge_index_type* offsets = cursor[p].data();
+            auto             place   = [&](const auto& edge) {
+              const size_t u   = static_cast<size_t>(edge.source_id);
+              const auto   pos = static_cast<edge_index_type>(row_start[u] + offsets[u]++);
+              col_index_[static_cast<size_t>(pos)] = edge_type{static_cast<vertex_id_type>(edge.target_id)};
+              if constexpr (!is_void_v<EV>)
+                static_cast<col_values_base&>(*this)[pos] = edge.value;
+            };
+            if constexpr (Stream) {
+              constexpr size_t                                 batch_size = 1024;
+              std::vector<copyable_edge_t<vertex_id_type, EV>> batch;
+              batch.reserve(batch_size);
+              for_each_edge(p, [&](const auto& edge) {
+                if constexpr (is_void_v<EV>)
+                  batch.push_back({static_cast<vertex_id_type>(edge.source_id),
+                                   static_cast<vertex_id_type>(edge.target_id)});
+                else
+                  batch.push_back({static_cast<vertex_id_type>(edge.source_id),
+                                   static_cast<vertex_id_type>(edge.target_id), edge.value});
+                if (batch.size() == batch_size) {
+                  std::ranges::for_each(batch, place);
+                  batch.clear();
+                }
+              });
+              std::ranges::for_each(batch, place);
+            } else {
+              for_each_edge(p, place);
+            }
+          },
+          1);
+    cursor = {};
+
+    finish_rows(row_start, vertex_count, options, pool);
+  }
+
+  // The last steps of the parallel builds: sorting the rows when asked, row_index_ from the row
+  // offsets, the vertex values and the incoming-edge index
+  void finish_rows(std::vector<edge_index_type>& row_start,
+                   size_type                     vertex_count,
+                   const csr_build_options&      options,
+                   thread_pool&                  pool) {
+    const size_t n = row_start.size() - 1;
+    if (options.sort_targets || options.remove_duplicates)
+      sort_rows(row_start, options.remove_duplicates, pool);
+
+    row_index_.resize(n + 1);
+    pool.for_each_chunk(n + 1, [&](size_t first, size_t last, size_t) {
+      for (size_t u = first; u < last; ++u) {
+        row_index_[u] = vertex_type{row_start[u]};
+      }
+    });
+
+    // If load_vertices(vrng,vproj) has been called but it doesn't have enough values for all
+    // the vertices then we extend the size to remove possibility of out-of-bounds occuring when
+    // getting a value for a row.
+    if (row_values_base::size() > 0 && row_values_base::size() < vertex_count)
+      row_values_base::resize(vertex_count);
+
+    if constexpr (Bidirectional)
+      build_in_index(pool);
+  }
+
+  // Sorts each row [row_start[u], row_start[u+1]) by target id, keeping equal targets in their
+  // current order; with remove_duplicates only the first edge per target is kept and the rows are
+  // compacted into new arrays (row_start is updated to match).
+  void sort_rows(std::vector<edge_index_type>& row_start, bool remove_duplicates, thread_pool& pool) {
+    const size_t n = row_start.size() - 1;
+    std::vector<edge_index_type> kept(remove_duplicates ? n + 1 : 0, edge_index_type{0});
+
+    // Edge values travel with their targets through a per-worker scratch buffer
+    using scratch_type = std::conditional_t<is_void_v<EV>, vertex_id_type, pair<vertex_id_type, edge_value_type>>;
+    std::vector<std::vector<scratch_type>> scratch(pool.size());
+
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t tid) {
+      auto& buf = scratch[tid];
+      for (size_t u = first; u < last; ++u) {
+        const size_t lo = static_cast<size_t>(row_start[u]), hi = static_cast<size_t>(row_start[u + 1]);
+        size_t       deg = hi - lo;
+        if constexpr (is_void_v<EV>) {
+          auto row_first = col_index_.begin() + static_cast<std::ptrdiff_t>(lo);
+          auto row_last  = col_index_.begin() + static_cast<std::ptrdiff_t>(hi);
+          std::ranges::sort(row_first, row_last, less<>{}, &edge_type::index);
+          if (remove_duplicates)
+            deg = static_cast<size_t>(std::ranges::unique(row_first, row_last, std::equal_to<>{}, &edge_type::index).begin() -
+                                      row_first);
+        } else {
+          auto& values = static_cast<col_values_base&>(*this);
+          buf.clear();
+          for (size_t j = lo; j < hi; ++j)
+            buf.emplace_back(col_index_[j].index, std::move(values[static_cast<edge_index_type>(j)]));
+          std::ranges::stable_sort(buf, less<>{}, &scratch_type::first);
+          if (remove_duplicates)
+            deg = static_cast<size_t>(std::ranges::unique(buf, std::equal_to<>{}, &scratch_type::first).begin() -
+                                      buf.begin());
+          for (size_t j = 0; j < deg; ++j) {
+            col_index_[lo + j]                               = edge_type{buf[j].first};
+            values[static_cast<edge_index_type>(lo + j)] = std::move(buf[j].second);
+          }
+        }
+        if (remove_duplicates)
+          kept[u] = static_cast<edge_index_type>(deg);
+      }
+    });
+    if (!remove_duplicates)
+      return;
+
+    // Compact the surviving prefix of every row
+    const auto total = static_cast<size_t>(parallel_exclusive_scan(pool, kept.begin(), n + 1));
+    if (total == col_index_.size())
+      return;
+    col_index_vector new_cols(total, col_index_.get_allocator());
+    col_values_base  new_values;
+    if constexpr (!is_void_v<EV>)
+      new_values.resize(total);
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t u = first; u < last; ++u) {
+        const size_t from = static_cast<size_t>(row_start[u]), to = static_cast<size_t>(kept[u]);
+        const size_t deg  = static_cast<size_t>(kept[u + 1]) - to;
+        for (size_t j = 0; j < deg; ++j) {
+          new_cols[to + j] = col_index_[from + j];
+          if constexpr (!is_void_v<EV>)
+            new_values[static_cast<edge_index_type>(to + j)] =
+                  std::move(static_cast<col_values_base&>(*this)[static_cast<edge_index_type>(from + j)]);
+        }
+      }
+    });
+    col_index_ = std::move(new_cols);
+    if constexpr (!is_void_v<EV>)
+      static_cast<col_values_base&>(*this) = std::move(new_values);
+    row_start = std::move(kept);
+  }
+
+  // Builds the incoming-edge index from row_index_ and col_index_ with the counting sort of
+  // load_unsorted_edges, keyed by target: the edges are split into contiguous parts, each part
+  // counts its edges per target, and the parts scatter in order. Edges are visited by increasing
+  // index, and so by increasing source id, which leaves every incoming row sorted by source.
+  void build_in_index(thread_pool& pool)
+  requires Bidirectional
+  {
+    in_index_base::clear();
+    const size_t n = size(), m = col_index_.size();
+    if (n == 0)
+      return;
+
+    const size_t parts      = std::clamp<size_t>(m / n, 1, pool.size());
+    auto         part_first = [&](size_t p) { return m * p / parts; };
+    // Source of the first edge of part p: the last row starting at or before it
+    auto part_source = [&](size_t p) {
+      const auto first = static_cast<edge_index_type>(part_first(p));
+      return static_cast<size_t>(std::ranges::upper_bound(row_index_, first, less<>{}, &vertex_type::index) -
+                                 row_index_.begin()) -
+             1;
+    };
+
+    std::vector<edge_index_type> cursor(parts * n, edge_index_type{0});
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            edge_index_type* counts = cursor.data() + p * n;
+            for (size_t i = part_first(p); i < part_first(p + 1); ++i)
+              ++counts[static_cast<size_t>(col_index_[i].index)];
+          },
+          1);
+
+    std::vector<edge_index_type> in_start(n + 1, edge_index_type{0});
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t v = first; v < last; ++v) {
+        edge_index_type running = 0;
+        for (size_t p = 0; p < parts; ++p) {
+          edge_index_type c   = cursor[p * n + v];
+          cursor[p * n + v]   = running;
+          running            += c;
+        }
+        in_start[v] = running;
+      }
+    });
+    parallel_exclusive_scan(pool, in_start.begin(), n + 1);
+
+    auto& in_cols = this->in_col_index_;
+    auto& in_ids  = this->in_edge_ids_;
+    in_cols.resize(m);
+    if constexpr (!is_void_v<EV>)
+      in_ids.resize(m);
+    pool.for_each_index(
+          parts,
+          [&](size_t p, size_t) {
+            if (part_first(p) == part_first(p + 1))
+              return;
+            edge_index_type* offsets = cursor.data() + p * n;
+            size_t           u       = part_source(p);
+            for (size_t i = part_first(p); i < part_first(p + 1); ++i) {
+              while (static_cast<size_t>(row_index_[u + 1].index) <= i)
+                ++u;
+              const size_t v   = static_cast<size_t>(col_index_[i].index);
+              const size_t pos = static_cast<size_t>(in_start[v] + offsets[v]++);
+              in_cols[pos]     = edge_type{static_cast<vertex_id_type>(u)};
+              if constexpr (!is_void_v<EV>)
+                in_ids[pos] = static_cast<edge_index_type>(i);
+            }
+          },
+          1);
+
+    this->in_row_index_.resize(n + 1);
+    pool.for_each_chunk(n + 1, [&](size_t first, size_t last, size_t) {
+      for (size_t v = first; v < last; ++v)
+        this->in_row_index_[v] = vertex_type{in_start[v]};
+    });
+  }
+
   constexpr void terminate_partitions() {
     if (partition_.empty()) {
       partition_.push_back(0);
@@ -970,6 +1670,63 @@ public: // Vertex range accessors
     return std::views::iota(start_idx, end_idx);
   }
 
+  /**
+   * @brief Get the target ids of a vertex's edges as a contiguous array.
+   *
+   * The ids are in storage order (ascending if the rows were loaded sorted). Set-intersection
+   * algorithms use this to run their kernels on raw id arrays (see detail/sorted_intersection.hpp).
+   *
+   * @param id Vertex ID
+   * @return Span over the row's target ids; empty if id is out of bounds
+  */
+  [[nodiscard]] std::span<const vertex_id_type> target_ids(vertex_id_type id) const noexcept {
+    static_assert(sizeof(edge_type) == sizeof(vertex_id_type) && std::is_standard_layout_v<edge_type>,
+                  "csr_col must be layout-compatible with vertex_id_type");
+    if (id >= size())
+      return {};
+    const auto first = row_index_[static_cast<typename row_index_vector::size_type>(id)].index;
+    const auto last  = row_index_[static_cast<typename row_index_vector::size_type>(id + 1)].index;
+    return {reinterpret_cast<const vertex_id_type*>(col_index_.data()) + first, static_cast<size_t>(last - first)};
+  }
+
+  /**
+   * @brief Get the source ids of a vertex's incoming edges as a contiguous array.
+   *
+   * The ids are in ascending order. Only available when @c Bidirectional is true.
+   *
+   * @param id Vertex ID
+   * @return Span over the incoming row's source ids; empty if id is out of bounds
+  */
+  [[nodiscard]] std::span<const vertex_id_type> source_ids(vertex_id_type id) const noexcept
+  requires Bidirectional
+  {
+    if (static_cast<size_t>(id) + 1 >= this->in_row_index_.size())
+      return {};
+    const auto first = this->in_row_index_[static_cast<size_t>(id)].index;
+    const auto last  = this->in_row_index_[static_cast<size_t>(id) + 1].index;
+    return {reinterpret_cast<const vertex_id_type*>(this->in_col_index_.data()) + first,
+            static_cast<size_t>(last - first)};
+  }
+
+  /**
+   * @brief Get the edge ids of a vertex's incoming edges, parallel to @c source_ids(id).
+   *
+   * Each entry is the edge's index in the outgoing arrays, usable with @c edge_value(edge_id) and
+   * @c target_id(edge_id). Only available when @c Bidirectional is true and @c EV is not void.
+   *
+   * @param id Vertex ID
+   * @return Span over the incoming row's edge ids; empty if id is out of bounds
+  */
+  [[nodiscard]] std::span<const edge_id_type> in_edge_ids(vertex_id_type id) const noexcept
+  requires(Bidirectional && !is_void_v<EV>)
+  {
+    if (static_cast<size_t>(id) + 1 >= this->in_row_index_.size())
+      return {};
+    const auto first = this->in_row_index_[static_cast<size_t>(id)].index;
+    const auto last  = this->in_row_index_[static_cast<size_t>(id) + 1].index;
+    return {this->in_edge_ids_.data() + first, static_cast<size_t>(last - first)};
+  }
+
   /**
    * @brief Get a const reference to the vertex value for a given vertex ID.
    * 
@@ -1056,6 +1813,40 @@ public: // Vertex range accessors
     return col_values_base::operator[](static_cast<typename col_values_base::size_type>(edge_id));
   }
 
+public: // Raw storage (serialization)
+  /**
+   * @brief Contiguous row offsets: size() + 1 entries, or none for a graph that was never loaded.
+   *
+   * Together with the other *_storage() accessors this exposes the CSR arrays as-is so they can be
+   * written in bulk (see io/binary_snapshot.hpp). Each entry is a @c csr_row<EIndex> holding a
+   * single @c EIndex.
+  */
+  [[nodiscard]] constexpr std::span<const vertex_type> row_index_storage() const noexcept { return row_index_; }
+
+  /// @brief Contiguous target ids, one @c csr_col<VId> per edge, in row order.
+  [[nodiscard]] constexpr std::span<const edge_type> col_index_storage() const noexcept { return col_index_; }
+
+  /// @brief Partition start ids followed by the terminating entry (may be empty).
+  [[nodiscard]] constexpr std::span<const partition_id_type> partition_storage() const noexcept {
+    return partition_;
+  }
+
+  /// @brief Contiguous vertex values; empty if @c load_vertices was never called.
+  template <typename VV_ = VV>
+  requires(!std::is_void_v<VV_>)
+  [[nodiscard]] constexpr std::span<const VV_> vertex_value_storage() const noexcept {
+    const size_t n = row_values_base::size();
+    return n == 0 ? std::span<const VV_>() : std::span<const VV_>(&row_values_base::operator[](0), n);
+  }
+
+  /// @brief Contiguous edge values, parallel to @c col_index_storage().
+  template <typename EV_ = EV>
+  requires(!std::is_void_v<EV_>)
+  [[nodiscard]] constexpr std::span<const EV_> edge_value_storage() const noexcept {
+    const size_t n = col_values_base::size();
+    return n == 0 ? std::span<const EV_>() : std::span<const EV_>(&col_values_base::operator[](0), n);
+  }
+
 private:                       // Member variables
   row_index_vector row_index_; // starting index into col_index_ and v_; holds +1 extra terminating row
   col_index_vector col_index_; // col_index_[n] holds the column index (aka target)
@@ -1245,7 +2036,8 @@ public: // Friend functions
    * 
    * Returns the target vertex ID for the given edge descriptor. For compressed_graph,
    * the edge descriptor's value() method returns the edge index into col_index_,
-   * which stores the target vertex IDs.
+   * which stores the target vertex IDs. An incoming edge (from @c in_edges) is owned by
+   * its target, so its target ID is the ID of the descriptor's vertex.
    * 
    * @param g The graph (forwarding reference)
    * @param uv The edge descriptor
@@ -1256,7 +2048,64 @@ public: // Friend functions
   template <typename G, typename EdgeDesc>
   requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base>
   [[nodiscard]] friend constexpr auto target_id(G&& /*g*/, const EdgeDesc& uv) noexcept {
-    // Edge descriptor's value() returns an iterator into col_index_
+    if constexpr (EdgeDesc::is_in_edge) {
+      // An incoming edge belongs to its target
+      return static_cast<vertex_id_type>(uv.source_id());
+    } else {
+      // Edge descriptor's value() returns an iterator into col_index_
+      return uv.value()->index;
+    }
+  }
+
+  /**
+   * @brief Get a view of the incoming edges of a vertex (bidirectional graphs only).
+   *
+   * Returns an edge_descriptor_view tagged @c in_edge_tag over the vertex's row of the
+   * incoming-edge index. The edges are ordered by ascending source ID; @c source_id(g,uv) gives
+   * the source and @c edge_value(g,uv) the value stored with the outgoing edge.
+   *
+   * @param g The graph to get edges from (forwarding reference)
+   * @param u The vertex descriptor of the target vertex
+   * @return edge_descriptor_view over the edges into u with appropriate const qualification
+   * @note Returns empty view if vertex descriptor is out of bounds
+   * @note This is the ADL customization point for the in_edges(g, u) CPO
+  */
+  template <typename G, vertex_descriptor_type VertexDesc>
+  requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base> && Bidirectional
+  [[nodiscard]] friend constexpr auto in_edges(G&& g, VertexDesc u) noexcept {
+    using edge_iter_type =
+          std::conditional_t<std::is_const_v<std::remove_reference_t<G>>, typename col_index_vector::const_iterator,
+                             typename col_index_vector::iterator>;
+    using vertex_iter_type = index_iterator;
+    using edge_desc_view   = edge_descriptor_view<edge_iter_type, vertex_iter_type, adj_list::in_edge_tag>;
+    using vertex_desc      = vertex_descriptor<vertex_iter_type>;
+
+    auto        vid = static_cast<std::size_t>(u.vertex_id());
+    vertex_desc target_vd(vid);
+    auto&&      in_cols = g.in_col_index_;
+    if (vid + 1 >= g.in_row_index_.size())
+      return edge_desc_view(in_cols.begin(), in_cols.begin(), target_vd);
+
+    auto start_idx = static_cast<std::ptrdiff_t>(g.in_row_index_[vid].index);
+    auto end_idx   = static_cast<std::ptrdiff_t>(g.in_row_index_[vid + 1].index);
+    return edge_desc_view(in_cols.begin() + start_idx, in_cols.begin() + end_idx, target_vd);
+  }
+
+  /**
+   * @brief Get the source vertex ID of an incoming edge.
+   *
+   * Outgoing edges take their source from the descriptor; incoming edges store it in the
+   * incoming-edge index.
+   *
+   * @param g The graph (forwarding reference)
+   * @param uv An edge descriptor from @c in_edges(g,u)
+   * @return The source vertex ID
+   * @note Complexity: O(1)
+  */
+  template <typename G, typename EdgeDesc>
+  requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base> &&
+           adj_list::is_edge_descriptor_v<EdgeDesc> && EdgeDesc::is_in_edge
+  [[nodiscard]] friend constexpr auto source_id(G&& /*g*/, const EdgeDesc& uv) noexcept {
     return uv.value()->index;
   }
 
@@ -1360,8 +2209,13 @@ public: // Friend functions
   template <typename G, typename E>
   requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base> && (!std::is_void_v<EV>)
   [[nodiscard]] friend constexpr decltype(auto) edge_value(G&& g, const E& uv) noexcept {
-    // Edge descriptor's value() is an iterator into col_index_; compute the offset for edge_value lookup
-    return g.edge_value(static_cast<vertex_id_type>(uv.value() - g.col_index_.begin()));
+    if constexpr (E::is_in_edge) {
+      // value() is an iterator into in_col_index_; the value is stored with the outgoing edge
+      return g.edge_value(g.in_edge_ids_[static_cast<size_t>(uv.value() - g.in_col_index_.begin())]);
+    } else {
+      // Edge descriptor's value() is an iterator into col_index_; compute the offset for edge_value lookup
+      return g.edge_value(static_cast<vertex_id_type>(uv.value() - g.col_index_.begin()));
+    }
   }
 
   /**
@@ -1435,13 +2289,14 @@ public: // Friend functions
  * @tparam GV Graph value type
  * @tparam VI Vertex Id type. This must be large enough for the count of vertices.
  * @tparam EIndex Edge Index type. This must be large enough for the count of edges.
+ * @tparam Bidirectional Also build an incoming-edge (CSC) index, enabling in_edges(g,u)
  * @tparam Alloc Allocator type
 */
-template <class EV, class VV, class GV, integral VId, integral EIndex, class Alloc>
-class compressed_graph : public compressed_graph_base<EV, VV, GV, VId, EIndex, Alloc> {
+template <class EV, class VV, class GV, integral VId, integral EIndex, bool Bidirectional, class Alloc>
+class compressed_graph : public compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc> {
 public: // Types
-  using graph_type = compressed_graph<EV, VV, GV, VId, EIndex, Alloc>;
-  using base_type  = compressed_graph_base<EV, VV, GV, VId, EIndex, Alloc>;
+  using graph_type = compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>;
+  using base_type  = compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>;
 
   using edge_value_type   = EV;
   using vertex_value_type = VV;
@@ -1599,14 +2454,15 @@ private: // Member variables
  * @tparam VV Vertex value type
  * @tparam VI Vertex Id type. This must be large enough for the count of vertices.
  * @tparam EIndex Edge Index type. This must be large enough for the count of edges.
+ * @tparam Bidirectional Also build an incoming-edge (CSC) index, enabling in_edges(g,u)
  * @tparam Alloc Allocator type
 */
-template <class EV, class VV, integral VId, integral EIndex, class Alloc>
-class compressed_graph<EV, VV, void, VId, EIndex, Alloc>
-      : public compressed_graph_base<EV, VV, void, VId, EIndex, Alloc> {
+template <class EV, class VV, integral VId, integral EIndex, bool Bidirectional, class Alloc>
+class compressed_graph<EV, VV, void, VId, EIndex, Bidirectional, Alloc>
+      : public compressed_graph_base<EV, VV, void, VId, EIndex, Bidirectional, Alloc> {
 public: // Types
-  using graph_type = compressed_graph<EV, VV, void, VId, EIndex, Alloc>;
-  using base_type  = compressed_graph_base<EV, VV, void, VId, EIndex, Alloc>;
+  using graph_type = compressed_graph<EV, VV, void, VId, EIndex, Bidirectional, Alloc>;
+  using base_type  = compressed_graph_base<EV, VV, void, VId, EIndex, Bidirectional, Alloc>;
 
   using vertex_id_type    = VId;
   using vertex_value_type = VV;
@@ -0,0 +1,564 @@
+#pragma once
+
+#include <vector>
+#include <concepts>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <cstdint>
+#include <limits>
+#include <cassert>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <type_traits>
+#include <utility>
+#include "graph/graph_data.hpp"
+#include "graph/graph.hpp"
+#include "graph/adj_list/vertex_descriptor_view.hpp"
+#include "graph/adj_list/edge_descriptor_view.hpp"
+#include "graph/container/compressed_graph.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+// NOTES
+//  compressed_varint_graph is a compressed_graph whose targets are stored as variable-length byte
+//  codes instead of one VId per edge, to reduce the bytes read by traversals.
+//  Each row is sorted by target. Its first target is stored as the zigzag-encoded difference to the
+//  row's own vertex id, and every other target as the gap to the previous one. The gaps are group
+//  varint coded: each group of 4 starts with a control byte holding a 2-bit length class per gap
+//  (1-4 bytes, or 1/2/4/8 bytes for 64-bit ids), followed by the gaps in little-endian order.
+//  The position of a code depends only on the control byte, so decoding a gap does not wait for the
+//  previous one, as it would with LEB128 varints. Gaps between neighbours of a well-ordered graph fit
+//  in 1-2 bytes, so rows take about 1.25-2.25 bytes per edge.
+//  byte_index_ holds the offset of each row in bytes_, row_index_ its first edge index (as
+//  compressed_graph's row_index_), so degrees, edge ids and edge values need no decoding.
+//  edges(g,u) decodes the targets on the fly, one per increment of the iterator. Random access to
+//  a single target by edge id is not offered: target_id(eid) would have to decode the row.
+//  bytes_ ends with group_varint::padding zero bytes, so the iterator can read ahead of the last code.
+//  The graph is immutable once loaded.
+//
+// API Design (as compressed_graph where possible):
+//  - vertex_ids(), edge_ids(), edge_ids(vertex_id) return iota views
+//  - target_ids(vertex_id) returns the decoded targets of a row (a forward range)
+//  - Direct access via vertex_value(id), edge_value(id)
+
+namespace graph::container {
+
+using adj_list::vertex_descriptor;
+using adj_list::edge_descriptor_view;
+using adj_list::vertex_descriptor_view;
+using adj_list::index_iterator;
+
+namespace group_varint {
+  /// Zero bytes after the last group, so that decoding may read ahead of the last code.
+  inline constexpr size_t padding = 16;
+
+  /// Code length of each 2-bit length class.
+  template <std::unsigned_integral U>
+  inline constexpr std::array<uint8_t, 4> lengths =
+        sizeof(U) > 4 ? std::array<uint8_t, 4>{1, 2, 4, 8} : std::array<uint8_t, 4>{1, 2, 3, 4};
+
+  /// Smallest length class that holds @c x.
+  template <std::unsigned_integral U>
+  [[nodiscard]] constexpr unsigned length_class(U x) noexcept {
+    unsigned c = 0;
+    while (c < 3 && (static_cast<uint64_t>(x) >> (8 * lengths<U>[c])) != 0)
+      ++c;
+    return c;
+  }
+
+  /// Appends up to 4 values as one group: a control byte with their length classes (the first
+  /// value in the low bits), then each value in little-endian order.
+  template <std::unsigned_integral U>
+  void encode(std::span<const U> values, std::vector<uint8_t>& out) {
+    assert(!values.empty() && values.size() <= 4);
+    const size_t control = out.size();
+    out.push_back(0);
+    for (size_t k = 0; k < values.size(); ++k) {
+      const unsigned c = length_class(values[k]);
+      out[control] |= static_cast<uint8_t>(c << (2 * k));
+      for (unsigned b = 0; b < lengths<U>[c]; ++b)
+        out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(values[k]) >> (8 * b)));
+    }
+  }
+
+  /// Value of the @c len byte code at @c p. Reads 8 bytes from @c p whatever @c len is.
+  template <std::unsigned_integral U>
+  [[nodiscard]] inline U load(const uint8_t* p, unsigned len) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+      uint64_t w;
+      std::memcpy(&w, p, sizeof(w));
+      return static_cast<U>(w & (~uint64_t{0} >> (64 - 8 * len)));
+    } else {
+      uint64_t x = 0;
+      for (unsigned b = 0; b < len; ++b)
+        x |= uint64_t{p[b]} << (8 * b);
+      return static_cast<U>(x);
+    }
+  }
+
+  // Differences between ids are taken modulo 2^digits, so that any VId round-trips
+  template <std::unsigned_integral U>
+  [[nodiscard]] constexpr U zigzag(U d) noexcept {
+    using S = std::make_signed_t<U>;
+    return static_cast<U>(static_cast<U>(d << 1) ^ static_cast<U>(static_cast<S>(d) >> (std::numeric_limits<U>::digits - 1)));
+  }
+  template <std::unsigned_integral U>
+  [[nodiscard]] constexpr U unzigzag(U z) noexcept {
+    return static_cast<U>(static_cast<U>(z >> 1) ^ static_cast<U>((z & 1) != 0 ? ~U{0} : U{0}));
+  }
+} // namespace group_varint
+
+/**
+ * @ingroup graph_containers
+ * @brief Forward iterator over the targets of one row of a @c compressed_varint_graph, decoding
+ *        one gap per increment.
+ *
+ * It also carries the edge index of the current edge, which locates the edge value and makes two
+ * iterators of the same row subtractable in O(1). Iterators compare by edge index only.
+ *
+ * @tparam VId    Vertex id type
+ * @tparam EIndex Edge index type
+*/
+template <std::integral VId, std::integral EIndex>
+class varint_target_iterator {
+  using code_type = std::make_unsigned_t<VId>;
+
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type        = VId;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = const VId*;
+  using reference         = const VId&;
+
+  constexpr varint_target_iterator() noexcept = default;
+
+  /// @param group  Control byte of the group of edge @c index, its first edge
+  /// @param next   Code of the next edge
+  /// @param target Decoded target of edge @c index
+  /// @param index  Edge index
+  constexpr varint_target_iterator(const uint8_t* group, const uint8_t* next, VId target, EIndex index) noexcept
+        : group_(group), next_(next), target_(target), index_(index) {}
+
+  [[nodiscard]] constexpr reference operator*() const noexcept { return target_; }
+  [[nodiscard]] constexpr pointer   operator->() const noexcept { return &target_; }
+
+  // Decodes the gap to the next target. The position of each code follows from the control byte
+  // alone, not from the codes before it. After the last edge of a row this reads the next row or
+  // the zero padding; the result is never dereferenced.
+  varint_target_iterator& operator++() noexcept {
+    if (slot_ == 3) {
+      group_ = next_;
+      next_  = group_ + 1;
+      slot_  = 0;
+    } else {
+      ++slot_;
+    }
+    const unsigned len = group_varint::lengths<code_type>[(*group_ >> (2 * slot_)) & 3];
+    target_            = static_cast<VId>(
+          static_cast<code_type>(static_cast<code_type>(target_) + group_varint::load<code_type>(next_, len)));
+    next_ += len;
+    ++index_;
+    return *this;
+  }
+  varint_target_iterator operator++(int) noexcept {
+    varint_target_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  /// Edge index of the current edge, as in compressed_graph.
+  [[nodiscard]] constexpr EIndex edge_index() const noexcept { return index_; }
+
+  [[nodiscard]] friend constexpr bool operator==(const varint_target_iterator& lhs,
+                                                 const varint_target_iterator& rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+  [[nodiscard]] friend constexpr auto operator<=>(const varint_target_iterator& lhs,
+                                                  const varint_target_iterator& rhs) noexcept {
+    return lhs.index_ <=> rhs.index_;
+  }
+  [[nodiscard]] friend constexpr difference_type operator-(const varint_target_iterator& lhs,
+                                                           const varint_target_iterator& rhs) noexcept {
+    return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+  }
+
+private:
+  const uint8_t* group_  = nullptr; // control byte of the current group
+  const uint8_t* next_   = nullptr; // code of the next edge
+  VId            target_ = 0;
+  EIndex         index_  = 0;
+  uint8_t        slot_   = 0; // position of the current edge in its group
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Compressed Sparse Row graph whose rows are stored as gap-encoded group varints.
+ *
+ * The layout is that of @c compressed_graph with @c col_index_ replaced by a byte stream: each row
+ * is sorted by target and stored as the differences between consecutive targets, in groups of 4
+ * variable-length codes behind a control byte of their lengths, with a byte offset per row. A
+ * traversal over a well-ordered graph (see @c order_vertices) then reads about 1.5-2 bytes per edge
+ * instead of @c sizeof(VId).
+ *
+ * @c edges(g,u) decodes the row while it is iterated, and the CPO customizations make the graph an
+ * @c index_adjacency_list, so every view and algorithm accepts it. Edges are visited in target
+ * order; edge values are stored uncompressed in the same order. Vertex and edge values are
+ * mutable, the structure is not.
+ *
+ * @tparam EV     Edge value type, or void
+ * @tparam VV     Vertex value type, or void
+ * @tparam GV     Graph value type, or void
+ * @tparam VId    Vertex id type
+ * @tparam EIndex Edge index type; must hold the number of edges
+*/
+template <class EV = void, class VV = void, class GV = void, std::integral VId = uint32_t, std::integral EIndex = uint32_t>
+class compressed_varint_graph {
+  struct no_value {};
+  using ev_storage = std::vector<std::conditional_t<std::is_void_v<EV>, no_value, EV>>;
+  using vv_storage = std::vector<std::conditional_t<std::is_void_v<VV>, no_value, VV>>;
+  using gv_storage = std::conditional_t<std::is_void_v<GV>, no_value, GV>;
+  using code_type  = std::make_unsigned_t<VId>; // gaps, modulo 2^digits
+
+public: // Types
+  using graph_type        = compressed_varint_graph<EV, VV, GV, VId, EIndex>;
+  using vertex_id_type    = VId;
+  using edge_index_type   = EIndex;
+  using edge_id_type      = EIndex;
+  using edge_value_type   = EV;
+  using vertex_value_type = VV;
+  using graph_value_type  = GV;
+  using size_type         = size_t;
+  using target_iterator   = varint_target_iterator<VId, EIndex>;
+
+public: // Construction
+  constexpr compressed_varint_graph() = default;
+
+  template <class GV_ = GV>
+  requires(!std::is_void_v<GV_>)
+  explicit compressed_varint_graph(const std::type_identity_t<GV_>& value) : graph_value_(value) {}
+
+  /**
+   * @brief Construct the graph from an edge range in any order. See @c load_edges().
+   */
+  template <std::ranges::random_access_range ERng, class EProj = identity>
+  requires std::ranges::sized_range<ERng>
+  compressed_varint_graph(const ERng&  erng,
+                          EProj        eprojection  = {},
+                          size_type    vertex_count = 0,
+                          thread_pool& pool         = default_thread_pool()) {
+    load_edges(erng, eprojection, vertex_count, pool);
+  }
+
+public: // Load
+  /**
+   * @brief Load edges given in any order.
+   *
+   * The edges are first gathered into rows with @c compressed_graph::load_unsorted_edges, rows
+   * sorted by target with parallel edges in input order, and then encoded by @c load_graph().
+   *
+   * @param erng         Input range for edges, in any order
+   * @param eprojection  Edge projection function that returns a @c copyable_edge_t<VId,EV> for an element in
+   *                     @c erng. It is called concurrently and must be free of side effects.
+   * @param vertex_count The number of vertices. If smaller than the largest vertex id + 1, the largest
+   *                     vertex id in the edge range determines the number of vertices.
+   * @param pool         Thread pool to build on.
+   *
+   * @throws graph_error if the number of edges does not fit in @c EIndex.
+  */
+  template <std::ranges::random_access_range ERng, class EProj = identity>
+  requires std::ranges::sized_range<ERng>
+  void load_edges(const ERng&  erng,
+                  EProj        eprojection  = {},
+                  size_type    vertex_count = 0,
+                  thread_pool& pool         = default_thread_pool()) {
+    compressed_graph<EV, void, void, VId, EIndex> rows;
+    rows.load_unsorted_edges(erng, eprojection, vertex_count, {.sort_targets = true}, pool);
+    load_graph(rows, pool);
+  }
+
+  /**
+   * @brief Encode the edges of another graph, in parallel.
+   *
+   * Vertex @c u of @c g is vertex @c u of this graph, with the same edges. Each row is sorted by
+   * target, keeping parallel edges in their order in @c g, unless it is sorted already. With a
+   * non-void @c EV the edge values are copied with @c edge_value(g,uv). Vertex values are
+   * default-constructed; set them with @c load_vertices().
+   *
+   * @param g    Source graph
+   * @param pool Thread pool to build on.
+   *
+   * @throws graph_error if the number of edges does not fit in @c EIndex.
+  */
+  template <adj_list::index_adjacency_list G>
+  void load_graph(const G& g, thread_pool& pool = default_thread_pool()) {
+    // should only be loading into an empty graph
+    assert(row_index_.empty() && bytes_.empty());
+
+    const size_t n         = static_cast<size_t>(adj_list::num_vertices(g));
+    auto         row_of    = [&g](size_t u) { return adj_list::edges(g, *adj_list::find_vertex(g, static_cast<vertex_id_t<G>>(u))); };
+    std::vector<size_t> row_start(n + 1, 0);
+    pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+      for (size_t u = first; u < last; ++u)
+        row_start[u] = static_cast<size_t>(std::ranges::distance(row_of(u)));
+    });
+    const size_t m = parallel_exclusive_scan(pool, row_start.begin(), n + 1);
+    if (m > static_cast<size_t>(std::numeric_limits<edge_index_type>::max())) {
+      throw graph_error(std::format("{} edges exceed the capacity of the edge index type", m));
+    }
+
+    row_index_.resize(n + 1);
+    byte_index_.assign(n + 1, 0);
+    if constexpr (!std::is_void_v<EV>)
+      edge_values_.resize(m);
+    if constexpr (!std::is_void_v<VV>)
+      vertex_values_.resize(n);
+
+    // Encode blocks of consecutive rows, each into its own buffer; byte_index_ is relative to the
+    // block until the blocks are joined
+    const size_t blocks      = std::min(n, pool.size() * 8);
+    auto         block_first = [&](size_t b) { return n * b / blocks; };
+    using scratch_type = std::conditional_t<std::is_void_v<EV>, VId, std::pair<VId, edge_value_type>>;
+    auto target_of     = [](const scratch_type& s) -> VId {
+      if constexpr (std::is_void_v<EV>)
+        return s;
+      else
+        return s.first;
+    };
+    std::vector<std::vector<uint8_t>> block_bytes(blocks);
+    pool.for_each_index(
+          blocks,
+          [&](size_t b, size_t) {
+            std::vector<scratch_type> row;
+            std::vector<code_type>    codes;
+            std::vector<uint8_t>&     out = block_bytes[b];
+            for (size_t u = block_first(b); u < block_first(b + 1); ++u) {
+              row.clear();
+              for (auto&& uv : row_of(u)) {
+                if constexpr (std::is_void_v<EV>)
+                  row.push_back(static_cast<VId>(adj_list::target_id(g, uv)));
+                else
+                  row.emplace_back(static_cast<VId>(adj_list::target_id(g, uv)), adj_list::edge_value(g, uv));
+              }
+              if (!std::ranges::is_sorted(row, {}, target_of))
+                std::ranges::stable_sort(row, {}, target_of);
+
+              row_index_[u]  = static_cast<edge_index_type>(row_start[u]);
+              byte_index_[u] = out.size();
+              codes.resize(row.size());
+              auto prev = static_cast<code_type>(u);
+              for (size_t j = 0; j < row.size(); ++j) {
+                const auto t = static_cast<code_type>(target_of(row[j]));
+                codes[j]     = static_cast<code_type>(t - prev);
+                prev         = t;
+                if constexpr (!std::is_void_v<EV>)
+                  edge_values_[row_start[u] + j] = std::move(row[j].second);
+              }
+              if (!codes.empty())
+                codes[0] = group_varint::zigzag(codes[0]);
+              for (size_t j = 0; j < codes.size(); j += 4)
+                group_varint::encode(std::span<const code_type>(codes).subspan(j, std::min<size_t>(4, codes.size() - j)),
+                                     out);
+            }
+          },
+          1);
+
+    std::vector<uint64_t> block_start(blocks + 1, 0);
+    for (size_t b = 0; b < blocks; ++b)
+      block_start[b + 1] = block_start[b] + block_bytes[b].size();
+    bytes_.assign(static_cast<size_t>(block_start[blocks]) + group_varint::padding, uint8_t{0});
+    pool.for_each_index(
+          blocks,
+          [&](size_t b, size_t) {
+            std::ranges::copy(block_bytes[b], bytes_.begin() + static_cast<std::ptrdiff_t>(block_start[b]));
+            block_bytes[b] = {};
+            for (size_t u = block_first(b); u < block_first(b + 1); ++u)
+              byte_index_[u] += block_start[b];
+          },
+          1);
+    row_index_[n]  = static_cast<edge_index_type>(m);
+    byte_index_[n] = block_start[blocks];
+  }
+
+  /**
+   * @brief Load vertex values, after the edges.
+   *
+   * @param vrng        Range of vertex data
+   * @param vprojection Projection that returns a @c copyable_vertex_t<VId,VV> for an element of @c vrng
+   *
+   * @throws graph_error if a vertex id is not less than @c size().
+  */
+  template <std::ranges::forward_range VRng, class VProj = identity>
+  requires(!std::is_void_v<VV>)
+  void load_vertices(const VRng& vrng, VProj vprojection = {}) {
+    for (auto&& vtx_data : vrng) {
+      auto&&     vtx = vprojection(vtx_data);
+      const auto id  = static_cast<size_t>(vtx.id);
+      if (id >= size()) {
+        throw graph_error(std::format("vertex id {} is out of range for {} vertices", id, size()));
+      }
+      vertex_values_[id] = vtx.value;
+    }
+  }
+
+public: // Properties
+  [[nodiscard]] constexpr size_type size() const noexcept { return row_index_.empty() ? 0 : row_index_.size() - 1; }
+  [[nodiscard]] constexpr size_type num_vertices() const noexcept { return size(); }
+  [[nodiscard]] constexpr bool      empty() const noexcept { return size() == 0; }
+  [[nodiscard]] constexpr size_type num_edges() const noexcept {
+    return row_index_.empty() ? 0 : static_cast<size_type>(row_index_.back());
+  }
+
+public: // Id-based accessors (as compressed_graph)
+  [[nodiscard]] constexpr auto vertex_ids() const noexcept {
+    return std::views::iota(vertex_id_type{0}, static_cast<vertex_id_type>(size()));
+  }
+  [[nodiscard]] constexpr auto edge_ids() const noexcept {
+    return std::views::iota(edge_index_type{0}, static_cast<edge_index_type>(num_edges()));
+  }
+  [[nodiscard]] constexpr auto edge_ids(vertex_id_type id) const noexcept {
+    if (static_cast<size_type>(id) >= size())
+      return std::views::iota(edge_index_type{0}, edge_index_type{0});
+    return std::views::iota(row_index_[static_cast<size_t>(id)], row_index_[static_cast<size_t>(id) + 1]);
+  }
+
+  /// Targets of a vertex's edges in increasing order, decoded while iterated.
+  [[nodiscard]] std::ranges::subrange<target_iterator> target_ids(vertex_id_type id) const noexcept {
+    if (static_cast<size_type>(id) >= size())
+      return {};
+    return {row_begin(static_cast<size_t>(id)), row_end(static_cast<size_t>(id))};
+  }
+
+  template <typename EV_ = EV>
+  requires(!std::is_void_v<EV_>)
+  [[nodiscard]] constexpr EV_& edge_value(edge_id_type edge_id) noexcept {
+    return edge_values_[static_cast<size_t>(edge_id)];
+  }
+  template <typename EV_ = EV>
+  requires(!std::is_void_v<EV_>)
+  [[nodiscard]] constexpr const EV_& edge_value(edge_id_type edge_id) const noexcept {
+    return edge_values_[static_cast<size_t>(edge_id)];
+  }
+
+  template <typename VV_ = VV>
+  requires(!std::is_void_v<VV_>)
+  [[nodiscard]] constexpr VV_& vertex_value(vertex_id_type id) noexcept {
+    return vertex_values_[static_cast<size_t>(id)];
+  }
+  template <typename VV_ = VV>
+  requires(!std::is_void_v<VV_>)
+  [[nodiscard]] constexpr const VV_& vertex_value(vertex_id_type id) const noexcept {
+    return vertex_values_[static_cast<size_t>(id)];
+  }
+
+  template <typename GV_ = GV>
+  requires(!std::is_void_v<GV_>)
+  [[nodiscard]] constexpr GV_& graph_value() noexcept {
+    return graph_value_;
+  }
+  template <typename GV_ = GV>
+  requires(!std::is_void_v<GV_>)
+  [[nodiscard]] constexpr const GV_& graph_value() const noexcept {
+    return graph_value_;
+  }
+
+  /// Row edge offsets and row byte offsets (size() + 1 entries each), and the encoded rows
+  /// (without the padding), as stored.
+  [[nodiscard]] constexpr std::span<const EIndex>   row_index() const noexcept { return row_index_; }
+  [[nodiscard]] constexpr std::span<const uint64_t> byte_index() const noexcept { return byte_index_; }
+  [[nodiscard]] constexpr std::span<const uint8_t>  bytes() const noexcept {
+    return {bytes_.data(), bytes_.empty() ? 0 : bytes_.size() - group_varint::padding};
+  }
+
+private:
+  // Iterator at the first edge of row u, with its target decoded. An empty row gives the end.
+  [[nodiscard]] target_iterator row_begin(size_t u) const noexcept {
+    const uint8_t* group = bytes_.data() + byte_index_[u];
+    if (row_index_[u] == row_index_[u + 1])
+      return target_iterator(group, group, vertex_id_type{0}, row_index_[u]);
+    const unsigned len  = group_varint::lengths<code_type>[*group & 3];
+    const auto     diff = group_varint::unzigzag(group_varint::load<code_type>(group + 1, len));
+    return target_iterator(group, group + 1 + len, static_cast<vertex_id_type>(static_cast<code_type>(u + diff)),
+                           row_index_[u]);
+  }
+  [[nodiscard]] constexpr target_iterator row_end(size_t u) const noexcept {
+    return target_iterator(nullptr, nullptr, vertex_id_type{0}, row_index_[u + 1]);
+  }
+
+public: // CPO customizations
+  friend constexpr auto vertices(const compressed_varint_graph& g) noexcept {
+    return std::ranges::iota_view<std::size_t, std::size_t>(0, g.size());
+  }
+
+  template <typename VId2>
+  friend constexpr auto find_vertex(const compressed_varint_graph&, const VId2& uid) noexcept {
+    using iterator = typename vertex_descriptor_view<index_iterator>::iterator;
+    return iterator{static_cast<vertex_id_type>(uid)};
+  }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto vertex_id(const compressed_varint_graph&, const VertexDesc& u) noexcept {
+    return static_cast<vertex_id_type>(u.vertex_id());
+  }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend auto edges(const compressed_varint_graph& g, const VertexDesc& u) noexcept {
+    using edge_desc_view = edge_descriptor_view<target_iterator, index_iterator>;
+    using vertex_desc    = vertex_descriptor<index_iterator>;
+    const auto vid       = static_cast<std::size_t>(u.vertex_id());
+    if (vid >= g.size())
+      return edge_desc_view(target_iterator(), target_iterator(), vertex_desc(vid));
+    return edge_desc_view(g.row_begin(vid), g.row_end(vid), vertex_desc(vid));
+  }
+
+  template <adj_list::edge_descriptor_type EdgeDesc>
+  friend constexpr auto target_id(const compressed_varint_graph&, const EdgeDesc& uv) noexcept {
+    return *uv.value();
+  }
+
+  friend constexpr auto num_edges(const compressed_varint_graph& g) noexcept { return g.num_edges(); }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto num_edges(const compressed_varint_graph& g, const VertexDesc& u) noexcept {
+    const auto vid = static_cast<std::size_t>(u.vertex_id());
+    return vid >= g.size() ? std::size_t{0} : static_cast<std::size_t>(g.row_index_[vid + 1] - g.row_index_[vid]);
+  }
+
+  friend constexpr bool has_edge(const compressed_varint_graph& g) noexcept { return g.num_edges() != 0; }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  requires(!std::is_void_v<VV>)
+  friend constexpr decltype(auto) vertex_value(compressed_varint_graph& g, const VertexDesc& u) noexcept {
+    return g.vertex_value(static_cast<vertex_id_type>(u.vertex_id()));
+  }
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  requires(!std::is_void_v<VV>)
+  friend constexpr decltype(auto) vertex_value(const compressed_varint_graph& g, const VertexDesc& u) noexcept {
+    return g.vertex_value(static_cast<vertex_id_type>(u.vertex_id()));
+  }
+
+  template <adj_list::edge_descriptor_type EdgeDesc>
+  requires(!std::is_void_v<EV>)
+  friend constexpr decltype(auto) edge_value(compressed_varint_graph& g, const EdgeDesc& uv) noexcept {
+    return g.edge_value(uv.value().edge_index());
+  }
+  template <adj_list::edge_descriptor_type EdgeDesc>
+  requires(!std::is_void_v<EV>)
+  friend constexpr decltype(auto) edge_value(const compressed_varint_graph& g, const EdgeDesc& uv) noexcept {
+    return g.edge_value(uv.value().edge_index());
+  }
+
+private:
+  std::vector<EIndex>   row_index_;  // first edge index of each row, plus the total
+  std::vector<uint64_t> byte_index_; // first byte of each row in bytes_, plus the total
+  std::vector<uint8_t>  bytes_;      // encoded rows, then group_varint::padding zero bytes
+
+  ev_storage                       edge_values_;
+  vv_storage                       vertex_values_;
+  [[no_unique_address]] gv_storage graph_value_{};
+};
+
+} // namespace graph::container
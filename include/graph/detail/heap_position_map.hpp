@@ -2,7 +2,7 @@
  * @file heap_position_map.hpp
  * @brief Position-map adapters for indexed_dary_heap.
  *
- * Two adapters are provided:
+ * Three adapters are provided:
  *
  *   - vector_position_map  : O(1) lookup for integral keys in a known dense
  *                            range [0, n). Backed by a caller-owned
@@ -13,7 +13,10 @@
  *                            Use this when vertex ids are sparse, non-integral,
  *                            or come from a mapped graph container.
  *
- * Both adapters store a pointer to their backing storage; the storage must
+ *   - finalizing_position_map<Base> : either of the above, but a popped key is
+ *                            marked finalized rather than absent (used by Prim).
+ *
+ * The first two store a pointer to their backing storage; the storage must
  * outlive the heap. This lets the caller reuse the same map across multiple
  * Dijkstra runs (call reset() between runs).
  *
@@ -111,4 +114,49 @@ private:
   map_type* storage_;
 };
 
+// ---------------------------------------------------------------------------
+// finalizing_position_map
+//
+// Wraps vector_position_map or assoc_position_map so that popped keys are
+// remembered: pop()'s set_position(k, npos) stores `finalized` instead. The
+// heap still sees the key as absent, while state(k) tells the three cases
+// apart with a single lookup:
+//
+//   npos       never pushed
+//   finalized  pushed and popped
+//   otherwise  the key's index in the heap
+//
+// Prim needs exactly this per edge: skip a popped target, decrease() a queued
+// one, push() a new one. A heap's clear() marks its remaining keys finalized.
+// ---------------------------------------------------------------------------
+
+template <class Base>
+class finalizing_position_map {
+public:
+  static constexpr std::size_t npos      = Base::npos;
+  static constexpr std::size_t finalized = npos - 1;
+
+  explicit finalizing_position_map(Base base) noexcept : base_(base) {}
+
+  template <class Key>
+  [[nodiscard]] std::size_t position(const Key& k) const {
+    const std::size_t pos = base_.position(k);
+    return pos == finalized ? npos : pos;
+  }
+
+  template <class Key>
+  void set_position(const Key& k, std::size_t pos) {
+    base_.set_position(k, pos == npos ? finalized : pos);
+  }
+
+  /// npos, finalized, or the heap index of k.
+  template <class Key>
+  [[nodiscard]] std::size_t state(const Key& k) const {
+    return base_.position(k);
+  }
+
+private:
+  Base base_;
+};
+
 } // namespace graph::detail
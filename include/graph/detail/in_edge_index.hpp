@@ -0,0 +1,102 @@
+/**
+ * @file in_edge_index.hpp
+ * @brief Parallel construction of an incoming-edge (CSC) index for index graphs.
+ *
+ * Algorithms that pull over in-edges (pagerank) or walk them backwards (parallel_scc) use
+ * in_edges(g, v) when the graph is bidirectional. For any other index graph they build this
+ * index once: the sources of every vertex in CSR form, in ascending order, optionally with a
+ * value per edge (e.g. its weight) stored alongside.
+ *
+ * The build is a counting sort over contiguous vertex ranges ("parts"): each part counts its
+ * edges per target, the counts are turned into per-part offsets within every row, and each
+ * part scatters its edges in order. Parts are limited so that the counters never outnumber
+ * the edges.
+ */
+
+#pragma once
+
+#include "graph/graph.hpp"
+#include "graph/detail/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace graph::detail {
+
+/// In-edges of every vertex: the sources of v are sources[offsets[v] .. offsets[v+1]), in
+/// ascending order, with values[k] the value of edge k when W is not void.
+template <class VId, class W = void>
+struct in_edge_index {
+  std::vector<size_t> offsets;
+  std::vector<VId>    sources;
+  std::vector<std::conditional_t<std::is_void_v<W>, char, W>> values; // empty when W is void
+};
+
+/**
+ * Builds the in-edge index of g, which has m edges. When W is not void, value(g, uv) is
+ * stored, converted to W, for every edge uv.
+ */
+template <class W = void, adj_list::index_adjacency_list G, class ValueFn>
+in_edge_index<adj_list::vertex_id_t<G>, W>
+build_in_edge_index(const G& g, size_t m, thread_pool& pool, ValueFn&& value) {
+  using id_type = adj_list::vertex_id_t<G>;
+  const size_t n     = static_cast<size_t>(adj_list::num_vertices(g));
+  const size_t parts = std::clamp<size_t>(m / std::max<size_t>(n, 1), 1, pool.size());
+  auto         first = [&](size_t p) { return n * p / parts; };
+
+  std::vector<size_t> cursor(parts * n, 0);
+  pool.for_each_index(
+        parts,
+        [&](size_t p, size_t) {
+          size_t* counts = cursor.data() + p * n;
+          for (size_t u = first(p); u < first(p + 1); ++u)
+            for (auto&& uv : adj_list::edges(g, *adj_list::find_vertex(g, static_cast<id_type>(u))))
+              ++counts[static_cast<size_t>(adj_list::target_id(g, uv))];
+        },
+        1);
+
+  in_edge_index<id_type, W> index;
+  index.offsets.assign(n + 1, 0);
+  pool.for_each_chunk(n, [&](size_t lo, size_t hi, size_t) {
+    for (size_t v = lo; v < hi; ++v) {
+      size_t running = 0;
+      for (size_t p = 0; p < parts; ++p) {
+        const size_t c    = cursor[p * n + v];
+        cursor[p * n + v] = running;
+        running += c;
+      }
+      index.offsets[v] = running;
+    }
+  });
+  parallel_exclusive_scan(pool, index.offsets.begin(), n + 1);
+
+  index.sources.resize(m);
+  if constexpr (!std::is_void_v<W>)
+    index.values.resize(m);
+  pool.for_each_index(
+        parts,
+        [&](size_t p, size_t) {
+          size_t* offsets = cursor.data() + p * n;
+          for (size_t u = first(p); u < first(p + 1); ++u) {
+            for (auto&& uv : adj_list::edges(g, *adj_list::find_vertex(g, static_cast<id_type>(u)))) {
+              const size_t v     = static_cast<size_t>(adj_list::target_id(g, uv));
+              const size_t pos   = index.offsets[v] + offsets[v]++;
+              index.sources[pos] = static_cast<id_type>(u);
+              if constexpr (!std::is_void_v<W>)
+                index.values[pos] = static_cast<W>(value(g, uv));
+            }
+          }
+        },
+        1);
+  return index;
+}
+
+/// Builds the in-edge index of g, which has m edges, without edge values.
+template <adj_list::index_adjacency_list G>
+in_edge_index<adj_list::vertex_id_t<G>> build_in_edge_index(const G& g, size_t m, thread_pool& pool) {
+  return build_in_edge_index<void>(g, m, pool, [](const auto&, const auto&) { return 0; });
+}
+
+} // namespace graph::detail
@@ -0,0 +1,218 @@
+/**
+ * @file label_histogram.hpp
+ * @brief Reusable per-vertex label histograms for label propagation.
+ *
+ * Label propagation tallies the labels of every vertex's neighbours on every sweep. Both
+ * histograms here are allocated once and cleared in O(1) by bumping an epoch counter, so a
+ * sweep performs no allocation once the scratch has reached its working size:
+ *
+ *   - dense_label_histogram  : integral labels in a known range [lo, lo + key_count). One
+ *                              counter and one stamp per possible label; add() is a single
+ *                              indexed increment.
+ *   - hashed_label_histogram : any hashable label type. Open addressing with linear probing,
+ *                              sized to the largest neighbourhood seen so far (it doubles when
+ *                              more than half full) rather than to the number of labels.
+ *
+ * Label propagation never creates labels, so the range of the initial labels bounds every
+ * later tally; with_label_histogram() uses it to choose between the two.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph::detail {
+
+/// Epoch-stamped histogram over integral labels in [lo, lo + key_count).
+template <std::integral Label>
+class dense_label_histogram {
+public:
+  using label_type = Label;
+
+  dense_label_histogram(Label lo, size_t key_count) : lo_(lo), count_(key_count), stamp_(key_count, 0) {}
+
+  /// Forgets all counts in O(1).
+  void clear() noexcept {
+    touched_.clear();
+    max_count_ = 0;
+    if (++epoch_ == 0) { // stamps wrapped: restart them once every 2^32 clears
+      std::ranges::fill(stamp_, 0u);
+      epoch_ = 1;
+    }
+  }
+
+  /// Counts one occurrence of lbl, which must lie in the histogram's range.
+  void add(Label lbl) {
+    const size_t key = static_cast<size_t>(static_cast<unsigned_type>(lbl) - static_cast<unsigned_type>(lo_));
+    if (stamp_[key] != epoch_) {
+      stamp_[key] = epoch_;
+      count_[key] = 0;
+      touched_.push_back(key);
+    }
+    max_count_ = std::max(max_count_, ++count_[key]);
+  }
+
+  [[nodiscard]] bool   empty() const noexcept { return touched_.empty(); }
+  [[nodiscard]] size_t max_count() const noexcept { return max_count_; }
+
+  /// Calls fn(label, count) for every label counted since the last clear().
+  template <class F>
+  void for_each(F&& fn) const {
+    for (size_t key : touched_)
+      fn(static_cast<Label>(static_cast<unsigned_type>(lo_) + static_cast<unsigned_type>(key)), count_[key]);
+  }
+
+private:
+  using unsigned_type = std::make_unsigned_t<Label>;
+
+  Label                 lo_;
+  std::vector<size_t>   count_;
+  std::vector<uint32_t> stamp_;
+  std::vector<size_t>   touched_; // keys counted in the current epoch, in first-seen order
+  uint32_t              epoch_     = 1;
+  size_t                max_count_ = 0;
+};
+
+/// Epoch-stamped open-addressing histogram over hashable labels.
+template <class Label, class Hash = std::hash<Label>>
+requires std::equality_comparable<Label> && std::copyable<Label> && std::default_initializable<Label>
+class hashed_label_histogram {
+public:
+  using label_type = Label;
+
+  explicit hashed_label_histogram(size_t initial_capacity = 16) {
+    rehash(std::bit_ceil(std::max<size_t>(initial_capacity, 16)));
+  }
+
+  /// Forgets all counts in O(1).
+  void clear() noexcept {
+    touched_.clear();
+    max_count_ = 0;
+    if (++epoch_ == 0) {
+      std::ranges::fill(stamp_, 0u);
+      epoch_ = 1;
+    }
+  }
+
+  /// Counts one occurrence of lbl. Grows the table when it becomes more than half full.
+  void add(const Label& lbl) {
+    if (2 * (touched_.size() + 1) > keys_.size())
+      rehash(2 * keys_.size());
+    const size_t slot = find_or_insert(lbl);
+    max_count_        = std::max(max_count_, ++count_[slot]);
+  }
+
+  [[nodiscard]] bool   empty() const noexcept { return touched_.empty(); }
+  [[nodiscard]] size_t max_count() const noexcept { return max_count_; }
+
+  /// Calls fn(label, count) for every label counted since the last clear().
+  template <class F>
+  void for_each(F&& fn) const {
+    for (size_t slot : touched_)
+      fn(keys_[slot], count_[slot]);
+  }
+
+private:
+  size_t find_or_insert(const Label& lbl) {
+    const size_t mask = keys_.size() - 1;
+    for (size_t slot = hash_(lbl) & mask;; slot = (slot + 1) & mask) {
+      if (stamp_[slot] != epoch_) {
+        stamp_[slot] = epoch_;
+        keys_[slot]  = lbl;
+        count_[slot] = 0;
+        touched_.push_back(slot);
+        return slot;
+      }
+      if (keys_[slot] == lbl)
+        return slot;
+    }
+  }
+
+  // Moves the live entries into a table of new_capacity (a power of two) slots.
+  void rehash(size_t new_capacity) {
+    std::vector<Label>  old_keys;
+    std::vector<size_t> old_count;
+    for (size_t slot : touched_) {
+      old_keys.push_back(std::move(keys_[slot]));
+      old_count.push_back(count_[slot]);
+    }
+    keys_.assign(new_capacity, Label{});
+    count_.assign(new_capacity, 0);
+    stamp_.assign(new_capacity, 0);
+    epoch_ = 1;
+    touched_.clear();
+    for (size_t i = 0; i < old_keys.size(); ++i)
+      count_[find_or_insert(old_keys[i])] = old_count[i];
+  }
+
+  [[no_unique_address]] Hash hash_;
+  std::vector<Label>         keys_;
+  std::vector<size_t>        count_;
+  std::vector<uint32_t>      stamp_;
+  std::vector<size_t>        touched_; // occupied slots in the current epoch, in first-seen order
+  uint32_t                   epoch_     = 1;
+  size_t                     max_count_ = 0;
+};
+
+/// The most frequent label of a non-empty histogram. When several labels share the maximum
+/// count, pick(ties) must return an index in [0, ties) selecting one of them (in the order
+/// they were first counted).
+template <class Histogram, class Pick>
+typename Histogram::label_type histogram_mode(const Histogram& hist, Pick&& pick) {
+  using label_type = typename Histogram::label_type;
+  const size_t top = hist.max_count();
+
+  size_t ties = 0;
+  hist.for_each([&](const label_type&, size_t count) { ties += count == top; });
+  size_t chosen = ties == 1 ? 0 : static_cast<size_t>(pick(ties));
+
+  std::optional<label_type> best;
+  hist.for_each([&](const label_type& lbl, size_t count) {
+    if (count == top && chosen-- == 0)
+      best.emplace(lbl);
+  });
+  return std::move(*best);
+}
+
+/// Labels up to this many times the vertex count use the dense histogram.
+inline constexpr size_t dense_label_range_factor = 4;
+
+/**
+ * Calls fn(make_histogram), where make_histogram() constructs an empty histogram for labels
+ * in [lo, hi]. Integral labels whose range is at most dense_label_range_factor * n / copies
+ * (+ 64K) use dense_label_histogram, so that `copies` thread-local histograms together stay
+ * O(n); all other labels use hashed_label_histogram. lo and hi are empty if no vertex has a
+ * label yet.
+ */
+template <class Label, class F>
+decltype(auto) with_label_histogram(const std::optional<Label>& lo,
+                                    const std::optional<Label>& hi,
+                                    size_t                      n,
+                                    size_t                      copies,
+                                    F&&                         fn) {
+  if constexpr (std::integral<Label> && !std::same_as<Label, bool>) {
+    if (lo && hi) {
+      using unsigned_type = std::make_unsigned_t<Label>;
+      const auto   span   = static_cast<unsigned_type>(static_cast<unsigned_type>(*hi) -
+                                                         static_cast<unsigned_type>(*lo));
+      const size_t budget = (dense_label_range_factor * n + (size_t{1} << 16)) / std::max<size_t>(copies, 1);
+      if (static_cast<uintmax_t>(span) < budget) {
+        const size_t key_count = static_cast<size_t>(span) + 1;
+        return fn([lo = *lo, key_count] { return dense_label_histogram<Label>(lo, key_count); });
+      }
+    }
+  }
+  return fn([] { return hashed_label_histogram<Label>(); });
+}
+
+} // namespace graph::detail
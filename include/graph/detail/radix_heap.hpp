@@ -0,0 +1,182 @@
+/**
+ * @file radix_heap.hpp
+ * @brief Monotone priority queues over unsigned integer keys: radix heap and Dial bucket queue.
+ *
+ * Dijkstra's algorithm with non-negative weights pops keys in nondecreasing order and never
+ * inserts a key below the last one popped. A monotone priority queue exploits that to replace
+ * the O(log n) comparisons of a binary heap with bit tricks on integer keys:
+ *
+ *   - @c radix_heap (Ahuja, Mehlhorn, Orlin and Tarjan, "Faster algorithms for the shortest
+ *     path problem", JACM 1990). Bucket i holds the keys whose highest bit differing from the
+ *     last popped key is bit i - 1. Popping from an empty bucket 0 takes the minimum of the
+ *     first non-empty bucket as the new last key and redistributes that bucket into lower ones.
+ *     Each element moves down at most (key bits) times, so push is O(1) and pop is amortized
+ *     O(log C) for a maximum key difference C. The keys must be monotone.
+ *
+ *   - @c bucket_queue (Dial, "Algorithm 360", CACM 1969). A circular array of buckets, one per
+ *     key, indexed by key modulo its size, which grows to a power of two spanning the smallest
+ *     and largest key queued. Push and pop are O(1) plus the scan over empty buckets, O(C) per
+ *     pop in total for a maximum key difference C, so it suits small integer weights. Keys may
+ *     also go below the last one popped (as Prim's do) as long as the span stays small.
+ *
+ * Both queues hold (key, value) pairs, pop equal keys in unspecified order and leave stale
+ * entries to the caller (lazy deletion), like the std::priority_queue path of
+ * dijkstra_shortest_paths. They always pop the smallest key, so the algorithms that select
+ * them static_assert a std::less compare (and a std::plus combine for shortest paths).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace graph::detail {
+
+/// Radix heap over unsigned keys; see the file comment. Pushed keys must not be less than the
+/// last popped key.
+template <std::unsigned_integral Key, class Value, class Alloc = std::allocator<std::pair<Key, Value>>>
+class radix_heap {
+public:
+  using key_type       = Key;
+  using value_type     = std::pair<Key, Value>;
+  using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+
+  explicit radix_heap(const allocator_type& alloc = allocator_type())
+        : buckets_(std::numeric_limits<Key>::digits + 1, bucket_type(alloc)) {}
+
+  [[nodiscard]] bool   empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+
+  void push(Key key, Value value) {
+    assert(key >= last_ && "radix_heap: keys must be monotone");
+    buckets_[bucket_of(key)].emplace_back(key, std::move(value));
+    ++size_;
+  }
+
+  /// The entry with the smallest key. Requires !empty().
+  [[nodiscard]] const value_type& top() {
+    refill();
+    return buckets_[0].back();
+  }
+
+  /// Removes top(). Requires !empty().
+  void pop() {
+    refill();
+    buckets_[0].pop_back();
+    --size_;
+  }
+
+  void clear() noexcept {
+    for (auto& b : buckets_)
+      b.clear();
+    size_ = 0;
+    last_ = 0;
+  }
+
+private:
+  using bucket_type = std::vector<value_type, allocator_type>;
+
+  [[nodiscard]] size_t bucket_of(Key key) const noexcept { return static_cast<size_t>(std::bit_width(Key(key ^ last_))); }
+
+  // Makes bucket 0 non-empty: its keys all equal last_
+  void refill() {
+    if (!buckets_[0].empty())
+      return;
+    size_t i = 1;
+    while (buckets_[i].empty())
+      ++i;
+    bucket_type& from = buckets_[i];
+    last_             = std::ranges::min_element(from, {}, &value_type::first)->first;
+    for (auto& entry : from)
+      buckets_[bucket_of(entry.first)].push_back(std::move(entry)); // always a bucket below i
+    from.clear();
+  }
+
+  std::vector<bucket_type> buckets_;
+  size_t                   size_ = 0;
+  Key                      last_ = 0;
+};
+
+/// Dial's bucket queue over unsigned keys; see the file comment. Memory grows with the span
+/// between the smallest and largest key queued.
+template <std::unsigned_integral Key, class Value, class Alloc = std::allocator<std::pair<Key, Value>>>
+class bucket_queue {
+public:
+  using key_type       = Key;
+  using value_type     = std::pair<Key, Value>;
+  using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+
+  explicit bucket_queue(const allocator_type& alloc = allocator_type()) : alloc_(alloc) {}
+
+  [[nodiscard]] bool   empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+
+  void push(Key key, Value value) {
+    if (size_ == 0) {
+      cursor_  = key;
+      max_key_ = key;
+    } else {
+      cursor_  = std::min(cursor_, key);
+      max_key_ = std::max(max_key_, key);
+    }
+    if (static_cast<size_t>(max_key_ - cursor_) >= buckets_.size())
+      grow(static_cast<size_t>(max_key_ - cursor_) + 1);
+    buckets_[static_cast<size_t>(key) & mask_].emplace_back(key, std::move(value));
+    ++size_;
+  }
+
+  /// The entry with the smallest key. Requires !empty().
+  [[nodiscard]] const value_type& top() {
+    advance();
+    return buckets_[static_cast<size_t>(cursor_) & mask_].back();
+  }
+
+  /// Removes top(). Requires !empty().
+  void pop() {
+    advance();
+    buckets_[static_cast<size_t>(cursor_) & mask_].pop_back();
+    --size_;
+  }
+
+  void clear() noexcept {
+    for (auto& b : buckets_)
+      b.clear();
+    size_ = 0;
+  }
+
+private:
+  using bucket_type = std::vector<value_type, allocator_type>;
+
+  // Moves the cursor to the smallest queued key. Every key lies in [cursor_, cursor_ + size),
+  // so the first non-empty bucket from the cursor holds only that key.
+  void advance() noexcept {
+    while (buckets_[static_cast<size_t>(cursor_) & mask_].empty())
+      ++cursor_;
+  }
+
+  void grow(size_t span) {
+    const size_t count = std::max({size_t{64}, buckets_.size() * 2, std::bit_ceil(span)});
+    std::vector<bucket_type> grown(count, bucket_type(alloc_));
+    for (auto& bucket : buckets_)
+      for (auto& entry : bucket)
+        grown[static_cast<size_t>(entry.first) & (count - 1)].push_back(std::move(entry));
+    buckets_ = std::move(grown);
+    mask_    = count - 1;
+  }
+
+  allocator_type           alloc_;
+  std::vector<bucket_type> buckets_;
+  size_t                   mask_    = 0;
+  size_t                   size_    = 0;
+  Key                      cursor_  = 0;
+  Key                      max_key_ = 0;
+};
+
+} // namespace graph::detail
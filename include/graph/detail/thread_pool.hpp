@@ -0,0 +1,288 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Minimal fork-join thread pool shared by the parallel algorithms.
+ *
+ * The pool owns `size() - 1` persistent worker threads; the calling thread
+ * participates as worker 0, so a pool of size 1 owns no threads and runs all
+ * work inline. Work is submitted in fork-join fashion:
+ *
+ *   - `run(fn)`              : invokes fn(tid) once on every worker, tid in [0, size()).
+ *   - `for_each_chunk(n, fn)`: splits [0, n) into chunks of `grain` indices that
+ *                              workers claim dynamically through an atomic cursor;
+ *                              fn(first, last, tid) is invoked per chunk.
+ *   - `for_each_index(n, fn)`: as above but invokes fn(i, tid) per index.
+ *
+ * Every call blocks until all workers have finished. The first exception thrown
+ * by any worker is captured and rethrown on the calling thread once the region
+ * has drained; the remaining chunks of that region are skipped.
+ *
+ * Calls made from inside a running region (nested parallelism) are executed
+ * serially on the calling worker instead of deadlocking on the pool. Concurrent
+ * submissions from unrelated threads are serialized.
+ *
+ * `parallel_exclusive_scan(pool, first, n)` is the shared prefix-sum building block
+ * (CSR offsets, compaction).
+ *
+ * The `tid` argument is always in [0, size()) and is stable for the duration of
+ * a region, so algorithms size their thread-local scratch by `size()` and index
+ * it by `tid` without further synchronization.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+class thread_pool {
+public:
+  using size_type = std::size_t;
+
+  /// Creates a pool with `num_threads` workers (including the caller). Zero selects
+  /// std::thread::hardware_concurrency(), falling back to 1 if that is unknown.
+  explicit thread_pool(size_type num_threads = 0) : size_(resolve_size(num_threads)) {
+    workers_.reserve(size_ - 1);
+    for (size_type tid = 1; tid < size_; ++tid) {
+      workers_.emplace_back([this, tid] { worker_loop(tid); });
+    }
+  }
+
+  thread_pool(const thread_pool&)            = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard lock(state_mutex_);
+      stopping_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& t : workers_) {
+      t.join();
+    }
+  }
+
+  /// Number of workers, including the calling thread.
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  /// Invokes fn(tid) once for every tid in [0, size()) and waits for completion.
+  template <class F>
+  void run(F&& fn) {
+    if (size_ == 1 || in_region_flag()) {
+      for (size_type tid = 0; tid < size_; ++tid) {
+        fn(tid);
+      }
+      return;
+    }
+
+    std::lock_guard submit(submit_mutex_);
+    auto            invoke = [](void* ctx, size_type tid) { (*static_cast<std::remove_reference_t<F>*>(ctx))(tid); };
+    {
+      std::lock_guard lock(state_mutex_);
+      job_ctx_    = static_cast<void*>(std::addressof(fn));
+      job_invoke_ = invoke;
+      pending_    = size_ - 1;
+      error_      = nullptr;
+      ++generation_;
+    }
+    start_cv_.notify_all();
+
+    execute(0);
+
+    std::unique_lock lock(state_mutex_);
+    done_cv_.wait(lock, [this] { return pending_ == 0; });
+    job_ctx_    = nullptr;
+    job_invoke_ = nullptr;
+    if (error_) {
+      std::exception_ptr err = std::exchange(error_, nullptr);
+      lock.unlock();
+      std::rethrow_exception(err);
+    }
+  }
+
+  /// Dynamically scheduled loop over [0, n): fn(first, last, tid) per chunk of at most
+  /// `grain` indices. A grain of 0 selects a default that yields ~8 chunks per worker.
+  template <class F>
+  void for_each_chunk(size_type n, F&& fn, size_type grain = 0) {
+    if (n == 0) {
+      return;
+    }
+    if (grain == 0) {
+      grain = std::max<size_type>(1, n / (size_ * 8));
+    }
+    if (size_ == 1 || n <= grain || in_region_flag()) {
+      fn(size_type{0}, n, size_type{0});
+      return;
+    }
+
+    std::atomic<size_type> cursor{0};
+    std::atomic<bool>      abort{false};
+    run([&](size_type tid) {
+      try {
+        while (!abort.load(std::memory_order_relaxed)) {
+          const size_type first = cursor.fetch_add(grain, std::memory_order_relaxed);
+          if (first >= n) {
+            break;
+          }
+          fn(first, std::min(n, first + grain), tid);
+        }
+      } catch (...) {
+        abort.store(true, std::memory_order_relaxed);
+        throw;
+      }
+    });
+  }
+
+  /// Dynamically scheduled loop over [0, n): fn(i, tid) per index.
+  template <class F>
+  void for_each_index(size_type n, F&& fn, size_type grain = 0) {
+    for_each_chunk(
+          n,
+          [&fn](size_type first, size_type last, size_type tid) {
+            for (size_type i = first; i < last; ++i) {
+              fn(i, tid);
+            }
+          },
+          grain);
+  }
+
+private:
+  static size_type resolve_size(size_type requested) noexcept {
+    if (requested == 0) {
+      requested = std::thread::hardware_concurrency();
+    }
+    return std::max<size_type>(1, requested);
+  }
+
+  static bool& in_region_flag() noexcept {
+    thread_local bool in_region = false;
+    return in_region;
+  }
+
+  void execute(size_type tid) {
+    bool& in_region = in_region_flag();
+    in_region       = true;
+    try {
+      job_invoke_(job_ctx_, tid);
+    } catch (...) {
+      std::lock_guard lock(state_mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+    in_region = false;
+  }
+
+  void worker_loop(size_type tid) {
+    size_type seen = 0;
+    for (;;) {
+      {
+        std::unique_lock lock(state_mutex_);
+        start_cv_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_) {
+          return;
+        }
+        seen = generation_;
+      }
+
+      execute(tid);
+
+      bool last = false;
+      {
+        std::lock_guard lock(state_mutex_);
+        last = (--pending_ == 0);
+      }
+      if (last) {
+        done_cv_.notify_one();
+      }
+    }
+  }
+
+  size_type                size_;
+  std::vector<std::thread> workers_;
+
+  std::mutex              submit_mutex_; // serializes concurrent run() callers
+  std::mutex              state_mutex_;  // guards everything below
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  size_type               generation_ = 0;
+  size_type               pending_    = 0;
+  bool                    stopping_   = false;
+  void*                   job_ctx_    = nullptr;
+  void (*job_invoke_)(void*, size_type) = nullptr;
+  std::exception_ptr      error_;
+};
+
+/// Process-wide pool sized to the hardware concurrency, created on first use.
+/// Parallel algorithms use it when no pool is passed explicitly.
+inline thread_pool& default_thread_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+/// In-place parallel exclusive prefix sum over [first, first + n): element i is replaced by the
+/// sum of the elements before it. Returns the sum of all n elements. Runs serially on a
+/// single-worker pool or when n is small.
+template <std::random_access_iterator It>
+std::iter_value_t<It> parallel_exclusive_scan(thread_pool& pool, It first, std::size_t n) {
+  using T = std::iter_value_t<It>;
+
+  constexpr std::size_t serial_cutoff = 1 << 14;
+  if (pool.size() == 1 || n < serial_cutoff) {
+    T running{};
+    for (std::size_t i = 0; i < n; ++i) {
+      T x      = first[i];
+      first[i] = running;
+      running += x;
+    }
+    return running;
+  }
+
+  // Two passes over the same static blocks: block sums, then local scans seeded by the
+  // scanned block sums
+  const std::size_t blocks      = pool.size() * 4;
+  auto              block_first = [&](std::size_t b) { return n * b / blocks; };
+  std::vector<T>    sums(blocks);
+  pool.for_each_index(
+        blocks,
+        [&](std::size_t b, std::size_t) {
+          T s{};
+          for (std::size_t i = block_first(b); i < block_first(b + 1); ++i) {
+            s += first[i];
+          }
+          sums[b] = s;
+        },
+        1);
+
+  T total{};
+  for (auto& s : sums) {
+    T x   = s;
+    s     = total;
+    total += x;
+  }
+
+  pool.for_each_index(
+        blocks,
+        [&](std::size_t b, std::size_t) {
+          T running = sums[b];
+          for (std::size_t i = block_first(b); i < block_first(b + 1); ++i) {
+            T x      = first[i];
+            first[i] = running;
+            running += x;
+          }
+        },
+        1);
+  return total;
+}
+
+} // namespace graph
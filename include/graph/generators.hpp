@@ -16,11 +16,18 @@
  *
  * All generators return a sorted std::vector<copyable_edge_t<VId, double>>
  * suitable for loading into any graph container via load_edges().
+ *
+ * rmat, erdos_renyi, erdos_renyi_gnm and plod run in parallel on a thread_pool
+ * over counter-based random streams (counter_rng.hpp), with the same result for
+ * any thread count. Their edge generators (rmat_generator, ...) also feed a
+ * compressed_graph directly through load_generated() (edge_generator.hpp).
  */
 
 #pragma once
 
 #include <graph/generators/common.hpp>
+#include <graph/generators/counter_rng.hpp>
+#include <graph/generators/edge_generator.hpp>
 #include <graph/generators/erdos_renyi.hpp>
 #include <graph/generators/gnm.hpp>
 #include <graph/generators/grid.hpp>
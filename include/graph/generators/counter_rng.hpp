@@ -0,0 +1,75 @@
+/**
+ * @file counter_rng.hpp
+ * @brief Counter-based random numbers (Philox4x32-10) for the parallel generators.
+ *
+ * A counter-based generator computes its n-th output directly from a key and the counter n,
+ * with no state carried from one output to the next (Salmon, Moraes, Dror and Shaw, "Parallel
+ * random numbers: as easy as 1, 2, 3", SC 2011). The parallel generators give every edge slot
+ * its own stream, keyed by the seed and numbered by the slot, so edge i is the same whichever
+ * thread produces it and however the slots are split.
+ *
+ * counter_rng is a UniformRandomBitGenerator over one such stream, so the standard
+ * distributions and sample_weight() draw from it as from std::mt19937_64.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace graph::generators {
+
+/// One Philox4x32-10 block: 10 rounds of the Philox S-box over a 128-bit counter and 64-bit key.
+[[nodiscard]] constexpr std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> ctr,
+                                                           std::array<uint32_t, 2> key) noexcept {
+  constexpr uint32_t mul0 = 0xD2511F53, mul1 = 0xCD9E8D57;
+  constexpr uint32_t weyl0 = 0x9E3779B9, weyl1 = 0xBB67AE85;
+  for (int round = 0; round < 10; ++round) {
+    const uint64_t p0 = uint64_t{mul0} * ctr[0];
+    const uint64_t p1 = uint64_t{mul1} * ctr[2];
+    ctr               = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<uint32_t>(p1),
+                         static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<uint32_t>(p0)};
+    key[0] += weyl0;
+    key[1] += weyl1;
+  }
+  return ctr;
+}
+
+/**
+ * @brief The random stream of one (seed, stream) pair, as a UniformRandomBitGenerator.
+ *
+ * Output k of stream s is half of the Philox block with counter (k / 2, s) under the key seed,
+ * so streams are independent and any output can be reached without generating the ones before.
+ */
+class counter_rng {
+public:
+  using result_type = uint64_t;
+
+  constexpr counter_rng(uint64_t seed, uint64_t stream) noexcept
+        : key_{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}, stream_(stream) {}
+
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+  [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  constexpr result_type operator()() noexcept {
+    if (index_ % 2 == 0)
+      block_ = philox4x32({static_cast<uint32_t>(index_ / 2), static_cast<uint32_t>(index_ / 2 >> 32),
+                           static_cast<uint32_t>(stream_), static_cast<uint32_t>(stream_ >> 32)},
+                          key_);
+    const size_t half = static_cast<size_t>(index_++ % 2) * 2;
+    return uint64_t{block_[half]} | uint64_t{block_[half + 1]} << 32;
+  }
+
+  /// A double in [0, 1) from the top 53 bits of the next output.
+  constexpr double uniform01() noexcept { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+private:
+  std::array<uint32_t, 2> key_;
+  uint64_t                stream_;
+  uint64_t                index_ = 0;
+  std::array<uint32_t, 4> block_{};
+};
+
+} // namespace graph::generators
@@ -0,0 +1,170 @@
+/**
+ * @file edge_generator.hpp
+ * @brief Parallel generation from counter-based edge generators.
+ *
+ * An edge generator describes a random graph as a sequence of independent slots, such as the m
+ * attempts of R-MAT or the rows of G(n, p). Each slot draws from its own counter_rng stream, so
+ * the edges of a slot do not depend on the other slots, the thread that produces them, or how
+ * the slots are split into chunks:
+ *
+ *   gen.num_vertices()                     The number of vertices of the graph
+ *   gen.num_slots()                        The number of slots
+ *   gen.for_each_edge(first, last, emit)   Calls emit(edge) for the edges of slots [first, last),
+ *                                          in slot order
+ *   gen.expected_edges()                   Optional: about how many edges the slots emit. Without
+ *                                          it, every slot counts as one edge
+ *
+ * Provides:
+ *   - generate_edges(gen, pool)                 All edges, in slot order, generated in parallel
+ *   - load_generated(g, gen, options, pool)     Edges straight into a compressed_graph
+ *   - sort_unique_edges(edges, n, pool)         Parallel sort by (source, target) and dedup
+ *
+ * The edge-list generators of rmat.hpp, erdos_renyi.hpp, gnm.hpp and plod.hpp are built on these.
+ */
+
+#pragma once
+
+#include <graph/container/compressed_graph.hpp>
+#include <graph/detail/thread_pool.hpp>
+#include <graph/generators/common.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace graph::generators {
+
+namespace detail {
+  /// Stands in for the emit callable when checking edge_generator.
+  template <class E>
+  struct edge_sink {
+    void operator()(const E&) const noexcept {}
+  };
+} // namespace detail
+
+/// A graph generated slot by slot; see the file comment.
+template <class Gen>
+concept edge_generator = requires(const Gen& gen, size_t slot, detail::edge_sink<typename Gen::edge_type> sink) {
+  typename Gen::vertex_id_type;
+  typename Gen::edge_type;
+  { gen.num_vertices() } -> std::convertible_to<size_t>;
+  { gen.num_slots() } -> std::convertible_to<size_t>;
+  gen.for_each_edge(slot, slot, sink);
+};
+
+namespace detail {
+  /// About how many edges gen emits: gen.expected_edges() if it has one, else one per slot.
+  template <edge_generator Gen>
+  [[nodiscard]] size_t expected_edges(const Gen& gen) {
+    if constexpr (requires { { gen.expected_edges() } -> std::convertible_to<size_t>; })
+      return gen.expected_edges();
+    else
+      return gen.num_slots();
+  }
+
+  /// The number of parts load_generated passes to load_edge_stream. Each part keeps a histogram
+  /// of one counter per vertex, so as load_unsorted_edges there are at most as many parts as
+  /// edges per vertex, and at most one per worker and per slot.
+  template <edge_generator Gen>
+  [[nodiscard]] size_t load_generated_parts(const Gen& gen, size_t workers) {
+    const size_t per_vertex = expected_edges(gen) / std::max<size_t>(gen.num_vertices(), 1);
+    return std::max<size_t>(std::min({per_vertex, workers, gen.num_slots()}), 1);
+  }
+} // namespace detail
+
+/**
+ * @brief All edges of a generator, in slot order.
+ *
+ * The slots are split into chunks generated in parallel, then concatenated. The result does not
+ * depend on the pool size.
+ */
+template <edge_generator Gen>
+[[nodiscard]] std::vector<typename Gen::edge_type> generate_edges(const Gen& gen, thread_pool& pool = default_thread_pool()) {
+  using edge_type      = typename Gen::edge_type;
+  const size_t nslots  = gen.num_slots();
+  const size_t nchunks = std::min(nslots, pool.size() * 8);
+  auto         first   = [&](size_t c) { return nslots * c / nchunks; };
+
+  std::vector<std::vector<edge_type>> chunk_edges(nchunks);
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          gen.for_each_edge(first(c), first(c + 1), [&](const edge_type& e) { chunk_edges[c].push_back(e); });
+        },
+        1);
+
+  std::vector<size_t> offset(nchunks + 1, 0);
+  for (size_t c = 0; c < nchunks; ++c)
+    offset[c + 1] = offset[c] + chunk_edges[c].size();
+  std::vector<edge_type> edges(offset[nchunks]);
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          std::ranges::copy(chunk_edges[c], edges.begin() + static_cast<std::ptrdiff_t>(offset[c]));
+          chunk_edges[c] = {};
+        },
+        1);
+  return edges;
+}
+
+/**
+ * @brief Load the edges of a generator into an empty compressed_graph, without an edge list.
+ *
+ * The slots are generated twice through compressed_graph::load_edge_stream, once to count the
+ * edges of each vertex and once to write them in place. @c options sorts the rows and removes
+ * duplicate edges in parallel; with @c remove_duplicates the first edge of each (source, target)
+ * in slot order is kept, as the edge-list generators do.
+ *
+ * The slots are split into at most one part per worker, and no more parts than the generator's
+ * expected edges per vertex, since each part counts the edges of every vertex.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc,
+          edge_generator Gen>
+void load_generated(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                    const Gen&                                                                gen,
+                    const container::csr_build_options&                                       options = {},
+                    thread_pool&                                                              pool    = default_thread_pool()) {
+  const size_t nslots = gen.num_slots();
+  const size_t parts  = detail::load_generated_parts(gen, pool.size());
+  g.load_edge_stream(
+        parts,
+        [&](size_t p, auto&& emit) { gen.for_each_edge(nslots * p / parts, nslots * (p + 1) / parts, emit); },
+        gen.num_vertices(), options, pool);
+}
+
+/**
+ * @brief Sort edges by (source_id, target_id) and keep the first edge of each pair, in parallel.
+ *
+ * The edges are counting-sorted by source and each row is then sorted by target and deduplicated,
+ * as compressed_graph::load_unsorted_edges does with @c remove_duplicates. Equal pairs keep the
+ * value of the one that came first.
+ *
+ * @param edges        Edges to sort in place.
+ * @param vertex_count The number of vertices, or 0 to use the largest vertex id + 1.
+ * @param pool         Thread pool. Default: default_thread_pool().
+ */
+template <class VId, class EV>
+void sort_unique_edges(std::vector<copyable_edge_t<VId, EV>>& edges,
+                       size_t                                 vertex_count = 0,
+                       thread_pool&                           pool         = default_thread_pool()) {
+  container::compressed_graph<EV, void, void, VId, uint64_t> csr;
+  csr.load_unsorted_edges(edges, std::identity{}, vertex_count, {.remove_duplicates = true}, pool);
+  edges.resize(csr.edge_ids().size());
+  pool.for_each_chunk(csr.size(), [&](size_t first, size_t last, size_t) {
+    for (size_t u = first; u < last; ++u) {
+      for (auto e : csr.edge_ids(static_cast<VId>(u))) {
+        auto& uv     = edges[static_cast<size_t>(e)];
+        uv.source_id = static_cast<VId>(u);
+        uv.target_id = csr.target_id(e);
+        if constexpr (!std::is_void_v<EV>)
+          uv.value = csr.edge_value(e);
+      }
+    }
+  });
+}
+
+} // namespace graph::generators
@@ -12,53 +12,95 @@
  *   offset = pos % (n−1)
  *   v      = offset < u ? offset : offset + 1   (skip self-loop)
  *
+ * Each row u is a slot of erdos_renyi_generator: it skips through its n−1 positions with
+ * geometric gaps drawn from counter_rng stream u, so the rows are generated in parallel and row u
+ * is the same for any thread count.
+ *
  * Set p = k / n for E/V ≈ k (sparse: k=2, moderate: k=8, dense: k=32).
- * The resulting edge list is already sorted by source_id because positions
- * are visited in ascending order and u is non-decreasing.
+ * The resulting edge list is already sorted by source_id because the rows are concatenated in
+ * order, and by target_id within each row.
  */
 
 #pragma once
 
 #include <graph/generators/common.hpp>
+#include <graph/generators/counter_rng.hpp>
+#include <graph/generators/edge_generator.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
-#include <random>
 #include <vector>
 
 namespace graph::generators {
 
-/// Generate an Erdős–Rényi G(n, p) directed random graph (no self-loops).
+/// The rows of an Erdős–Rényi G(n, p) graph as an edge_generator (see edge_generator.hpp).
+template <class VId = uint32_t>
+class erdos_renyi_generator {
+public:
+  using vertex_id_type = VId;
+  using edge_type      = edge_entry<VId>;
+
+  /// @param n     Number of vertices.
+  /// @param p     Edge probability. Use p = k/n for expected out-degree k.
+  /// @param seed  RNG seed for reproducibility.
+  /// @param wdist Weight distribution family.
+  erdos_renyi_generator(VId n, double p, uint64_t seed = 42, weight_dist wdist = weight_dist::uniform)
+        : n_(n), p_(p), log_q_(std::log1p(-std::min(p, 1.0))), seed_(seed), wdist_(wdist) {}
+
+  [[nodiscard]] size_t num_vertices() const noexcept { return n_; }
+  [[nodiscard]] size_t num_slots() const noexcept { return n_; }
+  /// n (n - 1) p, the expected number of edges.
+  [[nodiscard]] size_t expected_edges() const noexcept {
+    if (!(p_ > 0.0) || n_ < 2)
+      return 0;
+    return static_cast<size_t>(static_cast<double>(n_) * static_cast<double>(n_ - 1) * std::min(p_, 1.0));
+  }
+
+  template <class F>
+  void for_each_edge(size_t first, size_t last, F&& emit) const {
+    if (!(p_ > 0.0) || n_ < 2) {
+      return;
+    }
+    const size_t row = static_cast<size_t>(n_) - 1;
+    for (size_t u = first; u < last; ++u) {
+      counter_rng rng(seed_, u);
+      // Geometric skip: the gap before the next selected position, by inversion.
+      auto gap = [&]() -> size_t {
+        if (p_ >= 1.0)
+          return 0;
+        const double g = std::floor(std::log1p(-rng.uniform01()) / log_q_);
+        return g < static_cast<double>(row) ? static_cast<size_t>(g) : row;
+      };
+      for (size_t offset = gap(); offset < row; offset += gap() + 1) {
+        const VId v = static_cast<VId>(offset < u ? offset : offset + 1); // skip self-loop
+        emit(edge_type{static_cast<VId>(u), v, sample_weight(rng, wdist_)});
+      }
+    }
+  }
+
+private:
+  VId         n_;
+  double      p_;
+  double      log_q_;
+  uint64_t    seed_;
+  weight_dist wdist_;
+};
+
+/// Generate an Erdős–Rényi G(n, p) directed random graph (no self-loops), in parallel.
 ///
 /// @tparam VId  Vertex id type (default: uint32_t).
 /// @param n     Number of vertices.
 /// @param p     Edge probability. Use p = k/n for expected out-degree k.
 /// @param seed  RNG seed for reproducibility.
 /// @param wdist Weight distribution family.
+/// @param pool  Thread pool. The result does not depend on its size.
 /// @return Sorted edge list (sorted ascending by source_id).
 template <class VId = uint32_t>
 edge_list<VId> erdos_renyi(VId n, double p, uint64_t seed = 42,
-                           weight_dist wdist = weight_dist::uniform) {
-  std::mt19937_64 rng(seed);
-  const size_t    total = static_cast<size_t>(n) * (n - 1); // n*(n-1) directed pairs
-
-  edge_list<VId> generated_edges;
-  const size_t   expected = static_cast<size_t>(static_cast<double>(total) * p * 1.1) + 16;
-  generated_edges.reserve(expected);
-
-  // Geometric skip: sample the gap between consecutive selected positions.
-  std::geometric_distribution<size_t> geom(p);
-
-  size_t pos = geom(rng); // 0-indexed position of the first selected edge
-  while (pos < total) {
-    const VId u      = static_cast<VId>(pos / (n - 1));
-    const VId offset = static_cast<VId>(pos % (n - 1));
-    const VId v      = (offset < u) ? offset : offset + 1;
-    generated_edges.push_back({u, v, sample_weight(rng, wdist)});
-    pos += geom(rng) + 1;
-  }
-  // Edges are already sorted by source_id (u is non-decreasing).
-  return generated_edges;
+                           weight_dist wdist = weight_dist::uniform, thread_pool& pool = default_thread_pool()) {
+  // Edges are already sorted by source_id (rows are concatenated in order).
+  return generate_edges(erdos_renyi_generator<VId>(n, p, seed, wdist), pool);
 }
 
 } // namespace graph::generators
@@ -12,23 +12,78 @@
  *   offset = pos % (n−1)
  *   v      = offset < u ? offset : offset + 1   (skip self-loop)
  *
- * Distinct positions are drawn by rejection sampling (efficient while
- * m ≪ n*(n−1)) and the resulting edge list is sorted by source_id.
+ * Positions are drawn in parallel by erdos_renyi_gnm_generator, whose slot i picks a position
+ * from counter_rng stream i. A parallel sort-unique removes repeated positions, and further slots
+ * are drawn until m are distinct. When m is more than half the pairs, the n*(n−1) − m pairs left
+ * out are drawn instead. The weight of an edge comes from a stream of its position, so it does
+ * not depend on which slot drew it. The result is the same for any thread count, and the edge
+ * list is sorted by (source_id, target_id).
  */
 
 #pragma once
 
 #include <graph/generators/common.hpp>
+#include <graph/generators/counter_rng.hpp>
+#include <graph/generators/edge_generator.hpp>
 
 #include <algorithm>
 #include <cstdint>
 #include <random>
-#include <unordered_set>
 #include <vector>
 
 namespace graph::generators {
 
-/// Generate an Erdős–Rényi G(n, m) directed random graph (no self-loops).
+/// Candidate edges of G(n, m) as an edge_generator (see edge_generator.hpp): slot i is the pair
+/// at a uniformly random position, drawn from counter_rng stream first_slot + i. Pairs repeat;
+/// erdos_renyi_gnm() removes them and draws more slots.
+template <class VId = uint32_t>
+class erdos_renyi_gnm_generator {
+public:
+  using vertex_id_type = VId;
+  using edge_type      = edge_entry<VId>;
+
+  /// @param n          Number of vertices.
+  /// @param count      Number of candidate edges.
+  /// @param seed       RNG seed for reproducibility.
+  /// @param wdist      Weight distribution family.
+  /// @param first_slot Stream of the first candidate.
+  erdos_renyi_gnm_generator(VId n, size_t count, uint64_t seed = 42, weight_dist wdist = weight_dist::uniform,
+                            size_t first_slot = 0)
+        : n_(n), count_(n > 1 ? count : 0), seed_(seed), wdist_(wdist), first_slot_(first_slot) {}
+
+  [[nodiscard]] size_t num_vertices() const noexcept { return n_; }
+  [[nodiscard]] size_t num_slots() const noexcept { return count_; }
+  [[nodiscard]] size_t expected_edges() const noexcept { return count_; }
+
+  template <class F>
+  void for_each_edge(size_t first, size_t last, F&& emit) const {
+    const size_t row = static_cast<size_t>(n_) - 1;
+    for (size_t i = first; i < last; ++i) {
+      counter_rng                           rng(seed_, first_slot_ + i);
+      std::uniform_int_distribution<size_t> pick(0, static_cast<size_t>(n_) * row - 1);
+      emit(edge_at(pick(rng)));
+    }
+  }
+
+  /// The edge at a position, with the weight of that position.
+  [[nodiscard]] edge_type edge_at(size_t pos) const {
+    const size_t row    = static_cast<size_t>(n_) - 1;
+    const VId    u      = static_cast<VId>(pos / row);
+    const VId    offset = static_cast<VId>(pos % row);
+    const VId    v      = (offset < u) ? offset : offset + 1;
+    counter_rng  weight_rng(seed_ ^ 0x9E3779B97F4A7C15, pos);
+    return {u, v, sample_weight(weight_rng, wdist_)};
+  }
+
+private:
+  VId         n_;
+  size_t      count_;
+  uint64_t    seed_;
+  weight_dist wdist_;
+  size_t      first_slot_;
+};
+
+/// Generate an Erdős–Rényi G(n, m) directed random graph (no self-loops), in parallel.
 ///
 /// Selects exactly `m` distinct edges uniformly at random. If `m` exceeds the
 /// maximum possible edge count n*(n−1), it is clamped to that maximum.
@@ -38,41 +93,58 @@ namespace graph::generators {
 /// @param m     Number of edges to generate.
 /// @param seed  RNG seed for reproducibility.
 /// @param wdist Weight distribution family.
-/// @return Sorted edge list (ascending by source_id).
+/// @param pool  Thread pool. The result does not depend on its size.
+/// @return Edge list sorted by (source_id, target_id).
 template <class VId = uint32_t>
 edge_list<VId> erdos_renyi_gnm(VId n, size_t m, uint64_t seed = 42,
-                               weight_dist wdist = weight_dist::uniform) {
-  std::mt19937_64 rng(seed);
-  const size_t    total = (n > 1) ? static_cast<size_t>(n) * (n - 1) : 0;
+                               weight_dist wdist = weight_dist::uniform, thread_pool& pool = default_thread_pool()) {
+  const size_t total = (n > 1) ? static_cast<size_t>(n) * (n - 1) : 0;
   if (m > total) {
     m = total;
   }
-
-  edge_list<VId> generated_edges;
-  generated_edges.reserve(m);
   if (m == 0) {
-    return generated_edges;
+    return {};
   }
 
-  std::unordered_set<size_t> chosen;
-  chosen.reserve(m * 2);
-  std::uniform_int_distribution<size_t> pick(0, total - 1);
-
-  while (chosen.size() < m) {
-    const size_t pos = pick(rng);
-    if (chosen.insert(pos).second) {
-      const VId u      = static_cast<VId>(pos / (n - 1));
-      const VId offset = static_cast<VId>(pos % (n - 1));
-      const VId v      = (offset < u) ? offset : offset + 1;
-      generated_edges.push_back({u, v, sample_weight(rng, wdist)});
-    }
+  // Draw k distinct pairs: m of them, or the total - m left out.
+  const bool     complement = m > total / 2;
+  const size_t   k          = complement ? total - m : m;
+  edge_list<VId> drawn;
+  for (size_t next_slot = 0; drawn.size() < k;) {
+    const size_t deficit = k - drawn.size();
+    auto         more    = generate_edges(erdos_renyi_gnm_generator<VId>(n, deficit, seed, wdist, next_slot), pool);
+    next_slot += deficit;
+    drawn.insert(drawn.end(), more.begin(), more.end());
+    sort_unique_edges(drawn, n, pool);
+  }
+  if (!complement) {
+    return drawn;
   }
 
-  std::sort(generated_edges.begin(), generated_edges.end(),
-            [](const auto& a, const auto& b) {
-              return (a.source_id != b.source_id) ? a.source_id < b.source_id
-                                                  : a.target_id < b.target_id;
-            });
+  // Every pair except those drawn, row by row. drawn is sorted, so each row's exclusions are a run.
+  const erdos_renyi_gnm_generator<VId> weights(n, 0, seed, wdist);
+  const size_t                         row = static_cast<size_t>(n) - 1;
+  std::vector<size_t>                  first_excluded(static_cast<size_t>(n) + 1, 0);
+  for (size_t u = 0, i = 0; u <= n; ++u) {
+    while (i < drawn.size() && drawn[i].source_id < u)
+      ++i;
+    first_excluded[u] = i;
+  }
+  edge_list<VId> generated_edges(m);
+  pool.for_each_chunk(n, [&](size_t first, size_t last, size_t) {
+    for (size_t u = first; u < last; ++u) {
+      size_t out = u * row - first_excluded[u];
+      size_t x   = first_excluded[u];
+      for (size_t offset = 0; offset < row; ++offset) {
+        const VId v = static_cast<VId>(offset < u ? offset : offset + 1);
+        if (x < first_excluded[u + 1] && drawn[x].target_id == v) {
+          ++x;
+          continue;
+        }
+        generated_edges[out++] = weights.edge_at(u * row + offset);
+      }
+    }
+  });
   return generated_edges;
 }
 
@@ -12,6 +12,10 @@
  * decrementing the source's credit. The resulting out-degree distribution
  * follows a power law with exponent controlled by `alpha`.
  *
+ * Each vertex is a slot of plod_generator: it draws its credit and then its targets from its own
+ * counter_rng stream, so the vertices are generated in parallel and vertex i gets the same edges
+ * for any thread count.
+ *
  * Self-loops and duplicate directed edges are skipped; the returned list is
  * sorted by source_id.
  *
@@ -22,65 +26,99 @@
 #pragma once
 
 #include <graph/generators/common.hpp>
+#include <graph/generators/counter_rng.hpp>
+#include <graph/generators/edge_generator.hpp>
 
-#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <random>
-#include <set>
-#include <utility>
+#include <unordered_set>
 #include <vector>
 
 namespace graph::generators {
 
-/// Generate a PLOD (Power-Law Out-Degree) directed graph.
-///
-/// @tparam VId  Vertex id type (default: uint32_t).
-/// @param n     Number of vertices.
-/// @param alpha Power-law exponent (larger ⇒ steeper degree decay).
-/// @param beta  Degree scaling factor (larger ⇒ denser graph).
-/// @param seed  RNG seed for reproducibility.
-/// @param wdist Weight distribution family.
-/// @return Sorted edge list (ascending by source_id), no self-loops/duplicates.
+/// The vertices of a PLOD graph as an edge_generator (see edge_generator.hpp).
 template <class VId = uint32_t>
-edge_list<VId> plod(VId n, double alpha = 2.5, double beta = 10.0,
-                    uint64_t seed = 42, weight_dist wdist = weight_dist::uniform) {
-  std::mt19937_64 rng(seed);
-  edge_list<VId>  generated_edges;
-  if (n < 2) {
-    return generated_edges;
-  }
+class plod_generator {
+public:
+  using vertex_id_type = VId;
+  using edge_type      = edge_entry<VId>;
+
+  /// @param n     Number of vertices.
+  /// @param alpha Power-law exponent (larger ⇒ steeper degree decay).
+  /// @param beta  Degree scaling factor (larger ⇒ denser graph).
+  /// @param seed  RNG seed for reproducibility.
+  /// @param wdist Weight distribution family.
+  plod_generator(VId n, double alpha = 2.5, double beta = 10.0, uint64_t seed = 42,
+                 weight_dist wdist = weight_dist::uniform)
+        : n_(n), alpha_(alpha), beta_(beta), seed_(seed), wdist_(wdist) {}
 
-  // Assign a target out-degree (credit) to each vertex from the power law.
-  std::vector<size_t> credit(n, 0);
-  std::uniform_real_distribution<double> xdist(1.0, static_cast<double>(n));
-  for (VId i = 0; i < n; ++i) {
-    const double x = xdist(rng);
-    const double c = beta * std::pow(x, -alpha) * static_cast<double>(n);
-    credit[i]      = (c < 1.0) ? size_t{1} : static_cast<size_t>(c);
+  [[nodiscard]] size_t num_vertices() const noexcept { return n_ < 2 ? 0 : n_; }
+  [[nodiscard]] size_t num_slots() const noexcept { return n_ < 2 ? 0 : n_; }
+  /// About n (1 + beta n E[x^-alpha]) for x uniform on [1, n): the sum of the credits drawn
+  /// below, each at least 1.
+  [[nodiscard]] size_t expected_edges() const noexcept {
+    if (n_ < 2)
+      return 0;
+    const double n    = static_cast<double>(n_);
+    const double mean = alpha_ == 1.0 ? std::log(n) / (n - 1.0)
+                                      : (1.0 - std::pow(n, 1.0 - alpha_)) / ((alpha_ - 1.0) * (n - 1.0));
+    return static_cast<size_t>(n * (1.0 + beta_ * n * mean));
   }
 
-  std::set<std::pair<VId, VId>>      present;
-  std::uniform_int_distribution<VId> pick(0, n - 1);
+  template <class F>
+  void for_each_edge(size_t first, size_t last, F&& emit) const {
+    std::unordered_set<VId> present; // targets of the current vertex
+    for (size_t i = first; i < last; ++i) {
+      const VId   u = static_cast<VId>(i);
+      counter_rng rng(seed_, i);
 
-  for (VId u = 0; u < n; ++u) {
-    size_t guard = 0;
-    const size_t max_attempts = credit[u] * 4 + 8;
-    while (credit[u] > 0 && guard++ < max_attempts) {
-      VId v = pick(rng);
-      if (v == u) {
-        continue;
-      }
-      if (present.insert({u, v}).second) {
-        generated_edges.push_back({u, v, sample_weight(rng, wdist)});
-        --credit[u];
+      // A target out-degree (credit) from the power law.
+      std::uniform_real_distribution<double> xdist(1.0, static_cast<double>(n_));
+      const double                           x = xdist(rng);
+      const double c      = beta_ * std::pow(x, -alpha_) * static_cast<double>(n_);
+      size_t       credit = (c < 1.0) ? size_t{1} : static_cast<size_t>(c);
+
+      std::uniform_int_distribution<VId> pick(0, n_ - 1);
+      present.clear();
+      size_t       guard        = 0;
+      const size_t max_attempts = credit * 4 + 8;
+      while (credit > 0 && guard++ < max_attempts) {
+        VId v = pick(rng);
+        if (v == u) {
+          continue;
+        }
+        if (present.insert(v).second) {
+          emit(edge_type{u, v, sample_weight(rng, wdist_)});
+          --credit;
+        }
       }
     }
   }
 
-  std::stable_sort(generated_edges.begin(), generated_edges.end(),
-                   [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
-  return generated_edges;
+private:
+  VId         n_;
+  double      alpha_;
+  double      beta_;
+  uint64_t    seed_;
+  weight_dist wdist_;
+};
+
+/// Generate a PLOD (Power-Law Out-Degree) directed graph, in parallel.
+///
+/// @tparam VId  Vertex id type (default: uint32_t).
+/// @param n     Number of vertices.
+/// @param alpha Power-law exponent (larger ⇒ steeper degree decay).
+/// @param beta  Degree scaling factor (larger ⇒ denser graph).
+/// @param seed  RNG seed for reproducibility.
+/// @param wdist Weight distribution family.
+/// @param pool  Thread pool. The result does not depend on its size.
+/// @return Sorted edge list (ascending by source_id), no self-loops/duplicates.
+template <class VId = uint32_t>
+edge_list<VId> plod(VId n, double alpha = 2.5, double beta = 10.0, uint64_t seed = 42,
+                    weight_dist wdist = weight_dist::uniform, thread_pool& pool = default_thread_pool()) {
+  // Edges are already sorted by source_id (vertices are concatenated in order).
+  return generate_edges(plod_generator<VId>(n, alpha, beta, seed, wdist), pool);
 }
 
 } // namespace graph::generators
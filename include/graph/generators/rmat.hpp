@@ -16,25 +16,98 @@
  * log2(scale) levels. With a skewed (a, b, c, d) this produces the
  * power-law / community structure used by the Graph500 benchmark.
  *
- * The number of vertices is rounded **up** to the next power of two; the
- * returned list is sorted by source_id. Duplicate directed edges produced by
- * the recursive sampling are removed.
+ * The graph has 2^scale vertices. Each of the m attempts is a slot of rmat_generator with its own
+ * counter_rng stream, so attempt i places the same edge for any thread count, and rmat() generates
+ * the attempts in parallel. Self-loops are skipped, and duplicate directed edges are removed by a
+ * parallel sort-unique that keeps the first attempt; the returned list is sorted by
+ * (source_id, target_id). To build a compressed_graph without the edge list, pass the generator
+ * to load_generated() with csr_build_options::remove_duplicates.
  */
 
 #pragma once
 
 #include <graph/generators/common.hpp>
+#include <graph/generators/counter_rng.hpp>
+#include <graph/generators/edge_generator.hpp>
 
-#include <algorithm>
 #include <cstdint>
-#include <random>
-#include <set>
-#include <utility>
 #include <vector>
 
 namespace graph::generators {
 
-/// Generate an R-MAT directed graph (Graph500-style).
+/// The m attempts of an R-MAT graph as an edge_generator (see edge_generator.hpp).
+///
+/// Attempt i descends the scale levels with 32 bits of stream i per level, then draws the
+/// weight from the same stream. Attempts that land on the diagonal emit no edge.
+template <class VId = uint32_t>
+class rmat_generator {
+public:
+  using vertex_id_type = VId;
+  using edge_type      = edge_entry<VId>;
+
+  /// @param scale Graph has 2^scale vertices.
+  /// @param m     Number of (directed) edges to attempt to place.
+  /// @param a     Quadrant probability for the top-left block.
+  /// @param b     Quadrant probability for the top-right block.
+  /// @param c     Quadrant probability for the bottom-left block.
+  /// @param d     Quadrant probability for the bottom-right block (a+b+c+d ≈ 1).
+  /// @param seed  RNG seed for reproducibility.
+  /// @param wdist Weight distribution family.
+  rmat_generator(uint32_t scale, size_t m, double a = 0.57, double b = 0.19, double c = 0.19, double d = 0.05,
+                 uint64_t seed = 42, weight_dist wdist = weight_dist::uniform)
+        : scale_(scale), m_(scale == 0 ? 0 : m), seed_(seed), wdist_(wdist) {
+    // Normalise so the four probabilities form a partition of unity, as thresholds on 32 bits.
+    const double sum = a + b + c + d;
+    ta_              = threshold(a / sum);
+    tb_              = threshold((a + b) / sum);
+    tc_              = threshold((a + b + c) / sum);
+  }
+
+  [[nodiscard]] size_t num_vertices() const noexcept { return m_ == 0 ? 0 : size_t{1} << scale_; }
+  [[nodiscard]] size_t num_slots() const noexcept { return m_; }
+  [[nodiscard]] size_t expected_edges() const noexcept { return m_; }
+
+  template <class F>
+  void for_each_edge(size_t first, size_t last, F&& emit) const {
+    for (size_t i = first; i < last; ++i) {
+      counter_rng rng(seed_, i);
+      VId         u    = 0;
+      VId         v    = 0;
+      uint64_t    bits = 0;
+      for (uint32_t level = 0; level < scale_; ++level) {
+        if (level % 2 == 0)
+          bits = rng();
+        const uint64_t r   = (bits >> (level % 2 * 32)) & 0xFFFF'FFFF;
+        const VId      bit = static_cast<VId>(VId{1} << (scale_ - 1 - level));
+        if (r < ta_) {
+          // top-left: row bit 0, col bit 0
+        } else if (r < tb_) {
+          v = static_cast<VId>(v | bit); // top-right: col bit 1
+        } else if (r < tc_) {
+          u = static_cast<VId>(u | bit); // bottom-left: row bit 1
+        } else {
+          u = static_cast<VId>(u | bit); // bottom-right: both bits 1
+          v = static_cast<VId>(v | bit);
+        }
+      }
+      if (u == v) {
+        continue; // skip self-loops
+      }
+      emit(edge_type{u, v, sample_weight(rng, wdist_)});
+    }
+  }
+
+private:
+  static uint64_t threshold(double p) noexcept { return static_cast<uint64_t>(p * 4294967296.0); }
+
+  uint32_t    scale_;
+  size_t      m_;
+  uint64_t    seed_;
+  weight_dist wdist_;
+  uint64_t    ta_ = 0, tb_ = 0, tc_ = 0;
+};
+
+/// Generate an R-MAT directed graph (Graph500-style), in parallel.
 ///
 /// @tparam VId  Vertex id type (default: uint32_t).
 /// @param scale Graph has 2^scale vertices.
@@ -45,54 +118,15 @@ namespace graph::generators {
 /// @param d     Quadrant probability for the bottom-right block (a+b+c+d ≈ 1).
 /// @param seed  RNG seed for reproducibility.
 /// @param wdist Weight distribution family.
-/// @return Sorted edge list (ascending by source_id), self-loops removed.
+/// @param pool  Thread pool. The result does not depend on its size.
+/// @return Edge list sorted by (source_id, target_id), self-loops and duplicates removed.
 template <class VId = uint32_t>
 edge_list<VId> rmat(uint32_t scale, size_t m, double a = 0.57, double b = 0.19,
                     double c = 0.19, double d = 0.05, uint64_t seed = 42,
-                    weight_dist wdist = weight_dist::uniform) {
-  std::mt19937_64 rng(seed);
-  edge_list<VId>  generated_edges;
-  if (scale == 0 || m == 0) {
-    return generated_edges;
-  }
-
-  const double sum = a + b + c + d;
-  // Normalise so the four probabilities form a partition of unity.
-  const double pa = a / sum;
-  const double pb = pa + b / sum;
-  const double pc = pb + c / sum;
-
-  std::uniform_real_distribution<double> coin(0.0, 1.0);
-  std::set<std::pair<VId, VId>>          present;
-  generated_edges.reserve(m);
-
-  for (size_t e = 0; e < m; ++e) {
-    VId u = 0;
-    VId v = 0;
-    for (uint32_t level = 0; level < scale; ++level) {
-      const VId    bit = static_cast<VId>(VId{1} << (scale - 1 - level));
-      const double r   = coin(rng);
-      if (r < pa) {
-        // top-left: row bit 0, col bit 0
-      } else if (r < pb) {
-        v = static_cast<VId>(v | bit); // top-right: col bit 1
-      } else if (r < pc) {
-        u = static_cast<VId>(u | bit); // bottom-left: row bit 1
-      } else {
-        u = static_cast<VId>(u | bit); // bottom-right: both bits 1
-        v = static_cast<VId>(v | bit);
-      }
-    }
-    if (u == v) {
-      continue; // skip self-loops
-    }
-    if (present.insert({u, v}).second) {
-      generated_edges.push_back({u, v, sample_weight(rng, wdist)});
-    }
-  }
-
-  std::stable_sort(generated_edges.begin(), generated_edges.end(),
-                   [](const auto& lhs, const auto& rhs) { return lhs.source_id < rhs.source_id; });
+                    weight_dist wdist = weight_dist::uniform, thread_pool& pool = default_thread_pool()) {
+  const rmat_generator<VId> gen(scale, m, a, b, c, d, seed, wdist);
+  auto                      generated_edges = generate_edges(gen, pool);
+  sort_unique_edges(generated_edges, gen.num_vertices(), pool);
   return generated_edges;
 }
 
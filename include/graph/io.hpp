@@ -6,9 +6,12 @@
  *   - DOT (GraphViz):       write_dot(), read_dot()
  *   - GraphML (XML):        write_graphml(), read_graphml()
  *   - JSON:                 write_json(), read_json()
- *   - DIMACS:               write_dimacs(), write_dimacs_max_flow(), read_dimacs()
- *   - METIS:                write_metis(), read_metis()
+ *   - DIMACS:               write_dimacs(), write_dimacs_max_flow(), read_dimacs(), load_dimacs()
+ *   - METIS:                write_metis(), read_metis(), load_metis()
+ *   - Edge list:            load_edge_list() (compressed_graph only)
  *   - Adjacency List Text:  write_adjacency_list_text(), read_adjacency_list_text()
+ *   - Binary snapshot:      write_binary_snapshot(), map_binary_snapshot() (compressed_graph only)
+ *   - Contraction hierarchy: write_contraction_hierarchy(), read_contraction_hierarchy()
  *
  * All writers use std::format for zero-config value serialization when the
  * value type satisfies std::formatter<T>. Custom attribute functions can
@@ -18,8 +21,11 @@
 #pragma once
 
 #include <graph/io/adjacency_list_text.hpp>
+#include <graph/io/binary_snapshot.hpp>
+#include <graph/io/contraction_hierarchy.hpp>
 #include <graph/io/dimacs.hpp>
 #include <graph/io/dot.hpp>
+#include <graph/io/edge_list.hpp>
 #include <graph/io/graphml.hpp>
 #include <graph/io/json.hpp>
 #include <graph/io/metis.hpp>
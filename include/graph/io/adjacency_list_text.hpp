@@ -5,6 +5,8 @@
  * Provides:
  *   - write_adjacency_list_text(os, g)   Emit a graph as a textual adjacency list
  *   - read_adjacency_list_text(is)       Parse a textual adjacency list
+ *   - read_adjacency_list_text(text, pool)     Parse adjacency-list text in parallel
+ *   - read_adjacency_list_text_file(path, pool) Map a file and parse it in parallel
  *
  * This is the plain whitespace-delimited adjacency dump in the spirit of BGL's
  * `operator<<` / `operator>>` for graphs.  It is NOT CSV: one line per vertex,
@@ -18,6 +20,9 @@
  * The format carries structure only (no vertex/edge values).  Vertices with no
  * out-edges still produce a line (`<id>:`) so the vertex set is preserved.
  *
+ * The text and file readers parse chunks of whole lines on a thread_pool and
+ * return the same adjacency_list_text_graph as the stream reader.
+ *
  * NOTE: Self-contained — no external dependencies.
  */
 
@@ -25,12 +30,17 @@
 
 #include <graph/graph.hpp>
 #include <graph/io/detail/common.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+#include <graph/io/detail/text_chunks.hpp>
 
+#include <filesystem>
 #include <istream>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace graph::io {
@@ -118,4 +128,92 @@ inline adjacency_list_text_graph read_adjacency_list_text(std::istream& is) {
   return result;
 }
 
+/**
+ * @brief Parse adjacency-list text in parallel.
+ *
+ * Gives the same result as read_adjacency_list_text(std::istream&) on the same characters. Each
+ * chunk of whole lines is tokenized in place, keeping its edges and the vertices it saw first as
+ * views into the text. The vertices are then merged in file order through one hash set, and the
+ * edges are copied into the result in parallel.
+ *
+ * @param text Adjacency-list text, e.g. a mapped file. Only read during the call.
+ * @param pool Thread pool for tokenizing and copying. Default: default_thread_pool().
+ * @return Parsed adjacency_list_text_graph.
+ */
+inline adjacency_list_text_graph read_adjacency_list_text(std::string_view text,
+                                                          thread_pool&     pool = default_thread_pool()) {
+  struct chunk_tokens {
+    std::vector<std::string_view>                               first_seen; // in order of appearance
+    std::vector<std::pair<std::string_view, std::string_view>> edges;
+  };
+
+  const auto                chunks  = detail::line_chunks(text, pool);
+  const size_t              nchunks = chunks.size() - 1;
+  std::vector<chunk_tokens> parts(nchunks);
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          chunk_tokens&                        part = parts[c];
+          std::unordered_set<std::string_view> seen;
+          auto                                 see = [&](std::string_view id) {
+            if (seen.insert(id).second)
+              part.first_seen.push_back(id);
+          };
+          detail::for_each_line(text, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            // The first ':' separates like a space.
+            const auto          colon = line.find(':');
+            detail::text_cursor head(line.substr(0, colon));
+            detail::text_cursor tail(colon == std::string_view::npos ? std::string_view{} : line.substr(colon + 1));
+            auto                next = [&](std::string_view& token) { return head.get(token) || tail.get(token); };
+
+            std::string_view src;
+            if (!next(src))
+              return; // blank line
+            see(src);
+            std::string_view dst;
+            while (next(dst)) {
+              see(dst);
+              part.edges.emplace_back(src, dst);
+            }
+          });
+        },
+        1);
+
+  adjacency_list_text_graph            result;
+  std::unordered_set<std::string_view> seen;
+  std::vector<size_t>                  edge_start(nchunks + 1, 0);
+  for (size_t c = 0; c < nchunks; ++c) {
+    for (std::string_view id : parts[c].first_seen)
+      if (seen.insert(id).second)
+        result.vertex_ids.emplace_back(id);
+    edge_start[c + 1] = edge_start[c] + parts[c].edges.size();
+  }
+
+  result.edges.resize(edge_start[nchunks]);
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          auto out = result.edges.begin() + static_cast<std::ptrdiff_t>(edge_start[c]);
+          for (const auto& [src, dst] : parts[c].edges) {
+            out->source.assign(src);
+            out->target.assign(dst);
+            ++out;
+          }
+        },
+        1);
+  return result;
+}
+
+/**
+ * @brief Map an adjacency-list text file and parse it in parallel. See
+ * read_adjacency_list_text(std::string_view, thread_pool&).
+ *
+ * @throws std::system_error if the file cannot be opened or mapped.
+ */
+inline adjacency_list_text_graph read_adjacency_list_text_file(const std::filesystem::path& path,
+                                                               thread_pool& pool = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  return read_adjacency_list_text(file.text(), pool);
+}
+
 } // namespace graph::io
@@ -0,0 +1,601 @@
+/**
+ * @file binary_snapshot.hpp
+ * @brief Binary on-disk snapshot of a compressed_graph, with a zero-copy memory-mapped reader.
+ *
+ * Provides:
+ *   - write_binary_snapshot(os, g)       Write a compressed_graph to a binary stream
+ *   - write_binary_snapshot(path, g)     Same, to a file
+ *   - binary_snapshot_size(g)            The size of the snapshot of g, in bytes
+ *   - csr_snapshot_view<EV,VV,VId,EIndex> Read-only graph over a snapshot held in memory or
+ *                                        mapped from a file; satisfies index_adjacency_list
+ *   - map_binary_snapshot<...>(path)     Map a snapshot file and return its view
+ *   - snapshot_check                     How much of a snapshot is checked when it is opened
+ *
+ * Layout (version 1). All integers use the writer's byte order; every section starts on a
+ * 64-byte boundary so the arrays can be used in place:
+ *
+ *   offset 0    snapshot_header (128 bytes)
+ *   row_index   EIndex[num_vertices + 1]    offset of each row in col_index, plus terminator
+ *   col_index   VId[num_edges]              target id of each edge, in row order
+ *   vertex_vals VV[num_vertex_values]       0 or num_vertices entries (absent if VV is void)
+ *   edge_vals   EV[num_edges]               absent if EV is void
+ *   partitions  VId[num_partition_entries]  partition start ids plus terminator (may be empty)
+ *
+ * The header records the size and kind (signed, unsigned, floating-point, other) of VId,
+ * EIndex, EV and VV. Opening a snapshot with different template arguments, a different
+ * version or the other byte order throws graph_error; nothing is converted, which is what
+ * makes the reader zero-copy. EV and VV must be trivially copyable. The graph value (GV) is
+ * not stored.
+ *
+ * Mapping a file shares its pages with every other process mapping the same snapshot. Opening
+ * checks one of two amounts, chosen by snapshot_check:
+ *   - full (default)   The header, the section table and the arrays: row offsets ascend and
+ *                      span the edges, targets and partition ids are in range. One pass over
+ *                      the row, target and partition arrays, O(V + E), which reads those pages.
+ *   - header_only      The header and the section table only, in constant time; pages are read
+ *                      on first use. For snapshots this program wrote or otherwise trusts: the
+ *                      accessors do not check bounds, so corrupt arrays are undefined behavior.
+ *
+ * NOTE: Uses mmap (POSIX) or MapViewOfFile (Windows) for the file-backed view.
+ */
+
+#pragma once
+
+#include <graph/graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace graph::io {
+
+// ---------------------------------------------------------------------------
+// Format
+// ---------------------------------------------------------------------------
+
+/// First 8 bytes of every snapshot. The trailing CR LF detects text-mode transfers.
+inline constexpr std::array<char, 8> snapshot_magic = {'G', 'V', '3', 'C', 'S', 'R', '\r', '\n'};
+
+/// Current format version; readers reject any other version.
+inline constexpr std::uint32_t snapshot_version = 1;
+
+/// Written in native byte order; reads back byte-swapped on a machine of the other endianness.
+inline constexpr std::uint32_t snapshot_endian_tag = 0x01020304;
+
+/// Section alignment within the file.
+inline constexpr std::uint64_t snapshot_alignment = 64;
+
+/// Kind of a stored scalar type, recorded next to its size.
+enum class snapshot_type_kind : std::uint8_t {
+  none             = 0, ///< void: the section is absent
+  signed_integer   = 1,
+  unsigned_integer = 2,
+  floating_point   = 3,
+  trivial          = 4, ///< any other trivially copyable type, compared by size only
+};
+
+/// How much of a snapshot csr_snapshot_view checks when it is opened.
+enum class snapshot_check : std::uint8_t {
+  full        = 0, ///< Header, section table and arrays, O(V + E)
+  header_only = 1, ///< Header and section table, O(1); the arrays must be valid
+};
+
+/// Fixed-size file header (128 bytes).
+struct snapshot_header {
+  std::array<char, 8> magic{};
+  std::uint32_t       version    = 0;
+  std::uint32_t       endian_tag = 0;
+
+  std::uint8_t vertex_id_size    = 0;
+  std::uint8_t vertex_id_kind    = 0;
+  std::uint8_t edge_index_size   = 0;
+  std::uint8_t edge_index_kind   = 0;
+  std::uint8_t edge_value_size   = 0;
+  std::uint8_t edge_value_kind   = 0;
+  std::uint8_t vertex_value_size = 0;
+  std::uint8_t vertex_value_kind = 0;
+
+  std::uint64_t num_vertices          = 0;
+  std::uint64_t num_edges             = 0;
+  std::uint64_t num_vertex_values     = 0;
+  std::uint64_t num_partition_entries = 0;
+
+  std::uint64_t row_index_offset     = 0;
+  std::uint64_t col_index_offset     = 0;
+  std::uint64_t vertex_values_offset = 0;
+  std::uint64_t edge_values_offset   = 0;
+  std::uint64_t partition_offset     = 0;
+  std::uint64_t file_size            = 0;
+
+  std::array<std::uint8_t, 24> reserved{};
+};
+static_assert(sizeof(snapshot_header) == 128 && std::is_trivially_copyable_v<snapshot_header>);
+
+namespace detail {
+
+  template <class T>
+  constexpr snapshot_type_kind snapshot_kind_of() {
+    if constexpr (std::is_void_v<T>)
+      return snapshot_type_kind::none;
+    else if constexpr (std::is_floating_point_v<T>)
+      return snapshot_type_kind::floating_point;
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+      return snapshot_type_kind::signed_integer;
+    else if constexpr (std::is_integral_v<T>)
+      return snapshot_type_kind::unsigned_integer;
+    else
+      return snapshot_type_kind::trivial;
+  }
+
+  template <class T>
+  constexpr std::uint8_t snapshot_size_of() {
+    if constexpr (std::is_void_v<T>)
+      return 0;
+    else
+      return static_cast<std::uint8_t>(sizeof(T));
+  }
+
+  template <class T>
+  concept snapshot_value = std::is_void_v<T> || (std::is_trivially_copyable_v<T> && sizeof(T) <= 255);
+
+  constexpr std::uint64_t align_up(std::uint64_t off) {
+    return (off + snapshot_alignment - 1) / snapshot_alignment * snapshot_alignment;
+  }
+
+  /// Header describing the types and section layout for the given counts.
+  template <class EV, class VV, class VId, class EIndex>
+  snapshot_header make_snapshot_header(std::uint64_t n, std::uint64_t m, std::uint64_t nvv, std::uint64_t nparts) {
+    snapshot_header h;
+    h.magic             = snapshot_magic;
+    h.version           = snapshot_version;
+    h.endian_tag        = snapshot_endian_tag;
+    h.vertex_id_size    = snapshot_size_of<VId>();
+    h.vertex_id_kind    = static_cast<std::uint8_t>(snapshot_kind_of<VId>());
+    h.edge_index_size   = snapshot_size_of<EIndex>();
+    h.edge_index_kind   = static_cast<std::uint8_t>(snapshot_kind_of<EIndex>());
+    h.edge_value_size   = snapshot_size_of<EV>();
+    h.edge_value_kind   = static_cast<std::uint8_t>(snapshot_kind_of<EV>());
+    h.vertex_value_size = snapshot_size_of<VV>();
+    h.vertex_value_kind = static_cast<std::uint8_t>(snapshot_kind_of<VV>());
+
+    h.num_vertices          = n;
+    h.num_edges             = m;
+    h.num_vertex_values     = nvv;
+    h.num_partition_entries = nparts;
+
+    std::uint64_t off      = align_up(sizeof(snapshot_header));
+    h.row_index_offset     = off;
+    off                    = align_up(off + (n + 1) * sizeof(EIndex));
+    h.col_index_offset     = off;
+    off                    = align_up(off + m * sizeof(VId));
+    h.vertex_values_offset = off;
+    off                    = align_up(off + nvv * h.vertex_value_size);
+    h.edge_values_offset   = off;
+    off                    = align_up(off + m * h.edge_value_size);
+    h.partition_offset     = off;
+    h.file_size            = off + nparts * sizeof(VId);
+    return h;
+  }
+
+  inline void write_padding(std::ostream& os, std::uint64_t& pos, std::uint64_t target) {
+    static constexpr std::array<char, snapshot_alignment> zeros{};
+    while (pos < target) {
+      const auto k = static_cast<std::streamsize>(std::min<std::uint64_t>(target - pos, zeros.size()));
+      os.write(zeros.data(), k);
+      pos += static_cast<std::uint64_t>(k);
+    }
+  }
+
+  template <class T>
+  void write_section(std::ostream& os, std::uint64_t& pos, std::uint64_t offset, std::span<const T> values) {
+    write_padding(os, pos, offset);
+    os.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+    pos += values.size_bytes();
+  }
+
+} // namespace detail
+
+// ---------------------------------------------------------------------------
+// write_binary_snapshot
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Write a compressed_graph as a binary snapshot.
+ *
+ * Each CSR array is written with a single stream write, so the cost is one pass over the
+ * graph's memory. The stream must be opened in binary mode; check its state afterwards as
+ * with the other writers.
+ *
+ * @param os Output stream (binary mode).
+ * @param g  Graph to write. EV and VV must be void or trivially copyable; GV is not stored.
+ *           The incoming-edge index of a bidirectional graph is not stored either.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires detail::snapshot_value<EV> && detail::snapshot_value<VV>
+void write_binary_snapshot(std::ostream&                                                                          os,
+                           const container::compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g) {
+  using row_type = container::csr_row<EIndex>;
+  using col_type = container::csr_col<VId>;
+  static_assert(sizeof(row_type) == sizeof(EIndex) && sizeof(col_type) == sizeof(VId),
+                "csr_row / csr_col must be layout-compatible with their index type");
+
+  const auto rows  = g.row_index_storage();
+  const auto cols  = g.col_index_storage();
+  const auto parts = g.partition_storage();
+
+  std::uint64_t nvv = 0;
+  if constexpr (!std::is_void_v<VV>)
+    nvv = g.vertex_value_storage().size();
+
+  const auto h = detail::make_snapshot_header<EV, VV, VId, EIndex>(g.size(), cols.size(), nvv, parts.size());
+
+  std::uint64_t pos = 0;
+  os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  pos += sizeof(h);
+
+  // A graph that was never loaded has no terminating row; store the single 0 it implies
+  const EIndex empty_rows[1] = {0};
+  if (rows.empty())
+    detail::write_section(os, pos, h.row_index_offset, std::span<const EIndex>(empty_rows));
+  else
+    detail::write_section(os, pos, h.row_index_offset, rows);
+  detail::write_section(os, pos, h.col_index_offset, cols);
+  if constexpr (!std::is_void_v<VV>)
+    detail::write_section(os, pos, h.vertex_values_offset, g.vertex_value_storage());
+  if constexpr (!std::is_void_v<EV>)
+    detail::write_section(os, pos, h.edge_values_offset, g.edge_value_storage());
+  detail::write_section(os, pos, h.partition_offset, parts);
+}
+
+/**
+ * @brief Write a compressed_graph as a binary snapshot file.
+ *
+ * @throws graph_error if the file cannot be created or written.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires detail::snapshot_value<EV> && detail::snapshot_value<VV>
+void write_binary_snapshot(const std::filesystem::path&                                                           path,
+                           const container::compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g) {
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  if (!os)
+    throw graph_error(std::format("cannot create snapshot file {}", path.string()));
+  write_binary_snapshot(os, g);
+  os.flush();
+  if (!os)
+    throw graph_error(std::format("error writing snapshot file {}", path.string()));
+}
+
+/**
+ * @brief The number of bytes write_binary_snapshot writes for g.
+ *
+ * Lets a container format embed snapshots at precomputed offsets, as io/contraction_hierarchy.hpp does.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires detail::snapshot_value<EV> && detail::snapshot_value<VV>
+[[nodiscard]] std::uint64_t
+binary_snapshot_size(const container::compressed_graph_base<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g) {
+  std::uint64_t nvv = 0;
+  if constexpr (!std::is_void_v<VV>)
+    nvv = g.vertex_value_storage().size();
+  return detail::make_snapshot_header<EV, VV, VId, EIndex>(g.size(), g.col_index_storage().size(), nvv,
+                                                          g.partition_storage().size())
+        .file_size;
+}
+
+// ---------------------------------------------------------------------------
+// csr_snapshot_view
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Read-only compressed_graph over a binary snapshot, used in place.
+ *
+ * The view points into the snapshot bytes; nothing is copied. A view opened from a path owns
+ * the mapping (shared between copies of the view); a view built from a byte span does not own
+ * the bytes, which must outlive it and be aligned to 64 bytes.
+ *
+ * The view offers the same id-based accessors as compressed_graph (size(), vertex_ids(),
+ * edge_ids(u), target_id(eid), target_ids(u), edge_value(eid), vertex_value(id)) and the CPO customizations
+ * that make it an index_adjacency_list, so algorithms and views accept it directly. Edge and
+ * vertex values are const.
+ *
+ * @tparam EV     Edge value type stored in the snapshot (void if none)
+ * @tparam VV     Vertex value type stored in the snapshot (void if none)
+ * @tparam VId    Vertex id type
+ * @tparam EIndex Edge index type
+ */
+template <class EV = void, class VV = void, std::integral VId = std::uint32_t, std::integral EIndex = std::uint32_t>
+requires detail::snapshot_value<EV> && detail::snapshot_value<VV>
+class csr_snapshot_view {
+  using ev_storage = std::conditional_t<std::is_void_v<EV>, std::byte, EV>;
+  using vv_storage = std::conditional_t<std::is_void_v<VV>, std::byte, VV>;
+
+public: // Types
+  using vertex_id_type    = VId;
+  using edge_index_type   = EIndex;
+  using edge_id_type      = EIndex;
+  using edge_value_type   = EV;
+  using vertex_value_type = VV;
+  using partition_id_type = VId;
+  using size_type         = std::size_t;
+
+public: // Construction
+  csr_snapshot_view() = default;
+
+  /**
+   * @brief View a snapshot held in memory.
+   * @param check How much to check; with snapshot_check::header_only the arrays must be valid.
+   * @throws graph_error if the bytes are not a valid snapshot for these template arguments.
+   */
+  explicit csr_snapshot_view(std::span<const std::byte> bytes, snapshot_check check = snapshot_check::full) {
+    attach(bytes, check);
+  }
+
+  /**
+   * @brief Map a snapshot file read-only and view it.
+   * @param check How much to check; with snapshot_check::header_only the arrays must be valid.
+   * @throws std::system_error if the file cannot be opened or mapped.
+   * @throws graph_error if the file is not a valid snapshot for these template arguments.
+   */
+  explicit csr_snapshot_view(const std::filesystem::path& path, snapshot_check check = snapshot_check::full)
+        : file_(std::make_shared<const detail::mapped_file>(path)) {
+    attach(file_->bytes(), check);
+  }
+
+public: // Properties
+  [[nodiscard]] constexpr size_type size() const noexcept { return n_; }
+  [[nodiscard]] constexpr size_type num_vertices() const noexcept { return n_; }
+  [[nodiscard]] constexpr bool      empty() const noexcept { return n_ == 0; }
+
+  /// Header of the underlying snapshot.
+  [[nodiscard]] const snapshot_header& header() const noexcept { return header_; }
+
+public: // Id-based accessors (as compressed_graph)
+  [[nodiscard]] constexpr auto vertex_ids() const noexcept {
+    return std::views::iota(vertex_id_type{0}, static_cast<vertex_id_type>(n_));
+  }
+  [[nodiscard]] constexpr auto edge_ids() const noexcept {
+    return std::views::iota(edge_index_type{0}, static_cast<edge_index_type>(m_));
+  }
+  [[nodiscard]] constexpr auto edge_ids(vertex_id_type id) const noexcept {
+    if (static_cast<size_type>(id) >= n_)
+      return std::views::iota(edge_index_type{0}, edge_index_type{0});
+    return std::views::iota(rows_[id], rows_[id + 1]);
+  }
+  [[nodiscard]] constexpr vertex_id_type target_id(edge_id_type edge_id) const noexcept {
+    return cols_[static_cast<size_type>(edge_id)];
+  }
+
+  /// Target ids of a vertex's edges, contiguous (as compressed_graph::target_ids).
+  [[nodiscard]] constexpr std::span<const VId> target_ids(vertex_id_type id) const noexcept {
+    if (static_cast<size_type>(id) >= n_)
+      return {};
+    return {cols_ + rows_[id], static_cast<size_type>(rows_[id + 1] - rows_[id])};
+  }
+
+  template <typename EV_ = EV>
+  requires(!std::is_void_v<EV_>)
+  [[nodiscard]] constexpr const EV_& edge_value(edge_id_type edge_id) const noexcept {
+    return evals_[static_cast<size_type>(edge_id)];
+  }
+
+  /// @note The snapshot stores vertex values only if the graph had them (header().num_vertex_values).
+  template <typename VV_ = VV>
+  requires(!std::is_void_v<VV_>)
+  [[nodiscard]] constexpr const VV_& vertex_value(vertex_id_type id) const noexcept {
+    return vvals_[static_cast<size_type>(id)];
+  }
+
+  /// Row offsets (size() + 1 entries) and targets, as stored.
+  [[nodiscard]] constexpr std::span<const EIndex> row_index() const noexcept { return {rows_, n_ + 1}; }
+  [[nodiscard]] constexpr std::span<const VId>    col_index() const noexcept { return {cols_, m_}; }
+
+private:
+  void attach(std::span<const std::byte> bytes, snapshot_check check) {
+    if (bytes.size() < sizeof(snapshot_header))
+      throw graph_error(std::format("binary snapshot too small: {} bytes", bytes.size()));
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % snapshot_alignment != 0)
+      throw graph_error("binary snapshot bytes must be 64-byte aligned");
+    std::memcpy(&header_, bytes.data(), sizeof(header_));
+    const snapshot_header& h = header_;
+
+    if (h.magic != snapshot_magic)
+      throw graph_error("not a graph-v3 binary snapshot (bad magic)");
+    if (h.endian_tag != snapshot_endian_tag)
+      throw graph_error("binary snapshot was written with the other byte order");
+    if (h.version != snapshot_version)
+      throw graph_error(std::format("unsupported binary snapshot version {} (expected {})", h.version,
+                                    snapshot_version));
+
+    // Every section lies inside the bytes, so larger counts are corrupt; rejecting them first also
+    // keeps the offsets computed below from wrapping
+    if (h.num_vertices >= bytes.size() / sizeof(EIndex) || h.num_edges > bytes.size() / sizeof(VId) ||
+        h.num_vertex_values > bytes.size() / std::max<std::size_t>(h.vertex_value_size, 1) ||
+        h.num_edges > bytes.size() / std::max<std::size_t>(h.edge_value_size, 1) ||
+        h.num_partition_entries > bytes.size() / sizeof(VId))
+      throw graph_error("binary snapshot section sizes exceed the snapshot");
+
+    const auto expected = detail::make_snapshot_header<EV, VV, VId, EIndex>(h.num_vertices, h.num_edges,
+                                                                           h.num_vertex_values,
+                                                                           h.num_partition_entries);
+    auto check_type = [](const char* what, std::uint8_t size, std::uint8_t kind, std::uint8_t want_size,
+                         std::uint8_t want_kind) {
+      if (size != want_size || kind != want_kind)
+        throw graph_error(std::format("binary snapshot {} type mismatch: stored size {} kind {}, expected size {} "
+                                      "kind {}",
+                                      what, size, kind, want_size, want_kind));
+    };
+    check_type("vertex id", h.vertex_id_size, h.vertex_id_kind, expected.vertex_id_size, expected.vertex_id_kind);
+    check_type("edge index", h.edge_index_size, h.edge_index_kind, expected.edge_index_size,
+               expected.edge_index_kind);
+    check_type("edge value", h.edge_value_size, h.edge_value_kind, expected.edge_value_size,
+               expected.edge_value_kind);
+    check_type("vertex value", h.vertex_value_size, h.vertex_value_kind, expected.vertex_value_size,
+               expected.vertex_value_kind);
+
+    if (h.num_vertex_values != 0 && h.num_vertex_values != h.num_vertices)
+      throw graph_error("binary snapshot has a partial vertex value section");
+    if (h.row_index_offset != expected.row_index_offset || h.col_index_offset != expected.col_index_offset ||
+        h.vertex_values_offset != expected.vertex_values_offset ||
+        h.edge_values_offset != expected.edge_values_offset || h.partition_offset != expected.partition_offset ||
+        h.file_size != expected.file_size)
+      throw graph_error("binary snapshot section table is inconsistent");
+    if (h.file_size > bytes.size())
+      throw graph_error(std::format("binary snapshot truncated: {} of {} bytes", bytes.size(), h.file_size));
+
+    const std::byte* base = bytes.data();
+    n_                    = static_cast<size_type>(h.num_vertices);
+    m_                    = static_cast<size_type>(h.num_edges);
+    num_parts_            = static_cast<size_type>(h.num_partition_entries);
+    rows_                 = reinterpret_cast<const EIndex*>(base + h.row_index_offset);
+    cols_                 = reinterpret_cast<const VId*>(base + h.col_index_offset);
+    vvals_                = reinterpret_cast<const vv_storage*>(base + h.vertex_values_offset);
+    evals_                = reinterpret_cast<const ev_storage*>(base + h.edge_values_offset);
+    parts_                = reinterpret_cast<const VId*>(base + h.partition_offset);
+    if (check == snapshot_check::header_only)
+      return;
+
+    // One linear pass, so that the accessors can index without bounds checks
+    if (rows_[0] != 0 || static_cast<size_type>(rows_[n_]) != m_)
+      throw graph_error("binary snapshot row index does not span the edges");
+    for (size_type u = 0; u < n_; ++u)
+      if (rows_[u] > rows_[u + 1])
+        throw graph_error(std::format("binary snapshot row index decreases at vertex {}", u));
+    for (size_type k = 0; k < m_; ++k)
+      if (std::cmp_less(cols_[k], 0) || std::cmp_greater_equal(cols_[k], n_))
+        throw graph_error(std::format("binary snapshot edge {} has target {} outside [0, {})", k, cols_[k], n_));
+    // compressed_graph terminates its partition table with the row index size, n + 1
+    for (size_type p = 0; p < num_parts_; ++p)
+      if (std::cmp_less(parts_[p], 0) || std::cmp_greater(parts_[p], n_ + 1) || (p > 0 && parts_[p] < parts_[p - 1]))
+        throw graph_error("binary snapshot partition table is not an ascending list of vertex ids");
+  }
+
+public: // CPO customizations
+  friend constexpr auto vertices(const csr_snapshot_view& g) noexcept {
+    return std::ranges::iota_view<std::size_t, std::size_t>(0, g.n_);
+  }
+
+  template <std::integral PId>
+  friend constexpr auto vertices(const csr_snapshot_view& g, const PId& pid) noexcept {
+    using view_type = adj_list::vertex_descriptor_view<adj_list::index_iterator>;
+    if (g.num_parts_ <= 2)
+      return pid == 0 ? view_type(std::size_t{0}, g.n_) : view_type(std::size_t{0}, std::size_t{0});
+    if (pid < 0 || static_cast<std::size_t>(pid) >= g.num_parts_ - 1)
+      return view_type(std::size_t{0}, std::size_t{0});
+    return view_type(static_cast<std::size_t>(g.parts_[static_cast<std::size_t>(pid)]),
+                     static_cast<std::size_t>(g.parts_[static_cast<std::size_t>(pid) + 1]));
+  }
+
+  template <typename VId2>
+  friend constexpr auto find_vertex(const csr_snapshot_view&, const VId2& uid) noexcept {
+    using iterator = typename adj_list::vertex_descriptor_view<adj_list::index_iterator>::iterator;
+    return iterator{static_cast<vertex_id_type>(uid)};
+  }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto vertex_id(const csr_snapshot_view&, const VertexDesc& u) noexcept {
+    return static_cast<vertex_id_type>(u.vertex_id());
+  }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto edges(const csr_snapshot_view& g, const VertexDesc& u) noexcept {
+    using edge_desc_view = adj_list::edge_descriptor_view<const VId*, adj_list::index_iterator>;
+    using vertex_desc    = adj_list::vertex_descriptor<adj_list::index_iterator>;
+    const auto vid       = static_cast<std::size_t>(u.vertex_id());
+    if (vid >= g.n_)
+      return edge_desc_view(g.cols_, g.cols_, vertex_desc(vid));
+    return edge_desc_view(g.cols_ + g.rows_[vid], g.cols_ + g.rows_[vid + 1], vertex_desc(vid));
+  }
+
+  template <adj_list::edge_descriptor_type EdgeDesc>
+  friend constexpr auto target_id(const csr_snapshot_view&, const EdgeDesc& uv) noexcept {
+    return *uv.value();
+  }
+
+  friend constexpr auto num_edges(const csr_snapshot_view& g) noexcept { return g.m_; }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto num_edges(const csr_snapshot_view& g, const VertexDesc& u) noexcept {
+    const auto vid = static_cast<std::size_t>(u.vertex_id());
+    return vid >= g.n_ ? std::size_t{0} : static_cast<std::size_t>(g.rows_[vid + 1] - g.rows_[vid]);
+  }
+
+  friend constexpr bool has_edge(const csr_snapshot_view& g) noexcept { return g.m_ != 0; }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  requires(!std::is_void_v<VV>)
+  friend constexpr decltype(auto) vertex_value(const csr_snapshot_view& g, const VertexDesc& u) noexcept {
+    return g.vertex_value(static_cast<vertex_id_type>(u.vertex_id()));
+  }
+
+  template <adj_list::edge_descriptor_type EdgeDesc>
+  requires(!std::is_void_v<EV>)
+  friend constexpr decltype(auto) edge_value(const csr_snapshot_view& g, const EdgeDesc& uv) noexcept {
+    return g.edge_value(static_cast<edge_id_type>(uv.value() - g.cols_));
+  }
+
+  template <adj_list::vertex_descriptor_type VertexDesc>
+  friend constexpr auto partition_id(const csr_snapshot_view& g, const VertexDesc& u) noexcept -> partition_id_type {
+    if (g.num_parts_ <= 2)
+      return 0;
+    const auto vid = static_cast<VId>(u.vertex_id());
+    auto       it  = std::upper_bound(g.parts_, g.parts_ + g.num_parts_ - 1, vid);
+    return static_cast<partition_id_type>(it - g.parts_ - 1);
+  }
+
+  friend constexpr auto num_partitions(const csr_snapshot_view& g) noexcept -> partition_id_type {
+    return g.num_parts_ == 0 ? partition_id_type{1} : static_cast<partition_id_type>(g.num_parts_ - 1);
+  }
+
+private:
+  std::shared_ptr<const detail::mapped_file> file_; // null for views over caller-owned bytes
+  snapshot_header                            header_{};
+
+  size_type         n_         = 0;
+  size_type         m_         = 0;
+  size_type         num_parts_ = 0;
+  const EIndex*     rows_      = nullptr;
+  const VId*        cols_      = nullptr;
+  const vv_storage* vvals_     = nullptr;
+  const ev_storage* evals_     = nullptr;
+  const VId*        parts_     = nullptr;
+};
+
+/**
+ * @brief Map a binary snapshot file and return a read-only view of it.
+ *
+ * The template arguments must match the graph that was written. By default the whole snapshot
+ * is checked, in O(V + E); snapshot_check::header_only opens it in constant time for files that
+ * are trusted to be valid.
+ *
+ * @code
+ * using G = container::compressed_graph<double, void, void, uint32_t, uint64_t>;
+ * write_binary_snapshot("web.gv3", g);                        // once
+ * auto view = map_binary_snapshot<double, void, uint32_t, uint64_t>("web.gv3"); // at startup
+ * auto fast = map_binary_snapshot<double, void, uint32_t, uint64_t>("web.gv3", snapshot_check::header_only);
+ * dijkstra_shortest_distances(view, 0u, container_value_fn(dist), weight);
+ * @endcode
+ */
+template <class EV = void, class VV = void, std::integral VId = std::uint32_t, std::integral EIndex = std::uint32_t>
+requires detail::snapshot_value<EV> && detail::snapshot_value<VV>
+[[nodiscard]] csr_snapshot_view<EV, VV, VId, EIndex> map_binary_snapshot(const std::filesystem::path& path,
+                                                                         snapshot_check check = snapshot_check::full) {
+  return csr_snapshot_view<EV, VV, VId, EIndex>(path, check);
+}
+
+} // namespace graph::io
@@ -0,0 +1,219 @@
+/**
+ * @file contraction_hierarchy.hpp
+ * @brief Save a contraction_hierarchy to disk and load it back.
+ *
+ * Provides:
+ *   - write_contraction_hierarchy(os, ch)        Write a hierarchy to a binary stream
+ *   - write_contraction_hierarchy(path, ch)      Same, to a file
+ *   - read_contraction_hierarchy<D,VId,EIndex>(path) Map a hierarchy file and load it
+ *
+ * Preprocessing a road network takes seconds to minutes; a saved hierarchy loads at the speed of
+ * a file copy. The format wraps two binary snapshots (see binary_snapshot.hpp):
+ *
+ *   offset 0     ch_file_header (64 bytes)
+ *   rank         VId[num_vertices]              position of each vertex in the contraction order
+ *   upward       binary snapshot of upward()    64-byte aligned
+ *   downward     binary snapshot of downward()  64-byte aligned
+ *
+ * As for snapshots, integers use the writer's byte order, and reading with other template
+ * arguments, another version or the other byte order throws graph_error.
+ */
+
+#pragma once
+
+#include <graph/graph.hpp>
+#include <graph/algorithm/contraction_hierarchy.hpp>
+#include <graph/io/binary_snapshot.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace graph::io {
+
+/// First 8 bytes of every contraction hierarchy file.
+inline constexpr std::array<char, 8> ch_file_magic = {'G', 'V', '3', 'C', 'H', '\0', '\r', '\n'};
+
+/// Current format version; readers reject any other version.
+inline constexpr std::uint32_t ch_file_version = 1;
+
+/// Fixed-size file header (64 bytes).
+struct ch_file_header {
+  std::array<char, 8> magic{};
+  std::uint32_t       version    = 0;
+  std::uint32_t       endian_tag = 0;
+
+  std::uint8_t                distance_size   = 0;
+  std::uint8_t                distance_kind   = 0;
+  std::uint8_t                vertex_id_size  = 0;
+  std::uint8_t                vertex_id_kind  = 0;
+  std::uint8_t                edge_index_size = 0;
+  std::uint8_t                edge_index_kind = 0;
+  std::array<std::uint8_t, 2> reserved{};
+
+  std::uint64_t num_vertices    = 0;
+  std::uint64_t rank_offset     = 0;
+  std::uint64_t upward_offset   = 0;
+  std::uint64_t downward_offset = 0;
+  std::uint64_t file_size       = 0;
+};
+static_assert(sizeof(ch_file_header) == 64 && std::is_trivially_copyable_v<ch_file_header>);
+
+namespace detail {
+
+  /// Header for a hierarchy of n vertices whose snapshots take up and down bytes.
+  template <class Distance, class VId, class EIndex>
+  ch_file_header make_ch_file_header(std::uint64_t n, std::uint64_t up, std::uint64_t down) {
+    ch_file_header h;
+    h.magic           = ch_file_magic;
+    h.version         = ch_file_version;
+    h.endian_tag      = snapshot_endian_tag;
+    h.distance_size   = snapshot_size_of<Distance>();
+    h.distance_kind   = static_cast<std::uint8_t>(snapshot_kind_of<Distance>());
+    h.vertex_id_size  = snapshot_size_of<VId>();
+    h.vertex_id_kind  = static_cast<std::uint8_t>(snapshot_kind_of<VId>());
+    h.edge_index_size = snapshot_size_of<EIndex>();
+    h.edge_index_kind = static_cast<std::uint8_t>(snapshot_kind_of<EIndex>());
+    h.num_vertices    = n;
+    h.rank_offset     = sizeof(ch_file_header);
+    h.upward_offset   = align_up(h.rank_offset + n * sizeof(VId));
+    h.downward_offset = align_up(h.upward_offset + up);
+    h.file_size       = h.downward_offset + down;
+    return h;
+  }
+
+  /// Copies a snapshot view into an owning compressed_graph.
+  template <class EV, class VId, class EIndex>
+  container::compressed_graph<EV, void, void, VId, EIndex>
+  copy_snapshot(const csr_snapshot_view<EV, void, VId, EIndex>& view) {
+    container::compressed_graph<EV, void, void, VId, EIndex> g;
+    g.load_row_stream(
+          1,
+          [&view](std::size_t, auto&& next_row, auto&& emit) {
+            for (VId u : view.vertex_ids()) {
+              next_row();
+              for (auto eid : view.edge_ids(u))
+                emit(copyable_edge_t<VId, EV>{u, view.target_id(eid), view.edge_value(eid)});
+            }
+          },
+          view.size());
+    return g;
+  }
+
+} // namespace detail
+
+/**
+ * @brief Write a contraction hierarchy to a binary stream.
+ *
+ * The stream must be opened in binary mode; check its state afterwards as with the other
+ * writers.
+ */
+template <class Distance, std::integral VId, std::integral EIndex>
+requires detail::snapshot_value<ch_edge<Distance, VId>>
+void write_contraction_hierarchy(std::ostream& os, const contraction_hierarchy<Distance, VId, EIndex>& ch) {
+  const auto h = detail::make_ch_file_header<Distance, VId, EIndex>(
+        ch.num_vertices(), binary_snapshot_size(ch.upward()), binary_snapshot_size(ch.downward()));
+
+  std::uint64_t pos = 0;
+  os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+  pos += sizeof(h);
+  detail::write_section(os, pos, h.rank_offset, ch.rank());
+  detail::write_padding(os, pos, h.upward_offset);
+  write_binary_snapshot(os, ch.upward());
+  pos = h.upward_offset + binary_snapshot_size(ch.upward());
+  detail::write_padding(os, pos, h.downward_offset);
+  write_binary_snapshot(os, ch.downward());
+}
+
+/**
+ * @brief Write a contraction hierarchy to a file.
+ *
+ * @throws graph_error if the file cannot be created or written.
+ */
+template <class Distance, std::integral VId, std::integral EIndex>
+requires detail::snapshot_value<ch_edge<Distance, VId>>
+void write_contraction_hierarchy(const std::filesystem::path&                        path,
+                                 const contraction_hierarchy<Distance, VId, EIndex>& ch) {
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  if (!os)
+    throw graph_error(std::format("cannot create contraction hierarchy file {}", path.string()));
+  write_contraction_hierarchy(os, ch);
+  os.flush();
+  if (!os)
+    throw graph_error(std::format("error writing contraction hierarchy file {}", path.string()));
+}
+
+/**
+ * @brief Load a contraction hierarchy written by write_contraction_hierarchy.
+ *
+ * The template arguments must match the hierarchy that was written.
+ *
+ * @code
+ * write_contraction_hierarchy("ny.gv3ch", ch);                              // once
+ * auto ch = read_contraction_hierarchy<int64_t, uint32_t, uint32_t>("ny.gv3ch"); // at startup
+ * @endcode
+ *
+ * @throws std::system_error if the file cannot be opened or mapped.
+ * @throws graph_error if the file is not a valid hierarchy for these template arguments.
+ */
+template <class Distance, std::integral VId = std::uint32_t, std::integral EIndex = std::uint32_t>
+requires detail::snapshot_value<ch_edge<Distance, VId>>
+[[nodiscard]] contraction_hierarchy<Distance, VId, EIndex>
+read_contraction_hierarchy(const std::filesystem::path& path) {
+  using edge_value_type = ch_edge<Distance, VId>;
+
+  const detail::mapped_file        file(path);
+  const std::span<const std::byte> bytes = file.bytes();
+  if (bytes.size() < sizeof(ch_file_header))
+    throw graph_error(std::format("contraction hierarchy file too small: {} bytes", bytes.size()));
+  ch_file_header h;
+  std::memcpy(&h, bytes.data(), sizeof(h));
+
+  if (h.magic != ch_file_magic)
+    throw graph_error("not a graph-v3 contraction hierarchy file (bad magic)");
+  if (h.endian_tag != snapshot_endian_tag)
+    throw graph_error("contraction hierarchy file was written with the other byte order");
+  if (h.version != ch_file_version)
+    throw graph_error(std::format("unsupported contraction hierarchy version {} (expected {})", h.version,
+                                  ch_file_version));
+
+  // The rank section lies inside the file; a larger count is corrupt and would wrap the offsets
+  if (h.num_vertices > (bytes.size() - sizeof(ch_file_header)) / sizeof(VId))
+    throw graph_error(std::format("contraction hierarchy vertex count {} exceeds the file", h.num_vertices));
+
+  const auto expected = detail::make_ch_file_header<Distance, VId, EIndex>(
+        h.num_vertices, h.downward_offset - h.upward_offset, h.file_size - h.downward_offset);
+  if (h.distance_size != expected.distance_size || h.distance_kind != expected.distance_kind ||
+      h.vertex_id_size != expected.vertex_id_size || h.vertex_id_kind != expected.vertex_id_kind ||
+      h.edge_index_size != expected.edge_index_size || h.edge_index_kind != expected.edge_index_kind)
+    throw graph_error("contraction hierarchy type mismatch");
+  if (h.rank_offset != expected.rank_offset || h.upward_offset != expected.upward_offset ||
+      h.downward_offset < h.upward_offset || h.file_size < h.downward_offset)
+    throw graph_error("contraction hierarchy section table is inconsistent");
+  if (h.file_size > bytes.size())
+    throw graph_error(std::format("contraction hierarchy file truncated: {} of {} bytes", bytes.size(), h.file_size));
+
+  // The snapshot views validate their row offsets and target ids; the hierarchy's constructor
+  // checks the vertex counts, the ranks and the shortcut middles
+  const auto* rank_first = reinterpret_cast<const VId*>(bytes.data() + h.rank_offset);
+  const csr_snapshot_view<edge_value_type, void, VId, EIndex> up(
+        bytes.subspan(h.upward_offset, h.downward_offset - h.upward_offset));
+  const csr_snapshot_view<edge_value_type, void, VId, EIndex> down(
+        bytes.subspan(h.downward_offset, h.file_size - h.downward_offset));
+
+  return contraction_hierarchy<Distance, VId, EIndex>(
+        detail::copy_snapshot(up), detail::copy_snapshot(down),
+        std::vector<VId>(rank_first, rank_first + h.num_vertices));
+}
+
+} // namespace graph::io
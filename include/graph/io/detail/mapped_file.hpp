@@ -0,0 +1,116 @@
+/**
+ * @file detail/mapped_file.hpp
+ * @brief Read-only memory mapping of a whole file, shared by the readers of graph I/O headers.
+ *
+ * NOTE: Uses mmap (POSIX) or MapViewOfFile (Windows).
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace graph::io::detail {
+
+/// Read-only memory mapping of a whole file.
+class mapped_file {
+public:
+  explicit mapped_file(const std::filesystem::path& path) {
+#if defined(_WIN32)
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(),
+                              std::format("cannot open {}", path.string()));
+    LARGE_INTEGER file_size{};
+    if (!::GetFileSizeEx(file, &file_size)) {
+      const auto err = ::GetLastError();
+      ::CloseHandle(file);
+      throw std::system_error(static_cast<int>(err), std::system_category(),
+                              std::format("cannot stat {}", path.string()));
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    if (size_ > 0) {
+      HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping != nullptr) {
+        data_ = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        ::CloseHandle(mapping); // the view keeps the mapping alive
+      }
+      if (data_ == nullptr) {
+        const auto err = ::GetLastError();
+        ::CloseHandle(file);
+        throw std::system_error(static_cast<int>(err), std::system_category(),
+                                std::format("cannot map {}", path.string()));
+      }
+    }
+    ::CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      throw std::system_error(errno, std::generic_category(), std::format("cannot open {}", path.string()));
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+      const int err = errno;
+      ::close(fd);
+      throw std::system_error(err, std::generic_category(), std::format("cannot stat {}", path.string()));
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0) {
+      void* p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+      if (p == MAP_FAILED) {
+        const int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), std::format("cannot map {}", path.string()));
+      }
+      data_ = p;
+    }
+    ::close(fd); // the mapping stays valid
+#endif
+  }
+
+  mapped_file(const mapped_file&)            = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  ~mapped_file() {
+    if (data_ == nullptr)
+      return;
+#if defined(_WIN32)
+    ::UnmapViewOfFile(data_);
+#else
+    ::munmap(data_, size_);
+#endif
+  }
+
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+    return {static_cast<const std::byte*>(data_), size_};
+  }
+
+  /// The file contents as characters, for the text readers.
+  [[nodiscard]] std::string_view text() const noexcept { return {static_cast<const char*>(data_), size_}; }
+
+private:
+  void*       data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+} // namespace graph::io::detail
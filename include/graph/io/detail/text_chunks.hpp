@@ -0,0 +1,193 @@
+/**
+ * @file detail/text_chunks.hpp
+ * @brief Line-aligned chunking and stream-compatible field extraction for the parallel text readers.
+ *
+ * The readers of dimacs.hpp, metis.hpp and adjacency_list_text.hpp that take a std::string_view
+ * split the text into chunks of whole lines (line_chunks) and parse the chunks on a thread_pool.
+ * Each line is read with a text_cursor, which extracts fields from the characters in place with
+ * std::from_chars and follows the rules of std::istringstream >> so that both readers agree on
+ * every input: fields are separated by " \t\n\v\f\r", an extraction that fails leaves the cursor
+ * failed and every later one fails too, and integers keep the stream's handling of signs and
+ * overflow.
+ */
+
+#pragma once
+
+#include <graph/detail/thread_pool.hpp>
+#include <graph/graph_data.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace graph::io::detail {
+
+/// Whitespace skipped by formatted stream extraction in the "C" locale.
+[[nodiscard]] constexpr bool is_text_space(char c) noexcept { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+/// Reads the fields of one line as std::istringstream >> would, without copying the line.
+class text_cursor {
+public:
+  explicit constexpr text_cursor(std::string_view line) noexcept
+        : pos_(line.data()), last_(line.data() + line.size()) {}
+
+  /// False once an extraction has failed.
+  [[nodiscard]] constexpr bool good() const noexcept { return !failed_; }
+
+  /// True if only blanks remain. Does not fail the cursor.
+  [[nodiscard]] bool at_end() noexcept {
+    while (pos_ != last_ && is_text_space(*pos_))
+      ++pos_;
+    return pos_ == last_;
+  }
+
+  /// `>> c`: the next non-blank character.
+  bool get(char& c) noexcept {
+    if (!skip_blanks())
+      return false;
+    c = *pos_++;
+    return true;
+  }
+
+  /// `>> s` for std::string: the next blank-delimited token. The view points into the line.
+  bool get(std::string_view& s) noexcept {
+    if (!skip_blanks())
+      return false;
+    const char* first = pos_;
+    while (pos_ != last_ && !is_text_space(*pos_))
+      ++pos_;
+    s = std::string_view(first, static_cast<size_t>(pos_ - first));
+    return true;
+  }
+
+  bool get(std::string& s) {
+    std::string_view token;
+    if (!get(token))
+      return false;
+    s.assign(token);
+    return true;
+  }
+
+  /// `>> x` for an integer: an optional sign and decimal digits. With no digits x is 0, and out
+  /// of range x is clamped; both fail. As for streams, a '-' negates unsigned values modulo 2^N.
+  template <std::integral T>
+  requires(!std::same_as<T, bool> && !std::same_as<T, char>)
+  bool get(T& x) noexcept {
+    using U = std::make_unsigned_t<T>;
+    if (!skip_blanks())
+      return false;
+    const bool negative = *pos_ == '-';
+    if (negative || *pos_ == '+')
+      ++pos_;
+    U magnitude = 0;
+    const auto [ptr, ec] = std::from_chars(pos_, last_, magnitude);
+    if (ec == std::errc::invalid_argument) {
+      x       = 0;
+      failed_ = true;
+      return false;
+    }
+    pos_ = ptr;
+    if constexpr (std::is_signed_v<T>) {
+      const U limit = negative ? U(std::numeric_limits<T>::max()) + 1 : U(std::numeric_limits<T>::max());
+      if (ec == std::errc::result_out_of_range || magnitude > limit) {
+        x       = negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        failed_ = true;
+        return false;
+      }
+      x = negative ? static_cast<T>(U(0) - magnitude) : static_cast<T>(magnitude);
+    } else {
+      if (ec == std::errc::result_out_of_range) {
+        x       = std::numeric_limits<T>::max();
+        failed_ = true;
+        return false;
+      }
+      x = negative ? static_cast<T>(U(0) - magnitude) : magnitude;
+    }
+    return true;
+  }
+
+private:
+  bool skip_blanks() noexcept {
+    if (failed_)
+      return false;
+    while (pos_ != last_ && is_text_space(*pos_))
+      ++pos_;
+    if (pos_ == last_) {
+      failed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  const char* pos_;
+  const char* last_;
+  bool        failed_ = false;
+};
+
+/// A 1-based vertex id of a file as a 0-based VId, for the loaders into compressed_graph.
+template <std::integral VId>
+[[nodiscard]] VId one_based_vertex_id(std::uint64_t id, std::string_view line) {
+  if (id == 0 || id - 1 > static_cast<std::uint64_t>(std::numeric_limits<VId>::max()))
+    throw graph_error(std::format("vertex id {} out of range in line '{}'", id, line));
+  return static_cast<VId>(id - 1);
+}
+
+/// An edge value written in a file, for the loaders into compressed_graph.
+template <class T>
+[[nodiscard]] T parse_edge_value(std::string_view token, std::string_view line) {
+  T          value{};
+  const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+  if (ec != std::errc{} || ptr != token.data() + token.size())
+    throw graph_error(std::format("invalid edge value '{}' in line '{}'", token, line));
+  return value;
+}
+
+/// Chunks small enough to balance the workers, but not smaller than this many bytes.
+inline constexpr size_t min_text_chunk = size_t{1} << 16;
+
+/**
+ * @brief Offsets splitting text into at most `parts` chunks of whole lines.
+ *
+ * The result starts with 0 and ends with text.size(); every other offset follows a '\n'. Chunks
+ * may be empty when a line is longer than a chunk.
+ */
+[[nodiscard]] inline std::vector<size_t> line_chunks(std::string_view text, size_t parts) {
+  parts = std::max<size_t>(1, std::min(parts, text.size() / min_text_chunk));
+  std::vector<size_t> offsets(parts + 1, text.size());
+  offsets[0] = 0;
+  for (size_t k = 1; k < parts; ++k) {
+    const size_t nl = text.find('\n', std::max(offsets[k - 1], k * (text.size() / parts)));
+    offsets[k]      = nl == std::string_view::npos ? text.size() : nl + 1;
+  }
+  return offsets;
+}
+
+/// Chunks of text for a pool: several per worker, so that dense regions of the file balance out.
+[[nodiscard]] inline std::vector<size_t> line_chunks(std::string_view text, const thread_pool& pool) {
+  return line_chunks(text, pool.size() * 8);
+}
+
+/// Calls fn(line) for every line of text[first, last), as std::getline would split them: '\n'
+/// ends a line and is not part of it, and a last line without '\n' is still a line.
+template <class F>
+void for_each_line(std::string_view text, size_t first, size_t last, F&& fn) {
+  const char* p   = text.data() + first;
+  const char* end = text.data() + last;
+  while (p != end) {
+    const void* nl       = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    const char* line_end = nl ? static_cast<const char*>(nl) : end;
+    fn(std::string_view(p, static_cast<size_t>(line_end - p)));
+    p = nl ? line_end + 1 : end;
+  }
+}
+
+} // namespace graph::io::detail
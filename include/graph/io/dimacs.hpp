@@ -6,6 +6,10 @@
  *   - write_dimacs(os, g, problem = "sp")          Generic DIMACS arc list
  *   - write_dimacs_max_flow(os, g, src, snk, capfn) DIMACS max-flow problem
  *   - read_dimacs(is)                               Parse DIMACS into dimacs_graph
+ *   - read_dimacs(text, pool)                       Parse DIMACS text in parallel
+ *   - read_dimacs_file(path, pool)                  Map a DIMACS file and parse it in parallel
+ *   - load_dimacs(g, text, options, pool)           Parse DIMACS arcs straight into a compressed_graph
+ *   - load_dimacs_file(g, path, options, pool)      Map a DIMACS file and load its arcs into g
  *
  * The DIMACS family of formats is line oriented; each line begins with a
  * single character describing its kind:
@@ -20,6 +24,11 @@
  * to 0-indexed ids in the returned structure so they can be used directly
  * with graph-v3 containers.
  *
+ * The text and file readers split the text into chunks of whole lines and parse them on a
+ * thread_pool, extracting fields in place with std::from_chars. They return the same
+ * dimacs_graph as the stream reader. The loaders build a compressed_graph from the
+ * arcs without a dimacs_graph or an edge list in between.
+ *
  * Reference (max-flow): ftp://dimacs.rutgers.edu/pub/netflow/general-info/
  *
  * NOTE: Self-contained — no external dependencies.
@@ -28,15 +37,20 @@
 #pragma once
 
 #include <graph/graph.hpp>
+#include <graph/container/compressed_graph.hpp>
 #include <graph/io/detail/common.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+#include <graph/io/detail/text_chunks.hpp>
 
 #include <cstdint>
+#include <filesystem>
 #include <format>
 #include <istream>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace graph::io {
@@ -211,4 +225,195 @@ inline dimacs_graph read_dimacs(std::istream& is) {
   return result;
 }
 
+/**
+ * @brief Parse DIMACS text in parallel.
+ *
+ * Gives the same result as read_dimacs(std::istream&) on the same characters. The text is split
+ * into chunks of whole lines. A first parallel pass counts the node and arc lines of each chunk,
+ * and a second one parses every line into its final slot, so nodes and edges keep file order.
+ * `p` lines are applied in file order after the parallel passes.
+ *
+ * @param text DIMACS text, e.g. a mapped file. Only read during the call.
+ * @param pool Thread pool for both passes. Default: default_thread_pool().
+ * @return Parsed dimacs_graph.
+ */
+inline dimacs_graph read_dimacs(std::string_view text, thread_pool& pool = default_thread_pool()) {
+  dimacs_graph result;
+  const auto   chunks  = detail::line_chunks(text, pool);
+  const size_t nchunks = chunks.size() - 1;
+
+  // Pass 1: node and arc lines per chunk, and the problem lines
+  std::vector<size_t>                        node_start(nchunks + 1, 0);
+  std::vector<size_t>                        edge_start(nchunks + 1, 0);
+  std::vector<std::vector<std::string_view>> problems(nchunks);
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          detail::for_each_line(text, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            detail::text_cursor ls(line);
+            char                kind = 0;
+            if (!ls.get(kind))
+              return;
+            if (kind == 'p')
+              problems[c].push_back(line);
+            else if (kind == 'n')
+              ++node_start[c + 1];
+            else if (kind == 'a' || kind == 'e')
+              ++edge_start[c + 1];
+          });
+        },
+        1);
+  for (size_t c = 0; c < nchunks; ++c) {
+    node_start[c + 1] += node_start[c];
+    edge_start[c + 1] += edge_start[c];
+  }
+  result.nodes.resize(node_start[nchunks]);
+  result.edges.resize(edge_start[nchunks]);
+
+  // Pass 2: every node and arc line into its slot
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          size_t i = node_start[c];
+          size_t j = edge_start[c];
+          detail::for_each_line(text, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            detail::text_cursor ls(line);
+            char                kind = 0;
+            if (!ls.get(kind))
+              return;
+            if (kind == 'n') {
+              std::uint64_t id   = 0;
+              dimacs_node&  node = result.nodes[i++];
+              ls.get(id);
+              ls.get(node.designation);
+              node.id = id > 0 ? id - 1 : 0;
+            } else if (kind == 'a' || kind == 'e') {
+              std::uint64_t u = 0, v = 0;
+              dimacs_edge&  e = result.edges[j++];
+              ls.get(u);
+              ls.get(v);
+              ls.get(e.weight); // optional; empty if absent
+              e.source = u > 0 ? u - 1 : 0;
+              e.target = v > 0 ? v - 1 : 0;
+            }
+          });
+        },
+        1);
+
+  for (const auto& lines : problems) {
+    for (std::string_view line : lines) {
+      detail::text_cursor ls(line);
+      char                kind = 0;
+      ls.get(kind);
+      ls.get(result.problem);
+      ls.get(result.num_vertices);
+      ls.get(result.num_arcs);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Map a DIMACS file and parse it in parallel. See read_dimacs(std::string_view, thread_pool&).
+ *
+ * @throws std::system_error if the file cannot be opened or mapped.
+ */
+inline dimacs_graph read_dimacs_file(const std::filesystem::path& path, thread_pool& pool = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  return read_dimacs(file.text(), pool);
+}
+
+// ---------------------------------------------------------------------------
+// load_dimacs — arcs straight into compressed_graph
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Load the arcs of DIMACS text into an empty compressed_graph, in parallel.
+ *
+ * Every `a` and `e` line becomes an edge between its two vertices, converted to 0-indexed ids.
+ * When EV is not void, the third field is parsed with std::from_chars as the edge value, which
+ * is value-initialized if the field is absent. The graph has the vertex count of the `p` line,
+ * or more if an arc references a larger id. Other line kinds are ignored.
+ *
+ * No dimacs_graph or edge list is built: the text is parsed twice, chunk by chunk, through
+ * compressed_graph::load_edge_stream, once to count the arcs of every vertex and once to write
+ * them in place. Rows keep file order unless @c options sorts them. Besides the graph, the build
+ * keeps one degree histogram per chunk. The `p` line limits the number of chunks to the arcs per
+ * vertex, and without it there is one chunk per worker.
+ *
+ * @param g       Empty graph to load.
+ * @param text    DIMACS text, e.g. a mapped file. Only read during the call.
+ * @param options Row sorting and duplicate removal, as for load_unsorted_edges.
+ * @param pool    Thread pool for both passes. Default: default_thread_pool().
+ *
+ * @throws graph_error if an arc line lacks two vertex ids in [1, max VId + 1], if an edge value
+ *         does not parse, or if the arcs do not fit in EIndex. The graph is then left empty.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_dimacs(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                 std::string_view                                                          text,
+                 const container::csr_build_options&                                       options = {},
+                 thread_pool&                                                              pool    = default_thread_pool()) {
+  // The p line, before any other descriptor
+  std::uint64_t n = 0, m = 0;
+  for (size_t pos = 0; pos < text.size();) {
+    const size_t           nl   = text.find('\n', pos);
+    const std::string_view line = text.substr(pos, (nl == std::string_view::npos ? text.size() : nl) - pos);
+    pos                         = nl == std::string_view::npos ? text.size() : nl + 1;
+    detail::text_cursor ls(line);
+    char                kind = 0;
+    if (!ls.get(kind) || kind == 'c')
+      continue;
+    if (kind == 'p') {
+      std::string_view problem;
+      ls.get(problem);
+      ls.get(n);
+      ls.get(m);
+    }
+    break;
+  }
+
+  const size_t parts  = n > 0 && m > 0 ? std::clamp<size_t>(static_cast<size_t>(m / n), 1, pool.size()) : pool.size();
+  const auto   chunks = detail::line_chunks(text, parts);
+  g.load_edge_stream(
+        chunks.size() - 1,
+        [&](size_t c, auto&& emit) {
+          detail::for_each_line(text, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            detail::text_cursor ls(line);
+            char                kind = 0;
+            if (!ls.get(kind) || (kind != 'a' && kind != 'e'))
+              return;
+            std::uint64_t u = 0, v = 0;
+            if (!ls.get(u) || !ls.get(v))
+              throw graph_error(std::format("invalid DIMACS arc line '{}'", line));
+            copyable_edge_t<VId, EV> uv{};
+            uv.source_id = detail::one_based_vertex_id<VId>(u, line);
+            uv.target_id = detail::one_based_vertex_id<VId>(v, line);
+            if constexpr (!std::is_void_v<EV>) {
+              std::string_view value;
+              if (ls.get(value))
+                uv.value = detail::parse_edge_value<EV>(value, line);
+            }
+            emit(uv);
+          });
+        },
+        static_cast<size_t>(n), options, pool);
+}
+
+/**
+ * @brief Map a DIMACS file and load its arcs into an empty compressed_graph. See load_dimacs.
+ *
+ * @throws std::system_error if the file cannot be opened or mapped, and graph_error as load_dimacs.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_dimacs_file(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                      const std::filesystem::path&                                              path,
+                      const container::csr_build_options&                                       options = {},
+                      thread_pool&                                                              pool    = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  load_dimacs(g, file.text(), options, pool);
+}
+
 } // namespace graph::io
@@ -0,0 +1,151 @@
+/**
+ * @file edge_list.hpp
+ * @brief Plain edge-list text loaded straight into a compressed_graph.
+ *
+ * Provides:
+ *   - load_edge_list(g, text, vertex_count, options, pool)       Parse edge-list text into g
+ *   - load_edge_list_file(g, path, vertex_count, options, pool)  Map an edge-list file and load it
+ *
+ * The format is the whitespace-separated edge list of SNAP and most graph collections, one edge
+ * per line, with 0-indexed vertex ids and an optional value:
+ *
+ *   # comment line (also %)
+ *   <source> <target> [<value>]
+ *
+ * The loader parses the text in chunks of whole lines on a thread_pool, through
+ * compressed_graph::load_edge_stream, so no edge list is held in memory besides the graph.
+ *
+ * NOTE: Self-contained — no external dependencies.
+ */
+
+#pragma once
+
+#include <graph/graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+#include <graph/io/detail/text_chunks.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <numeric>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace graph::io {
+
+namespace detail {
+  /// An edge-list line that is neither blank nor a comment.
+  [[nodiscard]] inline bool is_edge_list_data_line(std::string_view line) noexcept {
+    const auto first = line.find_first_not_of(" \t\v\f\r");
+    return first != std::string_view::npos && line[first] != '#' && line[first] != '%';
+  }
+
+  /// A 0-indexed vertex id of an edge-list line.
+  template <std::integral VId>
+  [[nodiscard]] VId edge_list_vertex_id(text_cursor& ls, std::string_view line) {
+    std::uint64_t id = 0;
+    if (!ls.get(id))
+      throw graph_error(std::format("invalid edge list line '{}'", line));
+    if (id > static_cast<std::uint64_t>(std::numeric_limits<VId>::max()))
+      throw graph_error(std::format("vertex id {} out of range in line '{}'", id, line));
+    return static_cast<VId>(id);
+  }
+} // namespace detail
+
+/**
+ * @brief Load edge-list text into an empty compressed_graph, in parallel.
+ *
+ * Every data line becomes an edge from its first to its second vertex id. When EV is not void, a
+ * third field is parsed with std::from_chars as the edge value, which is value-initialized if the
+ * field is absent. Further fields are ignored. Rows keep file order unless @c options sorts them.
+ *
+ * The text is parsed in chunks of whole lines. A first pass counts the edges and, when
+ * @c vertex_count is 0, finds the largest vertex id. The edges are then parsed twice through
+ * compressed_graph::load_edge_stream, once to count the edges of every vertex and once to write
+ * them in place. Besides the graph, the build keeps one degree histogram per chunk, with no more
+ * chunks than edges per vertex.
+ *
+ * @param g            Empty graph to load.
+ * @param text         Edge-list text, e.g. a mapped file. Only read during the call.
+ * @param vertex_count The number of vertices, or 0 for the largest vertex id + 1. A smaller count
+ *                     than the ids need is raised.
+ * @param options      Row sorting and duplicate removal, as for load_unsorted_edges.
+ * @param pool         Thread pool for the passes. Default: default_thread_pool().
+ *
+ * @throws graph_error if a line lacks two vertex ids in [0, max VId], an edge value does not
+ *         parse, or the edges do not fit in EIndex. The graph is then left empty.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_edge_list(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                    std::string_view                                                          text,
+                    size_t                                                                    vertex_count = 0,
+                    const container::csr_build_options&                                       options      = {},
+                    thread_pool& pool = default_thread_pool()) {
+  // Edges and vertices, to bound the number of histograms
+  const auto          scan_chunks = detail::line_chunks(text, pool);
+  const size_t        nscan       = scan_chunks.size() - 1;
+  std::vector<size_t> chunk_edges(nscan, 0), chunk_vertices(nscan, 0);
+  pool.for_each_index(
+        nscan,
+        [&](size_t c, size_t) {
+          detail::for_each_line(text, scan_chunks[c], scan_chunks[c + 1], [&](std::string_view line) {
+            if (!detail::is_edge_list_data_line(line))
+              return;
+            ++chunk_edges[c];
+            if (vertex_count == 0) {
+              detail::text_cursor ls(line);
+              const VId           u = detail::edge_list_vertex_id<VId>(ls, line);
+              const VId           v = detail::edge_list_vertex_id<VId>(ls, line);
+              chunk_vertices[c]     = std::max(chunk_vertices[c], static_cast<size_t>(std::max(u, v)) + 1);
+            }
+          });
+        },
+        1);
+  const size_t m = std::reduce(chunk_edges.begin(), chunk_edges.end(), size_t{0});
+  const size_t n = std::max(vertex_count, std::ranges::max(chunk_vertices));
+  const size_t parts  = n > 0 ? std::clamp<size_t>(m / n, 1, pool.size()) : 1;
+  const auto   chunks = parts == nscan ? scan_chunks : detail::line_chunks(text, parts);
+
+  g.load_edge_stream(
+        chunks.size() - 1,
+        [&](size_t c, auto&& emit) {
+          detail::for_each_line(text, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            if (!detail::is_edge_list_data_line(line))
+              return;
+            detail::text_cursor      ls(line);
+            copyable_edge_t<VId, EV> uv{};
+            uv.source_id = detail::edge_list_vertex_id<VId>(ls, line);
+            uv.target_id = detail::edge_list_vertex_id<VId>(ls, line);
+            if constexpr (!std::is_void_v<EV>) {
+              std::string_view value;
+              if (ls.get(value))
+                uv.value = detail::parse_edge_value<EV>(value, line);
+            }
+            emit(uv);
+          });
+        },
+        n, options, pool);
+}
+
+/**
+ * @brief Map an edge-list file and load it into an empty compressed_graph. See load_edge_list.
+ *
+ * @throws std::system_error if the file cannot be opened or mapped, and graph_error as load_edge_list.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_edge_list_file(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                         const std::filesystem::path&                                              path,
+                         size_t                                                                    vertex_count = 0,
+                         const container::csr_build_options&                                       options      = {},
+                         thread_pool& pool = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  load_edge_list(g, file.text(), vertex_count, options, pool);
+}
+
+} // namespace graph::io
@@ -5,6 +5,10 @@
  * Provides:
  *   - write_metis(os, g)        Emit a graph in METIS adjacency format
  *   - read_metis(is)            Parse a METIS file into metis_graph
+ *   - read_metis(text, pool)    Parse METIS text in parallel
+ *   - read_metis_file(path, pool) Map a METIS file and parse it in parallel
+ *   - load_metis(g, text, options, pool)      Parse METIS straight into a compressed_graph
+ *   - load_metis_file(g, path, options, pool) Map a METIS file and load it into g
  *
  * The METIS graph format describes an *undirected* graph:
  *
@@ -22,7 +26,9 @@
  * The writer treats the input graph as undirected: each edge (u,v) contributes
  * v to u's list and u to v's list, deduplicated, so the output is symmetric.
  * The reader normalizes neighbour ids from the file's 1-indexed convention to
- * 0-indexed ids.
+ * 0-indexed ids. The text and file readers parse chunks of whole lines on a
+ * thread_pool with std::from_chars, and return the same metis_graph as the
+ * stream reader.
  *
  * Reference: METIS manual, "Graph Input File" section.
  *
@@ -32,15 +38,21 @@
 #pragma once
 
 #include <graph/graph.hpp>
+#include <graph/container/compressed_graph.hpp>
 #include <graph/io/detail/common.hpp>
+#include <graph/io/detail/mapped_file.hpp>
+#include <graph/io/detail/text_chunks.hpp>
 
 #include <cstdint>
+#include <filesystem>
 #include <format>
 #include <istream>
 #include <ostream>
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -211,4 +223,230 @@ inline metis_graph read_metis(std::istream& is) {
   return result;
 }
 
+namespace detail {
+  /// A METIS line that is neither blank nor a comment.
+  [[nodiscard]] inline bool is_metis_data_line(std::string_view line) noexcept {
+    const auto first = line.find_first_not_of(" \t\r");
+    return first != std::string_view::npos && line[first] != '%';
+  }
+
+  /// Reads the header, the first data line, into result. Returns the offset of the line after it,
+  /// or npos if there is no data line.
+  inline size_t read_metis_header(std::string_view text, metis_graph& result) {
+    for (size_t pos = 0; pos < text.size();) {
+      const size_t           nl   = text.find('\n', pos);
+      const std::string_view line = text.substr(pos, (nl == std::string_view::npos ? text.size() : nl) - pos);
+      pos                         = nl == std::string_view::npos ? text.size() : nl + 1;
+      if (!is_metis_data_line(line))
+        continue;
+      text_cursor hs(line);
+      hs.get(result.num_vertices);
+      hs.get(result.num_edges);
+      hs.get(result.fmt);  // optional
+      hs.get(result.ncon); // optional
+      return pos;
+    }
+    return std::string_view::npos;
+  }
+
+  /// The vertex of the first data line of each chunk after the header.
+  inline std::vector<std::uint64_t>
+  metis_first_vertices(std::string_view rest, const std::vector<size_t>& chunks, thread_pool& pool) {
+    const size_t               nchunks = chunks.size() - 1;
+    std::vector<std::uint64_t> first_vertex(nchunks + 1, 0);
+    pool.for_each_index(
+          nchunks,
+          [&](size_t c, size_t) {
+            for_each_line(rest, chunks[c], chunks[c + 1],
+                          [&](std::string_view line) { first_vertex[c + 1] += is_metis_data_line(line); });
+          },
+          1);
+    for (size_t c = 0; c < nchunks; ++c)
+      first_vertex[c + 1] += first_vertex[c];
+    return first_vertex;
+  }
+} // namespace detail
+
+/**
+ * @brief Parse METIS text in parallel.
+ *
+ * Gives the same result as read_metis(std::istream&) on the same characters. After the header,
+ * the text is split into chunks of whole lines; a first parallel pass counts the data lines of
+ * each chunk, which numbers the vertex of every line, and a second one parses each line into its
+ * vertex's adjacency.
+ *
+ * @param text METIS text, e.g. a mapped file. Only read during the call.
+ * @param pool Thread pool for both passes. Default: default_thread_pool().
+ * @return Parsed metis_graph.
+ */
+inline metis_graph read_metis(std::string_view text, thread_pool& pool = default_thread_pool()) {
+  metis_graph result;
+
+  // Header line.
+  const size_t body = detail::read_metis_header(text, result);
+  if (body == std::string_view::npos)
+    return result;
+
+  const bool has_vertex_sizes  = (result.fmt / 100) % 10 != 0;
+  const bool has_vertex_weight = (result.fmt / 10) % 10 != 0;
+  const bool has_edge_weight   = (result.fmt % 10) != 0;
+  const int  ncon              = result.ncon > 0 ? result.ncon : (has_vertex_weight ? 1 : 0);
+
+  result.adjacency.resize(result.num_vertices);
+  result.vertex_weights.resize(result.num_vertices);
+
+  const std::string_view rest    = text.substr(body);
+  const auto             chunks  = detail::line_chunks(rest, pool);
+  const size_t           nchunks = chunks.size() - 1;
+
+  // Pass 1: data lines per chunk, giving the vertex of the first line of each chunk
+  const auto first_vertex = detail::metis_first_vertices(rest, chunks, pool);
+
+  // Pass 2: each data line into its vertex; lines past the declared vertex count are ignored
+  pool.for_each_index(
+        nchunks,
+        [&](size_t c, size_t) {
+          std::uint64_t i = first_vertex[c];
+          if (i >= result.num_vertices)
+            return;
+          detail::for_each_line(rest, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            if (i >= result.num_vertices || !detail::is_metis_data_line(line))
+              return;
+            detail::text_cursor ls(line);
+
+            if (has_vertex_sizes) {
+              std::uint64_t vsize = 0;
+              ls.get(vsize); // consume and discard vertex size
+            }
+            for (int k = 0; k < ncon; ++k) {
+              std::uint64_t vw = 0;
+              if (ls.get(vw))
+                result.vertex_weights[i].push_back(vw);
+            }
+
+            std::uint64_t nbr = 0;
+            while (ls.get(nbr)) {
+              metis_adjacency entry;
+              entry.neighbor = nbr > 0 ? nbr - 1 : 0;
+              if (has_edge_weight)
+                ls.get(entry.weight);
+              result.adjacency[i].push_back(std::move(entry));
+            }
+            ++i;
+          });
+        },
+        1);
+
+  return result;
+}
+
+/**
+ * @brief Map a METIS file and parse it in parallel. See read_metis(std::string_view, thread_pool&).
+ *
+ * @throws std::system_error if the file cannot be opened or mapped.
+ */
+inline metis_graph read_metis_file(const std::filesystem::path& path, thread_pool& pool = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  return read_metis(file.text(), pool);
+}
+
+// ---------------------------------------------------------------------------
+// load_metis — adjacency lines straight into compressed_graph
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Load METIS text into an empty compressed_graph, in parallel.
+ *
+ * Vertex i of the graph gets the neighbours on the i-th adjacency line, converted to 0-indexed
+ * ids, in file order unless @c options sorts them. Each undirected edge is thus stored in both
+ * directions, as the file lists it. When the `fmt` flag has edge weights and EV is not void, they
+ * are parsed with std::from_chars as the edge values; otherwise the values are value-initialized.
+ * Vertex sizes and weights are skipped. The graph has the vertex count of the header, and lines
+ * past it are ignored, as read_metis does.
+ *
+ * The adjacency lines are in vertex order, so the rows are written straight into the CSR arrays
+ * through compressed_graph::load_row_stream: a cheap scan numbers the lines of each chunk, then
+ * the chunks are parsed twice, once for the degrees and once to write the neighbours in place.
+ * No metis_graph, edge list or degree histogram is built.
+ *
+ * @param g       Empty graph to load.
+ * @param text    METIS text, e.g. a mapped file. Only read during the call.
+ * @param options Row sorting and duplicate removal, as for load_unsorted_edges.
+ * @param pool    Thread pool for the passes. Default: default_thread_pool().
+ *
+ * @throws graph_error if a field is not a number, a neighbour is not in [1, max VId + 1], an edge
+ *         weight is missing or does not parse, or the edges do not fit in EIndex. The graph is
+ *         then left empty.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_metis(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                std::string_view                                                          text,
+                const container::csr_build_options&                                       options = {},
+                thread_pool&                                                              pool    = default_thread_pool()) {
+  metis_graph  header;
+  const size_t body = detail::read_metis_header(text, header);
+  if (body == std::string_view::npos)
+    return;
+
+  const bool has_vertex_sizes  = (header.fmt / 100) % 10 != 0;
+  const bool has_vertex_weight = (header.fmt / 10) % 10 != 0;
+  const bool has_edge_weight   = (header.fmt % 10) != 0;
+  const int  ncon              = header.ncon > 0 ? header.ncon : (has_vertex_weight ? 1 : 0);
+  const int  skipped           = (has_vertex_sizes ? 1 : 0) + ncon;
+
+  const std::string_view rest         = text.substr(body);
+  const auto             chunks       = detail::line_chunks(rest, pool);
+  const auto             first_vertex = detail::metis_first_vertices(rest, chunks, pool);
+  g.load_row_stream(
+        chunks.size() - 1,
+        [&](size_t c, auto&& next_row, auto&& emit) {
+          std::uint64_t i = first_vertex[c];
+          detail::for_each_line(rest, chunks[c], chunks[c + 1], [&](std::string_view line) {
+            if (i >= header.num_vertices || !detail::is_metis_data_line(line))
+              return;
+            next_row();
+            detail::text_cursor ls(line);
+            for (int k = 0; k < skipped && !ls.at_end(); ++k) {
+              std::uint64_t skip = 0;
+              if (!ls.get(skip))
+                throw graph_error(std::format("invalid METIS line '{}'", line));
+            }
+            while (!ls.at_end()) {
+              std::uint64_t nbr = 0;
+              if (!ls.get(nbr))
+                throw graph_error(std::format("invalid METIS line '{}'", line));
+              copyable_edge_t<VId, EV> uv{};
+              uv.source_id = static_cast<VId>(i);
+              uv.target_id = detail::one_based_vertex_id<VId>(nbr, line);
+              if (has_edge_weight) {
+                std::string_view weight;
+                if (!ls.get(weight))
+                  throw graph_error(std::format("missing edge weight in METIS line '{}'", line));
+                if constexpr (!std::is_void_v<EV>)
+                  uv.value = detail::parse_edge_value<EV>(weight, line);
+              }
+              emit(uv);
+            }
+            ++i;
+          });
+        },
+        static_cast<size_t>(header.num_vertices), options, pool);
+}
+
+/**
+ * @brief Map a METIS file and load it into an empty compressed_graph. See load_metis.
+ *
+ * @throws std::system_error if the file cannot be opened or mapped, and graph_error as load_metis.
+ */
+template <class EV, class VV, class GV, std::integral VId, std::integral EIndex, bool Bidirectional, class Alloc>
+requires(std::is_void_v<EV> || std::is_arithmetic_v<EV>)
+void load_metis_file(container::compressed_graph<EV, VV, GV, VId, EIndex, Bidirectional, Alloc>& g,
+                     const std::filesystem::path&                                              path,
+                     const container::csr_build_options&                                       options = {},
+                     thread_pool&                                                              pool    = default_thread_pool()) {
+  const detail::mapped_file file(path);
+  load_metis(g, file.text(), options, pool);
+}
+
 } // namespace graph::io
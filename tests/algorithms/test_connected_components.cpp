@@ -7,6 +7,8 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <graph/algorithm/connected_components.hpp>
 #include <graph/container/undirected_adjacency_list.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
 #include "../common/graph_fixtures.hpp"
 #include "../common/algorithm_test_types.hpp"
 #include <algorithm>
@@ -816,6 +818,94 @@ TEST_CASE("afforest - large disconnected graph", "[algorithm][afforest]") {
   REQUIRE(all_same_component(component, {7, 8, 9}));
 }
 
+// =============================================================================
+// afforest() Tests - Multi-threaded Overloads
+// =============================================================================
+
+namespace {
+
+using afforest_csr  = compressed_graph<void, void, void, uint32_t, uint64_t>;
+using afforest_edge = copyable_edge_t<uint32_t, void>;
+
+// Sorted edges of generator output; symmetric adds the reverse of every edge
+template <class EdgeList>
+std::vector<afforest_edge> afforest_edges(const EdgeList& generated, bool symmetric, bool reversed = false) {
+  std::vector<afforest_edge> el;
+  for (auto&& e : generated) {
+    el.push_back(reversed ? afforest_edge{e.target_id, e.source_id} : afforest_edge{e.source_id, e.target_id});
+    if (symmetric)
+      el.push_back({e.target_id, e.source_id});
+  }
+  std::ranges::sort(el, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return el;
+}
+
+afforest_csr make_afforest_csr(const std::vector<afforest_edge>& el, uint32_t n) {
+  afforest_csr g;
+  g.load_edges(el, std::identity{}, n);
+  return g;
+}
+
+// The parallel afforest labels every vertex with the smallest id of its component
+std::vector<uint32_t> min_id_components(const std::vector<afforest_edge>& el, uint32_t n) {
+  vov_void g;
+  g.load_edges(el, std::identity{}, n);
+  std::vector<uint32_t> cc(n);
+  const size_t          k = connected_components(g, container_value_fn(cc));
+  std::vector<uint32_t> min_id(k, std::numeric_limits<uint32_t>::max());
+  for (uint32_t v = 0; v < n; ++v)
+    min_id[cc[v]] = std::min(min_id[cc[v]], v);
+  for (auto& c : cc)
+    c = min_id[c];
+  return cc;
+}
+
+} // namespace
+
+TEST_CASE("afforest - parallel matches connected_components", "[algorithm][afforest][parallel]") {
+  const uint32_t n = 1u << 12;
+  const std::vector<std::pair<std::vector<afforest_edge>, uint32_t>> inputs = {
+        {afforest_edges(generators::rmat<uint32_t>(12, 3 * n, 0.57, 0.19, 0.19, 0.05, 7), true), n},
+        {afforest_edges(generators::grid_2d<uint32_t>(40, 50), false), 2000},
+        {{{5, 6}, {6, 5}}, 300}, // mostly isolated vertices
+  };
+
+  for (const auto& [el, count] : inputs) {
+    const auto g        = make_afforest_csr(el, count);
+    const auto expected = min_id_components(el, count);
+    for (size_t workers : {1, 4}) {
+      thread_pool pool(workers);
+      for (size_t rounds : {0, 2, 5}) {
+        std::vector<uint32_t> component(count, 17);
+        afforest(g, component, pool, rounds);
+        REQUIRE(component == expected);
+      }
+    }
+  }
+
+  SECTION("no vertices") {
+    afforest_csr          g;
+    std::vector<uint32_t> component;
+    thread_pool           pool(2);
+    afforest(g, component, pool);
+    REQUIRE(component.empty());
+  }
+}
+
+TEST_CASE("afforest - parallel with transpose", "[algorithm][afforest][parallel]") {
+  // A directed R-MAT graph linked through both edge directions gives its weak components
+  const uint32_t n         = 1u << 11;
+  const auto     generated = generators::rmat<uint32_t>(11, n, 0.57, 0.19, 0.19, 0.05, 3);
+  const auto     g         = make_afforest_csr(afforest_edges(generated, false), n);
+  const auto     g_t       = make_afforest_csr(afforest_edges(generated, false, true), n);
+  const auto     expected  = min_id_components(afforest_edges(generated, true), n);
+
+  thread_pool           pool(4);
+  std::vector<uint64_t> component(n);
+  afforest(g, g_t, component, pool);
+  REQUIRE(std::ranges::equal(component, expected));
+}
+
 // =============================================================================
 // Edge Cases and Special Scenarios
 // =============================================================================
@@ -0,0 +1,209 @@
+/**
+ * @file test_contraction_hierarchy.cpp
+ * @brief Tests for build_contraction_hierarchy and ch_query from contraction_hierarchy.hpp
+ *
+ * Query distances are checked against dijkstra_shortest_distances, and unpacked paths against
+ * the edge weights of the original graph.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/contraction_hierarchy.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::container;
+
+namespace {
+
+using csr_t     = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using int_csr_t = compressed_graph<int, void, void, uint32_t, uint32_t>;
+
+constexpr auto edge_weight = [](const auto& g, const auto& uv) { return edge_value(g, uv); };
+
+// Sums of the same weights added in another order may differ in the last bits
+bool near(double a, double b) { return a == b || std::abs(a - b) <= 1e-9 * std::max(std::abs(a), std::abs(b)); }
+
+template <class G>
+G make_graph(const generators::edge_list<uint32_t>& el, uint32_t n) {
+  G g;
+  g.load_edges(el, std::identity{}, n);
+  return g;
+}
+
+// The cheapest u -> v edge of g, or infinity if there is none
+template <class G>
+auto cheapest_edge(const G& g, uint32_t u, uint32_t v) {
+  using W = std::remove_cvref_t<decltype(g.edge_value(0))>;
+  W best  = infinite_distance<W>();
+  for (auto e : g.edge_ids(u))
+    if (g.target_id(e) == v)
+      best = std::min(best, g.edge_value(e));
+  return best;
+}
+
+// Compares every query from `sources` with Dijkstra, and the path of every reachable target
+// with the graph's edges
+template <class G, class Query>
+void check_against_dijkstra(const G& g, Query& q, const std::vector<uint32_t>& sources) {
+  using W        = typename Query::distance_type;
+  const size_t n = num_vertices(g);
+  std::vector<W>        dist(n);
+  std::vector<uint32_t> path;
+  for (uint32_t s : sources) {
+    init_shortest_paths(g, dist);
+    dijkstra_shortest_distances(g, s, container_value_fn(dist), edge_weight);
+    for (uint32_t t = 0; t < n; ++t) {
+      const W d = q.shortest_path(s, t, path);
+      if (dist[t] == infinite_distance<W>()) {
+        REQUIRE(d == infinite_distance<W>());
+        REQUIRE(path.empty());
+        continue;
+      }
+      REQUIRE(near(static_cast<double>(d), static_cast<double>(dist[t])));
+      REQUIRE(near(static_cast<double>(q.distance(s, t)), static_cast<double>(dist[t])));
+      REQUIRE(path.front() == s);
+      REQUIRE(path.back() == t);
+      W sum{};
+      for (size_t i = 1; i < path.size(); ++i) {
+        const W w = cheapest_edge(g, path[i - 1], path[i]);
+        REQUIRE(w != infinite_distance<W>());
+        sum += w;
+      }
+      REQUIRE(near(static_cast<double>(sum), static_cast<double>(dist[t])));
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("contraction_hierarchy - grid queries match Dijkstra", "[algorithm][contraction_hierarchy]") {
+  const auto g  = make_graph<csr_t>(generators::grid_2d<uint32_t>(30, 30, 11), 900);
+  const auto ch = build_contraction_hierarchy(g, edge_weight);
+  REQUIRE(ch.num_vertices() == 900);
+
+  // Every arc goes up in the order
+  for (uint32_t u = 0; u < 900; ++u) {
+    for (auto v : ch.upward().target_ids(u))
+      REQUIRE(ch.rank()[v] > ch.rank()[u]);
+    for (auto v : ch.downward().target_ids(u))
+      REQUIRE(ch.rank()[v] > ch.rank()[u]);
+  }
+
+  ch_query q(ch);
+  check_against_dijkstra(g, q, {0, 17, 450, 899});
+}
+
+TEST_CASE("contraction_hierarchy - directed random graph matches Dijkstra", "[algorithm][contraction_hierarchy]") {
+  // Sparse and directed: many pairs are unreachable, and u -> v rarely has a v -> u
+  const auto g  = make_graph<csr_t>(generators::erdos_renyi<uint32_t>(1'500, 0.0015, 5), 1'500);
+  const auto ch = build_contraction_hierarchy(g, edge_weight);
+  ch_query   q(ch);
+  check_against_dijkstra(g, q, {0, 1, 2, 700, 1'499});
+}
+
+TEST_CASE("contraction_hierarchy - unit weights with many equal paths", "[algorithm][contraction_hierarchy]") {
+  // Every grid cell offers two equally short paths around it; vertices contracted in the same
+  // round must not witness each other's shortcuts away
+  const auto g  = make_graph<int_csr_t>(generators::grid_2d<uint32_t>(25, 40, 3, generators::weight_dist::constant_one),
+                                        1'000);
+  const auto ch = build_contraction_hierarchy(g, edge_weight);
+  ch_query   q(ch);
+  check_against_dijkstra(g, q, {0, 39, 500, 999});
+}
+
+TEST_CASE("contraction_hierarchy - the same hierarchy for any number of threads",
+          "[algorithm][contraction_hierarchy]") {
+  const auto  g = make_graph<csr_t>(generators::grid_2d<uint32_t>(40, 40, 2), 1'600);
+  thread_pool one(1), four(4);
+  const auto  a = build_contraction_hierarchy(g, edge_weight, {}, one);
+  const auto  b = build_contraction_hierarchy(g, edge_weight, {}, four);
+
+  REQUIRE(std::ranges::equal(a.rank(), b.rank()));
+  REQUIRE(a.num_shortcuts() == b.num_shortcuts());
+  for (uint32_t u = 0; u < 1'600; ++u) {
+    REQUIRE(std::ranges::equal(a.upward().target_ids(u), b.upward().target_ids(u)));
+    REQUIRE(std::ranges::equal(a.downward().target_ids(u), b.downward().target_ids(u)));
+  }
+}
+
+TEST_CASE("contraction_hierarchy - tiny witness limits keep distances exact", "[algorithm][contraction_hierarchy]") {
+  const auto g = make_graph<csr_t>(generators::grid_2d<uint32_t>(30, 30, 8), 900);
+
+  // Witness searches that give up at once add superfluous shortcuts, which change no distance
+  ch_build_options tight;
+  tight.witness_settle_limit  = 1;
+  tight.priority_settle_limit = 1;
+  const auto ch               = build_contraction_hierarchy(g, edge_weight, tight);
+  ch_query   q(ch);
+  check_against_dijkstra(g, q, {0, 899});
+}
+
+TEST_CASE("contraction_hierarchy - edge cases", "[algorithm][contraction_hierarchy]") {
+  SECTION("source equals target") {
+    const auto            g  = make_graph<csr_t>(generators::grid_2d<uint32_t>(5, 5, 1), 25);
+    const auto            ch = build_contraction_hierarchy(g, edge_weight);
+    ch_query              q(ch);
+    std::vector<uint32_t> path;
+    REQUIRE(q.shortest_path(12, 12, path) == 0.0);
+    REQUIRE(path == std::vector<uint32_t>{12});
+  }
+
+  SECTION("unreachable target and isolated vertices") {
+    // 0 -> 1 -> 2; vertices 3 and 4 have no edges
+    csr_t                 g({{0, 1, 1.0}, {1, 2, 2.0}});
+    const auto            ch = build_contraction_hierarchy(g, edge_weight);
+    ch_query              q(ch);
+    std::vector<uint32_t> path{7};
+    REQUIRE(q.shortest_path(2, 0, path) == infinite_distance<double>());
+    REQUIRE(path.empty());
+    REQUIRE(q.shortest_path(0, 2, path) == 3.0);
+    REQUIRE(path == std::vector<uint32_t>{0, 1, 2});
+
+    csr_t padded;
+    padded.load_edges(std::vector<copyable_edge_t<uint32_t, double>>{{0, 1, 1.0}}, std::identity{}, 5);
+    const auto ch5 = build_contraction_hierarchy(padded, edge_weight);
+    ch_query   q5(ch5);
+    REQUIRE(q5.distance(3, 4) == infinite_distance<double>());
+    REQUIRE(q5.distance(0, 1) == 1.0);
+  }
+
+  SECTION("self-loops and parallel edges") {
+    csr_t                 g({{0, 0, 1.0}, {0, 1, 5.0}, {0, 1, 2.0}, {1, 2, 1.0}, {1, 2, 4.0}});
+    const auto            ch = build_contraction_hierarchy(g, edge_weight);
+    ch_query              q(ch);
+    std::vector<uint32_t> path;
+    REQUIRE(q.shortest_path(0, 2, path) == 3.0);
+    REQUIRE(path == std::vector<uint32_t>{0, 1, 2});
+  }
+
+  SECTION("empty graph") {
+    csr_t      g;
+    const auto ch = build_contraction_hierarchy(g, edge_weight);
+    REQUIRE(ch.num_vertices() == 0);
+    REQUIRE(ch.num_shortcuts() == 0);
+  }
+
+  SECTION("out-of-range vertex ids throw") {
+    const auto g  = make_graph<csr_t>(generators::grid_2d<uint32_t>(3, 3, 1), 9);
+    const auto ch = build_contraction_hierarchy(g, edge_weight);
+    ch_query   q(ch);
+    REQUIRE_THROWS_AS(q.distance(9, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(q.distance(0, 9), std::out_of_range);
+  }
+
+  SECTION("negative weights throw") {
+    csr_t g({{0, 1, 1.0}, {1, 2, -1.0}});
+    REQUIRE_THROWS_AS(build_contraction_hierarchy(g, edge_weight), std::out_of_range);
+  }
+}
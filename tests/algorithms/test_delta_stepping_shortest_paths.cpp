@@ -0,0 +1,185 @@
+/**
+ * @file test_delta_stepping_shortest_paths.cpp
+ * @brief Tests for parallel delta-stepping shortest paths from delta_stepping_shortest_paths.hpp
+ *
+ * Distances are checked against dijkstra_shortest_paths on the same inputs. Predecessors are
+ * checked for consistency with the distances (the chosen parent among equal-length paths is
+ * not deterministic across threads).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/delta_stepping_shortest_paths.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+#include "../common/algorithm_test_types.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::test;
+using namespace graph::test::fixtures;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_double = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+using csr_int    = container::compressed_graph<int, void, void, uint32_t, uint32_t>;
+
+template <class G, class EdgeList>
+G make_csr(const EdgeList& el, uint32_t n) {
+  G g;
+  g.load_edges(el, std::identity{}, n);
+  return g;
+}
+
+// Integer-weighted copy of a generated edge list
+inline std::vector<copyable_edge_t<uint32_t, int>> to_int_weights(const generators::edge_list<uint32_t>& el) {
+  std::vector<copyable_edge_t<uint32_t, int>> out;
+  out.reserve(el.size());
+  for (auto& e : el) {
+    out.push_back({e.source_id, e.target_id, static_cast<int>(std::lround(e.value))});
+  }
+  return out;
+}
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return edge_value(g, uv); };
+
+template <class G>
+void check_against_dijkstra(G& g, const std::vector<uint32_t>& sources, auto delta, thread_pool& pool) {
+  using D = decltype(delta);
+  const size_t n = num_vertices(g);
+
+  std::vector<D>        expected(n), actual(n);
+  std::vector<uint32_t> ref_pred(n), pred(n);
+  init_shortest_paths(g, expected, ref_pred);
+  init_shortest_paths(g, actual, pred);
+
+  dijkstra_shortest_paths(g, sources, container_value_fn(expected), container_value_fn(ref_pred), weight_fn);
+  delta_stepping_shortest_paths(g, sources, container_value_fn(actual), container_value_fn(pred), weight_fn, delta,
+                                pool);
+
+  for (size_t v = 0; v < n; ++v) {
+    if constexpr (std::is_floating_point_v<D>) {
+      REQUIRE(std::abs(actual[v] - expected[v]) <= 1e-9 * std::max(D(1), std::abs(expected[v])));
+    } else {
+      REQUIRE(actual[v] == expected[v]);
+    }
+  }
+
+  // Every reached non-source vertex has a predecessor edge that realizes its distance
+  std::vector<bool> is_source(n, false);
+  for (auto s : sources) {
+    is_source[s] = true;
+  }
+  for (uint32_t v = 0; v < n; ++v) {
+    if (is_source[v] || actual[v] == infinite_distance<D>()) {
+      continue;
+    }
+    const uint32_t u     = pred[v];
+    bool           found = false;
+    for (auto&& uv : edges(g, *find_vertex(g, u))) {
+      if (target_id(g, uv) == v && actual[u] + edge_value(g, uv) == actual[v]) {
+        found = true;
+      }
+    }
+    REQUIRE(found);
+  }
+}
+
+} // namespace
+
+// =============================================================================
+// Small fixtures
+// =============================================================================
+
+TEMPLATE_TEST_CASE("delta_stepping_shortest_paths - CLRS example", "[algorithm][delta_stepping][parallel]",
+                   vov_weighted,
+                   dov_weighted) {
+  using Graph  = TestType;
+  auto g       = clrs_dijkstra_graph<Graph>();
+  using Result = clrs_dijkstra_results;
+
+  std::vector<int>      distance(num_vertices(g));
+  std::vector<uint32_t> predecessor(num_vertices(g));
+  init_shortest_paths(g, distance, predecessor);
+
+  thread_pool pool(2);
+  delta_stepping_shortest_paths(g, uint32_t{0}, container_value_fn(distance), container_value_fn(predecessor),
+                                weight_fn, 3, pool);
+
+  for (size_t i = 0; i < Result::num_vertices; ++i) {
+    REQUIRE(distance[i] == Result::distances_from_0[i]);
+  }
+}
+
+TEST_CASE("delta_stepping_shortest_paths - unreachable and empty", "[algorithm][delta_stepping][parallel]") {
+  // 0 -> 1 (w=2), 2 -> 3 (w=1)
+  auto g = make_csr<csr_int>(std::vector<copyable_edge_t<uint32_t, int>>{{0, 1, 2}, {2, 3, 1}}, 4);
+
+  std::vector<int> dist(4);
+  init_shortest_paths(g, dist);
+  delta_stepping_shortest_distances(g, uint32_t{0}, container_value_fn(dist), weight_fn);
+  REQUIRE(dist == std::vector<int>{0, 2, infinite_distance<int>(), infinite_distance<int>()});
+
+  csr_int               empty;
+  std::vector<int>      none;
+  std::vector<uint32_t> no_sources;
+  delta_stepping_shortest_distances(empty, no_sources, container_value_fn(none), weight_fn);
+  REQUIRE(none.empty());
+}
+
+TEST_CASE("delta_stepping_shortest_paths - errors", "[algorithm][delta_stepping][parallel]") {
+  auto g = make_csr<csr_int>(std::vector<copyable_edge_t<uint32_t, int>>{{0, 1, 2}, {1, 2, -1}}, 3);
+
+  std::vector<int> dist(3);
+  init_shortest_paths(g, dist);
+  REQUIRE_THROWS_AS(delta_stepping_shortest_distances(g, uint32_t{7}, container_value_fn(dist), weight_fn),
+                    std::out_of_range);
+
+  thread_pool pool(2);
+  init_shortest_paths(g, dist);
+  REQUIRE_THROWS_AS(delta_stepping_shortest_distances(g, uint32_t{0}, container_value_fn(dist), weight_fn, 1, pool),
+                    std::out_of_range);
+}
+
+// =============================================================================
+// Generated graphs: distances must match Dijkstra for any delta and worker count
+// =============================================================================
+
+TEST_CASE("delta_stepping_shortest_paths - matches dijkstra (double weights)",
+          "[algorithm][delta_stepping][parallel]") {
+  const uint32_t n    = 2'000;
+  auto           er   = make_csr<csr_double>(generators::erdos_renyi<uint32_t>(n, 8.0 / n, 3), n);
+  auto           grid = make_csr<csr_double>(generators::grid_2d<uint32_t>(40, 50, 3), n);
+  auto           ba   = make_csr<csr_double>(generators::barabasi_albert<uint32_t>(n, 4, 3), n);
+  auto           path = make_csr<csr_double>(generators::path_graph<uint32_t>(n, 3), n);
+
+  for (size_t workers : {size_t{1}, size_t{4}}) {
+    thread_pool pool(workers);
+    for (double delta : {0.0, 1.0, 25.0, 1e9}) { // auto, Dijkstra-like, moderate, Bellman-Ford-like
+      check_against_dijkstra(er, {0}, delta, pool);
+      check_against_dijkstra(grid, {0, 1'234}, delta, pool);
+      check_against_dijkstra(ba, {5}, delta, pool);
+      check_against_dijkstra(path, {0}, delta, pool);
+    }
+  }
+}
+
+TEST_CASE("delta_stepping_shortest_paths - matches dijkstra (integer weights)",
+          "[algorithm][delta_stepping][parallel]") {
+  const uint32_t n  = 2'000;
+  auto           er = make_csr<csr_int>(to_int_weights(generators::erdos_renyi<uint32_t>(n, 8.0 / n, 9)), n);
+  auto           ba = make_csr<csr_int>(
+        to_int_weights(generators::barabasi_albert<uint32_t>(n, 4, 9, generators::weight_dist::constant_one)), n);
+
+  thread_pool pool(4);
+  for (int delta : {0, 1, 7, 1'000'000}) {
+    check_against_dijkstra(er, {0}, delta, pool);
+    check_against_dijkstra(ba, {0, 17}, delta, pool);
+  }
+}
@@ -10,6 +10,7 @@
  *   - Both arity 2 and arity 4
  *   - Custom comparator (max-heap via std::greater)
  *   - Both position-map adapters: vector_position_map, assoc_position_map
+ *   - finalizing_position_map (popped keys reported as finalized)
  *   - Random stress (1 000 keys + 500 decrease-key ops)
  *   - push_or_decrease convenience
  */
@@ -27,6 +28,7 @@
 using graph::detail::indexed_dary_heap;
 using graph::detail::vector_position_map;
 using graph::detail::assoc_position_map;
+using graph::detail::finalizing_position_map;
 
 namespace {
 
@@ -284,6 +286,37 @@ TEST_CASE("indexed_dary_heap: assoc_position_map decrease-key", "[heap][indexed_
   CHECK_FALSE(h.contains("x"));
 }
 
+TEST_CASE("indexed_dary_heap: finalizing_position_map remembers popped keys",
+          "[heap][indexed_dary_heap][finalizing_map]") {
+  std::vector<double>      dist = {3.0, 1.0, 2.0, 4.0};
+  std::vector<std::size_t> pos(dist.size(), vector_position_map::npos);
+  auto distfn = [&dist](unsigned k) -> const double& { return dist[k]; };
+
+  using PMap = finalizing_position_map<vector_position_map>;
+  PMap map{vector_position_map{pos}};
+  indexed_dary_heap<unsigned, decltype(distfn), std::less<double>, PMap, 4> h(distfn, std::less<double>{}, map);
+
+  h.push(0);
+  h.push(1);
+  h.push(2);
+  CHECK(map.state(3) == PMap::npos);
+
+  REQUIRE(h.top() == 1u);
+  h.pop();
+  CHECK_FALSE(h.contains(1));
+  CHECK(map.state(1) == PMap::finalized);
+  CHECK(map.state(0) < PMap::finalized);
+
+  // A finalized key reads as absent to the heap
+  CHECK(map.position(1) == PMap::npos);
+  dist[0] = 0.5;
+  h.decrease(0);
+  CHECK(drain(h) == std::vector<unsigned>{0, 2});
+  CHECK(map.state(0) == PMap::finalized);
+  CHECK(map.state(2) == PMap::finalized);
+  CHECK(map.state(3) == PMap::npos);
+}
+
 // ---------------------------------------------------------------------------
 // Random stress: cross-check monotone drain after mixed decrease-key
 // ---------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 #include <set>
 #include <algorithm>
 #include <numeric>
+#include <limits>
 
 using namespace graph;
 using namespace graph::adj_list;
@@ -689,3 +690,165 @@ TEST_CASE("prim - indexed d-ary heap parity", "[algorithm][mst][prim][indexed_he
   REQUIRE(wt_def == wt_idx4);
   REQUIRE(wt_def == wt_idx8);
 }
+
+// =============================================================================
+// Prim's Algorithm — standalone main loop
+// =============================================================================
+
+TEST_CASE("prim - negative weights match kruskal", "[algorithm][mst][prim]") {
+  using Graph = vov_weighted;
+  using vid_t = vertex_id_t<Graph>;
+  using Edge  = simple_edge<uint32_t, int>;
+
+  std::vector<Edge> edge_list = {{0, 1, -2}, {0, 3, 6}, {1, 2, -3}, {1, 3, 8}, {1, 4, -5}, {2, 4, 7}, {3, 4, -9}};
+  std::vector<copyable_edge_t<vid_t, int>> both;
+  for (const auto& e : edge_list) {
+    both.push_back({e.source_id, e.target_id, e.value});
+    both.push_back({e.target_id, e.source_id, e.value});
+  }
+  Graph g;
+  g.load_edges(both, std::identity{});
+
+  std::vector<Edge> mst;
+  kruskal(edge_list, mst);
+  const int kruskal_weight = total_weight(mst);
+  REQUIRE(kruskal_weight == -19);
+
+  auto run = [&](auto heap_tag) {
+    std::vector<vid_t> predecessor(num_vertices(g));
+    std::vector<int>   weight(num_vertices(g));
+    init_shortest_paths(g, weight, predecessor);
+    return prim(g, vid_t{0}, container_value_fn(weight), container_value_fn(predecessor),
+                [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, std::less<int>(), heap_tag);
+  };
+
+  CHECK(run(use_default_heap{}) == kruskal_weight);
+  CHECK(run(use_indexed_dary_heap<4>{}) == kruskal_weight);
+  CHECK_THROWS_AS(run(use_bucket_heap{}), std::out_of_range);
+  CHECK_THROWS_AS(run(use_radix_heap{}), std::out_of_range);
+}
+
+TEST_CASE("prim - maximum spanning tree needs a comparison heap", "[algorithm][mst][prim]") {
+  using Graph = vov_weighted;
+  using vid_t = vertex_id_t<Graph>;
+  using Edge  = simple_edge<uint32_t, int>;
+
+  std::vector<Edge> edge_list = {{0, 1, 1}, {0, 2, 5}, {1, 2, 3}, {2, 3, 2}, {1, 3, 4}};
+  std::vector<copyable_edge_t<vid_t, int>> both;
+  for (const auto& e : edge_list) {
+    both.push_back({e.source_id, e.target_id, e.value});
+    both.push_back({e.target_id, e.source_id, e.value});
+  }
+  Graph g;
+  g.load_edges(both, std::identity{});
+
+  std::vector<Edge> max_st;
+  kruskal(edge_list, max_st, std::greater<int>());
+  REQUIRE(total_weight(max_st) == 12);
+
+  // Under std::greater the unreached weight is the lowest value, not init_shortest_paths' infinity
+  auto run = [&](auto heap_tag) {
+    std::vector<vid_t> predecessor(num_vertices(g));
+    std::vector<int>   weight(num_vertices(g), std::numeric_limits<int>::lowest());
+    std::iota(predecessor.begin(), predecessor.end(), vid_t{0});
+    return prim(g, vid_t{0}, container_value_fn(weight), container_value_fn(predecessor),
+                [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, std::greater<int>(), heap_tag);
+  };
+  CHECK(run(use_default_heap{}) == 12);
+  CHECK(run(use_indexed_dary_heap<4>{}) == 12);
+
+  // use_bucket_heap and use_radix_heap always pop the smallest key; with std::greater prim
+  // fails to compile instead of growing a wrong tree
+  STATIC_REQUIRE(graph::detail::integer_queue_compare_v<int, std::less<int>>);
+  STATIC_REQUIRE(graph::detail::integer_queue_compare_v<int, std::less<>>);
+  STATIC_REQUIRE_FALSE(graph::detail::integer_queue_compare_v<int, std::greater<int>>);
+  STATIC_REQUIRE_FALSE(graph::detail::integer_queue_compare_v<int, std::greater<>>);
+}
+
+TEST_CASE("prim - random graphs, every heap matches kruskal", "[algorithm][mst][prim][indexed_heap]") {
+  using Graph = vov_weighted;
+  using vid_t = vertex_id_t<Graph>;
+  using Edge  = simple_edge<uint32_t, int>;
+
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  auto     next  = [&state](uint32_t bound) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<uint32_t>((state >> 33) % bound);
+  };
+
+  for (uint32_t n : {2u, 10u, 50u, 200u}) {
+    for (uint32_t degree : {1u, 3u, 20u}) {
+      // A path keeps the graph connected; the other edges are random, with small weights so
+      // that ties and edges into finalized vertices are frequent
+      std::vector<Edge> edge_list;
+      for (uint32_t v = 1; v < n; ++v)
+        edge_list.push_back({v - 1, v, static_cast<int>(next(10))});
+      for (uint32_t i = 0; i < n * degree; ++i)
+        edge_list.push_back({next(n), next(n), static_cast<int>(next(10))});
+
+      std::vector<copyable_edge_t<vid_t, int>> both;
+      for (const auto& e : edge_list) {
+        both.push_back({e.source_id, e.target_id, e.value});
+        both.push_back({e.target_id, e.source_id, e.value});
+      }
+      Graph g;
+      g.load_edges(both, std::identity{});
+
+      std::vector<Edge> mst;
+      kruskal(edge_list, mst);
+      const int kruskal_weight = total_weight(mst);
+
+      auto run = [&](auto heap_tag) {
+        std::vector<vid_t> predecessor(n);
+        std::vector<int>   weight(n);
+        init_shortest_paths(g, weight, predecessor);
+        const int total = prim(g, vid_t{0}, container_value_fn(weight), container_value_fn(predecessor),
+                               [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, std::less<int>(),
+                               heap_tag);
+        // The predecessors form a spanning tree whose edge weights are recorded in weight[]
+        CHECK(predecessor[0] == 0);
+        int sum = 0;
+        for (vid_t v = 1; v < n; ++v) {
+          CHECK(predecessor[v] != v);
+          sum += weight[v];
+        }
+        CHECK(sum == total);
+        return total;
+      };
+
+      INFO("n = " << n << ", degree = " << degree);
+      CHECK(run(use_default_heap{}) == kruskal_weight);
+      CHECK(run(use_indexed_dary_heap<2>{}) == kruskal_weight);
+      CHECK(run(use_indexed_dary_heap<4>{}) == kruskal_weight);
+      CHECK(run(use_indexed_dary_heap<8>{}) == kruskal_weight);
+      CHECK(run(use_bucket_heap{}) == kruskal_weight);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("prim - sparse indexed d-ary heap",
+                   "[algorithm][mst][prim][sparse][indexed_heap]",
+                   SPARSE_VERTEX_TYPES) {
+  using Graph   = TestType;
+  using id_type = vertex_id_t<Graph>;
+
+  // The topology of "prim - indexed d-ary heap parity" with ids scaled by 10: MST weight 18
+  Graph g({{0, 10, 4},  {10, 0, 4},  {0, 20, 1},  {20, 0, 1},  {10, 20, 2}, {20, 10, 2}, {10, 30, 5},
+           {30, 10, 5}, {20, 30, 8}, {30, 20, 8}, {20, 40, 10}, {40, 20, 10}, {30, 40, 2}, {40, 30, 2},
+           {30, 50, 6}, {50, 30, 6}, {40, 50, 3}, {50, 40, 3}, {40, 60, 9}, {60, 40, 9}, {50, 60, 7},
+           {60, 50, 7}, {50, 70, 1}, {70, 50, 1}, {60, 70, 4}, {70, 60, 4}});
+
+  auto run = [&](auto heap_tag) {
+    auto predecessor = make_vertex_property_map<Graph, id_type>(g, id_type{});
+    auto weight_map  = make_vertex_property_map<Graph, int>(g, 0);
+    init_shortest_paths(g, weight_map, predecessor);
+    auto total = prim(g, id_type(0), container_value_fn(weight_map), container_value_fn(predecessor),
+                      [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, std::less<int>(), heap_tag);
+    CHECK(predecessor[id_type(0)] == id_type(0));
+    return total;
+  };
+
+  CHECK(run(use_default_heap{}) == 18);
+  CHECK(run(use_indexed_dary_heap<4>{}) == 18);
+  CHECK(run(use_bucket_heap{}) == 18);
+}
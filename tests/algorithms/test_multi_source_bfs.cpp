@@ -0,0 +1,146 @@
+/**
+ * @file test_multi_source_bfs.cpp
+ * @brief Tests for the bit-parallel multi-source BFS from multi_source_bfs.hpp
+ *
+ * Every row of the hop-distance matrix is checked against a serial single-source
+ * breadth_first_search, for batch widths of one and several words and pools of several sizes.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/multi_source_bfs.hpp>
+#include <graph/algorithm/breadth_first_search.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+#include "../common/algorithm_test_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::test;
+using namespace graph::test::fixtures;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_t         = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+csr_t random_graph(uint32_t n, double p, uint64_t seed) {
+  csr_t g;
+  g.load_edges(generators::erdos_renyi<uint32_t>(n, p, seed), std::identity{}, n);
+  return g;
+}
+
+// Levels of one source from the serial BFS
+struct level_recorder {
+  std::vector<uint32_t>* level;
+
+  // The first examined edge into a vertex comes from the level before it
+  template <class G, class E>
+  void on_examine_edge(const G& g, const E& uv) {
+    auto& lv = (*level)[target_id(g, uv)];
+    if (lv == none)
+      lv = (*level)[source_id(g, uv)] + 1;
+  }
+};
+
+template <class G>
+std::vector<uint32_t> reference_row(G&& g, uint32_t seed_id) {
+  std::vector<uint32_t> level(num_vertices(g), none);
+  level[seed_id] = 0;
+  breadth_first_search(g, seed_id, level_recorder{&level});
+  return level;
+}
+
+template <size_t Lanes, class G>
+void check_matrix(G&& g, const std::vector<uint32_t>& sources, thread_pool& pool) {
+  const size_t          n = num_vertices(g);
+  std::vector<uint32_t> dist(sources.size() * n);
+  multi_source_bfs_distances<Lanes>(g, sources, dist, pool);
+  for (size_t i = 0; i < sources.size(); ++i) {
+    const auto expected = reference_row(g, sources[i]);
+    REQUIRE(std::ranges::equal(std::span(dist).subspan(i * n, n), expected));
+  }
+}
+
+} // namespace
+
+TEST_CASE("multi_source_bfs_distances matches one BFS per source", "[algorithm][multi_source_bfs]") {
+  const auto            g = random_graph(1'500, 0.002, 17);
+  std::vector<uint32_t> sources(300);
+  for (uint32_t i = 0; i < sources.size(); ++i)
+    sources[i] = (i * 37) % 1'500;
+  thread_pool one(1), three(3);
+
+  SECTION("64 lanes") {
+    check_matrix<64>(g, sources, one);
+    check_matrix<64>(g, sources, three);
+  }
+  SECTION("256 lanes, partial last batch") {
+    check_matrix<256>(g, sources, three);
+  }
+  SECTION("repeated sources are independent") {
+    check_matrix<64>(g, std::vector<uint32_t>{4, 4, 9, 4}, three);
+  }
+}
+
+TEST_CASE("multi_source_bfs reports each (source, vertex) once, in level order", "[algorithm][multi_source_bfs]") {
+  using Graph = vov_void;
+  auto g      = path_graph_4<Graph>(); // 0 -> 1 -> 2 -> 3
+
+  std::vector<uint32_t>              sources{0, 2, 3};
+  std::vector<std::vector<uint32_t>> seen(sources.size());
+  std::vector<std::vector<size_t>>   levels(sources.size());
+  thread_pool                        pool(2);
+  multi_source_bfs(
+        g, sources,
+        [&](size_t i, auto vid, size_t level) {
+          seen[i].push_back(static_cast<uint32_t>(vid));
+          levels[i].push_back(level);
+        },
+        pool);
+
+  REQUIRE(seen[0] == std::vector<uint32_t>{0, 1, 2, 3});
+  REQUIRE(levels[0] == std::vector<size_t>{0, 1, 2, 3});
+  REQUIRE(seen[1] == std::vector<uint32_t>{2, 3});
+  REQUIRE(seen[2] == std::vector<uint32_t>{3});
+}
+
+TEST_CASE("multi_source_bfs errors and edge cases", "[algorithm][multi_source_bfs]") {
+  const auto  g = random_graph(100, 0.05, 3);
+  thread_pool pool(2);
+
+  SECTION("source out of range") {
+    std::atomic<size_t> calls{0};
+    REQUIRE_THROWS_AS(multi_source_bfs(g, std::vector<uint32_t>{1, 100}, [&](size_t, uint32_t, size_t) { ++calls; }, pool),
+                      std::out_of_range);
+    REQUIRE(calls == 0);
+  }
+  SECTION("distances too small") {
+    std::vector<uint32_t> dist(199);
+    REQUIRE_THROWS_AS(multi_source_bfs_distances(g, std::vector<uint32_t>{1, 2}, dist, pool), std::out_of_range);
+  }
+  SECTION("no sources") {
+    std::vector<uint32_t> dist;
+    multi_source_bfs_distances(g, std::vector<uint32_t>{}, dist, pool);
+  }
+  SECTION("all sources, 128 lanes: row sums match") {
+    std::vector<uint32_t> sources(100);
+    std::iota(sources.begin(), sources.end(), 0u);
+    std::vector<uint64_t> farness(100, 0);
+    multi_source_bfs<128>(g, sources, [&](size_t i, uint32_t, size_t level) { farness[i] += level; }, pool);
+    for (uint32_t s = 0; s < 100; ++s) {
+      uint64_t expected = 0;
+      for (uint32_t d : reference_row(g, s))
+        expected += d == none ? 0 : d;
+      REQUIRE(farness[s] == expected);
+    }
+  }
+}
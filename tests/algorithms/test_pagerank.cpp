@@ -0,0 +1,258 @@
+/**
+ * @file test_pagerank.cpp
+ * @brief Tests for pagerank from pagerank.hpp
+ *
+ * Ranks are checked against a serial power iteration over an explicit edge list, run to a
+ * much tighter tolerance, for every method and every source of in-edges (transpose,
+ * bidirectional graph, symmetric graph).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/pagerank.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_weighted = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using csr_bidir    = compressed_graph<double, void, void, uint32_t, uint32_t, true>;
+using edge_vec     = std::vector<copyable_edge_t<uint32_t, double>>;
+
+constexpr pagerank_method all_methods[] = {pagerank_method::jacobi, pagerank_method::gauss_seidel,
+                                           pagerank_method::delta};
+
+// Directed Erdős–Rényi edges with weights in [1, 4], sorted by source. Every tenth vertex has
+// its out-edges removed so that there are dangling vertices.
+edge_vec random_edges(uint32_t n, double p, uint64_t seed) {
+  edge_vec edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(n, p, seed))
+    if (e.source_id % 10 != 3)
+      edges.push_back({e.source_id, e.target_id, 1.0 + static_cast<double>((e.source_id + e.target_id) % 4)});
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  return edges;
+}
+
+edge_vec symmetrized(const edge_vec& edges) {
+  edge_vec out;
+  for (auto& e : edges) {
+    out.push_back(e);
+    out.push_back({e.target_id, e.source_id, e.value});
+  }
+  std::ranges::stable_sort(out, {}, [](const auto& e) { return e.source_id; });
+  return out;
+}
+
+// Serial push-based power iteration on the edge list
+std::vector<double> reference(const edge_vec& edges, uint32_t n, bool weighted, double damping = 0.85) {
+  std::vector<double> out_w(n, 0.0);
+  for (auto& e : edges)
+    out_w[e.source_id] += weighted ? e.value : 1.0;
+  std::vector<double> r(n, 1.0 / n), next(n);
+  for (int it = 0; it < 10000; ++it) {
+    double dangling = 0;
+    for (uint32_t u = 0; u < n; ++u)
+      if (out_w[u] == 0)
+        dangling += r[u];
+    std::ranges::fill(next, (1 - damping) / n + damping * dangling / n);
+    for (auto& e : edges)
+      next[e.target_id] += damping * r[e.source_id] * (weighted ? e.value : 1.0) / out_w[e.source_id];
+    double err = 0;
+    for (uint32_t u = 0; u < n; ++u)
+      err += std::abs(next[u] - r[u]);
+    r.swap(next);
+    if (err < 1e-14)
+      break;
+  }
+  return r;
+}
+
+template <class G>
+G make_graph(const edge_vec& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+double max_diff(const std::vector<double>& a, const std::vector<double>& b) {
+  double m = 0;
+  for (size_t i = 0; i < a.size(); ++i)
+    m = std::max(m, std::abs(a[i] - b[i]));
+  return m;
+}
+
+auto weight_fn = [](const auto& g, const auto& uv) { return edge_value(g, uv); };
+
+} // namespace
+
+TEST_CASE("pagerank - small graphs", "[algorithm][pagerank]") {
+  thread_pool pool(2);
+
+  SECTION("cycle has uniform ranks") {
+    const auto          g = make_graph<csr_weighted>({{0, 1, 1}, {1, 2, 1}, {2, 0, 1}}, 3);
+    std::vector<double> pr(3);
+    auto                res = pagerank(g, container_value_fn(pr), {.tolerance = 1e-12}, pool);
+    REQUIRE(res.converged);
+    for (double x : pr)
+      REQUIRE(std::abs(x - 1.0 / 3) < 1e-12);
+  }
+
+  SECTION("a single dangling vertex spreads its rank evenly") {
+    // 0 -> 1, 1 dangling: r1 = 0.15/2 + 0.85 * (r1/2 + r0)
+    const auto          g = make_graph<csr_weighted>({{0, 1, 1}}, 2);
+    std::vector<double> pr(2);
+    pagerank(g, container_value_fn(pr), {.tolerance = 1e-14}, pool);
+    REQUIRE(std::abs(pr[0] + pr[1] - 1.0) < 1e-12);
+    REQUIRE(std::abs(pr[1] - (0.075 + 0.85 * (pr[1] / 2 + pr[0]))) < 1e-12);
+  }
+
+  SECTION("empty graph") {
+    csr_weighted        g;
+    std::vector<double> pr;
+    auto                res = pagerank(g, container_value_fn(pr), {}, pool);
+    REQUIRE(res.iterations == 0);
+    REQUIRE(res.converged);
+  }
+
+  SECTION("max_iters stops the run") {
+    const auto          g = make_graph<csr_weighted>(random_edges(200, 0.03, 5), 200);
+    std::vector<double> pr(200);
+    auto                res = pagerank(g, container_value_fn(pr), {.tolerance = 0, .max_iters = 3}, pool);
+    REQUIRE(res.iterations == 3);
+    REQUIRE(!res.converged);
+    REQUIRE(std::abs(std::accumulate(pr.begin(), pr.end(), 0.0) - 1.0) < 1e-12);
+  }
+}
+
+TEST_CASE("pagerank - matches a serial power iteration", "[algorithm][pagerank]") {
+  const uint32_t n     = 3000;
+  const auto     edges = random_edges(n, 4.0 / n, 11);
+  const auto     unw   = reference(edges, n, false);
+  const auto     wtd   = reference(edges, n, true);
+
+  for (size_t workers : {1, 4}) {
+    thread_pool pool(workers);
+    for (auto method : all_methods) {
+      const pagerank_options opts{.tolerance = 1e-11, .max_iters = 1000, .method = method};
+      std::vector<double>    pr(n);
+
+      // In-edges from a transpose
+      REQUIRE(pagerank(make_graph<csr_weighted>(edges, n), container_value_fn(pr), opts, pool).converged);
+      REQUIRE(max_diff(pr, unw) < 1e-9);
+      REQUIRE(pagerank(make_graph<vov_weighted>(edges, n), container_value_fn(pr), opts, pool).converged);
+      REQUIRE(max_diff(pr, unw) < 1e-9);
+
+      // In-edges from the graph
+      REQUIRE(pagerank(make_graph<csr_bidir>(edges, n), container_value_fn(pr), opts, pool).converged);
+      REQUIRE(max_diff(pr, unw) < 1e-9);
+
+      // Weighted
+      REQUIRE(pagerank(make_graph<csr_weighted>(edges, n), container_value_fn(pr), weight_fn, opts, pool).converged);
+      REQUIRE(max_diff(pr, wtd) < 1e-9);
+      REQUIRE(pagerank(make_graph<csr_bidir>(edges, n), container_value_fn(pr), weight_fn, opts, pool).converged);
+      REQUIRE(max_diff(pr, wtd) < 1e-9);
+    }
+  }
+}
+
+TEST_CASE("pagerank - symmetric graphs use their out-edges", "[algorithm][pagerank]") {
+  const uint32_t n     = 1000;
+  const auto     edges = symmetrized(random_edges(n, 3.0 / n, 23));
+  const auto     unw   = reference(edges, n, false);
+  const auto     wtd   = reference(edges, n, true);
+  const auto     g     = make_graph<csr_weighted>(edges, n);
+  thread_pool    pool(3);
+
+  for (auto method : all_methods) {
+    const pagerank_options opts{.tolerance = 1e-11, .max_iters = 1000, .method = method, .symmetric = true};
+    std::vector<double>    pr(n);
+    pagerank(g, container_value_fn(pr), opts, pool);
+    REQUIRE(max_diff(pr, unw) < 1e-9);
+    pagerank(g, container_value_fn(pr), weight_fn, opts, pool);
+    REQUIRE(max_diff(pr, wtd) < 1e-9);
+  }
+}
+
+TEST_CASE("pagerank - determinism, sweep counts and warm start", "[algorithm][pagerank]") {
+  const uint32_t n     = 5000;
+  const auto     g     = make_graph<csr_weighted>(random_edges(n, 5.0 / n, 31), n);
+  thread_pool    one(1), four(4);
+
+  SECTION("jacobi and delta do not depend on the number of workers") {
+    for (auto method : {pagerank_method::jacobi, pagerank_method::delta}) {
+      std::vector<double> a(n), b(n);
+      auto                ra = pagerank(g, container_value_fn(a), {.method = method}, one);
+      auto                rb = pagerank(g, container_value_fn(b), {.method = method}, four);
+      REQUIRE(a == b);
+      REQUIRE(ra.iterations == rb.iterations);
+    }
+  }
+
+  SECTION("gauss-seidel needs fewer sweeps than jacobi") {
+    std::vector<double> pr(n);
+    auto jacobi = pagerank(g, container_value_fn(pr), {.tolerance = 1e-10, .max_iters = 1000}, one);
+    auto gs     = pagerank(g, container_value_fn(pr),
+                           {.tolerance = 1e-10, .max_iters = 1000, .method = pagerank_method::gauss_seidel}, one);
+    REQUIRE(jacobi.converged);
+    REQUIRE(gs.converged);
+    REQUIRE(gs.iterations < jacobi.iterations);
+  }
+
+  SECTION("warm start from converged ranks") {
+    std::vector<double> pr(n);
+    auto                cold = pagerank(g, container_value_fn(pr), {.tolerance = 1e-10, .max_iters = 1000}, four);
+    auto warm = pagerank(g, container_value_fn(pr), {.tolerance = 1e-10, .max_iters = 1000, .warm_start = true}, four);
+    REQUIRE(warm.converged);
+    REQUIRE(warm.iterations < cold.iterations / 4);
+
+    // Unusable initial values fall back to uniform ranks
+    std::vector<double> zeros(n, 0.0);
+    REQUIRE(pagerank(g, container_value_fn(zeros), {.tolerance = 1e-10, .max_iters = 1000, .warm_start = true}, four)
+                  .converged);
+    REQUIRE(max_diff(zeros, pr) < 1e-9);
+  }
+
+  SECTION("delta after a local change") {
+    // A long ring with chords: after adding edges at one end, only the ranks near them move
+    // by much, so most delta sweeps are sparse
+    const uint32_t ring = 4000;
+    edge_vec       base;
+    for (uint32_t u = 0; u < ring; ++u) {
+      base.push_back({u, (u + 1) % ring, 1.0});
+      if (u % 7 == 0)
+        base.push_back({u, (u + 3) % ring, 1.0});
+    }
+    auto changed = base;
+    for (uint32_t u = 0; u < 5; ++u)
+      changed.push_back({u, u + 100, 1.0});
+    std::ranges::stable_sort(changed, {}, [](const auto& e) { return e.source_id; });
+    const auto exp = reference(changed, ring, false);
+
+    std::vector<double> before(ring);
+    pagerank(make_graph<csr_weighted>(base, ring), container_value_fn(before), {.tolerance = 1e-12, .max_iters = 5000},
+             four);
+    const auto             g2 = make_graph<csr_weighted>(changed, ring);
+    const pagerank_options opts{.tolerance = 1e-11, .max_iters = 5000, .method = pagerank_method::delta, .warm_start = true};
+    std::vector<double>    a = before, b = before;
+    REQUIRE(pagerank(g2, container_value_fn(a), opts, one).converged);
+    REQUIRE(pagerank(g2, container_value_fn(b), opts, four).converged);
+    REQUIRE(max_diff(a, exp) < 1e-9);
+    REQUIRE(a == b);
+  }
+
+  SECTION("float ranks") {
+    std::vector<float> pr(n);
+    auto               res = pagerank(g, container_value_fn(pr), {.tolerance = 1e-5}, four);
+    REQUIRE(res.converged);
+    REQUIRE(std::abs(std::accumulate(pr.begin(), pr.end(), 0.0) - 1.0) < 1e-4);
+  }
+}
@@ -0,0 +1,225 @@
+/**
+ * @file test_parallel_breadth_first_search.cpp
+ * @brief Tests for the direction-optimizing parallel BFS from parallel_breadth_first_search.hpp
+ *
+ * Levels are checked against dijkstra_shortest_distances with unit weights; parents are
+ * checked for tree validity (an edge from a vertex exactly one level closer), since the
+ * chosen parent is not deterministic across threads.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/parallel_breadth_first_search.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+#include "../common/algorithm_test_types.hpp"
+
+#include <limits>
+#include <set>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::test;
+using namespace graph::test::fixtures;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_t         = container::compressed_graph<void, void, void, uint32_t, uint64_t>;
+constexpr auto none = std::numeric_limits<uint32_t>::max();
+
+template <class EdgeList>
+csr_t make_csr(const EdgeList& el, uint32_t n) {
+  csr_t g;
+  g.load_edges(el, std::identity{}, n);
+  return g;
+}
+
+// Reference levels from the serial Dijkstra with unit weights
+template <class G>
+std::vector<uint32_t> reference_levels(G&& g, const std::vector<uint32_t>& sources) {
+  std::vector<uint32_t> dist(num_vertices(g), none);
+  for (auto s : sources) {
+    dist[s] = 0;
+  }
+  dijkstra_shortest_distances(g, sources, container_value_fn(dist));
+  return dist;
+}
+
+// Every reached non-source vertex must have a parent one level closer with an edge to it
+template <class G>
+bool valid_parents(G&&                          g,
+                   const std::vector<uint32_t>& level,
+                   const std::vector<uint32_t>& parent,
+                   const std::vector<uint32_t>& sources) {
+  std::set<uint32_t> src(sources.begin(), sources.end());
+  for (uint32_t v = 0; v < level.size(); ++v) {
+    if (level[v] == none || src.contains(v)) {
+      continue;
+    }
+    const uint32_t p = parent[v];
+    if (p >= level.size() || level[p] + 1 != level[v]) {
+      return false;
+    }
+    bool has_edge = false;
+    for (auto&& uv : edges(g, *find_vertex(g, p))) {
+      has_edge = has_edge || (target_id(g, uv) == v);
+    }
+    if (!has_edge) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class G>
+void check_against_reference(G&&                          g,
+                             const std::vector<uint32_t>& sources,
+                             const bfs_direction_options& options,
+                             thread_pool&                 pool) {
+  std::vector<uint32_t> level(num_vertices(g), none);
+  std::vector<uint32_t> parent(num_vertices(g), none);
+  parallel_breadth_first_search(g, sources, container_value_fn(level), container_value_fn(parent), empty_visitor(),
+                                options, pool);
+  REQUIRE(level == reference_levels(g, sources));
+  REQUIRE(valid_parents(g, level, parent, sources));
+}
+
+struct LevelEventVisitor {
+  std::vector<uint32_t> discovered;
+  std::vector<uint32_t> examined;
+  std::vector<uint32_t> finished;
+  size_t                initialized = 0;
+
+  void on_initialize_vertex(const csr_t&, const uint32_t&) { ++initialized; }
+  void on_discover_vertex(const csr_t&, const uint32_t& uid) { discovered.push_back(uid); }
+  void on_examine_vertex(const csr_t&, const uint32_t& uid) { examined.push_back(uid); }
+  void on_finish_vertex(const csr_t&, const uint32_t& uid) { finished.push_back(uid); }
+};
+
+} // namespace
+
+// =============================================================================
+// Small fixtures (serial pool and multi-worker pool)
+// =============================================================================
+
+TEMPLATE_TEST_CASE("parallel_breadth_first_search - path graph levels",
+                   "[algorithm][bfs][parallel]",
+                   vov_void,
+                   dov_void) {
+  auto        g = path_graph_4<TestType>();
+  thread_pool pool(2);
+
+  std::vector<uint32_t> level(num_vertices(g), none);
+  std::vector<uint32_t> parent(num_vertices(g), none);
+  parallel_breadth_first_search(g, uint32_t{0}, container_value_fn(level), container_value_fn(parent),
+                                empty_visitor(), bfs_direction_options{}, pool);
+
+  REQUIRE(level == std::vector<uint32_t>{0, 1, 2, 3});
+  REQUIRE(parent == std::vector<uint32_t>{none, 0, 1, 2});
+}
+
+TEST_CASE("parallel_breadth_first_search - unreachable vertices untouched", "[algorithm][bfs][parallel]") {
+  // 0 -> 1, 2 -> 3 (3 unreachable from 0)
+  auto g = make_csr(std::vector<copyable_edge_t<uint32_t, void>>{{0, 1}, {2, 3}}, 4);
+
+  std::vector<uint32_t> level(4, none);
+  parallel_breadth_first_search(g, uint32_t{0}, container_value_fn(level), _null_predecessor);
+  REQUIRE(level == std::vector<uint32_t>{0, 1, none, none});
+}
+
+TEST_CASE("parallel_breadth_first_search - empty graph", "[algorithm][bfs][parallel]") {
+  csr_t                 g;
+  std::vector<uint32_t> level;
+  std::vector<uint32_t> sources;
+  parallel_breadth_first_search(g, sources, container_value_fn(level), _null_predecessor);
+  REQUIRE(level.empty());
+}
+
+TEST_CASE("parallel_breadth_first_search - multi-source and duplicate sources", "[algorithm][bfs][parallel]") {
+  auto        el = generators::path_graph<uint32_t>(50);
+  auto        g  = make_csr(el, 50);
+  thread_pool pool(3);
+
+  check_against_reference(g, {0, 20, 20, 40}, bfs_direction_options{}, pool);
+}
+
+// =============================================================================
+// Generated graphs: every direction strategy must match the serial reference
+// =============================================================================
+
+TEST_CASE("parallel_breadth_first_search - symmetric graphs, all strategies", "[algorithm][bfs][parallel]") {
+  const uint32_t n  = 2'000;
+  auto           ba = make_csr(generators::barabasi_albert<uint32_t>(n, 4, 7), n);
+  auto           gr = make_csr(generators::grid_2d<uint32_t>(40, 50, 7), n);
+
+  // alpha huge  -> never switch (pure top-down)
+  // alpha tiny  -> switch on the first level (bottom-up as early as possible)
+  // defaults    -> Beamer heuristic
+  const bfs_direction_options top_down_only{.alpha = 1e18, .beta = 18.0, .symmetric = true};
+  const bfs_direction_options eager_bottom_up{.alpha = 1e-9, .beta = 1e18, .symmetric = true};
+  const bfs_direction_options heuristic{.symmetric = true};
+
+  for (size_t workers : {size_t{1}, size_t{4}}) {
+    thread_pool pool(workers);
+    for (const auto& opts : {top_down_only, eager_bottom_up, heuristic}) {
+      check_against_reference(ba, {0}, opts, pool);
+      check_against_reference(ba, {3, 1'500}, opts, pool);
+      check_against_reference(gr, {0}, opts, pool);
+      check_against_reference(gr, {999}, opts, pool);
+    }
+  }
+}
+
+TEST_CASE("parallel_breadth_first_search - directed graph stays top-down", "[algorithm][bfs][parallel]") {
+  // erdos_renyi edges are directed: without symmetric/in_edges only top-down is valid,
+  // even when the heuristic would prefer bottom-up.
+  const uint32_t n = 1'000;
+  auto           g = make_csr(generators::erdos_renyi<uint32_t>(n, 0.01, 11), n);
+  thread_pool    pool(4);
+
+  check_against_reference(g, {0}, bfs_direction_options{.alpha = 1e-9}, pool);
+  check_against_reference(g, {0}, bfs_direction_options{}, pool);
+}
+
+// =============================================================================
+// Visitor events
+// =============================================================================
+
+TEST_CASE("parallel_breadth_first_search - visitor events", "[algorithm][bfs][parallel]") {
+  const uint32_t n = 1'000;
+  auto           g = make_csr(generators::barabasi_albert<uint32_t>(n, 3, 5), n);
+  thread_pool    pool(4);
+
+  for (const auto& opts : {bfs_direction_options{.alpha = 1e18, .symmetric = true},
+                           bfs_direction_options{.alpha = 1e-9, .symmetric = true}}) {
+    LevelEventVisitor     vis;
+    std::vector<uint32_t> level(n, none);
+    parallel_breadth_first_search(g, uint32_t{0}, container_value_fn(level), _null_predecessor, vis, opts, pool);
+
+    // Every reached vertex is discovered, examined and finished exactly once
+    const size_t reached = static_cast<size_t>(std::ranges::count_if(level, [](uint32_t l) { return l != none; }));
+    REQUIRE(vis.initialized == 1);
+    REQUIRE(vis.discovered.size() == reached);
+    REQUIRE(vis.examined.size() == reached);
+    REQUIRE(vis.finished.size() == reached);
+    REQUIRE(std::set<uint32_t>(vis.discovered.begin(), vis.discovered.end()).size() == reached);
+
+    // Events arrive in level order
+    auto non_decreasing_levels = [&](const std::vector<uint32_t>& ids) {
+      for (size_t i = 1; i < ids.size(); ++i) {
+        if (level[ids[i - 1]] > level[ids[i]]) {
+          return false;
+        }
+      }
+      return true;
+    };
+    REQUIRE(vis.discovered.front() == 0);
+    REQUIRE(non_decreasing_levels(vis.discovered));
+    REQUIRE(non_decreasing_levels(vis.examined));
+    REQUIRE(non_decreasing_levels(vis.finished));
+  }
+}
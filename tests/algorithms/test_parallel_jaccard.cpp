@@ -0,0 +1,248 @@
+/**
+ * @file test_parallel_jaccard.cpp
+ * @brief Tests for the sorted-neighborhood Jaccard engine: parallel_jaccard_coefficient and
+ *        jaccard_top_k from parallel_jaccard.hpp
+ *
+ * Coefficients are checked against a brute-force evaluation on std::set neighborhoods, and
+ * top-k results against a full sort of the brute-force candidates.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/parallel_jaccard.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_void = compressed_graph<void, void, void, uint32_t, uint32_t>;
+using edge_vec = std::vector<copyable_edge_t<uint32_t, void>>;
+using match    = jaccard_match<uint32_t>;
+
+// Symmetric edges of a Barabási–Albert graph, sorted by source only; optionally with rows in
+// descending order, plus repeated edges and self-loops on every third vertex
+edge_vec ba_edges(uint32_t n, bool messy) {
+  edge_vec out;
+  for (auto& e : generators::barabasi_albert<uint32_t>(n, 4, 17)) {
+    out.push_back({e.source_id, e.target_id});
+    out.push_back({e.target_id, e.source_id});
+  }
+  std::ranges::sort(out, [](const auto& a, const auto& b) {
+    return std::pair(a.source_id, a.target_id) < std::pair(b.source_id, b.target_id);
+  });
+  auto dup = std::ranges::unique(out, [](const auto& a, const auto& b) {
+    return a.source_id == b.source_id && a.target_id == b.target_id;
+  });
+  out.erase(dup.begin(), dup.end());
+  if (messy) {
+    for (uint32_t u = 0; u < n; u += 3) {
+      const uint32_t v = (u * 7 + 1) % n;
+      out.push_back({u, u});
+      out.push_back({u, v});
+      out.push_back({u, v});
+      out.push_back({v, u});
+    }
+    std::ranges::reverse(out);
+    std::ranges::stable_sort(out, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  }
+  return out;
+}
+
+template <class G>
+G make_graph(const edge_vec& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+// Open neighborhoods as sets
+std::vector<std::set<uint32_t>> neighbor_sets(const edge_vec& edges, uint32_t n) {
+  std::vector<std::set<uint32_t>> nbrs(n);
+  for (auto& e : edges)
+    if (e.source_id != e.target_id)
+      nbrs[e.source_id].insert(e.target_id);
+  return nbrs;
+}
+
+double brute_jaccard(const std::vector<std::set<uint32_t>>& nbrs, uint32_t u, uint32_t v) {
+  size_t common = 0;
+  for (auto x : nbrs[u])
+    common += nbrs[v].count(x);
+  const size_t uni = nbrs[u].size() + nbrs[v].size() - common;
+  return uni == 0 ? 0.0 : static_cast<double>(common) / static_cast<double>(uni);
+}
+
+// Multiset of (uid, vid, J) reported by parallel_jaccard_coefficient
+template <class G>
+std::map<std::pair<uint32_t, uint32_t>, std::vector<double>> collect(const G& g, thread_pool& pool) {
+  std::mutex                                                   lock;
+  std::map<std::pair<uint32_t, uint32_t>, std::vector<double>> seen;
+  parallel_jaccard_coefficient(
+        g,
+        [&](uint32_t uid, uint32_t vid, auto&, double val) {
+          std::lock_guard guard(lock);
+          seen[{uid, vid}].push_back(val);
+        },
+        pool);
+  return seen;
+}
+
+} // namespace
+
+TEST_CASE("sorted_neighborhoods - rows used in place or rebuilt", "[algorithm][jaccard][parallel]") {
+  thread_pool pool(2);
+
+  SECTION("sorted CSR without loops or repeats is borrowed") {
+    const auto g = make_graph<csr_void>(ba_edges(200, false), 200);
+    const graph::detail::sorted_neighborhoods<csr_void> nbrs(g, pool);
+    REQUIRE(nbrs.borrowed());
+    REQUIRE(nbrs[5].data() == g.target_ids(5).data());
+  }
+
+  SECTION("loops and repeats are removed from a copy") {
+    const edge_vec edges = {{0, 2}, {0, 0}, {0, 1}, {0, 2}, {1, 0}, {2, 0}, {2, 2}};
+    const auto     g     = make_graph<csr_void>(edges, 3);
+    const graph::detail::sorted_neighborhoods<csr_void> nbrs(g, pool);
+    REQUIRE(!nbrs.borrowed());
+    REQUIRE(std::ranges::equal(nbrs[0], std::vector<uint32_t>{1, 2}));
+    REQUIRE(std::ranges::equal(nbrs[1], std::vector<uint32_t>{0}));
+    REQUIRE(std::ranges::equal(nbrs[2], std::vector<uint32_t>{0}));
+  }
+
+  SECTION("unsorted dynamic rows are sorted") {
+    const edge_vec edges = {{0, 3}, {0, 1}, {0, 2}, {1, 0}, {2, 0}, {3, 0}};
+    const auto     g     = make_graph<vol_void>(edges, 4);
+    const graph::detail::sorted_neighborhoods<vol_void> nbrs(g, pool);
+    REQUIRE(std::ranges::equal(nbrs[0], std::vector<uint32_t>{1, 2, 3}));
+  }
+}
+
+TEST_CASE("parallel_jaccard_coefficient - matches brute force", "[algorithm][jaccard][parallel]") {
+  const uint32_t n = 1500;
+
+  for (bool messy : {false, true}) {
+    const auto edges = ba_edges(n, messy);
+    const auto nbrs  = neighbor_sets(edges, n);
+
+    // Expected: one report per stored non-loop edge
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<double>> expected;
+    for (auto& e : edges)
+      if (e.source_id != e.target_id)
+        expected[{e.source_id, e.target_id}].push_back(brute_jaccard(nbrs, e.source_id, e.target_id));
+
+    auto check = [&](const auto& seen) {
+      REQUIRE(seen.size() == expected.size());
+      for (auto& [key, vals] : expected) {
+        auto it = seen.find(key);
+        REQUIRE(it != seen.end());
+        REQUIRE(it->second.size() == vals.size());
+        for (double v : it->second)
+          REQUIRE(std::abs(v - vals.front()) < 1e-12);
+      }
+    };
+
+    for (size_t workers : {1, 4}) {
+      thread_pool pool(workers);
+      check(collect(make_graph<csr_void>(edges, n), pool));
+      check(collect(make_graph<vol_void>(edges, n), pool));
+    }
+
+    // The serial algorithm uses the same engine
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<double>> serial;
+    jaccard_coefficient(make_graph<vov_void>(edges, n),
+                        [&](uint32_t uid, uint32_t vid, auto&, double val) { serial[{uid, vid}].push_back(val); });
+    check(serial);
+  }
+}
+
+TEST_CASE("jaccard_top_k - neighbors and two-hop candidates", "[algorithm][jaccard][parallel]") {
+  const uint32_t n     = 600;
+  const auto     edges = ba_edges(n, true);
+  const auto     nbrs  = neighbor_sets(edges, n);
+  const auto     g     = make_graph<csr_void>(edges, n);
+
+  auto better = [](const match& a, const match& b) {
+    return a.coefficient > b.coefficient || (a.coefficient == b.coefficient && a.target < b.target);
+  };
+
+  for (auto candidates : {jaccard_candidates::neighbors, jaccard_candidates::two_hop}) {
+    // Brute force: every candidate of every vertex, fully sorted
+    std::vector<std::vector<match>> all(n);
+    for (uint32_t u = 0; u < n; ++u) {
+      if (candidates == jaccard_candidates::neighbors) {
+        for (auto v : nbrs[u])
+          all[u].push_back({v, brute_jaccard(nbrs, u, v)});
+      } else {
+        std::set<uint32_t> reach;
+        for (auto w : nbrs[u])
+          for (auto v : nbrs[w])
+            if (v != u && !nbrs[u].count(v))
+              reach.insert(v);
+        for (auto v : reach)
+          all[u].push_back({v, brute_jaccard(nbrs, u, v)});
+      }
+      std::ranges::sort(all[u], better);
+    }
+
+    for (size_t k : {1, 5, 1000}) {
+      for (size_t workers : {1, 3}) {
+        thread_pool                     pool(workers);
+        std::vector<std::vector<match>> got(n);
+        std::vector<int>                calls(n, 0);
+        jaccard_top_k(
+              g, k,
+              [&](uint32_t uid, std::span<const match> matches) {
+                got[uid].assign(matches.begin(), matches.end());
+                ++calls[uid];
+              },
+              candidates, pool);
+
+        for (uint32_t u = 0; u < n; ++u) {
+          REQUIRE(calls[u] == (all[u].empty() ? 0 : 1));
+          const size_t keep = std::min(k, all[u].size());
+          REQUIRE(got[u].size() == keep);
+          for (size_t i = 0; i < keep; ++i) {
+            REQUIRE(got[u][i].target == all[u][i].target);
+            REQUIRE(std::abs(got[u][i].coefficient - all[u][i].coefficient) < 1e-12);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("parallel jaccard - degenerate inputs", "[algorithm][jaccard][parallel]") {
+  thread_pool pool(2);
+  size_t      calls = 0;
+  auto        count = [&](auto&&...) { ++calls; };
+
+  csr_void empty;
+  parallel_jaccard_coefficient(empty, count, pool);
+  jaccard_top_k(empty, 3, count, jaccard_candidates::two_hop, pool);
+  REQUIRE(calls == 0);
+
+  // Only self-loops: no reports at all
+  const auto loops = make_graph<csr_void>({{0, 0}, {1, 1}}, 2);
+  parallel_jaccard_coefficient(loops, count, pool);
+  jaccard_top_k(loops, 3, count, jaccard_candidates::neighbors, pool);
+  REQUIRE(calls == 0);
+
+  // k == 0 reports nothing
+  const auto pair = make_graph<csr_void>({{0, 1}, {1, 0}}, 2);
+  jaccard_top_k(pair, 0, count, jaccard_candidates::neighbors, pool);
+  REQUIRE(calls == 0);
+  jaccard_top_k(pair, 1, count, jaccard_candidates::neighbors, pool);
+  REQUIRE(calls == 2);
+}
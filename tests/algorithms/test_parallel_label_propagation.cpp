@@ -0,0 +1,261 @@
+/**
+ * @file test_parallel_label_propagation.cpp
+ * @brief Tests for the label histograms and multi-threaded label propagation from
+ *        parallel_label_propagation.hpp
+ *
+ * A run that ends by convergence leaves every labelled vertex with one of the most frequent
+ * labels of its neighbours; the parallel results are checked against that property rather
+ * than against the serial algorithm, whose update order differs.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/parallel_label_propagation.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+#include "../common/graph_test_types.hpp"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_void = compressed_graph<void, void, void, uint32_t, uint32_t>;
+using edge_vec = std::vector<copyable_edge_t<uint32_t, void>>;
+
+// Two cliques {0..k-1} and {k..2k-1} joined by the edge (0, k), stored in both directions
+edge_vec two_cliques(uint32_t k) {
+  edge_vec out;
+  for (uint32_t base : {0u, k})
+    for (uint32_t u = base; u < base + k; ++u)
+      for (uint32_t v = base; v < base + k; ++v)
+        if (u != v)
+          out.push_back({u, v});
+  out.push_back({0, k});
+  out.push_back({k, 0});
+  std::ranges::sort(out, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  return out;
+}
+
+template <class G>
+G make_graph(const edge_vec& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+// Every vertex with a labelled neighbour holds one of their most frequent labels
+template <class G, class Label>
+bool is_fixed_point(const G& g, const std::vector<Label>& label, std::optional<Label> empty = std::nullopt) {
+  for (auto&& u : vertices(g)) {
+    std::map<Label, size_t> freq;
+    for (auto&& uv : edges(g, u)) {
+      const auto& l = label[target_id(g, uv)];
+      if (!empty || l != *empty)
+        ++freq[l];
+    }
+    if (freq.empty())
+      continue;
+    size_t top = 0;
+    for (auto& [l, c] : freq)
+      top = std::max(top, c);
+    auto it = freq.find(label[vertex_id(g, u)]);
+    if (it == freq.end() || it->second != top)
+      return false;
+  }
+  return true;
+}
+
+std::vector<uint32_t> iota_labels(size_t n) {
+  std::vector<uint32_t> label(n);
+  std::iota(label.begin(), label.end(), 0u);
+  return label;
+}
+
+} // namespace
+
+TEST_CASE("label_histogram - dense and hashed tallies", "[algorithm][label_propagation][histogram]") {
+  auto check = [](auto hist) {
+    hist.add(-3);
+    hist.add(7);
+    hist.add(-3);
+    hist.add(5);
+    hist.add(7);
+    REQUIRE(hist.max_count() == 2);
+
+    std::vector<std::pair<int, size_t>> seen;
+    hist.for_each([&](int l, size_t c) { seen.emplace_back(l, c); });
+    REQUIRE(seen == std::vector<std::pair<int, size_t>>{{-3, 2}, {7, 2}, {5, 1}});
+
+    // Ties are offered in first-counted order
+    REQUIRE(graph::detail::histogram_mode(hist, [](size_t ties) { return ties - 1; }) == 7);
+    REQUIRE(graph::detail::histogram_mode(hist, [](size_t) { return size_t{0}; }) == -3);
+
+    hist.clear();
+    REQUIRE(hist.empty());
+    REQUIRE(hist.max_count() == 0);
+    hist.add(5);
+    REQUIRE(graph::detail::histogram_mode(hist, [](size_t) { return size_t{0}; }) == 5);
+  };
+
+  check(graph::detail::dense_label_histogram<int>(-3, 11));
+  check(graph::detail::hashed_label_histogram<int>());
+
+  SECTION("hashed table grows with the neighbourhood") {
+    graph::detail::hashed_label_histogram<std::string> hist(1);
+    for (int round = 0; round < 3; ++round) {
+      hist.clear();
+      for (int i = 0; i < 1000; ++i)
+        hist.add(std::to_string(i % 300));
+      size_t distinct = 0;
+      hist.for_each([&](const std::string&, size_t c) {
+        ++distinct;
+        REQUIRE(c >= 3);
+      });
+      REQUIRE(distinct == 300);
+      REQUIRE(hist.max_count() == 4);
+    }
+  }
+
+  SECTION("range selection") {
+    bool dense = false;
+    auto probe = [&](auto make) { dense = std::is_same_v<decltype(make()), graph::detail::dense_label_histogram<int>>; };
+    graph::detail::with_label_histogram<int>(0, 999, 1000, 1, probe);
+    REQUIRE(dense);
+    graph::detail::with_label_histogram<int>(0, 999'999'999, 1000, 1, probe);
+    REQUIRE(!dense);
+    graph::detail::with_label_histogram<int>(std::nullopt, std::nullopt, 1000, 1, probe);
+    REQUIRE(!dense);
+  }
+}
+
+TEST_CASE("parallel_label_propagation - two cliques", "[algorithm][label_propagation][parallel]") {
+  const uint32_t k     = 12;
+  const auto     edges = two_cliques(k);
+  const auto     g     = make_graph<csr_void>(edges, 2 * k);
+
+  for (auto schedule : {label_propagation_schedule::synchronous, label_propagation_schedule::semi_synchronous}) {
+    for (size_t workers : {1, 4}) {
+      thread_pool pool(workers);
+      auto        label = iota_labels(2 * k);
+      parallel_label_propagation(g, container_value_fn(label),
+                                 label_propagation_options{.schedule = schedule, .symmetric = true, .max_iters = 100},
+                                 pool);
+      REQUIRE(std::all_of(label.begin(), label.begin() + k, [&](auto l) { return l == label[1]; }));
+      REQUIRE(std::all_of(label.begin() + k, label.end(), [&](auto l) { return l == label[k + 1]; }));
+      REQUIRE(label[1] != label[k + 1]);
+      REQUIRE(is_fixed_point(g, label));
+    }
+  }
+}
+
+TEST_CASE("parallel_label_propagation - schedules on random graphs", "[algorithm][label_propagation][parallel]") {
+  edge_vec edges;
+  for (auto& e : generators::barabasi_albert<uint32_t>(3000, 3, 5))
+    edges.push_back({e.source_id, e.target_id});
+  const auto g = make_graph<csr_void>(edges, 3000);
+
+  SECTION("semi-synchronous converges to a fixed point") {
+    for (size_t workers : {1, 4}) {
+      thread_pool pool(workers);
+      auto        label = iota_labels(3000);
+      parallel_label_propagation(g, container_value_fn(label), label_propagation_options{.symmetric = true}, pool);
+      REQUIRE(is_fixed_point(g, label));
+      REQUIRE(std::set(label.begin(), label.end()).size() < 300);
+    }
+  }
+
+  SECTION("synchronous results do not depend on the number of workers") {
+    std::vector<std::vector<uint32_t>> results;
+    for (size_t workers : {1, 2, 4}) {
+      thread_pool pool(workers);
+      auto        label = iota_labels(3000);
+      parallel_label_propagation(g, container_value_fn(label),
+                                 label_propagation_options{.schedule  = label_propagation_schedule::synchronous,
+                                                           .symmetric = true,
+                                                           .max_iters = 30,
+                                                           .seed      = 9},
+                                 pool);
+      results.push_back(std::move(label));
+    }
+    REQUIRE(results[0] == results[1]);
+    REQUIRE(results[0] == results[2]);
+  }
+
+  SECTION("without a frontier every vertex is re-examined") {
+    thread_pool pool(4);
+    auto        label = iota_labels(3000);
+    parallel_label_propagation(g, container_value_fn(label), label_propagation_options{}, pool);
+    REQUIRE(is_fixed_point(g, label));
+  }
+}
+
+TEST_CASE("parallel_label_propagation - single edge", "[algorithm][label_propagation][parallel]") {
+  const auto  g = make_graph<csr_void>({{0, 1}, {1, 0}}, 2);
+  thread_pool pool(2);
+
+  SECTION("synchronous updates swap the two labels") {
+    std::vector<int> label = {10, 20};
+    parallel_label_propagation(
+          g, container_value_fn(label),
+          label_propagation_options{.schedule = label_propagation_schedule::synchronous, .max_iters = 3}, pool);
+    REQUIRE(label == std::vector<int>{20, 10});
+  }
+
+  SECTION("semi-synchronous updates agree on one label") {
+    std::vector<int> label = {10, 20};
+    parallel_label_propagation(g, container_value_fn(label), label_propagation_options{.symmetric = true}, pool);
+    REQUIRE(label[0] == label[1]);
+  }
+}
+
+TEST_CASE("parallel_label_propagation - empty_label", "[algorithm][label_propagation][parallel]") {
+  // Path 0-1-2-3-4 plus an unlabelled pair 5-6
+  edge_vec edges;
+  for (uint32_t u = 0; u < 4; ++u) {
+    edges.push_back({u, u + 1});
+    edges.push_back({u + 1, u});
+  }
+  edges.push_back({5, 6});
+  edges.push_back({6, 5});
+  std::ranges::sort(edges, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+  const auto g = make_graph<csr_void>(edges, 7);
+
+  thread_pool      pool(4);
+  std::vector<int> label = {-1, -1, 42, -1, -1, -1, -1};
+  parallel_label_propagation(g, container_value_fn(label), -1, label_propagation_options{.symmetric = true}, pool);
+  REQUIRE(label == std::vector<int>{42, 42, 42, 42, 42, -1, -1});
+  REQUIRE(is_fixed_point(g, label, std::optional(-1)));
+}
+
+TEST_CASE("parallel_label_propagation - bidirectional graph and string labels",
+          "[algorithm][label_propagation][parallel]") {
+  // Frontier and coloring come from in_edges; labels use the hashed histogram
+  const uint32_t k = 8;
+  const auto     g = make_graph<bidir_nu_vov_void>(two_cliques(k), 2 * k);
+
+  thread_pool              pool(4);
+  std::vector<std::string> label;
+  for (uint32_t i = 0; i < 2 * k; ++i)
+    label.push_back("v" + std::to_string(i));
+  parallel_label_propagation(g, container_value_fn(label), label_propagation_options{.max_iters = 100}, pool);
+  REQUIRE(std::all_of(label.begin(), label.begin() + k, [&](auto& l) { return l == label[1]; }));
+  REQUIRE(std::all_of(label.begin() + k, label.end(), [&](auto& l) { return l == label[k + 1]; }));
+  REQUIRE(is_fixed_point(g, label));
+}
+
+TEST_CASE("parallel_label_propagation - empty graph", "[algorithm][label_propagation][parallel]") {
+  csr_void              g;
+  std::vector<uint32_t> label;
+  parallel_label_propagation(g, container_value_fn(label));
+  REQUIRE(label.empty());
+}
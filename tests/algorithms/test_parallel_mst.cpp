@@ -0,0 +1,250 @@
+/**
+ * @file test_parallel_mst.cpp
+ * @brief Tests for boruvka and filter_kruskal from parallel_mst.hpp
+ *
+ * Forests are checked against kruskal: the same total weight and number of components, and
+ * an output that is a forest of input edges. The random graphs are large enough for the
+ * parallel partition and filter passes and several filter-Kruskal levels, with tied and with
+ * distinct weights, and are run on pools of 1, 2 and 4 workers.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/parallel_mst.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using int_edge    = copyable_edge_t<uint32_t, int>;
+using double_edge = copyable_edge_t<uint32_t, double>;
+using csr_int     = compressed_graph<int, void, void, uint32_t, uint32_t>;
+using csr_double  = compressed_graph<double, void, void, uint32_t, uint64_t>;
+
+template <class Edge>
+std::vector<Edge> sorted(std::vector<Edge> edges) {
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  return edges;
+}
+
+template <class Edge>
+std::vector<Edge> symmetric(const std::vector<Edge>& edges) {
+  std::vector<Edge> out = edges;
+  for (const auto& e : edges)
+    out.push_back({e.target_id, e.source_id, e.value});
+  return sorted(std::move(out));
+}
+
+template <class G, class Edge>
+G make_graph(const std::vector<Edge>& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+// G(n, p) with weights 1..max_weight (ties when max_weight is small)
+std::vector<int_edge> random_int_edges(uint32_t n, double p, int max_weight, uint64_t seed) {
+  std::vector<int_edge> edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(n, p, seed))
+    edges.push_back({e.source_id, e.target_id, 1 + static_cast<int>(e.value * 1000) % max_weight});
+  return edges;
+}
+
+// Checks that forest holds n - components edges of input, without a cycle
+template <class Edge, class Forest>
+void check_forest(const std::vector<Edge>& input, const Forest& forest, uint32_t n, size_t components) {
+  REQUIRE(forest.size() + components == n);
+  std::set<std::tuple<uint32_t, uint32_t, decltype(Edge::value)>> in;
+  for (const auto& e : input)
+    in.insert({e.source_id, e.target_id, e.value});
+  disjoint_vector<uint32_t> subsets(n);
+  for (uint32_t v = 0; v < n; ++v)
+    subsets[v].id = v;
+  for (const auto& e : forest) {
+    REQUIRE(in.contains({e.source_id, e.target_id, e.value}));
+    REQUIRE(disjoint_union_find(subsets, e.source_id, e.target_id));
+  }
+}
+
+} // namespace
+
+TEST_CASE("boruvka - small graphs", "[algorithm][mst][boruvka]") {
+  thread_pool pool(2);
+
+  SECTION("empty graph") {
+    csr_int               g;
+    std::vector<int_edge> forest;
+    REQUIRE(boruvka(g, forest, pool) == std::pair<int, size_t>{0, 0});
+    REQUIRE(forest.empty());
+  }
+
+  SECTION("isolated vertices and self-loops") {
+    const auto            g = make_graph<csr_int>(std::vector<int_edge>{{1, 1, 5}, {2, 2, 1}}, 4);
+    std::vector<int_edge> forest;
+    REQUIRE(boruvka(g, forest, pool) == std::pair<int, size_t>{0, 4});
+    REQUIRE(forest.empty());
+  }
+
+  SECTION("CLRS example, both directions stored") {
+    // Cormen et al., Figure 23.1: MST weight 37
+    const std::vector<int_edge> edges = {{0, 1, 4}, {0, 7, 8},  {1, 2, 8}, {1, 7, 11}, {2, 3, 7},
+                                         {2, 5, 4}, {2, 8, 2},  {3, 4, 9}, {3, 5, 14}, {4, 5, 10},
+                                         {5, 6, 2}, {6, 7, 1},  {6, 8, 6}, {7, 8, 7}};
+    const auto                  both = symmetric(edges);
+    const auto                  g    = make_graph<csr_int>(both, 9);
+    std::vector<int_edge>       forest;
+    const auto [total, components]   = boruvka(g, forest, pool);
+    REQUIRE(total == 37);
+    REQUIRE(components == 1);
+    check_forest(both, forest, 9, components);
+  }
+
+  SECTION("one direction stored, two components") {
+    // {0, 1, 2, 3} and {4, 5}; the lightest edge of 3 is stored as 0 -> 3
+    const std::vector<int_edge> edges = {{0, 1, 5}, {0, 3, 1}, {1, 2, 2}, {2, 3, 3}, {5, 4, 7}};
+    const auto                  g     = make_graph<csr_int>(edges, 6);
+    std::vector<int_edge>       forest;
+    const auto [total, components]    = boruvka(g, forest, pool);
+    REQUIRE(total == 1 + 2 + 3 + 7);
+    REQUIRE(components == 2);
+    check_forest(edges, forest, 6, components);
+  }
+
+  SECTION("custom weight and maximum spanning tree") {
+    const std::vector<int_edge> edges = {{0, 1, 1}, {0, 2, 5}, {1, 2, 3}, {2, 3, 2}, {1, 3, 4}};
+    const auto                  g     = make_graph<csr_int>(symmetric(edges), 4);
+    std::vector<int_edge>       forest;
+    auto weight = [](const auto& gr, const auto& uv) { return 10 * edge_value(gr, uv); };
+    REQUIRE(boruvka(g, forest, weight, std::greater<>(), pool).first == 10 * (5 + 4 + 3));
+  }
+
+  SECTION("vov graph") {
+    const auto            edges = symmetric(random_int_edges(300, 4.0 / 300, 5, 3));
+    std::vector<int_edge> forest, expected;
+    const auto            g = make_graph<vov_weighted>(edges, 300);
+    const auto            got = boruvka(g, forest, pool);
+    REQUIRE(got.first == kruskal(edges, expected).first);
+    check_forest(edges, forest, 300, got.second);
+  }
+}
+
+TEST_CASE("boruvka - agrees with kruskal", "[algorithm][mst][boruvka]") {
+  for (size_t workers : {1u, 2u, 4u}) {
+    thread_pool pool(workers);
+    for (int max_weight : {3, 1'000'000}) {
+      // A path through all vertices keeps kruskal's vertex count equal to n
+      const uint32_t n     = 20'000;
+      auto           edges = random_int_edges(n, 6.0 / n, max_weight, 7);
+      edges.push_back({0, n - 1, max_weight});
+      edges = symmetric(edges);
+
+      std::vector<int_edge> expected, forest;
+      const auto            want = kruskal(edges, expected);
+      const auto            got  = boruvka(make_graph<csr_int>(edges, n), forest, pool);
+      INFO("workers = " << workers << ", max_weight = " << max_weight);
+      REQUIRE(got == want);
+      check_forest(edges, forest, n, got.second);
+    }
+  }
+}
+
+TEST_CASE("boruvka - result does not depend on the number of workers", "[algorithm][mst][boruvka]") {
+  std::vector<double_edge> edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(50'000, 5.0 / 50'000, 11))
+    edges.push_back({e.source_id, e.target_id, e.value});
+  const auto g = make_graph<csr_double>(sorted(edges), 50'000);
+
+  std::vector<double_edge> one, four;
+  thread_pool              pool1(1), pool4(4);
+  const auto               a = boruvka(g, one, pool1);
+  const auto               b = boruvka(g, four, pool4);
+  REQUIRE(a.second == b.second);
+  REQUIRE(one.size() == four.size());
+  for (size_t i = 0; i < one.size(); ++i)
+    REQUIRE(std::tie(one[i].source_id, one[i].target_id) == std::tie(four[i].source_id, four[i].target_id));
+}
+
+TEST_CASE("filter_kruskal - small edge lists", "[algorithm][mst][filter_kruskal]") {
+  thread_pool pool(2);
+
+  SECTION("empty input") {
+    std::vector<int_edge> edges, forest;
+    REQUIRE(filter_kruskal(edges, forest, pool) == std::pair<int, size_t>{0, 0});
+  }
+
+  SECTION("CLRS example") {
+    const std::vector<int_edge> edges = {{0, 1, 4}, {0, 7, 8},  {1, 2, 8}, {1, 7, 11}, {2, 3, 7},
+                                         {2, 5, 4}, {2, 8, 2},  {3, 4, 9}, {3, 5, 14}, {4, 5, 10},
+                                         {5, 6, 2}, {6, 7, 1},  {6, 8, 6}, {7, 8, 7}};
+    std::vector<int_edge>       forest;
+    REQUIRE(filter_kruskal(edges, forest, pool) == std::pair<int, size_t>{37, 1});
+    check_forest(edges, forest, 9, 1);
+    REQUIRE(std::ranges::is_sorted(forest, {}, [](const auto& e) { return e.value; }));
+  }
+
+  SECTION("maximum spanning tree") {
+    const std::vector<int_edge> edges = {{0, 1, 1}, {0, 2, 5}, {1, 2, 3}, {2, 3, 2}, {1, 3, 4}};
+    std::vector<int_edge>       forest, expected;
+    REQUIRE(filter_kruskal(edges, forest, std::greater<int>(), pool) ==
+            kruskal(edges, expected, std::greater<int>()));
+    REQUIRE(forest.size() == 3);
+  }
+
+  SECTION("forward range input") {
+    const std::vector<int_edge> source = {{0, 1, 2}, {1, 2, 1}, {0, 2, 3}, {3, 4, 1}};
+    std::list<int_edge>         edges(source.begin(), source.end());
+    std::vector<int_edge>       forest;
+    REQUIRE(filter_kruskal(edges, forest, pool) == std::pair<int, size_t>{4, 2});
+  }
+}
+
+TEST_CASE("filter_kruskal - agrees with kruskal", "[algorithm][mst][filter_kruskal]") {
+  for (size_t workers : {1u, 2u, 4u}) {
+    thread_pool pool(workers);
+    // Dense enough for several levels above the 4096-edge base case; max_weight 1 makes every
+    // pivot the smallest weight
+    for (int max_weight : {1, 4, 1'000'000}) {
+      const uint32_t n     = 2'000;
+      auto           edges = random_int_edges(n, 30.0 / n, max_weight, 5);
+      edges.push_back({0, n - 1, max_weight});
+
+      std::vector<int_edge> expected, forest;
+      const auto            want = kruskal(edges, expected);
+      const auto            got  = filter_kruskal(edges, forest, pool);
+      INFO("workers = " << workers << ", max_weight = " << max_weight);
+      REQUIRE(got == want);
+      check_forest(edges, forest, n, got.second);
+    }
+  }
+}
+
+TEST_CASE("filter_kruskal - disconnected graph with double weights", "[algorithm][mst][filter_kruskal]") {
+  thread_pool              pool(3);
+  std::vector<double_edge> edges;
+  // Two random graphs on disjoint vertex ranges, and isolated vertices up to 3 * n
+  const uint32_t n = 5'000;
+  for (uint32_t part = 0; part < 2; ++part)
+    for (auto& e : generators::erdos_renyi<uint32_t>(n, 8.0 / n, 20 + part))
+      edges.push_back({part * n + e.source_id, part * n + e.target_id, e.value});
+  edges.push_back({3 * n - 1, 3 * n - 1, 1.0});
+
+  std::vector<double_edge> expected, forest;
+  const auto               want = kruskal(edges, expected);
+  const auto               got  = filter_kruskal(edges, forest, pool);
+  REQUIRE(got.second == want.second);
+  REQUIRE(std::abs(got.first - want.first) <= 1e-9 * want.first);
+  check_forest(edges, forest, 3 * n, got.second);
+}
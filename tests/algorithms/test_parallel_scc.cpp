@@ -0,0 +1,189 @@
+/**
+ * @file test_parallel_scc.cpp
+ * @brief Tests for parallel_scc from parallel_scc.hpp
+ *
+ * Partitions are checked against tarjan_scc on graphs that exercise every phase: DAGs and
+ * chains (trimming), a giant SCC (forward-backward), many mid-sized SCCs (coloring), and
+ * chains of cycles that coloring peels one per round (serial fallback). Covers the transpose,
+ * bidirectional and in-edge index paths, and that the result does not depend on the number
+ * of workers.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/parallel_scc.hpp>
+#include <graph/algorithm/tarjan_scc.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr       = compressed_graph<void, void, void, uint32_t, uint32_t>;
+using csr_bidir = compressed_graph<void, void, void, uint32_t, uint32_t, true>;
+using edge_vec  = std::vector<copyable_edge_t<uint32_t, void>>;
+
+edge_vec sorted(edge_vec edges) {
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  return edges;
+}
+
+edge_vec reversed(const edge_vec& edges) {
+  edge_vec out;
+  for (auto& e : edges)
+    out.push_back({e.target_id, e.source_id});
+  return sorted(std::move(out));
+}
+
+edge_vec random_edges(uint32_t n, double p, uint64_t seed) {
+  edge_vec edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(n, p, seed))
+    edges.push_back({e.source_id, e.target_id});
+  return sorted(std::move(edges));
+}
+
+// `count` directed cycles of `len` vertices, cycle k linked to cycle k - 1, so colors flow
+// from the last cycle to the first and each coloring round finds only one SCC
+edge_vec chained_cycles(uint32_t count, uint32_t len) {
+  edge_vec edges;
+  for (uint32_t k = 0; k < count; ++k) {
+    for (uint32_t i = 0; i < len; ++i)
+      edges.push_back({k * len + i, k * len + (i + 1) % len});
+    if (k > 0)
+      edges.push_back({k * len, (k - 1) * len});
+  }
+  return sorted(std::move(edges));
+}
+
+template <class G>
+G make_graph(const edge_vec& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+// Replaces every component id by the smallest vertex of its component
+std::vector<uint32_t> canonical(const std::vector<uint32_t>& comp) {
+  std::unordered_map<uint32_t, uint32_t> first;
+  std::vector<uint32_t>                  out(comp.size());
+  for (uint32_t v = 0; v < comp.size(); ++v)
+    out[v] = first.try_emplace(comp[v], v).first->second;
+  return out;
+}
+
+// Checks parallel_scc through all three in-edge sources against tarjan_scc, which does not
+// take compressed_graph
+void check(const edge_vec& edges, uint32_t n, size_t workers) {
+  thread_pool           pool(workers);
+  std::vector<uint32_t> exp(n), got(n);
+  const size_t          num = tarjan_scc(make_graph<vov_void>(edges, n), container_value_fn(exp));
+  const auto            ref = canonical(exp);
+
+  const auto g = make_graph<csr>(edges, n);
+  REQUIRE(parallel_scc(g, container_value_fn(got), pool) == num);
+  REQUIRE(canonical(got) == ref);
+  REQUIRE(std::ranges::max(got, {}, [](uint32_t c) { return c; }) + 1 == num);
+
+  REQUIRE(parallel_scc(make_graph<csr_bidir>(edges, n), container_value_fn(got), pool) == num);
+  REQUIRE(canonical(got) == ref);
+
+  REQUIRE(parallel_scc(g, make_graph<csr>(reversed(edges), n), container_value_fn(got), pool) == num);
+  REQUIRE(canonical(got) == ref);
+}
+
+} // namespace
+
+TEST_CASE("parallel_scc - small graphs", "[algorithm][parallel_scc][scc]") {
+  thread_pool pool(2);
+
+  SECTION("empty graph") {
+    csr                   g;
+    std::vector<uint32_t> comp;
+    REQUIRE(parallel_scc(g, container_value_fn(comp), pool) == 0);
+  }
+
+  SECTION("single vertex with a self-loop") {
+    const auto            g = make_graph<csr>({{0, 0}}, 1);
+    std::vector<uint32_t> comp(1, 99);
+    REQUIRE(parallel_scc(g, container_value_fn(comp), pool) == 1);
+    REQUIRE(comp[0] == 0);
+  }
+
+  SECTION("two cycles joined by one edge") {
+    // {0,1,2} -> {3,4}, 5 isolated
+    const auto            g = make_graph<csr>(sorted({{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 3}}), 6);
+    std::vector<uint32_t> comp(6);
+    REQUIRE(parallel_scc(g, container_value_fn(comp), pool) == 3);
+    REQUIRE((comp[0] == comp[1] && comp[1] == comp[2]));
+    REQUIRE(comp[3] == comp[4]);
+    REQUIRE(comp[0] != comp[3]);
+    REQUIRE(comp[5] != comp[0]);
+    REQUIRE(comp[5] != comp[3]);
+  }
+
+  SECTION("vov graph") {
+    const auto            edges = random_edges(300, 1.5 / 300, 2);
+    std::vector<uint32_t> exp(300), got(300);
+    const auto            g = make_graph<vov_void>(edges, 300);
+    REQUIRE(parallel_scc(g, container_value_fn(got), pool) == tarjan_scc(g, container_value_fn(exp)));
+    REQUIRE(canonical(got) == canonical(exp));
+  }
+}
+
+TEST_CASE("parallel_scc - agrees with tarjan_scc", "[algorithm][parallel_scc][scc]") {
+  for (size_t workers : {1, 4}) {
+    SECTION("sparse random graph: many small SCCs and trimming") {
+      check(random_edges(5000, 1.2 / 5000, 7), 5000, workers);
+    }
+    SECTION("denser random graph: one giant SCC") {
+      check(random_edges(5000, 4.0 / 5000, 8), 5000, workers);
+    }
+    SECTION("many mid-sized SCCs: coloring rounds") {
+      // 200 dense random blocks of 20 vertices, joined by a random DAG between the blocks
+      edge_vec edges;
+      for (auto& e : random_edges(4000, 4.0 / 4000, 9))
+        if (e.source_id / 20 == e.target_id / 20 || e.source_id / 20 < e.target_id / 20)
+          edges.push_back(e);
+      for (uint32_t b = 0; b < 200; ++b)
+        for (uint32_t i = 0; i < 20; ++i)
+          edges.push_back({b * 20 + i, b * 20 + (i + 1) % 20});
+      check(sorted(std::move(edges)), 4000, workers);
+    }
+    SECTION("chained cycles: serial fallback") {
+      check(chained_cycles(2000, 3), 6000, workers);
+    }
+    SECTION("DAG: everything is trimmed") {
+      edge_vec edges;
+      for (auto& e : random_edges(3000, 3.0 / 3000, 10))
+        if (e.source_id < e.target_id)
+          edges.push_back(e);
+      check(edges, 3000, workers);
+    }
+    SECTION("self-loops and repeated edges") {
+      auto edges = random_edges(3000, 1.5 / 3000, 11);
+      for (uint32_t v = 0; v < 3000; v += 3)
+        edges.push_back({v, v});
+      const size_t m = edges.size();
+      for (size_t i = 0; i < m; i += 2)
+        edges.push_back(edges[i]);
+      check(sorted(std::move(edges)), 3000, workers);
+    }
+  }
+}
+
+TEST_CASE("parallel_scc - component ids do not depend on the number of workers", "[algorithm][parallel_scc][scc]") {
+  const uint32_t n = 20000;
+  const auto     g = make_graph<csr_bidir>(random_edges(n, 1.5 / n, 12), n);
+
+  std::vector<uint32_t> a(n), b(n);
+  thread_pool           one(1), four(4);
+  REQUIRE(parallel_scc(g, container_value_fn(a), one) == parallel_scc(g, container_value_fn(b), four));
+  REQUIRE(a == b);
+}
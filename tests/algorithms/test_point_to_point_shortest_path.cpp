@@ -0,0 +1,324 @@
+/**
+ * @file test_point_to_point_shortest_path.cpp
+ * @brief Tests for dijkstra_shortest_path, bidirectional_dijkstra_shortest_path and
+ *        astar_shortest_path from point_to_point_shortest_path.hpp
+ *
+ * Every query is checked against the distances of a full dijkstra_shortest_paths run, and its
+ * predecessor chain against the edge weights along it.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/point_to_point_shortest_path.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/traversal_workspace.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::container;
+using namespace graph::test::fixtures;
+
+namespace {
+
+using bidir_csr = compressed_graph<double, void, void, uint32_t, uint32_t, true>;
+using csr_t     = compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+constexpr auto edge_weight = [](const auto& g, const auto& uv) { return edge_value(g, uv); };
+constexpr auto int_weight  = [](const auto& g, const auto& uv) { return static_cast<uint32_t>(edge_value(g, uv)); };
+constexpr auto inf         = infinite_distance<double>();
+
+// Sums of the same weights added in another order may differ in the last bits
+bool near(double a, double b) { return a == b || std::abs(a - b) <= 1e-9 * std::max(std::abs(a), std::abs(b)); }
+
+// In-edges of vov_graph_traits<..., true> are out-edge records without source_id(); these
+// traits store dynamic_in_edge instead (as in test_scc_bidirectional.cpp).
+template <class EV, class VId = uint32_t>
+struct vov_bidir_graph_traits {
+  using edge_value_type   = EV;
+  using vertex_value_type = void;
+  using graph_value_type  = void;
+  using vertex_id_type    = VId;
+  static constexpr bool bidirectional = true;
+
+  using edge_type    = dynamic_out_edge<EV, void, void, VId, true, vov_bidir_graph_traits>;
+  using in_edge_type = dynamic_in_edge<EV, void, void, VId, true, vov_bidir_graph_traits>;
+  using vertex_type  = dynamic_vertex<EV, void, void, VId, true, vov_bidir_graph_traits>;
+  using graph_type   = dynamic_graph<EV, void, void, VId, true, vov_bidir_graph_traits>;
+
+  using edges_type    = std::vector<edge_type>;
+  using in_edges_type = std::vector<in_edge_type>;
+  using vertices_type = std::vector<vertex_type>;
+};
+
+template <class G>
+G load(const generators::edge_list<uint32_t>& edges, uint32_t n) {
+  G g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+generators::edge_list<uint32_t> transposed(generators::edge_list<uint32_t> edges) {
+  for (auto& e : edges)
+    std::swap(e.source_id, e.target_id);
+  std::ranges::sort(edges, {}, [](const auto& e) { return std::pair(e.source_id, e.target_id); });
+  return edges;
+}
+
+template <class G>
+std::vector<double> all_distances(const G& g, uint32_t seed_id) {
+  std::vector<double> dist(num_vertices(g));
+  init_shortest_paths(g, dist);
+  dijkstra_shortest_distances(g, seed_id, container_value_fn(dist), edge_weight);
+  return dist;
+}
+
+// Follows predecessor from target_vid to source_vid, adding the lightest edge weight of each step
+template <class G, class Pred>
+double path_length(const G& g, uint32_t source_vid, uint32_t target_vid, Pred&& pred) {
+  double   length = 0;
+  uint32_t x      = target_vid;
+  for (size_t steps = 0; x != source_vid; ++steps) {
+    REQUIRE(steps < num_vertices(g));
+    const uint32_t p = pred(x);
+    double         w = inf;
+    for (auto&& [vid, uv] : views::incidence(g, *find_vertex(g, p)))
+      if (vid == x)
+        w = std::min(w, static_cast<double>(edge_value(g, uv)));
+    REQUIRE(w != inf);
+    length += w;
+    x = p;
+  }
+  return length;
+}
+
+} // namespace
+
+TEST_CASE("point-to-point searches match dijkstra_shortest_paths", "[algorithm][dijkstra][point_to_point]") {
+  const uint32_t n     = 2'000;
+  const auto     edges = generators::erdos_renyi<uint32_t>(n, 0.002, 5);
+  const auto     g     = load<bidir_csr>(edges, n);
+  const auto     g_t   = load<csr_t>(transposed(edges), n);
+
+  // Epoch-stamped property maps: each query resets them in O(1) and touches only what it explores
+  epoch_vertex_map<double, uint32_t>   dist, rdist;
+  epoch_vertex_map<uint32_t, uint32_t> pred, succ;
+  auto                                 distance_fn = [&](const auto&, uint32_t uid) -> double& { return dist[uid]; };
+  auto reverse_fn   = [&](const auto&, uint32_t uid) -> double& { return rdist[uid]; };
+  auto pred_fn      = [&](const auto&, uint32_t uid) -> uint32_t& { return pred[uid]; };
+  auto succ_fn      = [&](const auto&, uint32_t uid) -> uint32_t& { return succ[uid]; };
+  auto reset        = [&] {
+    dist.clear(n, inf);
+    rdist.clear(n, inf);
+    pred.clear(n, 0);
+    succ.clear(n, 0);
+  };
+  auto pred_of = [&](uint32_t x) { return pred.get(x); };
+
+  std::mt19937_64 rng(11);
+  for (int query = 0; query < 40; ++query) {
+    const uint32_t s        = static_cast<uint32_t>(rng() % n);
+    const uint32_t t        = static_cast<uint32_t>(rng() % n);
+    const auto     from_s   = all_distances(g, s);
+    const auto     to_t     = all_distances(g_t, t);
+    const double   expected = from_s[t];
+
+    reset();
+    REQUIRE(dijkstra_shortest_path(g, s, t, distance_fn, pred_fn, edge_weight) == expected);
+    if (expected != inf) {
+      REQUIRE(dist.keys().size() <= n);
+      REQUIRE(near(path_length(g, s, t, pred_of), expected));
+    }
+
+    reset();
+    REQUIRE(near(bidirectional_dijkstra_shortest_path(g, s, t, distance_fn, pred_fn, reverse_fn, succ_fn, edge_weight),
+                 expected));
+    if (expected != inf)
+      REQUIRE(near(path_length(g, s, t, pred_of), expected));
+
+    // Consistent heuristic: half the true remaining distance
+    auto half = [&](const auto&, uint32_t uid) { return to_t[uid] == inf ? 0.0 : to_t[uid] / 2; };
+    reset();
+    REQUIRE(astar_shortest_path(g, s, t, half, distance_fn, pred_fn, edge_weight) == expected);
+    if (expected != inf)
+      REQUIRE(near(path_length(g, s, t, pred_of), expected));
+
+    // Admissible but inconsistent: exact on odd vertices, 0 on even ones
+    auto patchy = [&](const auto&, uint32_t uid) { return (uid % 2 == 0 || to_t[uid] == inf) ? 0.0 : to_t[uid]; };
+    reset();
+    REQUIRE(astar_shortest_path(g, s, t, patchy, distance_fn, pred_fn, edge_weight) == expected);
+  }
+}
+
+TEST_CASE("point-to-point searches explore less than the full search", "[algorithm][dijkstra][point_to_point]") {
+  const uint32_t side = 100, n = side * side;
+  const auto     edges = generators::grid_2d<uint32_t>(side, side, 3);
+  const auto     g     = load<bidir_csr>(edges, n);
+
+  epoch_vertex_map<double, uint32_t> dist, rdist;
+  auto                               distance_fn = [&](const auto&, uint32_t uid) -> double& { return dist[uid]; };
+  auto                               reverse_fn  = [&](const auto&, uint32_t uid) -> double& { return rdist[uid]; };
+
+  // Source and target 10 steps apart near the middle of the grid; weights are at least 1
+  const uint32_t s        = 50 * side + 45;
+  const uint32_t t        = 50 * side + 55;
+  const double   expected = all_distances(g, s)[t];
+  auto           manhattan = [&](const auto&, uint32_t uid) {
+    return static_cast<double>(std::abs(int(uid / side) - int(t / side)) + std::abs(int(uid % side) - int(t % side)));
+  };
+
+  dist.clear(n, inf);
+  REQUIRE(dijkstra_shortest_path(g, s, t, distance_fn, _null_predecessor, edge_weight) == expected);
+  const size_t dijkstra_reached = dist.keys().size();
+
+  dist.clear(n, inf);
+  rdist.clear(n, inf);
+  REQUIRE(near(bidirectional_dijkstra_shortest_path(g, s, t, distance_fn, _null_predecessor, reverse_fn,
+                                                    _null_predecessor, edge_weight),
+               expected));
+  std::vector<uint32_t> both(dist.keys().begin(), dist.keys().end());
+  both.insert(both.end(), rdist.keys().begin(), rdist.keys().end());
+  std::ranges::sort(both);
+  const size_t bidirectional_reached = static_cast<size_t>(std::ranges::distance(both.begin(), std::ranges::unique(both).begin()));
+
+  dist.clear(n, inf);
+  REQUIRE(astar_shortest_path(g, s, t, manhattan, distance_fn, _null_predecessor, edge_weight) == expected);
+  const size_t astar_reached = dist.keys().size();
+
+  CHECK(dijkstra_reached < n / 2);
+  CHECK(bidirectional_reached < dijkstra_reached);
+  CHECK(astar_reached <= dijkstra_reached);
+}
+
+TEST_CASE("point-to-point searches with integer heaps", "[algorithm][dijkstra][point_to_point][radix_heap]") {
+  const uint32_t n     = 1'500;
+  const auto     g     = load<bidir_csr>(generators::erdos_renyi<uint32_t>(n, 0.003, 21), n);
+  const auto     g_int = [&](uint32_t s) {
+    std::vector<uint64_t> d(n);
+    init_shortest_paths(g, d);
+    dijkstra_shortest_distances(g, s, container_value_fn(d), int_weight);
+    return d;
+  };
+
+  std::vector<uint32_t> dist(n), rdist(n), pred(n), succ(n);
+  auto                  reset = [&] {
+    init_shortest_paths(g, dist, pred);
+    init_shortest_paths(g, rdist, succ);
+  };
+  auto run_all = [&](uint32_t s, uint32_t t, auto heap) {
+    std::vector<uint32_t> results;
+    reset();
+    results.push_back(dijkstra_shortest_path(g, s, t, container_value_fn(dist), container_value_fn(pred), int_weight,
+                                             std::less<uint32_t>{}, std::plus<uint32_t>{}, heap));
+    reset();
+    results.push_back(bidirectional_dijkstra_shortest_path(g, s, t, container_value_fn(dist), container_value_fn(pred),
+                                                           container_value_fn(rdist), container_value_fn(succ),
+                                                           int_weight, std::less<uint32_t>{}, std::plus<uint32_t>{},
+                                                           heap));
+    reset();
+    auto zero = [](const auto&, uint32_t) { return uint32_t{0}; };
+    results.push_back(astar_shortest_path(g, s, t, zero, container_value_fn(dist), container_value_fn(pred),
+                                          int_weight, std::less<uint32_t>{}, std::plus<uint32_t>{}, heap));
+    return results;
+  };
+
+  for (uint32_t s : {0u, 7u, 900u}) {
+    const auto expected = g_int(s);
+    for (uint32_t t : {1u, 2u, 444u, 1'499u}) {
+      const uint32_t want = expected[t] == infinite_distance<uint64_t>() ? infinite_distance<uint32_t>()
+                                                                         : static_cast<uint32_t>(expected[t]);
+      for (uint32_t d : run_all(s, t, use_default_heap{}))
+        REQUIRE(d == want);
+      for (uint32_t d : run_all(s, t, use_radix_heap{}))
+        REQUIRE(d == want);
+      for (uint32_t d : run_all(s, t, use_bucket_heap{}))
+        REQUIRE(d == want);
+      for (uint32_t d : run_all(s, t, use_indexed_dary_heap<4>{}))
+        REQUIRE(d == want);
+    }
+  }
+}
+
+TEST_CASE("bidirectional_dijkstra_shortest_path on a bidirectional dynamic_graph",
+          "[algorithm][dijkstra][point_to_point]") {
+  using Graph = dynamic_graph<int, void, void, uint32_t, true, vov_bidir_graph_traits<int>>;
+  static_assert(bidirectional_adjacency_list<Graph>);
+
+  // The CLRS example
+  Graph g({{0, 1, 10}, {0, 2, 5}, {1, 2, 2}, {1, 3, 1}, {2, 1, 3}, {2, 3, 9}, {2, 4, 2}, {3, 4, 4}, {4, 0, 7}, {4, 3, 6}});
+  std::vector<int>       dist(5), rdist(5);
+  std::vector<uint32_t>  pred(5), succ(5);
+  const std::vector<int> expected{0, 8, 5, 9, 7};
+  for (uint32_t t = 0; t < 5; ++t) {
+    init_shortest_paths(g, dist, pred);
+    init_shortest_paths(g, rdist, succ);
+    REQUIRE(bidirectional_dijkstra_shortest_path(g, 0u, t, container_value_fn(dist), container_value_fn(pred),
+                                                 container_value_fn(rdist), container_value_fn(succ),
+                                                 [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }) ==
+            expected[t]);
+  }
+}
+
+TEST_CASE("point-to-point searches: edge cases", "[algorithm][dijkstra][point_to_point]") {
+  const auto            g = load<bidir_csr>({{0, 1, 2.0}, {1, 2, 3.0}, {3, 0, 1.0}}, 4);
+  std::vector<double>   dist(4), rdist(4);
+  std::vector<uint32_t> pred(4), succ(4);
+  auto                  reset = [&] {
+    init_shortest_paths(g, dist, pred);
+    init_shortest_paths(g, rdist, succ);
+  };
+  auto bidir = [&](uint32_t s, uint32_t t) {
+    return bidirectional_dijkstra_shortest_path(g, s, t, container_value_fn(dist), container_value_fn(pred),
+                                                container_value_fn(rdist), container_value_fn(succ), edge_weight);
+  };
+  auto zero = [](const auto&, uint32_t) { return 0.0; };
+
+  SECTION("source is the target") {
+    reset();
+    REQUIRE(dijkstra_shortest_path(g, 1u, 1u, container_value_fn(dist), container_value_fn(pred), edge_weight) == 0);
+    reset();
+    REQUIRE(bidir(1, 1) == 0);
+  }
+  SECTION("unreachable target") {
+    reset();
+    REQUIRE(dijkstra_shortest_path(g, 0u, 3u, container_value_fn(dist), container_value_fn(pred), edge_weight) == inf);
+    reset();
+    REQUIRE(bidir(0, 3) == inf);
+    reset();
+    REQUIRE(astar_shortest_path(g, 2u, 0u, zero, container_value_fn(dist), container_value_fn(pred), edge_weight) ==
+            inf);
+  }
+  SECTION("full path through the meeting point") {
+    reset();
+    REQUIRE(bidir(3, 2) == 6.0);
+    REQUIRE(pred[2] == 1);
+    REQUIRE(pred[1] == 0);
+    REQUIRE(pred[0] == 3);
+    REQUIRE(dist[2] == 6.0);
+  }
+  SECTION("out-of-range endpoints throw") {
+    reset();
+    REQUIRE_THROWS_AS(dijkstra_shortest_path(g, 4u, 0u, container_value_fn(dist), container_value_fn(pred)),
+                      std::out_of_range);
+    REQUIRE_THROWS_AS(bidir(0, 9), std::out_of_range);
+    REQUIRE_THROWS_AS(astar_shortest_path(g, 0u, 4u, zero, container_value_fn(dist), container_value_fn(pred)),
+                      std::out_of_range);
+  }
+  SECTION("negative weight throws") {
+    const auto neg = load<bidir_csr>({{0, 1, -1.0}}, 2);
+    reset();
+    REQUIRE_THROWS_AS(dijkstra_shortest_path(neg, 0u, 1u, container_value_fn(dist), container_value_fn(pred),
+                                             edge_weight),
+                      std::out_of_range);
+  }
+}
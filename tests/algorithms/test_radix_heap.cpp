@@ -0,0 +1,236 @@
+/**
+ * @file test_radix_heap.cpp
+ * @brief Tests for the monotone integer queues (radix_heap, bucket_queue) and the
+ *        use_radix_heap / use_bucket_heap paths of dijkstra_shortest_paths and prim.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/detail/radix_heap.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/mst.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::test;
+using namespace graph::test::fixtures;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr_t = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+// Integer weights 1..99 taken from the uniform [1, 100) edge values
+constexpr auto int_weight = [](const auto& g, const auto& uv) { return static_cast<uint32_t>(edge_value(g, uv)); };
+
+struct CountingVisitor {
+  int discover    = 0;
+  int examine     = 0;
+  int finish      = 0;
+  int relaxed     = 0;
+  int not_relaxed = 0;
+
+  template <typename G, typename V> void on_discover_vertex (const G&, const V&) { ++discover;  }
+  template <typename G, typename V> void on_examine_vertex  (const G&, const V&) { ++examine;   }
+  template <typename G, typename V> void on_finish_vertex   (const G&, const V&) { ++finish;    }
+  template <typename G, typename E> void on_edge_relaxed    (const G&, const E&) { ++relaxed;   }
+  template <typename G, typename E> void on_edge_not_relaxed(const G&, const E&) { ++not_relaxed; }
+};
+
+// Pushes monotone keys (never below the last popped) interleaved with pops; checks that the
+// queue pops the same keys as a sorted reference.
+template <class Queue>
+void monotone_stress(Queue& q, uint32_t max_step, uint64_t seed) {
+  std::mt19937_64       rng(seed);
+  std::vector<uint32_t> pending; // reference: the queued keys
+  uint32_t              last = 0;
+  for (int round = 0; round < 20'000; ++round) {
+    if (pending.empty() || rng() % 3 != 0) {
+      const uint32_t key = last + static_cast<uint32_t>(rng() % (max_step + 1));
+      q.push(key, round);
+      pending.push_back(key);
+    } else {
+      const auto it = std::ranges::min_element(pending);
+      REQUIRE(q.top().first == *it);
+      last = *it;
+      pending.erase(it);
+      q.pop();
+    }
+    REQUIRE(q.size() == pending.size());
+  }
+}
+
+} // namespace
+
+TEST_CASE("radix_heap pops monotone keys in order", "[heap][radix_heap]") {
+  SECTION("small steps") {
+    graph::detail::radix_heap<uint32_t, int> q;
+    monotone_stress(q, 100, 1);
+  }
+  SECTION("large steps") {
+    graph::detail::radix_heap<uint32_t, int> q;
+    monotone_stress(q, 1'000'000, 2);
+  }
+  SECTION("64-bit keys and clear") {
+    graph::detail::radix_heap<uint64_t, int> q;
+    q.push(uint64_t{1} << 40, 1);
+    q.push(3, 2);
+    q.push(uint64_t{1} << 63, 3);
+    REQUIRE(q.top().second == 2);
+    q.pop();
+    REQUIRE(q.top().second == 1);
+    q.clear();
+    REQUIRE(q.empty());
+    q.push(0, 4);
+    REQUIRE(q.top().first == 0);
+  }
+}
+
+TEST_CASE("bucket_queue pops keys in order", "[heap][bucket_queue]") {
+  SECTION("monotone keys, growing span") {
+    graph::detail::bucket_queue<uint32_t, int> q;
+    monotone_stress(q, 5'000, 3);
+  }
+  SECTION("keys below the last popped one, within a bounded range") {
+    graph::detail::bucket_queue<uint16_t, int> q;
+    std::mt19937_64                            rng(4);
+    std::vector<uint16_t>                      pending;
+    for (int round = 0; round < 20'000; ++round) {
+      if (pending.empty() || rng() % 2 != 0) {
+        const auto key = static_cast<uint16_t>(rng() % 300);
+        q.push(key, round);
+        pending.push_back(key);
+      } else {
+        const auto it = std::ranges::min_element(pending);
+        REQUIRE(q.top().first == *it);
+        pending.erase(it);
+        q.pop();
+      }
+    }
+  }
+}
+
+TEST_CASE("dijkstra(radix/bucket heap) - CLRS example", "[algorithm][dijkstra][radix_heap]") {
+  using Graph = vov_weighted;
+  auto g      = clrs_dijkstra_graph<Graph>();
+
+  auto run = [&](auto heap_tag) {
+    std::vector<int>                distance(num_vertices(g));
+    std::vector<vertex_id_t<Graph>> predecessor(num_vertices(g));
+    init_shortest_paths(g, distance, predecessor);
+    dijkstra_shortest_paths(g, vertex_id_t<Graph>(0), container_value_fn(distance), container_value_fn(predecessor),
+                            [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, empty_visitor{},
+                            std::less<int>{}, std::plus<int>{}, heap_tag, std::allocator<std::byte>{});
+    return distance;
+  };
+
+  for (const auto& distance : {run(use_radix_heap{}), run(use_bucket_heap{})})
+    for (size_t i = 0; i < clrs_dijkstra_results::distances_from_0.size(); ++i)
+      CHECK(distance[i] == clrs_dijkstra_results::distances_from_0[i]);
+}
+
+TEST_CASE("dijkstra(radix/bucket heap) - matches the binary heap on integer weights",
+          "[algorithm][dijkstra][radix_heap]") {
+  csr_t g;
+  g.load_edges(generators::erdos_renyi<uint32_t>(4'000, 0.002, 9), std::identity{}, 4'000);
+  const auto n = num_vertices(g);
+
+  // Reference: signed distances keep the std::priority_queue path
+  auto reference = [&](auto weight) {
+    std::vector<int64_t> distance(n);
+    init_shortest_paths(g, distance);
+    CountingVisitor counts;
+    dijkstra_shortest_distances(g, std::vector<uint32_t>{0, 17}, container_value_fn(distance), weight, counts);
+    return std::make_tuple(distance, counts);
+  };
+  auto run = [&](auto weight, auto heap_tag) {
+    std::vector<uint32_t> distance(n);
+    std::vector<uint32_t> predecessor(n);
+    init_shortest_paths(g, distance, predecessor);
+    CountingVisitor counts;
+    dijkstra_shortest_paths(g, std::vector<uint32_t>{0, 17}, container_value_fn(distance),
+                            container_value_fn(predecessor), weight, counts, std::less<uint32_t>{},
+                            std::plus<uint32_t>{}, heap_tag, std::allocator<std::byte>{});
+    return std::make_tuple(distance, counts);
+  };
+  auto check = [&](auto weight, auto heap_tag) {
+    const auto [expected, expected_counts] = reference(weight);
+    const auto [distance, counts]          = run(weight, heap_tag);
+    for (size_t v = 0; v < n; ++v) {
+      if (expected[v] == infinite_distance<int64_t>())
+        REQUIRE(distance[v] == infinite_distance<uint32_t>());
+      else
+        REQUIRE(distance[v] == expected[v]);
+    }
+    REQUIRE(counts.discover == expected_counts.discover);
+    REQUIRE(counts.examine == expected_counts.examine);
+    REQUIRE(counts.finish == expected_counts.finish);
+    REQUIRE(counts.relaxed + counts.not_relaxed == expected_counts.relaxed + expected_counts.not_relaxed);
+  };
+
+  auto unit_weight = [](const auto&, const auto&) { return uint32_t{1}; };
+  SECTION("uniform integer weights") {
+    check(int_weight, use_radix_heap{});
+    check(int_weight, use_bucket_heap{});
+    check(int_weight, use_default_heap{}); // unsigned distances select the radix heap
+  }
+  SECTION("unit weights") {
+    check(unit_weight, use_radix_heap{});
+    check(unit_weight, use_bucket_heap{});
+  }
+}
+
+TEST_CASE("dijkstra(radix/bucket heap) - throws on out-of-range source", "[algorithm][dijkstra][radix_heap]") {
+  using Graph = vov_weighted;
+  auto                            g = clrs_dijkstra_graph<Graph>();
+  std::vector<int>                distance(num_vertices(g));
+  std::vector<vertex_id_t<Graph>> predecessor(num_vertices(g));
+  init_shortest_paths(g, distance, predecessor);
+  CHECK_THROWS_AS(dijkstra_shortest_paths(g, vertex_id_t<Graph>(99), container_value_fn(distance),
+                                          container_value_fn(predecessor),
+                                          [](const auto& gr, const auto& uv) { return edge_value(gr, uv); },
+                                          empty_visitor{}, std::less<int>{}, std::plus<int>{}, use_radix_heap{},
+                                          std::allocator<std::byte>{}),
+                  std::out_of_range);
+}
+
+TEST_CASE("prim - bucket and radix heap parity", "[algorithm][mst][prim][radix_heap]") {
+  using Graph = vov_weighted;
+  using vid_t = vertex_id_t<Graph>;
+
+  // The graph of "prim - indexed d-ary heap parity": MST weight 18, with edges into
+  // finalized vertices cheaper than their tree edge
+  Graph g({{0, 1, 4}, {1, 0, 4}, {0, 2, 1}, {2, 0, 1}, {1, 2, 2}, {2, 1, 2},
+           {1, 3, 5}, {3, 1, 5}, {2, 3, 8}, {3, 2, 8}, {2, 4, 10},{4, 2, 10},
+           {3, 4, 2}, {4, 3, 2}, {3, 5, 6}, {5, 3, 6}, {4, 5, 3}, {5, 4, 3},
+           {4, 6, 9}, {6, 4, 9}, {5, 6, 7}, {6, 5, 7}, {5, 7, 1}, {7, 5, 1},
+           {6, 7, 4}, {7, 6, 4}});
+  const auto N = num_vertices(g);
+
+  auto run = [&](auto heap_tag) {
+    std::vector<vid_t> predecessor(N);
+    std::vector<int>   weight(N);
+    init_shortest_paths(g, weight, predecessor);
+    auto total = prim(g, vid_t{0}, container_value_fn(weight), container_value_fn(predecessor),
+                      [](const auto& gr, const auto& uv) { return edge_value(gr, uv); }, std::less<int>(), heap_tag);
+    return std::make_tuple(total, weight);
+  };
+
+  auto [total_def, wt_def]       = run(use_default_heap{});
+  auto [total_bucket, wt_bucket] = run(use_bucket_heap{});
+  auto [total_radix, wt_radix]   = run(use_radix_heap{});
+  REQUIRE(total_def == 18);
+  REQUIRE(total_bucket == 18);
+  REQUIRE(total_radix == 18);
+  REQUIRE(wt_bucket == wt_def);
+  REQUIRE(wt_radix == wt_def);
+}
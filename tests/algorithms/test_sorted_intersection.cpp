@@ -0,0 +1,112 @@
+/**
+ * @file test_sorted_intersection.cpp
+ * @brief Tests for the sorted-array intersection kernels in detail/sorted_intersection.hpp
+ *
+ * Every kernel must reproduce the scalar merge exactly, including repeated ids. SIMD kernels
+ * the CPU does not support fall back to scalar, so the same checks run on any machine.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/detail/sorted_intersection.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace graph::detail;
+
+namespace {
+
+constexpr intersection_kernel all_kernels[] = {intersection_kernel::automatic, intersection_kernel::scalar,
+                                               intersection_kernel::galloping, intersection_kernel::avx2,
+                                               intersection_kernel::avx512};
+
+// Reference: the merge loop the kernels replace
+template <class T>
+std::vector<T> merge_matches(const std::vector<T>& a, const std::vector<T>& b) {
+  std::vector<T> out;
+  size_t         i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (a[i] < b[j])
+      ++i;
+    else if (b[j] < a[i])
+      ++j;
+    else {
+      out.push_back(a[i]);
+      ++i;
+      ++j;
+    }
+  }
+  return out;
+}
+
+template <class T>
+std::vector<T> sorted_sample(std::mt19937_64& rng, size_t n, T lo, T hi) {
+  std::uniform_int_distribution<T> dist(lo, hi);
+  std::vector<T>                   v(n);
+  for (auto& x : v)
+    x = dist(rng);
+  std::ranges::sort(v);
+  return v;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("sorted_intersection - kernels match merge", "[detail][sorted_intersection]", int32_t, uint32_t,
+                   int64_t, uint64_t, int16_t) {
+  using T = TestType;
+  std::mt19937_64 rng(7);
+
+  // Values straddle zero for signed types and the sign bit for unsigned ones
+  const T lo = std::is_signed_v<T> ? T(-500) : T(std::numeric_limits<T>::max() / 2 - 500);
+  const T hi = T(lo + 1'000);
+
+  for (int trial = 0; trial < 400; ++trial) {
+    const size_t na = rng() % 100;
+    const size_t nb = trial % 4 == 0 ? rng() % 5'000 : rng() % 300; // balanced and skewed pairs
+    const auto   a  = sorted_sample<T>(rng, na, lo, hi);               // repeats likely
+    const auto   b  = sorted_sample<T>(rng, nb, lo, hi);
+    const auto   expected = merge_matches(a, b);
+
+    for (auto kernel : all_kernels) {
+      std::vector<T> got;
+      sorted_intersection(a.data(), a.size(), b.data(), b.size(), [&](T x) { got.push_back(x); }, kernel);
+      REQUIRE(got == expected);
+      REQUIRE(sorted_intersection_count(b.data(), b.size(), a.data(), a.size(), kernel) == expected.size());
+    }
+  }
+}
+
+TEST_CASE("sorted_intersection - edge cases", "[detail][sorted_intersection]") {
+  const std::vector<uint32_t> empty;
+  const std::vector<uint32_t> ids = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31, 33};
+  const std::vector<uint32_t> all_same(40, 5);
+  const std::vector<uint32_t> tail = {33};
+
+  for (auto kernel : all_kernels) {
+    REQUIRE(sorted_intersection_count(empty.data(), 0, ids.data(), ids.size(), kernel) == 0);
+    REQUIRE(sorted_intersection_count(ids.data(), ids.size(), ids.data(), ids.size(), kernel) == ids.size());
+    REQUIRE(sorted_intersection_count(all_same.data(), all_same.size(), ids.data(), ids.size(), kernel) == 1);
+    REQUIRE(sorted_intersection_count(all_same.data(), 3, all_same.data(), all_same.size(), kernel) == 3);
+    REQUIRE(sorted_intersection_count(tail.data(), 1, ids.data(), ids.size(), kernel) == 1);
+  }
+}
+
+TEST_CASE("sorted_intersection - automatic kernel selection", "[detail][sorted_intersection]") {
+  REQUIRE(select_intersection_kernel<uint32_t>(100, 100) == intersection_kernel::scalar);
+  REQUIRE(select_intersection_kernel<uint32_t>(10, 10 * gallop_ratio) == intersection_kernel::galloping);
+
+  const auto moderate = select_intersection_kernel<uint32_t>(10, 10 * simd_ratio);
+  if (intersection_kernel_supported(intersection_kernel::avx512))
+    REQUIRE(moderate == intersection_kernel::avx512);
+  else if (intersection_kernel_supported(intersection_kernel::avx2))
+    REQUIRE(moderate == intersection_kernel::avx2);
+  else
+    REQUIRE(moderate == intersection_kernel::scalar);
+
+  // No SIMD kernel for 16-bit ids
+  REQUIRE(select_intersection_kernel<int16_t>(10, 10 * simd_ratio) == intersection_kernel::scalar);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Catch2 tests for graph::thread_pool.
+ *
+ * Coverage:
+ *   - size() resolution, single-worker pool runs inline
+ *   - run() invokes every tid exactly once
+ *   - for_each_chunk / for_each_index cover [0, n) exactly once for several grains
+ *   - Exceptions are rethrown on the calling thread and the pool stays usable
+ *   - Nested regions run serially instead of deadlocking
+ *   - parallel_exclusive_scan agrees with std::exclusive_scan
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/detail/thread_pool.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using graph::thread_pool;
+using graph::parallel_exclusive_scan;
+
+TEST_CASE("thread_pool - size", "[thread_pool]") {
+  REQUIRE(thread_pool(1).size() == 1);
+  REQUIRE(thread_pool(3).size() == 3);
+  REQUIRE(thread_pool(0).size() >= 1);
+  REQUIRE(graph::default_thread_pool().size() >= 1);
+}
+
+TEST_CASE("thread_pool - single worker runs inline", "[thread_pool]") {
+  thread_pool           pool(1);
+  const std::thread::id caller = std::this_thread::get_id();
+  bool                  inline_run = false;
+  pool.run([&](size_t tid) { inline_run = (tid == 0 && std::this_thread::get_id() == caller); });
+  REQUIRE(inline_run);
+}
+
+TEST_CASE("thread_pool - run invokes every tid once", "[thread_pool]") {
+  thread_pool                    pool(4);
+  std::vector<std::atomic<int>> hits(pool.size());
+  for (int rep = 0; rep < 50; ++rep) {
+    pool.run([&](size_t tid) { hits[tid].fetch_add(1); });
+  }
+  for (auto& h : hits) {
+    REQUIRE(h.load() == 50);
+  }
+}
+
+TEST_CASE("thread_pool - for_each_chunk covers range exactly once", "[thread_pool]") {
+  thread_pool pool(4);
+  for (size_t n : {size_t{0}, size_t{1}, size_t{7}, size_t{1000}, size_t{100'003}}) {
+    for (size_t grain : {size_t{0}, size_t{1}, size_t{64}}) {
+      std::vector<std::atomic<int>> seen(n);
+      pool.for_each_chunk(
+            n,
+            [&](size_t first, size_t last, size_t tid) {
+              REQUIRE(tid < pool.size());
+              for (size_t i = first; i < last; ++i) {
+                seen[i].fetch_add(1, std::memory_order_relaxed);
+              }
+            },
+            grain);
+      size_t bad = 0;
+      for (auto& s : seen) {
+        bad += (s.load() != 1);
+      }
+      REQUIRE(bad == 0);
+    }
+  }
+}
+
+TEST_CASE("thread_pool - for_each_index sums", "[thread_pool]") {
+  thread_pool         pool(3);
+  std::atomic<size_t> sum{0};
+  pool.for_each_index(10'000, [&](size_t i, size_t) { sum.fetch_add(i, std::memory_order_relaxed); });
+  REQUIRE(sum.load() == size_t{10'000} * 9'999 / 2);
+}
+
+TEST_CASE("thread_pool - exceptions propagate to caller", "[thread_pool]") {
+  thread_pool pool(4);
+  REQUIRE_THROWS_AS(pool.for_each_index(1000,
+                                        [](size_t i, size_t) {
+                                          if (i == 537) {
+                                            throw std::runtime_error("boom");
+                                          }
+                                        },
+                                        1),
+                    std::runtime_error);
+  REQUIRE_THROWS_AS(pool.run([](size_t tid) {
+    if (tid == 3) { // thrown on a worker thread, not the caller
+      throw std::logic_error("worker");
+    }
+  }),
+                    std::logic_error);
+
+  // Pool remains usable afterwards
+  std::atomic<size_t> count{0};
+  pool.for_each_index(100, [&](size_t, size_t) { ++count; });
+  REQUIRE(count.load() == 100);
+}
+
+TEST_CASE("thread_pool - nested regions run serially", "[thread_pool]") {
+  thread_pool         pool(4);
+  std::atomic<size_t> count{0};
+  pool.for_each_index(
+        16,
+        [&](size_t, size_t) {
+          pool.for_each_index(10, [&](size_t, size_t) { count.fetch_add(1, std::memory_order_relaxed); });
+        },
+        1);
+  REQUIRE(count.load() == 160);
+}
+
+TEST_CASE("parallel_exclusive_scan - matches std::exclusive_scan", "[thread_pool]") {
+  for (size_t workers : {size_t{1}, size_t{3}}) {
+    thread_pool pool(workers);
+    for (size_t n : {size_t{0}, size_t{1}, size_t{100}, size_t{100'003}}) {
+      std::vector<uint64_t> values(n);
+      for (size_t i = 0; i < n; ++i) {
+        values[i] = (i * 7919) % 13;
+      }
+      std::vector<uint64_t> expected(n);
+      std::exclusive_scan(values.begin(), values.end(), expected.begin(), uint64_t{0});
+      const uint64_t expected_total = std::accumulate(values.begin(), values.end(), uint64_t{0});
+
+      REQUIRE(parallel_exclusive_scan(pool, values.begin(), n) == expected_total);
+      REQUIRE(values == expected);
+    }
+  }
+}
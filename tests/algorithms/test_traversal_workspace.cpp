@@ -0,0 +1,203 @@
+/**
+ * @file test_traversal_workspace.cpp
+ * @brief Tests for traversal_workspace and the algorithm overloads that reuse it.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/breadth_first_search.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/topological_sort.hpp>
+#include <graph/algorithm/traversal_workspace.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/graph_fixtures.hpp"
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace graph;
+using namespace graph::adj_list;
+using namespace graph::test;
+using namespace graph::test::fixtures;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using weighted_csr = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+weighted_csr random_graph(uint32_t n, double p, uint64_t seed) {
+  weighted_csr g;
+  g.load_edges(generators::erdos_renyi<uint32_t>(n, p, seed), std::identity{}, n);
+  return g;
+}
+
+struct event_log {
+  std::vector<uint32_t>* order;
+  size_t*                relaxed;
+
+  template <class G>
+  void on_discover_vertex(const G&, const vertex_id_t<G>& uid) {
+    order->push_back(static_cast<uint32_t>(uid));
+  }
+  template <class G, class E>
+  void on_edge_relaxed(const G&, const E&) {
+    ++*relaxed;
+  }
+};
+
+} // namespace
+
+TEST_CASE("epoch_vertex_set", "[algorithm][traversal_workspace]") {
+  epoch_vertex_set<uint32_t, uint8_t> set(10);
+  REQUIRE(set.insert(3));
+  REQUIRE(set.insert(7));
+  REQUIRE_FALSE(set.insert(3));
+  REQUIRE(set.contains(7));
+  REQUIRE_FALSE(set.contains(0));
+  REQUIRE(std::ranges::equal(set.members(), std::vector<uint32_t>{3, 7}));
+
+  // Clearing past the wrap of the 8-bit epoch still empties the set
+  for (int k = 0; k < 600; ++k) {
+    set.clear();
+    REQUIRE(set.empty());
+    REQUIRE_FALSE(set.contains(3));
+    REQUIRE(set.insert(static_cast<uint32_t>(k % 10)));
+  }
+
+  set.clear(20);
+  REQUIRE(set.capacity() == 20);
+  REQUIRE(set.insert(19));
+}
+
+TEST_CASE("epoch_vertex_map", "[algorithm][traversal_workspace]") {
+  epoch_vertex_map<int, uint32_t, uint8_t> m(8, -1);
+  REQUIRE(m.get(2) == -1);
+  m[2] = 5;
+  m[6] += 3;
+  REQUIRE(m.get(2) == 5);
+  REQUIRE(m.get(6) == 2);
+  REQUIRE(std::ranges::equal(m.keys(), std::vector<uint32_t>{2, 6}));
+  REQUIRE(vertex_property_map_contains(m, 2));
+  REQUIRE(vertex_property_map_get(m, 3, 42) == 42);
+
+  for (int k = 0; k < 300; ++k) {
+    m.clear(8, 0);
+    REQUIRE(m.keys().empty());
+    REQUIRE(m.get(2) == 0);
+    m[static_cast<uint32_t>(k % 8)] = k;
+  }
+}
+
+TEST_CASE("breadth_first_search with a workspace matches the allocating version", "[algorithm][traversal_workspace]") {
+  const auto                    g = random_graph(2'000, 0.0015, 7);
+  traversal_workspace<uint32_t> ws;
+
+  for (uint32_t source = 0; source < 2'000; source += 97) {
+    std::vector<uint32_t> expected, actual;
+    size_t                unused = 0;
+    breadth_first_search(g, source, event_log{&expected, &unused});
+    breadth_first_search(g, source, ws, event_log{&actual, &unused});
+    REQUIRE(actual == expected);
+    REQUIRE(std::ranges::equal(ws.visited().members(), expected));
+  }
+
+  SECTION("multiple sources, one listed twice") {
+    std::vector<uint32_t> sources{5, 9, 5};
+    breadth_first_search(g, sources, ws);
+    REQUIRE(ws.visited().contains(5));
+    REQUIRE(ws.visited().contains(9));
+    std::vector<uint32_t> members(ws.visited().members().begin(), ws.visited().members().end());
+    std::ranges::sort(members);
+    REQUIRE(std::ranges::adjacent_find(members) == members.end());
+  }
+}
+
+TEST_CASE("dijkstra_shortest_paths with a workspace matches the allocating version", "[algorithm][traversal_workspace]") {
+  const auto g      = random_graph(3'000, 0.002, 11);
+  auto       weight = [](const auto& gr, const auto& uv) { return edge_value(gr, uv); };
+
+  traversal_workspace<uint32_t, double> ws;
+  for (uint32_t source = 0; source < 3'000; source += 211) {
+    std::vector<double>   distance(num_vertices(g));
+    std::vector<uint32_t> predecessor(num_vertices(g));
+    init_shortest_paths(g, distance, predecessor);
+    std::vector<uint32_t> expected_order, order;
+    size_t                expected_relaxed = 0, relaxed = 0;
+    dijkstra_shortest_paths(g, source, container_value_fn(distance), container_value_fn(predecessor), weight,
+                            event_log{&expected_order, &expected_relaxed});
+    dijkstra_shortest_paths(g, source, ws, weight, event_log{&order, &relaxed});
+
+    REQUIRE(order == expected_order);
+    REQUIRE(relaxed == expected_relaxed);
+    REQUIRE(std::ranges::equal(ws.distances().keys(), expected_order));
+    for (uint32_t v = 0; v < num_vertices(g); ++v) {
+      REQUIRE(ws.distances().get(v) == distance[v]);
+      REQUIRE(ws.predecessor(v) == predecessor[v]);
+    }
+  }
+
+  SECTION("distances only") {
+    dijkstra_shortest_distances(g, std::vector<uint32_t>{0, 1}, ws, weight);
+    std::vector<double> distance(num_vertices(g), infinite_distance<double>());
+    dijkstra_shortest_distances(g, std::vector<uint32_t>{0, 1}, container_value_fn(distance), weight);
+    for (uint32_t v = 0; v < num_vertices(g); ++v) {
+      REQUIRE(ws.distances().get(v) == distance[v]);
+      REQUIRE(ws.predecessor(v) == v);
+    }
+  }
+}
+
+TEST_CASE("dijkstra_shortest_paths with a workspace on the CLRS example", "[algorithm][traversal_workspace]") {
+  using Graph = vov_weighted;
+  auto g      = clrs_dijkstra_graph<Graph>();
+
+  traversal_workspace<uint32_t, int> ws;
+  dijkstra_shortest_paths(g, vertex_id_t<Graph>(0), ws,
+                          [](const auto& graph_ref, const auto& uv) { return edge_value(graph_ref, uv); });
+  for (uint32_t v = 0; v < num_vertices(g); ++v)
+    REQUIRE(ws.distances().get(v) == clrs_dijkstra_results::distances_from_0[v]);
+
+  SECTION("errors leave the workspace usable") {
+    REQUIRE_THROWS_AS(dijkstra_shortest_paths(g, vertex_id_t<Graph>(99), ws), std::out_of_range);
+    REQUIRE_THROWS_AS(dijkstra_shortest_paths(g, vertex_id_t<Graph>(0), ws, [](const auto&, const auto&) { return -1; }),
+                      std::out_of_range);
+    dijkstra_shortest_paths(g, vertex_id_t<Graph>(0), ws);
+    REQUIRE(ws.distances().get(0) == 0);
+    REQUIRE(ws.distances().keys().size() == num_vertices(g));
+  }
+}
+
+TEST_CASE("topological_sort with a workspace matches the allocating version", "[algorithm][traversal_workspace]") {
+  // A DAG: edges go from lower to higher ids
+  std::vector<copyable_edge_t<uint32_t, double>> dag;
+  for (const auto& e : generators::erdos_renyi<uint32_t>(500, 0.01, 3))
+    if (e.source_id < e.target_id)
+      dag.push_back(e);
+  weighted_csr g;
+  g.load_edges(dag, std::identity{}, 500);
+
+  traversal_workspace<uint32_t> ws;
+  for (uint32_t source = 0; source < 500; source += 37) {
+    std::vector<uint32_t> expected, actual;
+    REQUIRE(topological_sort(g, source, std::back_inserter(expected)));
+    REQUIRE(topological_sort(g, source, std::back_inserter(actual), ws));
+    REQUIRE(actual == expected);
+  }
+
+  std::vector<uint32_t> sources{400, 3, 250}, expected, actual;
+  REQUIRE(topological_sort(g, sources, std::back_inserter(expected)));
+  REQUIRE(topological_sort(g, sources, std::back_inserter(actual), ws));
+  REQUIRE(actual == expected);
+
+  SECTION("cycles") {
+    weighted_csr cyclic;
+    cyclic.load_edges(std::vector<copyable_edge_t<uint32_t, double>>{{0, 1, 1.0}, {1, 2, 1.0}, {2, 0, 1.0}, {3, 0, 1.0}},
+                      std::identity{}, 4);
+    std::vector<uint32_t> out;
+    REQUIRE_FALSE(topological_sort(cyclic, 3u, std::back_inserter(out), ws));
+    REQUIRE(out.empty());
+    REQUIRE(topological_sort(g, 0u, std::back_inserter(out), ws));
+  }
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_vertex_ordering.cpp
+ * @brief Tests for order_vertices and reorder from vertex_ordering.hpp
+ *
+ * Every ordering must return a permutation with its inverse, independent of the number of
+ * workers. Beyond that each is checked for the property it is built for, on graphs whose ids
+ * were shuffled: degree and hub orders group the high-degree vertices, bfs and rcm recover the
+ * band of paths and grids, and gorder and rabbit keep dense communities together. Results on a
+ * reordered graph must translate back to the original ids.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/algorithm/vertex_ordering.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include "../common/algorithm_test_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test::algorithm;
+
+namespace {
+
+using csr      = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using edge_vec = std::vector<copyable_edge_t<uint32_t, double>>;
+
+constexpr vertex_order all_orders[] = {vertex_order::degree_sort, vertex_order::hub_cluster, vertex_order::bfs,
+                                       vertex_order::rcm,    vertex_order::gorder,      vertex_order::rabbit};
+
+csr make_graph(edge_vec edges, uint32_t n) {
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  csr g;
+  g.load_edges(edges, std::identity{}, n);
+  return g;
+}
+
+// Edges with both directions stored
+edge_vec symmetrized(const edge_vec& edges) {
+  edge_vec out;
+  for (auto& e : edges) {
+    out.push_back(e);
+    out.push_back({e.target_id, e.source_id, e.value});
+  }
+  return out;
+}
+
+// Renames every vertex by a random permutation, as graphs arrive with arbitrary ids
+edge_vec shuffled_ids(const edge_vec& edges, uint32_t n, uint64_t seed) {
+  std::vector<uint32_t> p(n);
+  std::iota(p.begin(), p.end(), 0u);
+  std::mt19937_64 rng(seed);
+  std::ranges::shuffle(p, rng);
+  edge_vec out;
+  for (auto& e : edges)
+    out.push_back({p[e.source_id], p[e.target_id], e.value});
+  return out;
+}
+
+edge_vec random_edges(uint32_t n, double p, uint64_t seed) {
+  edge_vec edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(n, p, seed))
+    edges.push_back({e.source_id, e.target_id, e.value});
+  return edges;
+}
+
+// k dense random blocks of size s, plus a few edges between blocks
+edge_vec communities(uint32_t k, uint32_t s, uint64_t seed) {
+  std::mt19937_64                         rng(seed);
+  std::uniform_int_distribution<uint32_t> in_block(0, s - 1), block(0, k - 1);
+  edge_vec                                edges;
+  for (uint32_t b = 0; b < k; ++b)
+    for (uint32_t i = 0; i < 4 * s; ++i)
+      edges.push_back({b * s + in_block(rng), b * s + in_block(rng), 1.0});
+  for (uint32_t i = 0; i < k; ++i)
+    edges.push_back({block(rng) * s + in_block(rng), block(rng) * s + in_block(rng), 1.0});
+  return symmetrized(edges);
+}
+
+void check_permutation(const vertex_permutation<uint32_t>& perm, uint32_t n) {
+  REQUIRE(perm.new_id.size() == n);
+  REQUIRE(perm.old_id.size() == n);
+  for (uint32_t v = 0; v < n; ++v)
+    REQUIRE(perm.new_id[perm.old_id[v]] == v);
+}
+
+// Largest |new(u) - new(v)| over the edges
+size_t bandwidth(const edge_vec& edges, const vertex_permutation<uint32_t>& perm) {
+  size_t b = 0;
+  for (auto& e : edges)
+    b = std::max<size_t>(b, static_cast<size_t>(std::abs(static_cast<int64_t>(perm.new_id[e.source_id]) -
+                                                         static_cast<int64_t>(perm.new_id[e.target_id]))));
+  return b;
+}
+
+// Mean log2 of the id gap over the edges: the usual locality score of an ordering
+double mean_log_gap(const edge_vec& edges, const vertex_permutation<uint32_t>& perm) {
+  double sum = 0;
+  for (auto& e : edges)
+    sum += std::log2(1.0 + std::abs(static_cast<double>(perm.new_id[e.source_id]) -
+                                    static_cast<double>(perm.new_id[e.target_id])));
+  return sum / static_cast<double>(edges.size());
+}
+
+vertex_permutation<uint32_t> identity_permutation(uint32_t n) {
+  vertex_permutation<uint32_t> perm{std::vector<uint32_t>(n), std::vector<uint32_t>(n)};
+  std::iota(perm.new_id.begin(), perm.new_id.end(), 0u);
+  std::iota(perm.old_id.begin(), perm.old_id.end(), 0u);
+  return perm;
+}
+
+} // namespace
+
+TEST_CASE("order_vertices - every ordering is a permutation", "[algorithm][vertex_ordering]") {
+  thread_pool one(1), four(4);
+
+  SECTION("directed random graph with isolated vertices") {
+    const uint32_t n = 2000;
+    const auto     g = make_graph(random_edges(n, 1.5 / n, 1), n);
+    for (auto method : all_orders) {
+      const auto perm = order_vertices(g, method, {}, four);
+      check_permutation(perm, n);
+      const auto serial = order_vertices(g, method, {}, one);
+      REQUIRE(serial.old_id == perm.old_id);
+    }
+  }
+
+  SECTION("symmetric graph") {
+    const uint32_t n = 1000;
+    const auto     g = make_graph(communities(20, 50, 2), n);
+    for (auto method : all_orders)
+      check_permutation(order_vertices(g, method, {.symmetric = true}, four), n);
+  }
+
+  SECTION("empty graph and a single vertex") {
+    for (auto method : all_orders) {
+      check_permutation(order_vertices(csr{}, method), 0);
+      check_permutation(order_vertices(make_graph({{0, 0, 1.0}}, 1), method), 1);
+    }
+  }
+
+  SECTION("vov graph") {
+    const uint32_t n     = 300;
+    const auto     edges = random_edges(n, 3.0 / n, 3);
+    vov_void       g;
+    g.load_edges(edges, [](const auto& e) { return copyable_edge_t<uint32_t, void>{e.source_id, e.target_id}; }, n);
+    for (auto method : all_orders)
+      REQUIRE(std::ranges::equal(order_vertices(g, method).old_id, order_vertices(make_graph(edges, n), method).old_id));
+  }
+}
+
+TEST_CASE("order_vertices - degree and hub orders", "[algorithm][vertex_ordering]") {
+  const uint32_t n = 3000;
+  const auto     g = make_graph(symmetrized(shuffled_ids(generators::barabasi_albert<uint32_t>(n, 3, 4), n, 5)), n);
+  std::vector<size_t> degree(n);
+  for (uint32_t u = 0; u < n; ++u)
+    degree[u] = g.edge_ids(u).size();
+
+  SECTION("degree_sort: non-increasing, ties by id") {
+    const auto perm = order_vertices(g, vertex_order::degree_sort, {.symmetric = true});
+    for (uint32_t v = 1; v < n; ++v) {
+      const auto a = perm.old_id[v - 1], b = perm.old_id[v];
+      REQUIRE((degree[a] > degree[b] || (degree[a] == degree[b] && a < b)));
+    }
+  }
+
+  SECTION("hub_cluster: hubs first, both groups in id order") {
+    const auto   perm  = order_vertices(g, vertex_order::hub_cluster, {.symmetric = true});
+    const double avg   = static_cast<double>(std::accumulate(degree.begin(), degree.end(), size_t{0})) / n;
+    auto         is_hub = [&](uint32_t u) { return static_cast<double>(degree[u]) > avg; };
+    REQUIRE(std::ranges::is_partitioned(perm.old_id, is_hub));
+    const auto split = std::ranges::partition_point(perm.old_id, is_hub) - perm.old_id.begin();
+    REQUIRE(split > 0);
+    REQUIRE(std::is_sorted(perm.old_id.begin(), perm.old_id.begin() + split));
+    REQUIRE(std::is_sorted(perm.old_id.begin() + split, perm.old_id.end()));
+  }
+}
+
+TEST_CASE("order_vertices - bfs and rcm recover a narrow band", "[algorithm][vertex_ordering]") {
+  SECTION("shuffled path: rcm gives bandwidth 1, bfs from an inner vertex at most 2") {
+    const uint32_t n     = 1000;
+    const auto     edges = symmetrized(shuffled_ids(generators::path_graph<uint32_t>(n, 6), n, 7));
+    const auto     g     = make_graph(edges, n);
+    REQUIRE(bandwidth(edges, order_vertices(g, vertex_order::bfs, {.symmetric = true})) <= 2);
+    REQUIRE(bandwidth(edges, order_vertices(g, vertex_order::rcm, {.symmetric = true})) == 1);
+  }
+
+  SECTION("shuffled 40 x 40 grid: rcm bandwidth close to the width, bfs a few widths") {
+    const uint32_t n     = 1600;
+    const auto     edges = shuffled_ids(generators::grid_2d<uint32_t>(40, 40, 8), n, 9);
+    const auto     g     = make_graph(edges, n);
+    REQUIRE(bandwidth(edges, identity_permutation(n)) > 1000);
+    REQUIRE(bandwidth(edges, order_vertices(g, vertex_order::rcm, {.symmetric = true})) <= 60);
+    REQUIRE(bandwidth(edges, order_vertices(g, vertex_order::bfs, {.symmetric = true})) <= 120);
+    // Directed view of the same graph: in-edges complete the neighbourhoods
+    REQUIRE(bandwidth(edges, order_vertices(g, vertex_order::rcm)) <= 60);
+  }
+}
+
+TEST_CASE("order_vertices - gorder and rabbit keep communities together", "[algorithm][vertex_ordering]") {
+  const uint32_t k = 40, s = 50, n = k * s;
+  const auto     edges = shuffled_ids(communities(k, s, 10), n, 11);
+  const auto     g     = make_graph(edges, n);
+  const double   base  = mean_log_gap(edges, identity_permutation(n));
+
+  for (auto method : {vertex_order::gorder, vertex_order::rabbit}) {
+    const auto perm = order_vertices(g, method, {.symmetric = true});
+    REQUIRE(mean_log_gap(edges, perm) < 0.6 * base);
+  }
+
+  SECTION("rabbit places disjoint cliques contiguously") {
+    edge_vec cliques;
+    for (uint32_t c = 0; c < 30; ++c)
+      for (uint32_t i = 0; i < 6; ++i)
+        for (uint32_t j = 0; j < 6; ++j)
+          if (i != j)
+            cliques.push_back({c * 6 + i, c * 6 + j, 1.0});
+    const auto shuffled = shuffled_ids(cliques, 180, 12);
+    const auto perm     = order_vertices(make_graph(shuffled, 180), vertex_order::rabbit, {.symmetric = true});
+    REQUIRE(bandwidth(shuffled, perm) <= 5);
+  }
+}
+
+TEST_CASE("reorder - results translate back to the original ids", "[algorithm][vertex_ordering]") {
+  const uint32_t n     = 2000;
+  const auto     edges = random_edges(n, 3.0 / n, 13);
+  const auto     g     = make_graph(edges, n);
+
+  // Hop counts from vertex 0
+  std::vector<uint32_t> expected(n, std::numeric_limits<uint32_t>::max());
+  dijkstra_shortest_distances(g, uint32_t{0}, container_value_fn(expected));
+
+  for (auto method : all_orders) {
+    const auto perm = order_vertices(g, method);
+    const auto h    = reorder(g, perm);
+    REQUIRE(h.col_index_storage().size() == edges.size());
+
+    std::vector<uint32_t> dist(n, std::numeric_limits<uint32_t>::max()), back(n);
+    dijkstra_shortest_distances(h, perm.new_id[0], container_value_fn(dist));
+    for (uint32_t v = 0; v < n; ++v)
+      back[perm.old_id[v]] = dist[v];
+    REQUIRE(back == expected);
+  }
+
+  SECTION("the graph value is carried along") {
+    using named_csr = compressed_graph<double, void, std::string, uint32_t, uint32_t>;
+    named_csr named(std::string("roads"));
+    named.load_edges(std::vector<copyable_edge_t<uint32_t, double>>{{0, 1, 1.0}, {1, 2, 2.0}}, std::identity{});
+    const auto h = reorder(named, order_vertices(named, vertex_order::bfs));
+    REQUIRE(h.graph_value() == "roads");
+  }
+}
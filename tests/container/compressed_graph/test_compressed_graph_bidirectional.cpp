@@ -0,0 +1,257 @@
+/**
+ * @file test_compressed_graph_bidirectional.cpp
+ * @brief Tests for compressed_graph with Bidirectional=true (incoming-edge / CSC index).
+ *
+ * The reference for every case is a brute-force transpose of the loaded edges: incoming rows
+ * must hold the same (source, value) pairs, ordered by source id. Also covers the in_edges,
+ * in_degree and source_id CPOs, the in_incidence / in_neighbors views, transpose_view and the
+ * single-graph kosaraju overload, and that Bidirectional=false graphs are unchanged.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/connected_components.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/generators.hpp>
+#include <graph/graph.hpp>
+#include <graph/views/transpose.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+namespace {
+
+using bidir_csr      = compressed_graph<double, void, void, uint32_t, uint32_t, true>;
+using bidir_void_csr = compressed_graph<void, void, void, uint32_t, uint32_t, true>;
+using bidir_vv_csr   = compressed_graph<void, int, void, uint32_t, uint64_t, true>;
+using plain_csr      = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using edge_vec       = std::vector<copyable_edge_t<uint32_t, double>>;
+using in_rows        = std::vector<std::vector<std::pair<uint32_t, double>>>;
+
+// Random edges with repeats and self-loops, sorted by source_id as load_edges expects
+edge_vec random_edges(uint32_t n, size_t m, uint64_t seed) {
+  std::mt19937_64                         rng(seed);
+  std::uniform_int_distribution<uint32_t> vid(0, n - 1);
+  edge_vec                                edges;
+  for (size_t i = 0; i < m; ++i)
+    edges.push_back({vid(rng), vid(rng), static_cast<double>(i)});
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  return edges;
+}
+
+// Brute-force transpose: incoming (source, value) pairs of every vertex, ordered by source.
+// Edges of the same source keep their load order, as in the index.
+in_rows transpose_of(const edge_vec& edges, size_t n) {
+  in_rows rows(n);
+  for (auto& e : edges)
+    rows[e.target_id].emplace_back(e.source_id, e.value);
+  for (auto& row : rows)
+    std::ranges::stable_sort(row, {}, [](const auto& p) { return p.first; });
+  return rows;
+}
+
+template <class G>
+in_rows in_rows_of(const G& g) {
+  in_rows rows(num_vertices(g));
+  for (auto v : vertices(g)) {
+    for (auto ie : in_edges(g, v)) {
+      REQUIRE(target_id(g, ie) == vertex_id(g, v));
+      rows[vertex_id(g, v)].emplace_back(source_id(g, ie), edge_value(g, ie));
+    }
+  }
+  return rows;
+}
+
+} // namespace
+
+TEST_CASE("compressed_graph bidirectional - concepts", "[compressed_graph][bidirectional]") {
+  STATIC_REQUIRE(adj_list::index_bidirectional_adjacency_list<bidir_csr>);
+  STATIC_REQUIRE(adj_list::index_bidirectional_adjacency_list<const bidir_csr>);
+  STATIC_REQUIRE(adj_list::index_bidirectional_adjacency_list<bidir_void_csr>);
+  STATIC_REQUIRE(adj_list::index_bidirectional_adjacency_list<bidir_vv_csr>);
+  STATIC_REQUIRE(bidir_csr::bidirectional);
+
+  // Bidirectional=false is unchanged
+  STATIC_REQUIRE(adj_list::index_adjacency_list<plain_csr>);
+  STATIC_REQUIRE(!adj_list::bidirectional_adjacency_list<plain_csr>);
+  STATIC_REQUIRE(!plain_csr::bidirectional);
+}
+
+TEST_CASE("compressed_graph bidirectional - in_edges match the transpose", "[compressed_graph][bidirectional]") {
+  const uint32_t n     = 300;
+  const auto     edges = random_edges(n, 4000, 7);
+  const auto     ref   = transpose_of(edges, n);
+
+  SECTION("load_edges") {
+    bidir_csr g;
+    g.load_edges(edges, std::identity{}, n);
+    REQUIRE(in_rows_of(g) == ref);
+
+    // Out-edges are unaffected
+    size_t out = 0;
+    for (auto u : vertices(g))
+      out += static_cast<size_t>(degree(g, u));
+    REQUIRE(out == edges.size());
+  }
+
+  SECTION("load_unsorted_edges") {
+    auto shuffled = edges;
+    std::ranges::shuffle(shuffled, std::mt19937_64(11));
+    for (size_t workers : {1, 4}) {
+      thread_pool pool(workers);
+      bidir_csr   g;
+      g.load_unsorted_edges(shuffled, std::identity{}, n, {.sort_targets = true}, pool);
+
+      // Row order now depends on the shuffle; compare as sorted multisets
+      auto got = in_rows_of(g);
+      auto exp = ref;
+      for (uint32_t v = 0; v < n; ++v) {
+        REQUIRE(std::ranges::is_sorted(got[v], {}, [](const auto& p) { return p.first; }));
+        std::ranges::sort(got[v]);
+        std::ranges::sort(exp[v]);
+      }
+      REQUIRE(got == exp);
+    }
+  }
+
+  SECTION("const graph") {
+    bidir_csr g;
+    g.load_edges(edges, std::identity{}, n);
+    const bidir_csr& cg = g;
+    REQUIRE(in_rows_of(cg) == ref);
+  }
+
+  SECTION("edge values are shared with the outgoing edges") {
+    bidir_csr g;
+    g.load_edges(edges, std::identity{}, n);
+    g.edge_value(0) = -1.0;
+    const auto first_target = edges.front().target_id;
+    bool       seen         = false;
+    for (auto ie : in_edges(g, *find_vertex(g, first_target)))
+      seen = seen || edge_value(g, ie) == -1.0;
+    REQUIRE(seen);
+  }
+}
+
+TEST_CASE("compressed_graph bidirectional - in_degree and id accessors", "[compressed_graph][bidirectional]") {
+  // 0 -> 1, 0 -> 2, 1 -> 2, 2 -> 0, 3 -> 2
+  const edge_vec edges = {{0, 1, 1.5}, {0, 2, 2.5}, {1, 2, 3.5}, {2, 0, 4.5}, {3, 2, 5.5}};
+  bidir_csr      g;
+  g.load_edges(edges, std::identity{}, 5);
+
+  REQUIRE(in_degree(g, *find_vertex(g, 0u)) == 1);
+  REQUIRE(in_degree(g, *find_vertex(g, 1u)) == 1);
+  REQUIRE(in_degree(g, *find_vertex(g, 2u)) == 3);
+  REQUIRE(in_degree(g, *find_vertex(g, 3u)) == 0);
+  REQUIRE(in_degree(g, *find_vertex(g, 4u)) == 0);
+
+  REQUIRE(std::ranges::equal(g.source_ids(2), std::vector<uint32_t>{0, 1, 3}));
+  REQUIRE(std::ranges::equal(g.in_edge_ids(2), std::vector<uint32_t>{1, 2, 4}));
+  REQUIRE(g.source_ids(3).empty());
+  REQUIRE(g.source_ids(99).empty());
+
+  // in_edges by vertex id
+  std::vector<uint32_t> sources;
+  for (auto ie : in_edges(g, 2u))
+    sources.push_back(static_cast<uint32_t>(source_id(g, ie)));
+  REQUIRE(sources == std::vector<uint32_t>{0, 1, 3});
+}
+
+TEST_CASE("compressed_graph bidirectional - views", "[compressed_graph][bidirectional]") {
+  const std::vector<copyable_edge_t<uint32_t, void>> ev = {{0, 1}, {0, 2}, {1, 2}, {3, 2}};
+  bidir_void_csr                                     g;
+  g.load_edges(ev, std::identity{}, 4);
+
+  SECTION("in_neighbors") {
+    std::vector<uint32_t> ids;
+    for (auto&& [sid, s] : views::in_neighbors(g, *find_vertex(g, 2u)))
+      ids.push_back(static_cast<uint32_t>(sid));
+    REQUIRE(ids == std::vector<uint32_t>{0, 1, 3});
+  }
+
+  SECTION("in_incidence") {
+    std::vector<uint32_t> ids;
+    for (auto&& [sid, ie] : views::in_incidence(g, *find_vertex(g, 2u)))
+      ids.push_back(static_cast<uint32_t>(sid));
+    REQUIRE(ids == std::vector<uint32_t>{0, 1, 3});
+  }
+
+  SECTION("transpose_view") {
+    views::transpose_view tv(g);
+    std::vector<uint32_t> ids;
+    for (auto e : edges(tv, *find_vertex(tv, 2u)))
+      ids.push_back(static_cast<uint32_t>(target_id(tv, e)));
+    REQUIRE(ids == std::vector<uint32_t>{0, 1, 3});
+  }
+}
+
+TEST_CASE("compressed_graph bidirectional - kosaraju without a transpose", "[compressed_graph][bidirectional]") {
+  const uint32_t n = 2000;
+  edge_vec       edges;
+  for (auto& e : generators::erdos_renyi<uint32_t>(n, 1.5 / n, 3))
+    edges.push_back({e.source_id, e.target_id, 1.0});
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+
+  bidir_csr g;
+  g.load_edges(edges, std::identity{}, n);
+
+  // Reference: two-graph overload with an explicit transpose
+  edge_vec reversed;
+  for (auto& e : edges)
+    reversed.push_back({e.target_id, e.source_id, e.value});
+  std::ranges::stable_sort(reversed, {}, [](const auto& e) { return e.source_id; });
+  plain_csr fwd, rev;
+  fwd.load_edges(edges, std::identity{}, n);
+  rev.load_edges(reversed, std::identity{}, n);
+
+  std::vector<uint32_t> got(n), exp(n);
+  kosaraju(g, container_value_fn(got));
+  kosaraju(fwd, rev, container_value_fn(exp));
+
+  // Same partition, possibly with different labels
+  for (uint32_t u = 0; u < n; ++u)
+    for (uint32_t v = u + 1; v < std::min(n, u + 50); ++v)
+      REQUIRE((got[u] == got[v]) == (exp[u] == exp[v]));
+}
+
+TEST_CASE("compressed_graph bidirectional - edge cases", "[compressed_graph][bidirectional]") {
+  SECTION("empty graph") {
+    bidir_csr g;
+    REQUIRE(num_vertices(g) == 0);
+    REQUIRE(g.source_ids(0).empty());
+    g.load_edges(edge_vec{}, std::identity{});
+    REQUIRE(num_vertices(g) == 0);
+  }
+
+  SECTION("vertices without edges") {
+    bidir_csr g;
+    g.load_edges(edge_vec{{1, 2, 1.0}}, std::identity{}, 6);
+    REQUIRE(num_vertices(g) == 6);
+    for (uint32_t v = 0; v < 6; ++v)
+      REQUIRE(in_degree(g, *find_vertex(g, v)) == (v == 2 ? 1u : 0u));
+  }
+
+  SECTION("load_vertices after load_edges") {
+    bidir_vv_csr g;
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, void>>{{0, 1}, {1, 0}}, std::identity{});
+    std::vector<copyable_vertex_t<uint32_t, int>> vv = {{0, 10}, {1, 11}, {2, 12}, {3, 13}};
+    g.load_vertices(vv, std::identity{});
+    REQUIRE(num_vertices(g) == 4);
+    REQUIRE(in_degree(g, *find_vertex(g, 3u)) == 0);
+    REQUIRE(in_degree(g, *find_vertex(g, 0u)) == 1);
+  }
+
+  SECTION("clear") {
+    bidir_csr g;
+    g.load_edges(edge_vec{{0, 1, 1.0}, {1, 0, 2.0}}, std::identity{});
+    g.clear();
+    REQUIRE(num_vertices(g) == 0);
+    REQUIRE(g.source_ids(0).empty());
+    g.load_edges(edge_vec{{0, 2, 3.0}}, std::identity{});
+    REQUIRE(std::ranges::equal(g.source_ids(2), std::vector<uint32_t>{0}));
+  }
+}
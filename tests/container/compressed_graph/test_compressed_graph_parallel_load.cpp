@@ -0,0 +1,280 @@
+/**
+ * @file test_compressed_graph_parallel_load.cpp
+ * @brief Tests for compressed_graph::load_unsorted_edges, load_edge_stream and load_row_stream
+ *        (parallel CSR construction).
+ *
+ * The reference for every case is load_edges on the same edges after a stable sort by
+ * source_id, which is what callers had to do before.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "graph/container/compressed_graph.hpp"
+#include "graph/generators.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+namespace {
+
+using weighted_csr = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using void_csr     = compressed_graph<void, void, void, uint32_t, uint32_t>;
+using edge_vec     = std::vector<copyable_edge_t<uint32_t, double>>;
+
+// Rows as (target, value) lists, in storage order
+std::vector<std::vector<std::pair<uint32_t, double>>> rows_of(const weighted_csr& g) {
+  std::vector<std::vector<std::pair<uint32_t, double>>> rows(g.size());
+  for (auto u : g.vertex_ids()) {
+    for (auto e : g.edge_ids(u)) {
+      rows[u].emplace_back(g.target_id(e), g.edge_value(e));
+    }
+  }
+  return rows;
+}
+
+std::vector<std::vector<uint32_t>> rows_of(const void_csr& g) {
+  std::vector<std::vector<uint32_t>> rows(g.size());
+  for (auto u : g.vertex_ids()) {
+    for (auto e : g.edge_ids(u)) {
+      rows[u].push_back(g.target_id(e));
+    }
+  }
+  return rows;
+}
+
+edge_vec shuffled(edge_vec edges, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::ranges::shuffle(edges, rng);
+  return edges;
+}
+
+weighted_csr reference(edge_vec edges, size_t vertex_count = 0) {
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  weighted_csr g;
+  g.load_edges(edges, std::identity{}, vertex_count);
+  return g;
+}
+
+} // namespace
+
+TEST_CASE("load_unsorted_edges preserves input order within rows", "[compressed_graph][parallel_load]") {
+  const uint32_t n     = 3'000;
+  const auto     input = shuffled(generators::erdos_renyi<uint32_t>(n, 12.0 / n, 5), 17);
+  const auto     rows  = rows_of(reference(input, n));
+
+  for (size_t workers : {size_t{1}, size_t{4}}) {
+    thread_pool  pool(workers);
+    weighted_csr g;
+    g.load_unsorted_edges(input, std::identity{}, n, csr_build_options{}, pool);
+    REQUIRE(g.size() == n);
+    REQUIRE(rows_of(g) == rows);
+  }
+}
+
+TEST_CASE("load_unsorted_edges with few edges per vertex", "[compressed_graph][parallel_load]") {
+  // Average degree below the worker count limits the number of histogram parts
+  const uint32_t n     = 5'000;
+  const auto     input = shuffled(generators::path_graph<uint32_t>(n, 3), 9);
+
+  thread_pool  pool(8);
+  weighted_csr g;
+  g.load_unsorted_edges(input, std::identity{}, 0, csr_build_options{}, pool);
+  REQUIRE(rows_of(g) == rows_of(reference(input)));
+}
+
+TEST_CASE("load_unsorted_edges sorts rows and removes duplicates", "[compressed_graph][parallel_load]") {
+  edge_vec input = {{2, 1, 1.0}, {0, 3, 2.0}, {0, 1, 3.0}, {2, 1, 4.0}, {0, 3, 5.0}, {1, 0, 6.0}, {0, 2, 7.0}};
+
+  thread_pool pool(3);
+
+  SECTION("sort_targets is stable for equal targets") {
+    weighted_csr g;
+    g.load_unsorted_edges(input, std::identity{}, 0, csr_build_options{.sort_targets = true}, pool);
+    REQUIRE(rows_of(g) == std::vector<std::vector<std::pair<uint32_t, double>>>{
+                                {{1, 3.0}, {2, 7.0}, {3, 2.0}, {3, 5.0}}, {{0, 6.0}}, {{1, 1.0}, {1, 4.0}}, {}});
+  }
+
+  SECTION("remove_duplicates keeps the first occurrence") {
+    weighted_csr g;
+    g.load_unsorted_edges(input, std::identity{}, 0, csr_build_options{.remove_duplicates = true}, pool);
+    REQUIRE(g.size() == 4);
+    REQUIRE(rows_of(g) == std::vector<std::vector<std::pair<uint32_t, double>>>{
+                                {{1, 3.0}, {2, 7.0}, {3, 2.0}}, {{0, 6.0}}, {{1, 1.0}}, {}});
+  }
+
+  SECTION("void edge values") {
+    void_csr g;
+    g.load_unsorted_edges(input, [](const auto& e) { return copyable_edge_t<uint32_t, void>{e.source_id, e.target_id}; },
+                          0, csr_build_options{.remove_duplicates = true}, pool);
+    REQUIRE(rows_of(g) == std::vector<std::vector<uint32_t>>{{1, 2, 3}, {0}, {1}, {}});
+  }
+}
+
+TEST_CASE("load_unsorted_edges deduplicates generated multigraphs", "[compressed_graph][parallel_load]") {
+  // Every edge three times, shuffled: dedup must recover the simple graph
+  const uint32_t n    = 2'000;
+  const auto     base = generators::barabasi_albert<uint32_t>(n, 4, 21);
+  edge_vec       tripled;
+  for (int copy = 0; copy < 3; ++copy) {
+    tripled.insert(tripled.end(), base.begin(), base.end());
+  }
+  tripled = shuffled(std::move(tripled), 23);
+
+  edge_vec unique_edges(base.begin(), base.end());
+  std::ranges::sort(unique_edges, {}, [](const auto& e) { return std::pair(e.source_id, e.target_id); });
+  auto dup = std::ranges::unique(unique_edges, {}, [](const auto& e) { return std::pair(e.source_id, e.target_id); });
+  unique_edges.erase(dup.begin(), dup.end());
+
+  for (size_t workers : {size_t{1}, size_t{4}}) {
+    thread_pool pool(workers);
+    void_csr    g;
+    g.load_unsorted_edges(tripled, [](const auto& e) { return copyable_edge_t<uint32_t, void>{e.source_id, e.target_id}; },
+                          n, csr_build_options{.remove_duplicates = true}, pool);
+
+    std::vector<std::vector<uint32_t>> expected(n);
+    for (auto& e : unique_edges) {
+      expected[e.source_id].push_back(e.target_id);
+    }
+    REQUIRE(rows_of(g) == expected);
+  }
+}
+
+TEST_CASE("load_unsorted_edges vertex counts", "[compressed_graph][parallel_load]") {
+  thread_pool pool(2);
+
+  SECTION("empty input with a vertex count") {
+    void_csr g;
+    g.load_unsorted_edges(edge_vec{}, [](const auto& e) { return copyable_edge_t<uint32_t, void>{e.source_id, e.target_id}; },
+                          5, csr_build_options{}, pool);
+    REQUIRE(g.size() == 5);
+    REQUIRE(g.edge_ids().size() == 0);
+  }
+
+  SECTION("empty input without a vertex count") {
+    weighted_csr g;
+    g.load_unsorted_edges(edge_vec{}, std::identity{}, 0, csr_build_options{}, pool);
+    REQUIRE(g.empty());
+  }
+
+  SECTION("largest id is a target") {
+    weighted_csr g;
+    g.load_unsorted_edges(edge_vec{{1, 7, 1.0}, {0, 1, 1.0}}, std::identity{}, 0, csr_build_options{}, pool);
+    REQUIRE(g.size() == 8);
+    REQUIRE(g.edge_ids(7).size() == 0);
+  }
+
+  SECTION("explicit count adds isolated vertices") {
+    weighted_csr g;
+    g.load_unsorted_edges(edge_vec{{1, 2, 1.0}}, std::identity{}, 10, csr_build_options{}, pool);
+    REQUIRE(g.size() == 10);
+    REQUIRE(g.edge_ids(1).size() == 1);
+  }
+}
+
+TEST_CASE("load_unsorted_edges then load_vertices", "[compressed_graph][parallel_load]") {
+  compressed_graph<int, int, void, uint32_t, uint32_t> g;
+  g.load_unsorted_edges(std::vector<copyable_edge_t<uint32_t, int>>{{3, 0, 5}, {0, 3, 6}});
+  g.load_vertices(std::vector<copyable_vertex_t<uint32_t, int>>{{0, 10}, {1, 11}, {2, 12}, {3, 13}});
+  REQUIRE(g.size() == 4);
+  REQUIRE(g.vertex_value(3) == 13);
+  REQUIRE(g.edge_value(*g.edge_ids(3).begin()) == 5);
+  REQUIRE(g.edge_value(*g.edge_ids(0).begin()) == 6);
+}
+
+TEST_CASE("load_edge_stream builds from edges generated per part", "[compressed_graph][parallel_load]") {
+  const uint32_t n     = 3'000;
+  const auto     input = shuffled(generators::erdos_renyi<uint32_t>(n, 12.0 / n, 5), 17);
+  const auto     rows  = rows_of(reference(input, n));
+
+  for (size_t parts : {size_t{1}, size_t{5}}) {
+    thread_pool  pool(4);
+    weighted_csr g;
+    size_t       calls = 0;
+    g.load_edge_stream(
+          parts,
+          [&](size_t p, auto&& emit) {
+            if (p == 0)
+              ++calls;
+            for (size_t i = input.size() * p / parts; i < input.size() * (p + 1) / parts; ++i)
+              emit(input[i]);
+          },
+          0, csr_build_options{}, pool);
+    REQUIRE(calls == 2);
+    REQUIRE(rows_of(g) == rows);
+  }
+
+  SECTION("vertex count and sorting") {
+    thread_pool  pool(2);
+    weighted_csr g;
+    g.load_edge_stream(
+          2,
+          [](size_t p, auto&& emit) {
+            emit(copyable_edge_t<uint32_t, double>{1, p == 0 ? 3u : 2u, 1.0 + p});
+            emit(copyable_edge_t<uint32_t, double>{1, 2, 3.0 + p});
+          },
+          6, csr_build_options{.remove_duplicates = true}, pool);
+    REQUIRE(g.size() == 6);
+    REQUIRE(rows_of(g)[1] == std::vector<std::pair<uint32_t, double>>{{2, 3.0}, {3, 1.0}});
+  }
+
+  SECTION("an exception while counting leaves the graph empty") {
+    thread_pool  pool(2);
+    weighted_csr g;
+    REQUIRE_THROWS_AS(g.load_edge_stream(
+                            3,
+                            [](size_t p, auto&& emit) {
+                              emit(copyable_edge_t<uint32_t, double>{0, 1, 1.0});
+                              if (p == 2)
+                                throw std::runtime_error("bad input");
+                            },
+                            0, csr_build_options{}, pool),
+                      std::runtime_error);
+    REQUIRE(g.empty());
+    REQUIRE(g.edge_ids().size() == 0);
+  }
+}
+
+TEST_CASE("load_row_stream builds rows in part order", "[compressed_graph][parallel_load]") {
+  const uint32_t n    = 2'000;
+  const auto     rows = rows_of(reference(generators::barabasi_albert<uint32_t>(n, 4, 21), n));
+
+  for (size_t parts : {size_t{1}, size_t{7}}) {
+    thread_pool  pool(4);
+    weighted_csr g;
+    g.load_row_stream(
+          parts,
+          [&](size_t p, auto&& next_row, auto&& emit) {
+            for (size_t u = n * p / parts; u < n * (p + 1) / parts; ++u) {
+              next_row();
+              for (auto [t, w] : rows[u])
+                emit(copyable_edge_t<uint32_t, double>{static_cast<uint32_t>(u), t, w});
+            }
+          },
+          0, csr_build_options{}, pool);
+    REQUIRE(g.size() == n);
+    REQUIRE(rows_of(g) == rows);
+  }
+
+  SECTION("missing rows and targets beyond the rows") {
+    thread_pool pool(2);
+    void_csr    g;
+    g.load_row_stream(
+          2,
+          [](size_t p, auto&& next_row, auto&& emit) {
+            next_row();
+            emit(copyable_edge_t<uint32_t, void>{static_cast<uint32_t>(p), p == 0 ? 9u : 0u});
+            emit(copyable_edge_t<uint32_t, void>{static_cast<uint32_t>(p), 1});
+          },
+          4, csr_build_options{.sort_targets = true}, pool);
+    REQUIRE(g.size() == 10);
+    auto r = rows_of(g);
+    REQUIRE(r[0] == std::vector<uint32_t>{1, 9});
+    REQUIRE(r[1] == std::vector<uint32_t>{0, 1});
+    REQUIRE(r[9].empty());
+  }
+}
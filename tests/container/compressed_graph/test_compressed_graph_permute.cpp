@@ -0,0 +1,156 @@
+/**
+ * @file test_compressed_graph_permute.cpp
+ * @brief Tests for compressed_graph::load_permuted (parallel renumbering of the vertices).
+ *
+ * Every edge (u, v, w) of the source must appear as (new_id[u], new_id[v], w) in the copy, rows
+ * sorted by target with parallel edges in their original order, and vertex values must follow
+ * their vertices.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "graph/container/compressed_graph.hpp"
+#include "graph/generators.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+namespace {
+
+using weighted_csr = compressed_graph<double, std::string, void, uint32_t, uint32_t>;
+using bidir_csr    = compressed_graph<double, void, void, uint32_t, uint32_t, true>;
+using edge_vec     = std::vector<copyable_edge_t<uint32_t, double>>;
+
+edge_vec random_edges(uint32_t n, size_t m, uint64_t seed) {
+  std::mt19937_64                         rng(seed);
+  std::uniform_int_distribution<uint32_t> id(0, n - 1);
+  edge_vec                                edges;
+  for (size_t i = 0; i < m; ++i)
+    edges.push_back({id(rng), id(rng), static_cast<double>(i)});
+  std::ranges::stable_sort(edges, {}, [](const auto& e) { return e.source_id; });
+  return edges;
+}
+
+std::vector<uint32_t> random_permutation(uint32_t n, uint64_t seed) {
+  std::vector<uint32_t> p(n);
+  std::iota(p.begin(), p.end(), 0u);
+  std::mt19937_64 rng(seed);
+  std::ranges::shuffle(p, rng);
+  return p;
+}
+
+// Rows as (target, value) lists, in storage order
+template <class G>
+std::vector<std::vector<std::pair<uint32_t, double>>> rows_of(const G& g) {
+  std::vector<std::vector<std::pair<uint32_t, double>>> rows(g.size());
+  for (auto u : g.vertex_ids())
+    for (auto e : g.edge_ids(u))
+      rows[u].emplace_back(g.target_id(e), g.edge_value(e));
+  return rows;
+}
+
+} // namespace
+
+TEST_CASE("load_permuted renumbers rows, targets and values", "[compressed_graph][permute]") {
+  const uint32_t n     = 500;
+  const auto     edges = random_edges(n, 4000, 1);
+  const auto     p     = random_permutation(n, 2);
+
+  weighted_csr g;
+  g.load_edges(edges, std::identity{}, n);
+  std::vector<copyable_vertex_t<uint32_t, std::string>> names;
+  for (uint32_t u = 0; u < n; ++u)
+    names.push_back({u, "v" + std::to_string(u)});
+  g.load_vertices(names);
+
+  thread_pool  pool(4);
+  weighted_csr h;
+  h.load_permuted(g, p, pool);
+
+  REQUIRE(h.size() == n);
+  REQUIRE(h.col_index_storage().size() == edges.size());
+  for (uint32_t u = 0; u < n; ++u)
+    REQUIRE(h.vertex_value(p[u]) == "v" + std::to_string(u));
+
+  // Expected rows: the renumbered edges, stable-sorted by target
+  std::vector<std::vector<std::pair<uint32_t, double>>> expected(n);
+  for (auto& e : edges)
+    expected[p[e.source_id]].emplace_back(p[e.target_id], e.value);
+  for (auto& row : expected)
+    std::ranges::stable_sort(row, {}, [](const auto& tw) { return tw.first; });
+  REQUIRE(rows_of(h) == expected);
+  REQUIRE(num_partitions(h) == 1);
+
+  SECTION("identity permutation sorts the rows and changes nothing else") {
+    std::vector<uint32_t> id(n);
+    std::iota(id.begin(), id.end(), 0u);
+    weighted_csr same;
+    same.load_permuted(g, id, pool);
+    auto rows = rows_of(g);
+    for (auto& row : rows)
+      std::ranges::stable_sort(row, {}, [](const auto& tw) { return tw.first; });
+    REQUIRE(rows_of(same) == rows);
+  }
+
+  SECTION("the result does not depend on the number of workers") {
+    thread_pool  one(1);
+    weighted_csr serial;
+    serial.load_permuted(g, p, one);
+    REQUIRE(rows_of(serial) == rows_of(h));
+  }
+}
+
+TEST_CASE("load_permuted rebuilds the incoming-edge index", "[compressed_graph][permute][bidirectional]") {
+  const uint32_t n     = 300;
+  const auto     edges = random_edges(n, 2000, 3);
+  const auto     p     = random_permutation(n, 4);
+
+  bidir_csr g;
+  g.load_edges(edges, std::identity{}, n);
+  bidir_csr h;
+  h.load_permuted(g, p);
+
+  // Incoming edges of every vertex, with their values, against the outgoing rows
+  std::vector<std::vector<std::pair<uint32_t, double>>> in(n), expected(n);
+  for (auto u : h.vertex_ids())
+    for (auto e : h.edge_ids(u))
+      expected[h.target_id(e)].emplace_back(u, h.edge_value(e));
+  for (uint32_t v = 0; v < n; ++v) {
+    const auto sources = h.source_ids(v);
+    const auto ids     = h.in_edge_ids(v);
+    for (size_t k = 0; k < sources.size(); ++k)
+      in[v].emplace_back(sources[k], h.edge_value(ids[k]));
+    REQUIRE(std::ranges::is_sorted(sources));
+  }
+  REQUIRE(in == expected);
+}
+
+TEST_CASE("load_permuted edge cases", "[compressed_graph][permute]") {
+  SECTION("empty graph") {
+    weighted_csr g, h;
+    h.load_permuted(g, std::vector<uint32_t>{});
+    REQUIRE(h.size() == 0);
+  }
+
+  SECTION("isolated vertices and self-loops") {
+    weighted_csr g;
+    g.load_edges(edge_vec{{1, 1, 1.0}, {1, 3, 2.0}}, std::identity{}, 5);
+    weighted_csr h;
+    h.load_permuted(g, std::vector<uint32_t>{4, 0, 3, 1, 2});
+    REQUIRE(rows_of(h) == std::vector<std::vector<std::pair<uint32_t, double>>>{{{0, 1.0}, {1, 2.0}}, {}, {}, {}, {}});
+  }
+
+  SECTION("a repeated id or wrong size is rejected") {
+    weighted_csr g;
+    g.load_edges(edge_vec{{0, 1, 1.0}, {1, 2, 2.0}}, std::identity{}, 3);
+    weighted_csr h1, h2, h3;
+    REQUIRE_THROWS_AS(h1.load_permuted(g, std::vector<uint32_t>{0, 1, 1}), graph_error);
+    REQUIRE_THROWS_AS(h2.load_permuted(g, std::vector<uint32_t>{0, 1, 3}), graph_error);
+    REQUIRE_THROWS_AS(h3.load_permuted(g, std::vector<uint32_t>{0, 1}), graph_error);
+  }
+}
@@ -0,0 +1,363 @@
+/**
+ * @file test_compressed_varint_graph.cpp
+ * @brief Tests for compressed_varint_graph (CSR with gap-encoded varint rows).
+ *
+ * Decoded rows must equal the rows of a compressed_graph built from the same edges with sorted
+ * targets, edge values must follow their edges, and the graph must work with the algorithms and
+ * views unchanged: each is run on both containers and the results compared.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "graph/container/compressed_varint_graph.hpp"
+#include "graph/container/compressed_graph.hpp"
+#include "graph/container/dynamic_graph.hpp"
+#include "graph/container/traits/vov_graph_traits.hpp"
+#include "graph/algorithm/articulation_points.hpp"
+#include "graph/algorithm/bellman_ford_shortest_paths.hpp"
+#include "graph/algorithm/biconnected_components.hpp"
+#include "graph/algorithm/breadth_first_search.hpp"
+#include "graph/algorithm/connected_components.hpp"
+#include "graph/algorithm/delta_stepping_shortest_paths.hpp"
+#include "graph/algorithm/depth_first_search.hpp"
+#include "graph/algorithm/dijkstra_shortest_paths.hpp"
+#include "graph/algorithm/jaccard.hpp"
+#include "graph/algorithm/label_propagation.hpp"
+#include "graph/algorithm/mis.hpp"
+#include "graph/algorithm/mst.hpp"
+#include "graph/algorithm/pagerank.hpp"
+#include "graph/algorithm/parallel_breadth_first_search.hpp"
+#include "graph/algorithm/parallel_scc.hpp"
+#include "graph/algorithm/parallel_triangle_count.hpp"
+#include "graph/algorithm/tarjan_scc.hpp"
+#include "graph/algorithm/tc.hpp"
+#include "graph/algorithm/topological_sort.hpp"
+#include "graph/algorithm/vertex_ordering.hpp"
+#include "graph/generators.hpp"
+#include "graph/views.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+namespace {
+
+using varint_graph = compressed_varint_graph<double, void, void, uint32_t, uint32_t>;
+using csr          = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using vov          = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using edge_vec     = std::vector<copyable_edge_t<uint32_t, double>>;
+
+static_assert(adj_list::index_adjacency_list<varint_graph>);
+static_assert(adj_list::ordered_vertex_edges<varint_graph>);
+static_assert(std::sized_sentinel_for<varint_graph::target_iterator, varint_graph::target_iterator>);
+
+edge_vec random_edges(uint32_t n, size_t m, uint64_t seed) {
+  std::mt19937_64                         rng(seed);
+  std::uniform_int_distribution<uint32_t> id(0, n - 1);
+  edge_vec                                el;
+  for (size_t i = 0; i < m; ++i)
+    el.push_back({id(rng), id(rng), static_cast<double>(1 + i % 7)});
+  return el;
+}
+
+// Both directions of every edge
+edge_vec symmetrized(const edge_vec& el) {
+  edge_vec out;
+  for (auto& e : el) {
+    out.push_back(e);
+    out.push_back({e.target_id, e.source_id, e.value});
+  }
+  return out;
+}
+
+csr make_csr(const edge_vec& el, uint32_t n) {
+  csr g;
+  g.load_unsorted_edges(el, std::identity{}, n, {.sort_targets = true});
+  return g;
+}
+
+// For the algorithms that do not accept compressed_graph: the same rows in a dynamic_graph
+vov make_vov(edge_vec el, uint32_t n) {
+  std::ranges::stable_sort(el, {}, [](const auto& e) { return std::pair(e.source_id, e.target_id); });
+  vov g;
+  g.load_edges(el, [](const auto& e) { return copyable_edge_t<uint32_t, void>{e.source_id, e.target_id}; }, n);
+  return g;
+}
+
+// Rows as (target, value) lists, in iteration order
+template <class G>
+std::vector<std::vector<std::pair<uint32_t, double>>> rows_of(const G& g) {
+  std::vector<std::vector<std::pair<uint32_t, double>>> rows(num_vertices(g));
+  for (auto&& [uid, u] : views::vertexlist(g))
+    for (auto&& uv : edges(g, u))
+      rows[uid].emplace_back(target_id(g, uv), edge_value(g, uv));
+  return rows;
+}
+
+// Records the discovery order of a search
+struct order_visitor {
+  std::vector<uint32_t>* order;
+  template <class G, class U>
+  void on_discover_vertex(const G& g, const U& u) {
+    order->push_back(static_cast<uint32_t>(vertex_id(g, u)));
+  }
+};
+
+constexpr auto weight_fn = [](const auto& g, const auto& uv) { return edge_value(g, uv); };
+
+} // namespace
+
+TEST_CASE("compressed_varint_graph decodes the rows of compressed_graph", "[compressed_varint_graph]") {
+  const uint32_t n     = 1000;
+  const auto     el    = random_edges(n, 8000, 1);
+  const auto     ref   = make_csr(el, n);
+
+  thread_pool  four(4);
+  varint_graph g(el, std::identity{}, n, four);
+  REQUIRE(g.size() == n);
+  REQUIRE(num_edges(g) == el.size());
+  REQUIRE(rows_of(g) == rows_of(ref));
+
+  for (auto u : g.vertex_ids()) {
+    REQUIRE(std::ranges::equal(g.target_ids(u), ref.target_ids(u)));
+    REQUIRE(std::ranges::equal(g.edge_ids(u), ref.edge_ids(u)));
+    REQUIRE(num_edges(g, *find_vertex(g, u)) == ref.edge_ids(u).size());
+    REQUIRE(std::ranges::size(edges(g, *find_vertex(g, u))) == ref.edge_ids(u).size());
+  }
+  REQUIRE(g.byte_index().size() == n + 1);
+  REQUIRE(g.byte_index().back() == g.bytes().size());
+
+  SECTION("the encoding does not depend on the number of workers") {
+    thread_pool  one(1);
+    varint_graph serial(el, std::identity{}, n, one);
+    REQUIRE(std::ranges::equal(serial.bytes(), g.bytes()));
+    REQUIRE(std::ranges::equal(serial.byte_index(), g.byte_index()));
+  }
+
+  SECTION("load_graph from a graph with unsorted rows") {
+    auto by_source = el;
+    std::ranges::stable_sort(by_source, {}, [](const auto& e) { return e.source_id; });
+    csr unsorted;
+    unsorted.load_edges(by_source, std::identity{}, n);
+    varint_graph h;
+    h.load_graph(unsorted, four);
+    REQUIRE(rows_of(h) == rows_of(ref));
+  }
+
+  SECTION("edge values are mutable") {
+    for (auto eid : g.edge_ids())
+      g.edge_value(eid) = 2 * g.edge_value(eid);
+    for (auto u : g.vertex_ids())
+      for (auto&& uv : edges(g, *find_vertex(g, u)))
+        REQUIRE(edge_value(g, uv) == 2 * ref.edge_value(uv.value().edge_index()));
+  }
+}
+
+TEST_CASE("compressed_varint_graph edge cases", "[compressed_varint_graph]") {
+  SECTION("empty graph") {
+    varint_graph g(edge_vec{});
+    REQUIRE(g.size() == 0);
+    REQUIRE(num_edges(g) == 0);
+    REQUIRE(g.bytes().empty());
+    REQUIRE(std::ranges::empty(g.target_ids(0)));
+  }
+
+  SECTION("isolated vertices, self-loops, parallel edges and targets below the source") {
+    const edge_vec el{{3, 3, 1.0}, {3, 0, 2.0}, {1, 4, 3.0}, {3, 0, 4.0}, {3, 5, 5.0}};
+    varint_graph   g(el, std::identity{}, 8);
+    REQUIRE(g.size() == 8);
+    REQUIRE(rows_of(g) == std::vector<std::vector<std::pair<uint32_t, double>>>{
+                                {}, {{4, 3.0}}, {}, {{0, 2.0}, {0, 4.0}, {3, 1.0}, {5, 5.0}}, {}, {}, {}, {}});
+    REQUIRE(std::ranges::empty(g.target_ids(7)));
+    REQUIRE(std::ranges::empty(g.target_ids(8)));
+  }
+
+  SECTION("vertex and graph values") {
+    compressed_varint_graph<void, std::string, std::string, uint32_t, uint32_t> g(std::string("roads"));
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, void>>{{0, 1}, {1, 2}});
+    g.load_vertices(std::vector<copyable_vertex_t<uint32_t, std::string>>{{0, "a"}, {2, "c"}});
+    REQUIRE(g.graph_value() == "roads");
+    REQUIRE(vertex_value(g, *find_vertex(g, 0u)) == "a");
+    REQUIRE(g.vertex_value(1).empty());
+    REQUIRE(g.vertex_value(2) == "c");
+    REQUIRE_THROWS_AS(g.load_vertices(std::vector<copyable_vertex_t<uint32_t, std::string>>{{3, "d"}}),
+                      graph_error);
+  }
+
+  SECTION("64-bit ids and gaps") {
+    using big_graph = compressed_varint_graph<void, void, void, uint64_t, uint64_t>;
+    big_graph g(std::vector<copyable_edge_t<uint64_t, void>>{{0, 70000}, {0, 1}, {70000, 0}, {1, 70000}});
+    REQUIRE(std::ranges::equal(g.target_ids(0), std::vector<uint64_t>{1, 70000}));
+    REQUIRE(std::ranges::equal(g.target_ids(70000), std::vector<uint64_t>{0}));
+
+    // One group with a value of each length class
+    const std::vector<uint64_t> values{0, 256, std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint64_t>::max()};
+    std::vector<uint8_t>        buf;
+    group_varint::encode(std::span<const uint64_t>(values), buf);
+    REQUIRE(buf.size() == 1 + 1 + 2 + 4 + 8);
+    REQUIRE(buf[0] == 0b11'10'01'00);
+    buf.resize(buf.size() + group_varint::padding);
+    REQUIRE(group_varint::load<uint64_t>(buf.data() + 1, 1) == 0);
+    REQUIRE(group_varint::load<uint64_t>(buf.data() + 2, 2) == 256);
+    REQUIRE(group_varint::load<uint64_t>(buf.data() + 4, 4) == values[2]);
+    REQUIRE(group_varint::load<uint64_t>(buf.data() + 8, 8) == values[3]);
+    for (uint64_t x : values)
+      REQUIRE(group_varint::unzigzag(group_varint::zigzag(x)) == x);
+    REQUIRE(group_varint::zigzag(static_cast<uint64_t>(-1)) == 1);
+    REQUIRE(group_varint::length_class(uint32_t{1} << 24) == 3);
+  }
+}
+
+TEST_CASE("compressed_varint_graph takes 1-2 bytes per edge on a well-ordered graph", "[compressed_varint_graph]") {
+  // A shuffled 100 x 100 grid, renumbered by rcm
+  const uint32_t        n = 10000;
+  std::vector<uint32_t> p(n);
+  std::iota(p.begin(), p.end(), 0u);
+  std::mt19937_64 rng(2);
+  std::ranges::shuffle(p, rng);
+  edge_vec el;
+  for (auto& e : generators::grid_2d<uint32_t>(100, 100, 3))
+    el.push_back({p[e.source_id], p[e.target_id], e.value});
+  const auto shuffled = make_csr(el, n);
+  const auto ordered  = reorder(shuffled, order_vertices(shuffled, vertex_order::rcm, {.symmetric = true}));
+
+  varint_graph before, after;
+  before.load_graph(shuffled);
+  after.load_graph(ordered);
+  const double m = static_cast<double>(el.size());
+  REQUIRE(static_cast<double>(before.bytes().size()) / m > 1.5);
+  REQUIRE(static_cast<double>(after.bytes().size()) / m < 1.5);
+  REQUIRE(rows_of(after) == rows_of(ordered));
+}
+
+TEST_CASE("compressed_varint_graph runs the algorithms unchanged", "[compressed_varint_graph][algorithm]") {
+  const uint32_t n     = 600;
+  const auto     el    = random_edges(n, 1500, 4);
+  const auto     ref   = make_csr(el, n);
+  const auto     g     = varint_graph(el, std::identity{}, n);
+  const auto     sym   = symmetrized(el);
+  const auto     ref_u = make_csr(sym, n);
+  const auto     g_u   = varint_graph(sym, std::identity{}, n);
+  const auto     vov_u = make_vov(sym, n);
+  constexpr auto inf   = std::numeric_limits<double>::max();
+
+  SECTION("views") {
+    auto bfs_order = [](const auto& gr) {
+      std::vector<uint32_t> order;
+      for (auto [v] : gr | views::adaptors::vertices_bfs(0u))
+        order.push_back(static_cast<uint32_t>(vertex_id(gr, v)));
+      return order;
+    };
+    auto dfs_order = [](const auto& gr) {
+      std::vector<uint32_t> order;
+      for (auto [v] : gr | views::adaptors::vertices_dfs(0u))
+        order.push_back(static_cast<uint32_t>(vertex_id(gr, v)));
+      return order;
+    };
+    REQUIRE(bfs_order(g) == bfs_order(ref));
+    REQUIRE(dfs_order(g) == dfs_order(ref));
+  }
+
+  SECTION("searches") {
+    std::vector<uint32_t> a, b;
+    breadth_first_search(g, 0u, order_visitor{&a});
+    breadth_first_search(ref, 0u, order_visitor{&b});
+    REQUIRE(a == b);
+    a.clear(), b.clear();
+    depth_first_search(g, 0u, order_visitor{&a});
+    depth_first_search(ref, 0u, order_visitor{&b});
+    REQUIRE(a == b);
+
+    thread_pool           pool(4);
+    std::vector<uint32_t> la(n), pa(n), lb(n), pb(n);
+    parallel_breadth_first_search(g, 0u, container_value_fn(la), container_value_fn(pa), empty_visitor(), {}, pool);
+    parallel_breadth_first_search(ref, 0u, container_value_fn(lb), container_value_fn(pb), empty_visitor(), {}, pool);
+    REQUIRE(la == lb);
+  }
+
+  SECTION("shortest paths") {
+    std::vector<double> expected(n, inf);
+    dijkstra_shortest_distances(ref, 0u, container_value_fn(expected), weight_fn);
+
+    std::vector<double> dist(n, inf);
+    dijkstra_shortest_distances(g, 0u, container_value_fn(dist), weight_fn);
+    REQUIRE(dist == expected);
+    std::ranges::fill(dist, inf);
+    REQUIRE(!bellman_ford_shortest_distances(g, 0u, container_value_fn(dist), weight_fn).has_value());
+    REQUIRE(dist == expected);
+    std::ranges::fill(dist, inf);
+    delta_stepping_shortest_distances(g, 0u, container_value_fn(dist), weight_fn);
+    REQUIRE(dist == expected);
+  }
+
+  SECTION("components and orderings") {
+    std::vector<uint32_t> a(n), b(n);
+    REQUIRE(tarjan_scc(g, container_value_fn(a)) == parallel_scc(ref, container_value_fn(b)));
+    REQUIRE(parallel_scc(g, container_value_fn(a)) == parallel_scc(ref, container_value_fn(b)));
+    REQUIRE(a == b);
+    REQUIRE(connected_components(g_u, container_value_fn(a)) == parallel_scc(ref_u, container_value_fn(b)));
+    afforest(g_u, a);
+    afforest(ref_u, b);
+    REQUIRE(a == b);
+
+    std::vector<uint32_t> cut_a, cut_b;
+    articulation_points(g_u, std::back_inserter(cut_a));
+    articulation_points(vov_u, std::back_inserter(cut_b));
+    REQUIRE(cut_a == cut_b);
+    std::vector<std::vector<uint32_t>> bcc_a, bcc_b;
+    biconnected_components(g_u, bcc_a);
+    biconnected_components(vov_u, bcc_b);
+    REQUIRE(bcc_a == bcc_b);
+
+    std::vector<uint32_t> mis_a, mis_b;
+    maximal_independent_set(g_u, std::back_inserter(mis_a), 0u);
+    maximal_independent_set(ref_u, std::back_inserter(mis_b), 0u);
+    REQUIRE(mis_a == mis_b);
+
+    // The rows below the diagonal form a DAG
+    edge_vec dag;
+    for (auto& e : el)
+      if (e.source_id < e.target_id)
+        dag.push_back(e);
+    std::vector<uint32_t> topo_a, topo_b;
+    REQUIRE(topological_sort(varint_graph(dag, std::identity{}, n), std::back_inserter(topo_a)));
+    REQUIRE(topological_sort(make_csr(dag, n), std::back_inserter(topo_b)));
+    REQUIRE(topo_a == topo_b);
+
+    REQUIRE(order_vertices(g, vertex_order::rcm).old_id == order_vertices(ref, vertex_order::rcm).old_id);
+  }
+
+  SECTION("spanning trees, ranks and neighbourhoods") {
+    std::vector<double>   wa(n), wb(n);
+    std::vector<uint32_t> pa(n), pb(n);
+    REQUIRE(prim(g_u, 0u, container_value_fn(wa), container_value_fn(pa)) ==
+            prim(ref_u, 0u, container_value_fn(wb), container_value_fn(pb)));
+    REQUIRE(pa == pb);
+
+    std::vector<double> ra(n), rb(n);
+    pagerank(g, container_value_fn(ra));
+    pagerank(ref, container_value_fn(rb));
+    REQUIRE(ra == rb);
+
+    std::vector<uint32_t> la(n), lb(n);
+    std::iota(la.begin(), la.end(), 0u);
+    std::iota(lb.begin(), lb.end(), 0u);
+    std::mt19937 rng_a(5), rng_b(5);
+    label_propagation(g_u, container_value_fn(la), rng_a);
+    label_propagation(ref_u, container_value_fn(lb), rng_b);
+    REQUIRE(la == lb);
+
+    REQUIRE(triangle_count(g_u) == triangle_count(ref_u));
+    REQUIRE(parallel_triangle_count(g_u) == triangle_count(ref_u));
+
+    double ja = 0, jb = 0;
+    jaccard_coefficient(g_u, [&](auto, auto, auto&, double val) { ja += val; });
+    jaccard_coefficient(ref_u, [&](auto, auto, auto&, double val) { jb += val; });
+    REQUIRE(ja == jb);
+  }
+}
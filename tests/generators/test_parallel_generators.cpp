@@ -0,0 +1,192 @@
+/**
+ * @file test_parallel_generators.cpp
+ * @brief Tests for counter_rng, the edge generators and their parallel drivers
+ *        (generate_edges, load_generated, sort_unique_edges).
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <graph/generators.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace graph;
+using namespace graph::generators;
+
+namespace {
+
+using edges_t      = generators::edge_list<uint32_t>;
+using weighted_csr = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+template <class EdgeList>
+bool same_edges(const EdgeList& a, const EdgeList& b) {
+  return std::ranges::equal(a, b, [](const auto& x, const auto& y) {
+    return x.source_id == y.source_id && x.target_id == y.target_id && x.value == y.value;
+  });
+}
+
+bool sorted_by_source_target(const edges_t& edges) {
+  return std::ranges::is_sorted(edges, {}, [](const auto& e) { return std::pair(e.source_id, e.target_id); });
+}
+
+std::vector<std::vector<std::pair<uint32_t, double>>> rows_of(const weighted_csr& g) {
+  std::vector<std::vector<std::pair<uint32_t, double>>> rows(g.size());
+  for (auto u : g.vertex_ids())
+    for (auto e : g.edge_ids(u))
+      rows[u].emplace_back(g.target_id(e), g.edge_value(e));
+  return rows;
+}
+
+} // namespace
+
+TEST_CASE("counter_rng: Philox4x32-10 known answers", "[generators][counter_rng]") {
+  // Known-answer vectors of the Random123 reference implementation
+  STATIC_REQUIRE(philox4x32({0, 0, 0, 0}, {0, 0}) ==
+                 std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  STATIC_REQUIRE(philox4x32({~0u, ~0u, ~0u, ~0u}, {~0u, ~0u}) ==
+                 std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+  STATIC_REQUIRE(philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+                 std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+  SECTION("streams are reproducible and distinct") {
+    counter_rng a(7, 3), b(7, 3), c(7, 4), d(8, 3);
+    std::set<uint64_t> seen;
+    for (int k = 0; k < 100; ++k) {
+      const uint64_t x = a();
+      REQUIRE(x == b());
+      seen.insert(x);
+      seen.insert(c());
+      seen.insert(d());
+    }
+    REQUIRE(seen.size() == 300);
+  }
+
+  SECTION("uniform01 is in [0, 1)") {
+    counter_rng rng(1, 2);
+    double      sum = 0;
+    for (int k = 0; k < 10'000; ++k) {
+      const double x = rng.uniform01();
+      REQUIRE(x >= 0.0);
+      REQUIRE(x < 1.0);
+      sum += x;
+    }
+    REQUIRE(sum / 10'000 > 0.48);
+    REQUIRE(sum / 10'000 < 0.52);
+  }
+}
+
+TEST_CASE("parallel generators do not depend on the thread count", "[generators][parallel]") {
+  thread_pool one(1), four(4);
+
+  SECTION("rmat") {
+    const auto expected = rmat<uint32_t>(12, 40'000, 0.57, 0.19, 0.19, 0.05, 3, weight_dist::uniform, one);
+    REQUIRE(same_edges(rmat<uint32_t>(12, 40'000, 0.57, 0.19, 0.19, 0.05, 3, weight_dist::uniform, four), expected));
+    REQUIRE(sorted_by_source_target(expected));
+  }
+
+  SECTION("erdos_renyi") {
+    const auto expected = erdos_renyi<uint32_t>(3'000, 0.004, 5, weight_dist::exponential, one);
+    REQUIRE(same_edges(erdos_renyi<uint32_t>(3'000, 0.004, 5, weight_dist::exponential, four), expected));
+    REQUIRE(sorted_by_source_target(expected));
+  }
+
+  SECTION("erdos_renyi_gnm, sparse and dense") {
+    for (size_t m : {size_t{20'000}, size_t{9'000}}) {
+      const auto expected = erdos_renyi_gnm<uint32_t>(100, m, 9, weight_dist::uniform, one);
+      REQUIRE(expected.size() == std::min<size_t>(m, 100 * 99));
+      REQUIRE(same_edges(erdos_renyi_gnm<uint32_t>(100, m, 9, weight_dist::uniform, four), expected));
+      REQUIRE(sorted_by_source_target(expected));
+      REQUIRE(std::ranges::adjacent_find(expected, {}, [](const auto& e) {
+                return std::pair(e.source_id, e.target_id);
+              }) == expected.end());
+      REQUIRE(std::ranges::none_of(expected, [](const auto& e) { return e.source_id == e.target_id; }));
+    }
+  }
+
+  SECTION("plod") {
+    const auto expected = plod<uint32_t>(2'000, 2.5, 10.0, 11, weight_dist::uniform, one);
+    REQUIRE(same_edges(plod<uint32_t>(2'000, 2.5, 10.0, 11, weight_dist::uniform, four), expected));
+  }
+}
+
+TEST_CASE("edge generators: slot i is the same however the slots are split", "[generators][parallel]") {
+  const rmat_generator<uint32_t> gen(10, 5'000, 0.45, 0.15, 0.15, 0.25, 21);
+  edges_t                        whole;
+  gen.for_each_edge(0, gen.num_slots(), [&](const auto& e) { whole.push_back(e); });
+
+  // Slots generated one at a time, last to first, then put back in slot order
+  std::vector<edges_t> slots(gen.num_slots());
+  for (size_t i = gen.num_slots(); i-- > 0;)
+    gen.for_each_edge(i, i + 1, [&](const auto& e) { slots[i].push_back(e); });
+  edges_t pieces;
+  for (const auto& slot : slots)
+    pieces.insert(pieces.end(), slot.begin(), slot.end());
+  REQUIRE(same_edges(pieces, whole));
+  REQUIRE(same_edges(generate_edges(gen), whole));
+}
+
+TEST_CASE("sort_unique_edges keeps the first edge of each pair", "[generators][parallel]") {
+  edges_t edges = {{3, 1, 1.0}, {0, 2, 2.0}, {3, 1, 3.0}, {0, 1, 4.0}, {0, 2, 5.0}, {2, 0, 6.0}};
+  thread_pool pool(2);
+  sort_unique_edges(edges, 0, pool);
+  REQUIRE(same_edges(edges, edges_t{{0, 1, 4.0}, {0, 2, 2.0}, {2, 0, 6.0}, {3, 1, 1.0}}));
+
+  // rmat dedups like a std::set keyed by (source, target) over the attempts in order
+  const rmat_generator<uint32_t>                   gen(9, 20'000);
+  std::map<std::pair<uint32_t, uint32_t>, double> first;
+  gen.for_each_edge(0, gen.num_slots(), [&](const auto& e) { first.try_emplace({e.source_id, e.target_id}, e.value); });
+  const auto generated = rmat<uint32_t>(9, 20'000);
+  REQUIRE(generated.size() == first.size());
+  size_t i = 0;
+  for (const auto& [st, w] : first) {
+    REQUIRE(generated[i].source_id == st.first);
+    REQUIRE(generated[i].target_id == st.second);
+    REQUIRE(generated[i].value == w);
+    ++i;
+  }
+}
+
+TEST_CASE("load_generated builds the graph of the edge list", "[generators][parallel]") {
+  thread_pool pool(3);
+
+  SECTION("rmat, duplicates removed in the CSR build") {
+    const rmat_generator<uint32_t> gen(11, 30'000, 0.57, 0.19, 0.19, 0.05, 4);
+    weighted_csr                   g;
+    load_generated(g, gen, {.remove_duplicates = true}, pool);
+    weighted_csr expected;
+    expected.load_edges(rmat<uint32_t>(11, 30'000, 0.57, 0.19, 0.19, 0.05, 4), std::identity{}, gen.num_vertices());
+    REQUIRE(g.size() == expected.size());
+    REQUIRE(rows_of(g) == rows_of(expected));
+  }
+
+  SECTION("erdos_renyi, rows in generated order") {
+    const erdos_renyi_generator<uint32_t> gen(5'000, 0.002, 8);
+    weighted_csr                          g;
+    load_generated(g, gen, {}, pool);
+    weighted_csr expected;
+    expected.load_edges(erdos_renyi<uint32_t>(5'000, 0.002, 8), std::identity{}, 5'000);
+    REQUIRE(rows_of(g) == rows_of(expected));
+  }
+}
+
+TEST_CASE("load_generated uses no more parts than edges per vertex", "[generators][parallel]") {
+  using generators::detail::load_generated_parts;
+
+  // One vertex histogram per part: a sparse graph on a large pool keeps to a few parts
+  REQUIRE(load_generated_parts(erdos_renyi_generator<uint32_t>(100'000, 2.0 / 100'000, 1), 64) == 1);
+  REQUIRE(load_generated_parts(rmat_generator<uint32_t>(16, 65'536, 0.57, 0.19, 0.19, 0.05, 1), 64) == 1);
+  REQUIRE(load_generated_parts(rmat_generator<uint32_t>(16, 4 * 65'536, 0.57, 0.19, 0.19, 0.05, 1), 64) == 4);
+  REQUIRE(load_generated_parts(erdos_renyi_gnm_generator<uint32_t>(1'000, 500, 1), 64) == 1);
+  REQUIRE(load_generated_parts(plod_generator<uint32_t>(100'000, 2.5, 1.0, 1), 64) == 1);
+
+  // Dense graphs use every worker, and never more parts than slots
+  REQUIRE(load_generated_parts(erdos_renyi_generator<uint32_t>(1'000, 0.5, 1), 64) == 64);
+  REQUIRE(load_generated_parts(erdos_renyi_generator<uint32_t>(1'000, 0.5, 1), 3) == 3);
+  REQUIRE(load_generated_parts(erdos_renyi_generator<uint32_t>(40, 1.0, 1), 64) == 39);
+  REQUIRE(load_generated_parts(erdos_renyi_generator<uint32_t>(0, 0.5, 1), 64) == 1);
+}
@@ -0,0 +1,261 @@
+/**
+ * @file test_binary_snapshot.cpp
+ * @brief Tests for the compressed_graph binary snapshot writer and memory-mapped reader.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <graph/io/binary_snapshot.hpp>
+#include <graph/algorithm/breadth_first_search.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/generators.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::io;
+
+namespace {
+
+using weighted_csr = container::compressed_graph<double, int, void, uint32_t, uint64_t>;
+using plain_csr    = container::compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using weighted_view = csr_snapshot_view<double, int, uint32_t, uint64_t>;
+using plain_view    = csr_snapshot_view<void, void, uint32_t, uint32_t>;
+
+static_assert(adj_list::index_adjacency_list<weighted_view>);
+static_assert(adj_list::index_adjacency_list<plain_view>);
+
+// Snapshot bytes in 64-byte aligned storage, as a mapping would provide
+struct aligned_bytes {
+  std::unique_ptr<std::byte[]> storage;
+  std::byte*                   data = nullptr;
+  size_t                       size = 0;
+
+  explicit aligned_bytes(const std::string& s) : storage(new std::byte[s.size() + 64]), size(s.size()) {
+    auto addr = reinterpret_cast<std::uintptr_t>(storage.get());
+    data      = storage.get() + (64 - addr % 64) % 64;
+    std::memcpy(data, s.data(), s.size());
+  }
+  std::span<const std::byte> bytes() const { return {data, size}; }
+};
+
+template <class G>
+std::string snapshot_of(const G& g) {
+  std::ostringstream os(std::ios::binary);
+  write_binary_snapshot(os, g);
+  return os.str();
+}
+
+weighted_csr make_weighted(uint32_t n = 500) {
+  weighted_csr g;
+  g.load_edges(generators::erdos_renyi<uint32_t>(n, 6.0 / n, 11), std::identity{}, n);
+  std::vector<copyable_vertex_t<uint32_t, int>> vv;
+  for (uint32_t i = 0; i < n; ++i)
+    vv.push_back({i, static_cast<int>(i * 3)});
+  g.load_vertices(vv);
+  return g;
+}
+
+template <class G, class V>
+void require_same_structure(const G& g, const V& view) {
+  REQUIRE(view.size() == g.size());
+  REQUIRE(num_edges(view) == num_edges(g));
+  for (auto u : g.vertex_ids()) {
+    auto ge = g.edge_ids(u);
+    auto ve = view.edge_ids(u);
+    REQUIRE(ve.size() == ge.size());
+    for (auto [a, b] = std::pair(ge.begin(), ve.begin()); a != ge.end(); ++a, ++b) {
+      REQUIRE(view.target_id(*b) == g.target_id(*a));
+    }
+  }
+}
+
+struct discover_counter {
+  size_t count = 0;
+  template <class G, class V>
+  void on_discover_vertex(const G&, const V&) {
+    ++count;
+  }
+};
+
+} // namespace
+
+TEST_CASE("binary_snapshot: in-memory round trip", "[io][binary_snapshot]") {
+  const auto g     = make_weighted();
+  const auto bytes = aligned_bytes(snapshot_of(g));
+
+  weighted_view view(bytes.bytes());
+  require_same_structure(g, view);
+  for (auto u : g.vertex_ids()) {
+    REQUIRE(view.vertex_value(u) == g.vertex_value(u));
+    for (auto e : g.edge_ids(u))
+      REQUIRE(view.edge_value(e) == g.edge_value(e));
+  }
+
+  // Through the CPOs
+  for (auto u : vertices(view)) {
+    REQUIRE(vertex_value(view, u) == static_cast<int>(vertex_id(view, u) * 3));
+    for (auto uv : edges(view, u))
+      REQUIRE(edge_value(view, uv) == view.edge_value(static_cast<uint64_t>(uv.value() - view.col_index().data())));
+  }
+}
+
+TEST_CASE("binary_snapshot: file round trip through mmap", "[io][binary_snapshot]") {
+  const auto g    = make_weighted(2'000);
+  const auto path = std::filesystem::temp_directory_path() / "graph_v3_test_snapshot.gv3";
+  write_binary_snapshot(path, g);
+
+  {
+    auto view = map_binary_snapshot<double, int, uint32_t, uint64_t>(path);
+    require_same_structure(g, view);
+    require_same_structure(g, map_binary_snapshot<double, int, uint32_t, uint64_t>(path, snapshot_check::header_only));
+
+    // Algorithms run on the view unchanged
+    std::vector<double> expected(g.size()), actual(g.size());
+    init_shortest_paths(g, expected);
+    init_shortest_paths(view, actual);
+    auto w = [](const auto& gr, const auto& uv) { return edge_value(gr, uv); };
+    dijkstra_shortest_distances(g, uint32_t{0}, container_value_fn(expected), w);
+    dijkstra_shortest_distances(view, uint32_t{0}, container_value_fn(actual), w);
+    REQUIRE(actual == expected);
+
+    // Copies share the mapping
+    auto             copy = view;
+    discover_counter counter;
+    breadth_first_search(copy, uint32_t{0}, counter);
+    size_t reached = 0;
+    for (auto d : actual)
+      reached += d != infinite_distance<double>();
+    REQUIRE(counter.count == reached);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("binary_snapshot: void values, empty graph and partitions", "[io][binary_snapshot]") {
+  SECTION("void edge and vertex values") {
+    plain_csr g;
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, void>>{{0, 1}, {0, 2}, {2, 0}, {3, 1}});
+    const auto bytes = aligned_bytes(snapshot_of(g));
+    plain_view view(bytes.bytes());
+    require_same_structure(g, view);
+    REQUIRE(view.header().edge_value_size == 0);
+  }
+
+  SECTION("never loaded") {
+    plain_csr  g;
+    const auto bytes = aligned_bytes(snapshot_of(g));
+    plain_view view(bytes.bytes());
+    REQUIRE(view.empty());
+    REQUIRE(num_edges(view) == 0);
+    REQUIRE(std::ranges::empty(vertices(view)));
+  }
+
+  SECTION("partitions") {
+    std::vector<copyable_edge_t<uint32_t, void>> el = {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}};
+    plain_csr g(el, std::identity{}, std::vector<uint32_t>{0, 2, 4});
+    const auto bytes = aligned_bytes(snapshot_of(g));
+    plain_view view(bytes.bytes());
+    REQUIRE(num_partitions(view) == num_partitions(g));
+    for (auto u : vertices(g))
+      REQUIRE(partition_id(view, *find_vertex(view, vertex_id(g, u))) == partition_id(g, u));
+    REQUIRE(std::ranges::distance(vertices(view, 1)) == std::ranges::distance(vertices(g, 1)));
+  }
+}
+
+TEST_CASE("binary_snapshot: rejects invalid input", "[io][binary_snapshot]") {
+  const auto g        = make_weighted(50);
+  const auto original = snapshot_of(g);
+
+  auto open = [](const std::string& s) {
+    const aligned_bytes b(s);
+    weighted_view       view(b.bytes());
+  };
+
+  REQUIRE_NOTHROW(open(original));
+
+  SECTION("too small") { REQUIRE_THROWS_AS(open(original.substr(0, 100)), graph_error); }
+
+  SECTION("truncated sections") { REQUIRE_THROWS_AS(open(original.substr(0, original.size() - 8)), graph_error); }
+
+  SECTION("bad magic") {
+    auto s = original;
+    s[0]   = 'X';
+    REQUIRE_THROWS_AS(open(s), graph_error);
+  }
+
+  SECTION("unsupported version") {
+    auto s = original;
+    s[offsetof(snapshot_header, version)] = 9;
+    REQUIRE_THROWS_AS(open(s), graph_error);
+  }
+
+  SECTION("other byte order") {
+    auto           s   = original;
+    const uint32_t tag = 0x04030201;
+    std::memcpy(s.data() + offsetof(snapshot_header, endian_tag), &tag, sizeof(tag));
+    REQUIRE_THROWS_AS(open(s), graph_error);
+  }
+
+  SECTION("type mismatch") {
+    const aligned_bytes b(original);
+    REQUIRE_THROWS_AS((csr_snapshot_view<double, int, uint32_t, uint32_t>(b.bytes())), graph_error);
+    REQUIRE_THROWS_AS((csr_snapshot_view<float, int, uint32_t, uint64_t>(b.bytes())), graph_error);
+    REQUIRE_THROWS_AS((csr_snapshot_view<double, void, uint32_t, uint64_t>(b.bytes())), graph_error);
+  }
+
+  SECTION("corrupt row index or targets") {
+    snapshot_header h;
+    std::memcpy(&h, original.data(), sizeof(h));
+    auto s = original;
+
+    const uint64_t zero = 0;
+    std::memcpy(s.data() + h.row_index_offset + 10 * sizeof(uint64_t), &zero, sizeof(zero));
+    REQUIRE_THROWS_AS(open(s), graph_error);
+
+    s                   = original;
+    const uint32_t high = 50;
+    std::memcpy(s.data() + h.col_index_offset + 3 * sizeof(uint32_t), &high, sizeof(high));
+    REQUIRE_THROWS_AS(open(s), graph_error);
+  }
+
+  SECTION("counts larger than the snapshot") {
+    auto           s = original;
+    const uint64_t n = uint64_t{1} << 61;
+    std::memcpy(s.data() + offsetof(snapshot_header, num_vertices), &n, sizeof(n));
+    REQUIRE_THROWS_AS(open(s), graph_error);
+  }
+
+  SECTION("header_only checks the header but not the arrays") {
+    snapshot_header h;
+    std::memcpy(&h, original.data(), sizeof(h));
+    auto           s    = original;
+    const uint32_t high = 50;
+    std::memcpy(s.data() + h.col_index_offset + 3 * sizeof(uint32_t), &high, sizeof(high));
+    const aligned_bytes corrupt(s);
+    REQUIRE_THROWS_AS(weighted_view(corrupt.bytes()), graph_error);
+    REQUIRE_THROWS_AS(weighted_view(corrupt.bytes(), snapshot_check::full), graph_error);
+    const weighted_view trusted(corrupt.bytes(), snapshot_check::header_only);
+    REQUIRE(trusted.size() == g.size());
+    REQUIRE(trusted.col_index()[3] == high);
+
+    auto bad_magic = original;
+    bad_magic[0]   = 'X';
+    const aligned_bytes b(bad_magic);
+    REQUIRE_THROWS_AS(weighted_view(b.bytes(), snapshot_check::header_only), graph_error);
+    REQUIRE_THROWS_AS(weighted_view(aligned_bytes(original.substr(0, original.size() - 8)).bytes(),
+                                    snapshot_check::header_only),
+                      graph_error);
+  }
+
+  SECTION("missing file") {
+    REQUIRE_THROWS_AS(map_binary_snapshot(std::filesystem::path("/nonexistent/graph.gv3")), std::system_error);
+  }
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_contraction_hierarchy_io.cpp
+ * @brief Tests for write_contraction_hierarchy and read_contraction_hierarchy.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <graph/io/contraction_hierarchy.hpp>
+#include <graph/generators.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace graph;
+using namespace graph::io;
+
+namespace {
+
+using csr_t = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+auto make_hierarchy() {
+  csr_t g;
+  g.load_edges(generators::grid_2d<uint32_t>(20, 20, 4), std::identity{}, 400);
+  return build_contraction_hierarchy(g, [](const auto& gr, const auto& uv) { return edge_value(gr, uv); });
+}
+
+template <class G>
+void require_same_graph(const G& a, const G& b) {
+  REQUIRE(a.size() == b.size());
+  for (auto u : a.vertex_ids()) {
+    REQUIRE(std::ranges::equal(a.target_ids(u), b.target_ids(u)));
+    auto ae = a.edge_ids(u);
+    auto be = b.edge_ids(u);
+    for (auto [x, y] = std::pair(ae.begin(), be.begin()); x != ae.end(); ++x, ++y) {
+      REQUIRE(a.edge_value(*x).weight == b.edge_value(*y).weight);
+      REQUIRE(a.edge_value(*x).middle == b.edge_value(*y).middle);
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("contraction_hierarchy io: file round trip", "[io][contraction_hierarchy]") {
+  const auto ch   = make_hierarchy();
+  const auto path = std::filesystem::temp_directory_path() / "graph_v3_test_hierarchy.gv3ch";
+  write_contraction_hierarchy(path, ch);
+
+  {
+    const auto loaded = read_contraction_hierarchy<double>(path);
+    REQUIRE(loaded.num_vertices() == ch.num_vertices());
+    REQUIRE(loaded.num_shortcuts() == ch.num_shortcuts());
+    REQUIRE(std::ranges::equal(loaded.rank(), ch.rank()));
+    require_same_graph(loaded.upward(), ch.upward());
+    require_same_graph(loaded.downward(), ch.downward());
+
+    ch_query              a(ch), b(loaded);
+    std::vector<uint32_t> pa, pb;
+    for (uint32_t t : {0u, 19u, 210u, 399u}) {
+      REQUIRE(b.shortest_path(5, t, pb) == a.shortest_path(5, t, pa));
+      REQUIRE(pb == pa);
+    }
+  }
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("contraction_hierarchy io: rejects invalid input", "[io][contraction_hierarchy]") {
+  const auto ch   = make_hierarchy();
+  const auto path = std::filesystem::temp_directory_path() / "graph_v3_test_hierarchy_bad.gv3ch";
+
+  SECTION("other template arguments") {
+    write_contraction_hierarchy(path, ch);
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<float>(path), graph_error);
+    REQUIRE_THROWS_AS((read_contraction_hierarchy<double, uint64_t>(path)), graph_error);
+  }
+
+  SECTION("bad magic") {
+    std::ostringstream os(std::ios::binary);
+    write_contraction_hierarchy(os, ch);
+    std::string bytes = os.str();
+    bytes[0]          = 'X';
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<double>(path), graph_error);
+  }
+
+  SECTION("truncated file") {
+    std::ostringstream os(std::ios::binary);
+    write_contraction_hierarchy(os, ch);
+    const std::string bytes = os.str();
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 2));
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<double>(path), graph_error);
+  }
+  SECTION("vertex count that wraps the section offsets") {
+    std::ostringstream os(std::ios::binary);
+    write_contraction_hierarchy(os, ch);
+    std::string bytes = os.str();
+    // n * sizeof(uint32_t) wraps to the stored 400 * 4, so the offsets alone still match
+    const uint64_t n = (uint64_t{1} << 62) + 400;
+    std::memcpy(bytes.data() + offsetof(ch_file_header, num_vertices), &n, sizeof(n));
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<double>(path), graph_error);
+  }
+
+  SECTION("target id out of range") {
+    std::ostringstream os(std::ios::binary);
+    write_contraction_hierarchy(os, ch);
+    std::string    bytes = os.str();
+    ch_file_header h;
+    std::memcpy(&h, bytes.data(), sizeof(h));
+    snapshot_header up;
+    std::memcpy(&up, bytes.data() + h.upward_offset, sizeof(up));
+    const uint32_t bad = 400;
+    std::memcpy(bytes.data() + h.upward_offset + up.col_index_offset, &bad, sizeof(bad));
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<double>(path), graph_error);
+  }
+
+  SECTION("shortcut middle that unpacks into a cycle") {
+    // With u as its own middle, u -> v unpacks into u -> u and u -> v again
+    using edge_t     = ch_edge<double, uint32_t>;
+    const auto& up   = ch.upward();
+    uint32_t    tail = 0, arc = 0;
+    bool        found = false;
+    for (auto u : up.vertex_ids())
+      for (auto eid : up.edge_ids(u))
+        if (!found && up.edge_value(eid).middle != ch.no_middle) {
+          tail  = u;
+          arc   = eid;
+          found = true;
+        }
+    REQUIRE(found);
+
+    std::ostringstream os(std::ios::binary);
+    write_contraction_hierarchy(os, ch);
+    std::string    bytes = os.str();
+    ch_file_header h;
+    std::memcpy(&h, bytes.data(), sizeof(h));
+    snapshot_header uh;
+    std::memcpy(&uh, bytes.data() + h.upward_offset, sizeof(uh));
+    const size_t at = h.upward_offset + uh.edge_values_offset + arc * sizeof(edge_t) + offsetof(edge_t, middle);
+    std::memcpy(bytes.data() + at, &tail, sizeof(tail));
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    REQUIRE_THROWS_AS(read_contraction_hierarchy<double>(path), graph_error);
+  }
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,324 @@
+/**
+ * @file test_csr_loaders.cpp
+ * @brief Tests for load_dimacs, load_metis and load_edge_list, which parse text straight into a
+ *        compressed_graph.
+ *
+ * The reference for every case is the graph built by load_unsorted_edges from the edges of the
+ * text readers (read_dimacs, read_metis) or of a stream parse of the edge list.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <graph/io/dimacs.hpp>
+#include <graph/io/edge_list.hpp>
+#include <graph/io/metis.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+using namespace graph;
+using namespace graph::io;
+
+namespace {
+
+using weighted_csr = container::compressed_graph<double, void, void, uint32_t, uint32_t>;
+using void_csr     = container::compressed_graph<void, void, void, uint32_t, uint32_t>;
+using bidir_csr    = container::compressed_graph<double, void, void, uint32_t, uint32_t, true>;
+using edge_vec     = std::vector<copyable_edge_t<uint32_t, double>>;
+using rows_t       = std::vector<std::vector<std::pair<uint32_t, double>>>;
+
+// Rows as (target, value) lists, in storage order
+template <class G>
+rows_t rows_of(const G& g) {
+  rows_t rows(g.size());
+  for (auto u : g.vertex_ids())
+    for (auto e : g.edge_ids(u))
+      rows[u].emplace_back(g.target_id(e), g.edge_value(e));
+  return rows;
+}
+
+std::vector<std::vector<uint32_t>> rows_of(const void_csr& g) {
+  std::vector<std::vector<uint32_t>> rows(g.size());
+  for (auto u : g.vertex_ids())
+    for (auto e : g.edge_ids(u))
+      rows[u].push_back(g.target_id(e));
+  return rows;
+}
+
+double weight_of(const std::string& w) { return w.empty() ? 0.0 : std::stod(w); }
+
+rows_t reference(const edge_vec& edges, size_t vertex_count, const container::csr_build_options& options = {}) {
+  weighted_csr g;
+  g.load_unsorted_edges(edges, std::identity{}, vertex_count, options);
+  return rows_of(g);
+}
+
+rows_t dimacs_reference(std::string_view text, const container::csr_build_options& options = {}) {
+  const auto d = read_dimacs(text);
+  edge_vec   edges;
+  for (const auto& e : d.edges)
+    edges.push_back({static_cast<uint32_t>(e.source), static_cast<uint32_t>(e.target), weight_of(e.weight)});
+  return reference(edges, d.num_vertices, options);
+}
+
+rows_t metis_reference(std::string_view text) {
+  const auto m = read_metis(text);
+  edge_vec   edges;
+  for (size_t u = 0; u < m.adjacency.size(); ++u)
+    for (const auto& a : m.adjacency[u])
+      edges.push_back({static_cast<uint32_t>(u), static_cast<uint32_t>(a.neighbor), weight_of(a.weight)});
+  return reference(edges, m.num_vertices);
+}
+
+rows_t edge_list_reference(const std::string& text, size_t vertex_count = 0) {
+  std::istringstream is(text);
+  std::string        line;
+  edge_vec           edges;
+  while (std::getline(is, line)) {
+    if (!io::detail::is_edge_list_data_line(line))
+      continue;
+    std::istringstream ls(line);
+    uint32_t           u = 0, v = 0;
+    std::string        w;
+    ls >> u >> v >> w;
+    edges.push_back({u, v, weight_of(w)});
+  }
+  return reference(edges, vertex_count);
+}
+
+std::string large_dimacs() {
+  std::mt19937_64                              rng(42);
+  std::uniform_int_distribution<std::uint64_t> id(1, 20'000);
+  std::uniform_int_distribution<int>           kind(0, 19);
+  std::string                                  text = "c large\np sp 20000 200000\n";
+  for (size_t i = 0; i < 200'000; ++i) {
+    switch (kind(rng)) {
+      case 0: text += "c comment line\n"; break;
+      case 1: text += "n " + std::to_string(id(rng)) + " s\n"; break;
+      case 2: text += "e " + std::to_string(id(rng)) + " " + std::to_string(id(rng)) + "\r\n"; break;
+      default:
+        text += "a " + std::to_string(id(rng)) + "\t" + std::to_string(id(rng)) + " " + std::to_string(id(rng) % 100) +
+                "\n";
+    }
+  }
+  return text;
+}
+
+std::string large_metis(int fmt) {
+  std::mt19937_64                              rng(7);
+  const std::uint64_t                          n = 25'000;
+  std::uniform_int_distribution<std::uint64_t> id(1, n);
+  std::uniform_int_distribution<int>           degree(0, 12);
+  std::string text = "% large\n" + std::to_string(n) + " " + std::to_string(3 * n) + " " + std::to_string(fmt) + "\n";
+  for (std::uint64_t v = 0; v < n; ++v) {
+    if (v % 97 == 0)
+      text += "% comment between vertices\n\n";
+    if (fmt / 100 % 10)
+      text += "1 ";
+    if (fmt / 10 % 10)
+      text += std::to_string(id(rng)) + " ";
+    for (int k = degree(rng); k > 0; --k) {
+      text += std::to_string(id(rng)) + " ";
+      if (fmt % 10)
+        text += std::to_string(id(rng) % 10) + " ";
+    }
+    text += "\n";
+  }
+  return text;
+}
+
+std::string large_edge_list() {
+  std::mt19937_64                         rng(11);
+  std::uniform_int_distribution<uint32_t> id(0, 30'000);
+  std::string                             text = "# Directed graph\n# FromNodeId\tToNodeId\n";
+  for (size_t i = 0; i < 300'000; ++i) {
+    text += std::to_string(id(rng)) + "\t" + std::to_string(id(rng));
+    if (i % 3)
+      text += " " + std::to_string(id(rng) % 50) + ".5";
+    text += i % 7 ? "\n" : "\r\n";
+  }
+  return text;
+}
+
+} // namespace
+
+TEST_CASE("load_dimacs matches read_dimacs", "[io][csr_loaders][dimacs]") {
+  SECTION("small") {
+    const std::string text = "c sample\np sp 5 4\na 1 2 7\na 3 1 2.5\nn 2 s\ne 1 5\na 1 3 1\n";
+    weighted_csr      g;
+    load_dimacs(g, text);
+    REQUIRE(g.size() == 5);
+    REQUIRE(rows_of(g) == rows_t{{{1, 7.0}, {4, 0.0}, {2, 1.0}}, {}, {{0, 2.5}}, {}, {}});
+  }
+
+  SECTION("large, with one and several workers") {
+    const std::string text     = large_dimacs();
+    const auto        expected = dimacs_reference(text);
+    for (size_t workers : {size_t{1}, size_t{4}}) {
+      thread_pool  pool(workers);
+      weighted_csr g;
+      load_dimacs(g, text, {}, pool);
+      REQUIRE(rows_of(g) == expected);
+    }
+  }
+
+  SECTION("build options") {
+    const std::string                 text = large_dimacs();
+    const container::csr_build_options options{.sort_targets = true, .remove_duplicates = true};
+    weighted_csr                      g;
+    load_dimacs(g, text, options);
+    REQUIRE(rows_of(g) == dimacs_reference(text, options));
+  }
+
+  SECTION("no values") {
+    void_csr g;
+    load_dimacs(g, "p max 3 2\na 1 3 9\na 3 2 4\n");
+    REQUIRE(rows_of(g) == std::vector<std::vector<uint32_t>>{{2}, {}, {1}});
+  }
+
+  SECTION("no p line, or arcs past it") {
+    weighted_csr g;
+    load_dimacs(g, "a 2 6 1\n");
+    REQUIRE(g.size() == 6);
+    weighted_csr h;
+    load_dimacs(h, "p sp 2 1\na 1 4 1\n");
+    REQUIRE(h.size() == 4);
+  }
+
+  SECTION("bidirectional") {
+    bidir_csr g;
+    load_dimacs(g, "p sp 3 3\na 1 2 1\na 3 2 2\na 2 1 3\n");
+    REQUIRE(in_degree(g, *find_vertex(g, 1u)) == 2);
+    REQUIRE(in_degree(g, *find_vertex(g, 0u)) == 1);
+    REQUIRE(in_degree(g, *find_vertex(g, 2u)) == 0);
+  }
+
+  SECTION("errors leave the graph empty") {
+    for (const char* text : {"p sp 3 1\na 1 x 2\n", "p sp 3 1\na 0 1 2\n", "p sp 3 1\na 1 2 w\n", "a 1\n"}) {
+      weighted_csr g;
+      REQUIRE_THROWS_AS(load_dimacs(g, text), graph_error);
+      REQUIRE(g.empty());
+    }
+  }
+}
+
+TEST_CASE("load_metis matches read_metis", "[io][csr_loaders][metis]") {
+  SECTION("small, with vertex sizes and weights") {
+    const std::string text = "% sample\n3 2 111 1\n1 5 2 4 3 6\n\n1 5 1 4\n% comment\n1 5 1 6\n9 9 9\n";
+    weighted_csr      g;
+    load_metis(g, text);
+    REQUIRE(g.size() == 3);
+    REQUIRE(rows_of(g) == rows_t{{{1, 4.0}, {2, 6.0}}, {{0, 4.0}}, {{0, 6.0}}});
+  }
+
+  for (int fmt : {0, 1, 10, 11, 111}) {
+    DYNAMIC_SECTION("large, fmt " << fmt) {
+      const std::string text     = large_metis(fmt);
+      const auto        expected = metis_reference(text);
+      for (size_t workers : {size_t{1}, size_t{4}}) {
+        thread_pool  pool(workers);
+        weighted_csr g;
+        load_metis(g, text, {}, pool);
+        REQUIRE(rows_of(g) == expected);
+      }
+    }
+  }
+
+  SECTION("no values, fewer lines than vertices") {
+    void_csr g;
+    load_metis(g, "4 1\n2\n1\n");
+    REQUIRE(rows_of(g) == std::vector<std::vector<uint32_t>>{{1}, {0}, {}, {}});
+  }
+
+  SECTION("no header") {
+    void_csr g;
+    load_metis(g, "% only a comment\n");
+    REQUIRE(g.empty());
+  }
+
+  SECTION("errors leave the graph empty") {
+    for (const char* text : {"2 1\n2 x\n1\n", "2 1 1\n2\n1 1\n", "2 1\n0\n1\n", "2 1 1\n2 w\n1 1\n"}) {
+      weighted_csr g;
+      REQUIRE_THROWS_AS(load_metis(g, text), graph_error);
+      REQUIRE(g.empty());
+    }
+  }
+}
+
+TEST_CASE("load_edge_list matches a stream parse", "[io][csr_loaders][edge_list]") {
+  SECTION("small") {
+    weighted_csr g;
+    load_edge_list(g, "# comment\n% comment\n0 2 1.5\n\n2 1\n0 1 3 extra\n");
+    REQUIRE(g.size() == 3);
+    REQUIRE(rows_of(g) == rows_t{{{2, 1.5}, {1, 3.0}}, {}, {{1, 0.0}}});
+  }
+
+  SECTION("large, with one and several workers") {
+    const std::string text     = large_edge_list();
+    const auto        expected = edge_list_reference(text);
+    for (size_t workers : {size_t{1}, size_t{4}}) {
+      thread_pool  pool(workers);
+      weighted_csr g;
+      load_edge_list(g, text, 0, {}, pool);
+      REQUIRE(rows_of(g) == expected);
+    }
+  }
+
+  SECTION("vertex count") {
+    void_csr g;
+    load_edge_list(g, "0 1\n1 0\n", 5);
+    REQUIRE(rows_of(g) == std::vector<std::vector<uint32_t>>{{1}, {0}, {}, {}, {}});
+    void_csr h;
+    load_edge_list(h, "0 3\n", 2);
+    REQUIRE(h.size() == 4);
+  }
+
+  SECTION("errors leave the graph empty") {
+    for (const char* text : {"0 x\n", "1\n", "0 1 w\n", "0 4294967296\n", "-1 2\n"}) {
+      weighted_csr g;
+      REQUIRE_THROWS_AS(load_edge_list(g, text), graph_error);
+      REQUIRE(g.empty());
+    }
+  }
+}
+
+TEST_CASE("file loaders map the file", "[io][csr_loaders]") {
+  const auto dir        = std::filesystem::temp_directory_path();
+  auto       write_file = [](const std::filesystem::path& path, const std::string& text) {
+    std::ofstream os(path, std::ios::binary);
+    os << text;
+  };
+
+  const std::string dimacs_text = large_dimacs();
+  const auto        dimacs_path = dir / "graph_v3_test_load.dimacs";
+  write_file(dimacs_path, dimacs_text);
+  weighted_csr dg;
+  load_dimacs_file(dg, dimacs_path);
+  REQUIRE(rows_of(dg) == dimacs_reference(dimacs_text));
+
+  const std::string metis_text = large_metis(1);
+  const auto        metis_path = dir / "graph_v3_test_load.metis";
+  write_file(metis_path, metis_text);
+  weighted_csr mg;
+  load_metis_file(mg, metis_path);
+  REQUIRE(rows_of(mg) == metis_reference(metis_text));
+
+  const std::string el_text = large_edge_list();
+  const auto        el_path = dir / "graph_v3_test_load.el";
+  write_file(el_path, el_text);
+  weighted_csr eg;
+  load_edge_list_file(eg, el_path);
+  REQUIRE(rows_of(eg) == edge_list_reference(el_text));
+
+  for (const auto& path : {dimacs_path, metis_path, el_path})
+    std::filesystem::remove(path);
+  weighted_csr g;
+  REQUIRE_THROWS_AS(load_edge_list_file(g, dir / "graph_v3_no_such_file.el"), std::system_error);
+}
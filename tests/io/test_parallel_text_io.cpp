@@ -0,0 +1,314 @@
+/**
+ * @file test_parallel_text_io.cpp
+ * @brief Tests for the parallel DIMACS, METIS and adjacency-list text readers, against the stream readers.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <graph/io/adjacency_list_text.hpp>
+#include <graph/io/dimacs.hpp>
+#include <graph/io/metis.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace graph;
+using namespace graph::io;
+
+namespace {
+
+// Large enough to be split into many chunks
+constexpr size_t large_lines = 100'000;
+
+void require_same(const dimacs_graph& a, const dimacs_graph& b) {
+  REQUIRE(a.problem == b.problem);
+  REQUIRE(a.num_vertices == b.num_vertices);
+  REQUIRE(a.num_arcs == b.num_arcs);
+  REQUIRE(a.nodes.size() == b.nodes.size());
+  for (size_t i = 0; i < a.nodes.size(); ++i) {
+    REQUIRE(a.nodes[i].id == b.nodes[i].id);
+    REQUIRE(a.nodes[i].designation == b.nodes[i].designation);
+  }
+  REQUIRE(a.edges.size() == b.edges.size());
+  for (size_t i = 0; i < a.edges.size(); ++i) {
+    REQUIRE(a.edges[i].source == b.edges[i].source);
+    REQUIRE(a.edges[i].target == b.edges[i].target);
+    REQUIRE(a.edges[i].weight == b.edges[i].weight);
+  }
+}
+
+void require_same(const metis_graph& a, const metis_graph& b) {
+  REQUIRE(a.num_vertices == b.num_vertices);
+  REQUIRE(a.num_edges == b.num_edges);
+  REQUIRE(a.fmt == b.fmt);
+  REQUIRE(a.ncon == b.ncon);
+  REQUIRE(a.vertex_weights == b.vertex_weights);
+  REQUIRE(a.adjacency.size() == b.adjacency.size());
+  for (size_t i = 0; i < a.adjacency.size(); ++i) {
+    REQUIRE(a.adjacency[i].size() == b.adjacency[i].size());
+    for (size_t k = 0; k < a.adjacency[i].size(); ++k) {
+      REQUIRE(a.adjacency[i][k].neighbor == b.adjacency[i][k].neighbor);
+      REQUIRE(a.adjacency[i][k].weight == b.adjacency[i][k].weight);
+    }
+  }
+}
+
+void require_same(const adjacency_list_text_graph& a, const adjacency_list_text_graph& b) {
+  REQUIRE(a.vertex_ids == b.vertex_ids);
+  REQUIRE(a.edges.size() == b.edges.size());
+  for (size_t i = 0; i < a.edges.size(); ++i) {
+    REQUIRE(a.edges[i].source == b.edges[i].source);
+    REQUIRE(a.edges[i].target == b.edges[i].target);
+  }
+}
+
+template <class Read>
+auto from_stream(const std::string& text, Read read) {
+  std::istringstream is(text);
+  return read(is);
+}
+
+std::string large_dimacs() {
+  std::mt19937_64                              rng(42);
+  std::uniform_int_distribution<std::uint64_t> id(1, 50'000);
+  std::uniform_int_distribution<int>           kind(0, 19);
+  std::string                                  text = "c large\np sp 50000 " + std::to_string(large_lines) + "\n";
+  for (size_t i = 0; i < large_lines; ++i) {
+    switch (kind(rng)) {
+      case 0: text += "c comment line\n"; break;
+      case 1: text += "\n"; break;
+      case 2: text += "n " + std::to_string(id(rng)) + " s\n"; break;
+      case 3: text += "e " + std::to_string(id(rng)) + " " + std::to_string(id(rng)) + "\r\n"; break;
+      default:
+        text += "a " + std::to_string(id(rng)) + "\t" + std::to_string(id(rng)) + " " + std::to_string(id(rng) % 100) +
+                "\n";
+    }
+  }
+  return text;
+}
+
+std::string large_metis(int fmt) {
+  std::mt19937_64                              rng(7);
+  const std::uint64_t                          n = large_lines / 4;
+  std::uniform_int_distribution<std::uint64_t> id(1, n);
+  std::uniform_int_distribution<int>           degree(0, 12);
+  std::string text = "% large\n" + std::to_string(n) + " " + std::to_string(3 * n) + " " + std::to_string(fmt) + "\n";
+  for (std::uint64_t v = 0; v < n; ++v) {
+    if (v % 97 == 0)
+      text += "% comment between vertices\n\n";
+    if (fmt / 100 % 10)
+      text += "1 ";
+    if (fmt / 10 % 10)
+      text += std::to_string(id(rng)) + " ";
+    for (int k = degree(rng); k > 0; --k) {
+      text += std::to_string(id(rng)) + " ";
+      if (fmt % 10)
+        text += std::to_string(id(rng) % 10) + " ";
+    }
+    text += "\n";
+  }
+  return text;
+}
+
+std::string large_adjacency_list_text() {
+  std::mt19937_64                    rng(3);
+  std::uniform_int_distribution<int> id(0, 1'000); // the stream reader looks vertices up linearly
+  std::uniform_int_distribution<int> degree(0, 6);
+  std::string                        text;
+  for (size_t v = 0; v < large_lines / 2; ++v) {
+    text += "v" + std::to_string(id(rng)) + (v % 3 ? ":" : "");
+    for (int k = degree(rng); k > 0; --k)
+      text += " v" + std::to_string(id(rng));
+    text += v % 5 ? "\n" : "\r\n";
+  }
+  return text;
+}
+
+} // namespace
+
+TEST_CASE("text_cursor extracts fields as a string stream does", "[io][parallel_text]") {
+  const std::vector<std::string> inputs = {"", "   ", "12", " \t 12 34", "+7", "-1", "-", "+", "abc", "12abc",
+                                           "007", "18446744073709551615", "18446744073709551616",
+                                           "99999999999999999999 5", "2147483648", "-2147483648", "-2147483649",
+                                           "1 -2 +3 x 4", "\v1\f2\r"};
+  for (const auto& s : inputs) {
+    {
+      std::istringstream          is(s);
+      io::detail::text_cursor         ls(s);
+      std::uint64_t               a = 99, b = 99;
+      bool                        ok_a = true, ok_b = true;
+      while (ok_a || ok_b) {
+        ok_a = static_cast<bool>(is >> a);
+        ok_b = ls.get(b);
+        REQUIRE(ok_a == ok_b);
+        REQUIRE(a == b);
+      }
+    }
+    {
+      std::istringstream  is(s);
+      io::detail::text_cursor ls(s);
+      int                 a = 99, b = 99;
+      REQUIRE(static_cast<bool>(is >> a) == ls.get(b));
+      REQUIRE(a == b);
+      REQUIRE(static_cast<bool>(is >> a) == ls.get(b));
+      REQUIRE(a == b);
+    }
+    {
+      std::istringstream  is(s);
+      io::detail::text_cursor ls(s);
+      char                c1 = 0, c2 = 0;
+      std::string         t1, t2;
+      REQUIRE(static_cast<bool>(is >> c1 >> t1) == (ls.get(c2) && ls.get(t2)));
+      REQUIRE(c1 == c2);
+      REQUIRE(t1 == t2);
+    }
+  }
+}
+
+TEST_CASE("line_chunks splits text after newlines", "[io][parallel_text]") {
+  REQUIRE(io::detail::line_chunks("", 8) == std::vector<size_t>{0, 0});
+  REQUIRE(io::detail::line_chunks("a\nb", 8) == std::vector<size_t>{0, 3});
+
+  const std::string text    = large_dimacs();
+  const auto        offsets = io::detail::line_chunks(text, 16);
+  REQUIRE(offsets.size() == 17);
+  REQUIRE(offsets.front() == 0);
+  REQUIRE(offsets.back() == text.size());
+  for (size_t k = 1; k + 1 < offsets.size(); ++k) {
+    REQUIRE(offsets[k - 1] <= offsets[k]);
+    REQUIRE(text[offsets[k] - 1] == '\n');
+  }
+
+  // One line longer than the chunks: empty chunks, nothing split
+  const std::string long_line(4 * io::detail::min_text_chunk, 'x');
+  const auto        single = io::detail::line_chunks(long_line + "\n" + long_line, 8);
+  for (size_t k = 1; k + 1 < single.size(); ++k)
+    REQUIRE((single[k] == long_line.size() + 1 || single[k] == 2 * long_line.size() + 1));
+}
+
+TEST_CASE("read_dimacs from text matches the stream reader", "[io][parallel_text][dimacs]") {
+  thread_pool pool(4);
+  auto        stream_read = [](std::istream& is) { return read_dimacs(is); };
+
+  SECTION("irregular lines") {
+    const std::string text = "c comment\n"
+                             "\n"
+                             "p max 4 5\n"
+                             "   n 1 s\n"
+                             "n 4\n"
+                             "n x t\n"
+                             "a 1 2 10\r\n"
+                             "a1 2\n"
+                             "a 3\n"
+                             "a 0 0 0\n"
+                             "e 12abc 4\n"
+                             "a -1 18446744073709551616 w\n"
+                             "q 1 2 3\n"
+                             "p sp\n"
+                             "a 2 3 1.5 extra";
+    require_same(read_dimacs(std::string_view(text), pool), from_stream(text, stream_read));
+  }
+
+  SECTION("large input, any pool size") {
+    const std::string text     = large_dimacs();
+    const auto        expected = from_stream(text, stream_read);
+    require_same(read_dimacs(std::string_view(text), pool), expected);
+    thread_pool serial(1);
+    require_same(read_dimacs(std::string_view(text), serial), expected);
+  }
+
+  SECTION("empty text") {
+    const auto result = read_dimacs(std::string_view{}, pool);
+    REQUIRE(result.problem.empty());
+    REQUIRE(result.edges.empty());
+  }
+}
+
+TEST_CASE("read_metis from text matches the stream reader", "[io][parallel_text][metis]") {
+  thread_pool pool(4);
+  auto        stream_read = [](std::istream& is) { return read_metis(is); };
+
+  SECTION("irregular lines") {
+    for (const std::string text : {"% only a comment\n\n",
+                                   "3 3\n2 3\n% comment\n\n1 3\n1 2\n",
+                                   "  \t\r\n% c\n4 2 011\n5 2 1 3 2\n\n% c\n7\n\n1 4 x 9\n2 8 1\n",
+                                   "2 1 101 2\n1 1 5 2\n7 8\n",
+                                   "3 3 1\n2 1.5 3 4\n1\n1 2 2\nextra 1 2\n",
+                                   "5 0\n\n1\n"}) {
+      require_same(read_metis(std::string_view(text), pool), from_stream(text, stream_read));
+    }
+  }
+
+  SECTION("large input, every format, any pool size") {
+    thread_pool serial(1);
+    for (int fmt : {0, 1, 10, 11, 100, 111}) {
+      const std::string text     = large_metis(fmt);
+      const auto        expected = from_stream(text, stream_read);
+      require_same(read_metis(std::string_view(text), pool), expected);
+      require_same(read_metis(std::string_view(text), serial), expected);
+    }
+  }
+}
+
+TEST_CASE("read_adjacency_list_text from text matches the stream reader", "[io][parallel_text][adjtext]") {
+  thread_pool pool(4);
+  auto        stream_read = [](std::istream& is) { return read_adjacency_list_text(is); };
+
+  SECTION("irregular lines") {
+    const std::string text = "0: 1 2\n"
+                             "\n"
+                             "1:2\n"
+                             "  2 0 3\r\n"
+                             "3:\n"
+                             "a:b:c d\n"
+                             ":x y\n"
+                             "4";
+    require_same(read_adjacency_list_text(std::string_view(text), pool), from_stream(text, stream_read));
+  }
+
+  SECTION("large input, any pool size") {
+    const std::string text     = large_adjacency_list_text();
+    const auto        expected = from_stream(text, stream_read);
+    require_same(read_adjacency_list_text(std::string_view(text), pool), expected);
+    thread_pool serial(1);
+    require_same(read_adjacency_list_text(std::string_view(text), serial), expected);
+  }
+}
+
+TEST_CASE("file readers map the file", "[io][parallel_text]") {
+  const auto dir = std::filesystem::temp_directory_path();
+  auto       write_file = [](const std::filesystem::path& path, const std::string& text) {
+    std::ofstream os(path, std::ios::binary);
+    os << text;
+  };
+
+  const std::string dimacs_text = large_dimacs();
+  const auto        dimacs_path = dir / "graph_v3_test_parallel.dimacs";
+  write_file(dimacs_path, dimacs_text);
+  require_same(read_dimacs_file(dimacs_path), from_stream(dimacs_text, [](std::istream& is) { return read_dimacs(is); }));
+
+  const std::string metis_text = large_metis(11);
+  const auto        metis_path = dir / "graph_v3_test_parallel.metis";
+  write_file(metis_path, metis_text);
+  require_same(read_metis_file(metis_path), from_stream(metis_text, [](std::istream& is) { return read_metis(is); }));
+
+  const std::string adj_text = large_adjacency_list_text();
+  const auto        adj_path = dir / "graph_v3_test_parallel.adj";
+  write_file(adj_path, adj_text);
+  require_same(read_adjacency_list_text_file(adj_path),
+               from_stream(adj_text, [](std::istream& is) { return read_adjacency_list_text(is); }));
+
+  const auto empty_path = dir / "graph_v3_test_parallel_empty.dimacs";
+  write_file(empty_path, "");
+  REQUIRE(read_dimacs_file(empty_path).edges.empty());
+
+  for (const auto& path : {dimacs_path, metis_path, adj_path, empty_path})
+    std::filesystem::remove(path);
+  REQUIRE_THROWS_AS(read_dimacs_file(dir / "graph_v3_no_such_file.dimacs"), std::system_error);
+}